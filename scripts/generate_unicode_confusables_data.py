@@ -47,9 +47,9 @@ def generate_decompositions():
 
     return {c: gen(c) for c in interesting}
 
-def main():
-    decompositions = generate_decompositions()
+PAGE_BITS = 8
 
+def print_data(decompositions):
     # Deduplicate
     decomposition_set = sorted(set(tuple(x) for x in decompositions.values()))
     len_set = sorted(set(len(x) for x in decomposition_set))
@@ -63,6 +63,13 @@ def main():
         decomposition_offsets.append(cur_offset)
         cur_offset += len(d)
 
+    # 0 marks codepoints without decomposition, other values are the index
+    # into `decomp_slices` plus one.
+    chars = sorted(decompositions)
+    page_index, pages = unicode.two_level_table({c: i + 1 for i, c in enumerate(chars)}, PAGE_BITS)
+    if len(pages) > 256:
+        raise ValueError("Can't store page index in 8 bit")
+
     print("""\
 #include <stdint.h>
 
@@ -74,8 +81,12 @@ struct DECOMP_SLICE
 """)
     print("enum")
     print("{")
-    print("\tNUM_DECOMP_LENGTHS={},".format(len(len_set)))
-    print("\tNUM_DECOMPS={},".format(len(decompositions)))
+    print("\tNUM_DECOMP_LENGTHS = {},".format(len(len_set)))
+    print("\tNUM_DECOMPS = {},".format(len(decompositions)))
+    print("\tDECOMP_PAGE_BITS = {},".format(PAGE_BITS))
+    print("\tDECOMP_PAGE_SIZE = 1 << DECOMP_PAGE_BITS,")
+    print("\tNUM_DECOMP_PAGES = {},".format(len(pages)))
+    print("\tNUM_DECOMP_PAGE_INDEX = {},".format(len(page_index)))
     print("};")
     print()
 
@@ -85,14 +96,21 @@ struct DECOMP_SLICE
     print("};")
     print()
 
-    print("static const int32_t decomp_chars[NUM_DECOMPS] = {")
-    for k in sorted(decompositions):
-        print("\t0x{:x},".format(k))
+    print("static const uint8_t decomp_page_index[NUM_DECOMP_PAGE_INDEX] = {")
+    unicode.print_c_rows(page_index)
+    print("};")
+    print()
+
+    print("static const uint16_t decomp_pages[NUM_DECOMP_PAGES][DECOMP_PAGE_SIZE] = {")
+    for page in pages:
+        print("\t{")
+        unicode.print_c_rows(page)
+        print("\t},")
     print("};")
     print()
 
     print("static const struct DECOMP_SLICE decomp_slices[NUM_DECOMPS] = {")
-    for k in sorted(decompositions):
+    for k in chars:
         d = decompositions[k]
         i = decomposition_set.index(tuple(d))
         l = len_set.index(len(d))
@@ -106,5 +124,8 @@ struct DECOMP_SLICE
             print("\t0x{:x},".format(c))
     print("};")
 
+def main():
+    print_data(generate_decompositions())
+
 if __name__ == '__main__':
     main()
@@ -12,27 +12,41 @@ def generate_cases():
     ud = unicode.data()
     return [(unicode.unhex(u["Value"]), unicode.unhex(u["Simple_Lowercase_Mapping"])) for u in ud if u["Simple_Lowercase_Mapping"]]
 
-def main():
-    cases = generate_cases()
+PAGE_BITS = 8
+
+def print_data(cases):
+    # Pages store the difference to the lowercase codepoint so that
+    # codepoints without mapping share the all-zero page.
+    page_index, pages = unicode.two_level_table({upper: lower - upper for upper, lower in cases}, PAGE_BITS)
+    if len(pages) > 256:
+        raise ValueError("Can't store page index in 8 bit")
 
     print("""\
 #include <stdint.h>
 
-struct UPPER_LOWER
-{{
-\tint32_t upper;
-\tint32_t lower;
-}};
-
 enum
 {{
-\tNUM_TOLOWER={},
+\tTOLOWER_PAGE_BITS = {},
+\tTOLOWER_PAGE_SIZE = 1 << TOLOWER_PAGE_BITS,
+\tNUM_TOLOWER_PAGES = {},
+\tNUM_TOLOWER_PAGE_INDEX = {},
 }};
+""".format(PAGE_BITS, len(pages), len(page_index)))
 
-static const struct UPPER_LOWER tolower[NUM_TOLOWER] = {{""".format(len(cases)))
-    for upper_code, lower_code in cases:
-        print("\t{{{}, {}}},".format(upper_code, lower_code))
+    print("static const uint8_t tolower_page_index[NUM_TOLOWER_PAGE_INDEX] = {")
+    unicode.print_c_rows(page_index)
     print("};")
+    print()
+
+    print("static const int32_t tolower_pages[NUM_TOLOWER_PAGES][TOLOWER_PAGE_SIZE] = {")
+    for page in pages:
+        print("\t{")
+        unicode.print_c_rows(page)
+        print("\t},")
+    print("};")
+
+def main():
+    print_data(generate_cases())
 
 if __name__ == '__main__':
     main()
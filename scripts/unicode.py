@@ -33,3 +33,24 @@ def unhex(s):
 
 def unhex_sequence(s):
     return [unhex(x) for x in s.split()] if '<' not in s else None
+
+def two_level_table(values, page_bits, default=0):
+    """Splits a {codepoint: value} mapping into deduplicated pages of
+    `2**page_bits` values and an index with the page of each block of
+    codepoints, so that a lookup is `pages[index[c >> page_bits]][c & mask]`.
+    The index ends after the page of the highest codepoint in `values`."""
+    page_size = 1 << page_bits
+    pages = []
+    page_ids = {}
+    index = []
+    for start in range(0, max(values) + 1, page_size):
+        page = tuple(values.get(c, default) for c in range(start, start + page_size))
+        if page not in page_ids:
+            page_ids[page] = len(pages)
+            pages.append(page)
+        index.append(page_ids[page])
+    return index, pages
+
+def print_c_rows(values, per_line=16):
+    for i in range(0, len(values), per_line):
+        print("\t" + " ".join("{},".format(v) for v in values[i:i + per_line]))
@@ -1681,6 +1681,17 @@ int net_udp_close(NETSOCKET sock)
 	return priv_net_close_all_sockets(sock);
 }
 
+int net_udp_local_addr(NETSOCKET sock, NETADDR *addr)
+{
+	struct sockaddr_storage sockaddrbuf;
+	socklen_t sockaddr_len = sizeof(sockaddrbuf);
+	int fd = sock.ipv4sock >= 0 ? sock.ipv4sock : sock.ipv6sock;
+	if(fd < 0 || getsockname(fd, (struct sockaddr *)&sockaddrbuf, &sockaddr_len) != 0)
+		return -1;
+	sockaddr_to_netaddr((struct sockaddr *)&sockaddrbuf, addr);
+	return 0;
+}
+
 NETSOCKET net_tcp_create(NETADDR bindaddr)
 {
 	NETSOCKET sock = invalid_socket;
@@ -2821,6 +2832,79 @@ int str_hex_decode(void *dst, int dst_size, const char *src)
 	return 0;
 }
 
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void str_base64(char *dst, int dst_size, const void *data_raw, int data_size)
+{
+	const unsigned char *data = data_raw;
+	int i;
+	int len = 0;
+	for(i = 0; i < data_size && len + 4 < dst_size; i += 3)
+	{
+		unsigned value = data[i] << 16;
+		if(i + 1 < data_size)
+			value |= data[i + 1] << 8;
+		if(i + 2 < data_size)
+			value |= data[i + 2];
+		dst[len++] = BASE64_CHARS[(value >> 18) & 0x3f];
+		dst[len++] = BASE64_CHARS[(value >> 12) & 0x3f];
+		dst[len++] = i + 1 < data_size ? BASE64_CHARS[(value >> 6) & 0x3f] : '=';
+		dst[len++] = i + 2 < data_size ? BASE64_CHARS[value & 0x3f] : '=';
+	}
+	if(dst_size > 0)
+		dst[len] = 0;
+}
+
+static int base64_value(char c)
+{
+	if(c >= 'A' && c <= 'Z')
+		return c - 'A';
+	if(c >= 'a' && c <= 'z')
+		return c - 'a' + 26;
+	if(c >= '0' && c <= '9')
+		return c - '0' + 52;
+	if(c == '+')
+		return 62;
+	if(c == '/')
+		return 63;
+	return -1;
+}
+
+int str_base64_decode(void *dst_raw, int dst_size, const char *data)
+{
+	unsigned char *dst = dst_raw;
+	int len = 0;
+	int i;
+	while(*data)
+	{
+		unsigned value = 0;
+		int num = 0;
+		for(i = 0; i < 4; i++)
+		{
+			int v;
+			if(data[i] == '=')
+				break;
+			v = base64_value(data[i]);
+			if(v < 0)
+				return -1;
+			value |= v << (18 - 6 * i);
+			num++;
+		}
+		// padding is only allowed at the end
+		if(num < 2 || (num < 4 && (data[num] != '=' || (num == 2 && data[3] != '=') || data[4] != 0)))
+			return -1;
+		if(len + num - 1 > dst_size)
+			return -1;
+		dst[len++] = value >> 16;
+		if(num > 2)
+			dst[len++] = value >> 8;
+		if(num > 3)
+			dst[len++] = value;
+		data += 4;
+	}
+	return len;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wformat-nonliteral"
@@ -842,6 +842,20 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, void *buffer, int maxsize, MMSGS
 */
 int net_udp_close(NETSOCKET sock);
 
+/*
+	Function: net_udp_local_addr
+		Gets the address an UDP socket is bound to, e.g. the port picked
+		by the system when it was created with port 0.
+
+	Parameters:
+		sock - Socket to query.
+		addr - Address to fill in.
+
+	Returns:
+		Returns 0 on success. -1 on error.
+*/
+int net_udp_local_addr(NETSOCKET sock, NETADDR *addr);
+
 /* Group: Network TCP */
 
 /*
@@ -1479,6 +1493,41 @@ void str_hex(char *dst, int dst_size, const void *data, int data_size);
 		- The contents of the buffer is only valid on success
 */
 int str_hex_decode(void *dst, int dst_size, const char *src);
+
+/*
+	Function: str_base64
+		Takes a datablock and generates the base64 encoding of it.
+
+	Parameters:
+		dst - Buffer to fill with base64 data
+		dst_size - Size of the buffer
+		data - Data to turn into base64
+		data_size - Size of the data
+
+	Remarks:
+		- The destination buffer will be zero-terminated
+		- The output is truncated to whole groups of four characters
+		  if the buffer is too small
+*/
+void str_base64(char *dst, int dst_size, const void *data, int data_size);
+
+/*
+	Function: str_base64_decode
+		Takes a base64 string and returns a byte array.
+
+	Parameters:
+		dst - Buffer for the byte array
+		dst_size - Size of the buffer
+		data - String to decode
+
+	Returns:
+		Number of bytes written to dst, or -1 if the string is not valid
+		base64 or doesn't fit the buffer.
+
+	Remarks:
+		- The contents of the buffer is only valid on success
+*/
+int str_base64_decode(void *dst, int dst_size, const char *data);
 /*
 	Function: str_timestamp
 		Copies a time stamp in the format year-month-day_hour-minute-second to the string.
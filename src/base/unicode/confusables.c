@@ -6,22 +6,17 @@
 
 static int str_utf8_skeleton(int ch, const int **skeleton, int *skeleton_len)
 {
-	int i;
-	for(i = 0; i < NUM_DECOMPS; i++)
+	int index = 0;
+	if(ch >= 0 && (ch >> DECOMP_PAGE_BITS) < NUM_DECOMP_PAGE_INDEX)
 	{
-		if(ch == decomp_chars[i])
-		{
-			int offset = decomp_slices[i].offset;
-			int length = decomp_lengths[decomp_slices[i].length];
-
-			*skeleton = &decomp_data[offset];
-			*skeleton_len = length;
-			return 1;
-		}
-		else if(ch < decomp_chars[i])
-		{
-			break;
-		}
+		index = decomp_pages[decomp_page_index[ch >> DECOMP_PAGE_BITS]][ch & (DECOMP_PAGE_SIZE - 1)];
+	}
+	if(index != 0)
+	{
+		const struct DECOMP_SLICE *slice = &decomp_slices[index - 1];
+		*skeleton = &decomp_data[slice->offset];
+		*skeleton_len = decomp_lengths[slice->length];
+		return 1;
 	}
 	*skeleton = NULL;
 	*skeleton_len = 1;
@@ -10,6 +10,10 @@ enum
 {
 	NUM_DECOMP_LENGTHS = 8,
 	NUM_DECOMPS = 9563,
+	DECOMP_PAGE_BITS = 8,
+	DECOMP_PAGE_SIZE = 1 << DECOMP_PAGE_BITS,
+	NUM_DECOMP_PAGES = 165,
+	NUM_DECOMP_PAGE_INDEX = 4352,
 };
 
 static const uint8_t decomp_lengths[NUM_DECOMP_LENGTHS] = {
@@ -23,9570 +27,3252 @@ static const uint8_t decomp_lengths[NUM_DECOMP_LENGTHS] = {
 	15,
 };
 
-static const int32_t decomp_chars[NUM_DECOMPS] = {
-	0x0,
-	0x1,
-	0x2,
-	0x3,
-	0x4,
-	0x5,
-	0x6,
-	0x7,
-	0x8,
-	0x9,
-	0xa,
-	0xb,
-	0xc,
-	0xd,
-	0xe,
-	0xf,
-	0x10,
-	0x11,
-	0x12,
-	0x13,
-	0x14,
-	0x15,
-	0x16,
-	0x17,
-	0x18,
-	0x19,
-	0x1a,
-	0x1b,
-	0x1c,
-	0x1d,
-	0x1e,
-	0x1f,
-	0x20,
-	0x22,
-	0x25,
-	0x30,
-	0x31,
-	0x49,
-	0x60,
-	0x6c,
-	0x6d,
-	0x7c,
-	0x7f,
-	0x80,
-	0x81,
-	0x82,
-	0x83,
-	0x84,
-	0x85,
-	0x86,
-	0x87,
-	0x88,
-	0x89,
-	0x8a,
-	0x8b,
-	0x8c,
-	0x8d,
-	0x8e,
-	0x8f,
-	0x90,
-	0x91,
-	0x92,
-	0x93,
-	0x94,
-	0x95,
-	0x96,
-	0x97,
-	0x98,
-	0x99,
-	0x9a,
-	0x9b,
-	0x9c,
-	0x9d,
-	0x9e,
-	0x9f,
-	0xa0,
-	0xa2,
-	0xa5,
-	0xad,
-	0xaf,
-	0xb4,
-	0xb5,
-	0xb8,
-	0xc0,
-	0xc1,
-	0xc2,
-	0xc3,
-	0xc4,
-	0xc5,
-	0xc6,
-	0xc7,
-	0xc8,
-	0xc9,
-	0xca,
-	0xcb,
-	0xcc,
-	0xcd,
-	0xce,
-	0xcf,
-	0xd0,
-	0xd1,
-	0xd2,
-	0xd3,
-	0xd4,
-	0xd5,
-	0xd6,
-	0xd7,
-	0xd8,
-	0xd9,
-	0xda,
-	0xdb,
-	0xdc,
-	0xdd,
-	0xe0,
-	0xe1,
-	0xe2,
-	0xe3,
-	0xe4,
-	0xe5,
-	0xe6,
-	0xe7,
-	0xe8,
-	0xe9,
-	0xea,
-	0xeb,
-	0xec,
-	0xed,
-	0xee,
-	0xef,
-	0xf0,
-	0xf1,
-	0xf2,
-	0xf3,
-	0xf4,
-	0xf5,
-	0xf6,
-	0xf8,
-	0xf9,
-	0xfa,
-	0xfb,
-	0xfc,
-	0xfd,
-	0xff,
-	0x100,
-	0x101,
-	0x102,
-	0x103,
-	0x104,
-	0x105,
-	0x106,
-	0x107,
-	0x108,
-	0x109,
-	0x10a,
-	0x10b,
-	0x10c,
-	0x10d,
-	0x10e,
-	0x10f,
-	0x110,
-	0x111,
-	0x112,
-	0x113,
-	0x114,
-	0x115,
-	0x116,
-	0x117,
-	0x118,
-	0x119,
-	0x11a,
-	0x11b,
-	0x11c,
-	0x11d,
-	0x11e,
-	0x11f,
-	0x120,
-	0x121,
-	0x122,
-	0x123,
-	0x124,
-	0x125,
-	0x126,
-	0x127,
-	0x128,
-	0x129,
-	0x12a,
-	0x12b,
-	0x12c,
-	0x12d,
-	0x12e,
-	0x12f,
-	0x130,
-	0x131,
-	0x132,
-	0x133,
-	0x134,
-	0x135,
-	0x136,
-	0x137,
-	0x139,
-	0x13a,
-	0x13b,
-	0x13c,
-	0x13d,
-	0x13e,
-	0x13f,
-	0x140,
-	0x141,
-	0x142,
-	0x143,
-	0x144,
-	0x145,
-	0x146,
-	0x147,
-	0x148,
-	0x149,
-	0x14c,
-	0x14d,
-	0x14e,
-	0x14f,
-	0x150,
-	0x151,
-	0x152,
-	0x153,
-	0x154,
-	0x155,
-	0x156,
-	0x157,
-	0x158,
-	0x159,
-	0x15a,
-	0x15b,
-	0x15c,
-	0x15d,
-	0x15e,
-	0x15f,
-	0x160,
-	0x161,
-	0x162,
-	0x163,
-	0x164,
-	0x165,
-	0x166,
-	0x167,
-	0x168,
-	0x169,
-	0x16a,
-	0x16b,
-	0x16c,
-	0x16d,
-	0x16e,
-	0x16f,
-	0x170,
-	0x171,
-	0x172,
-	0x173,
-	0x174,
-	0x175,
-	0x176,
-	0x177,
-	0x178,
-	0x179,
-	0x17a,
-	0x17b,
-	0x17c,
-	0x17d,
-	0x17e,
-	0x17f,
-	0x180,
-	0x181,
-	0x182,
-	0x183,
-	0x184,
-	0x187,
-	0x189,
-	0x18a,
-	0x18c,
-	0x18d,
-	0x191,
-	0x192,
-	0x193,
-	0x196,
-	0x197,
-	0x198,
-	0x199,
-	0x19a,
-	0x19d,
-	0x19e,
-	0x19f,
-	0x1a0,
-	0x1a1,
-	0x1a4,
-	0x1a5,
-	0x1a6,
-	0x1a7,
-	0x1ac,
-	0x1ad,
-	0x1ae,
-	0x1af,
-	0x1b0,
-	0x1b3,
-	0x1b4,
-	0x1b5,
-	0x1b6,
-	0x1b7,
-	0x1bb,
-	0x1bc,
-	0x1bd,
-	0x1bf,
-	0x1c0,
-	0x1c1,
-	0x1c3,
-	0x1c4,
-	0x1c5,
-	0x1c6,
-	0x1c7,
-	0x1c8,
-	0x1c9,
-	0x1ca,
-	0x1cb,
-	0x1cc,
-	0x1cd,
-	0x1ce,
-	0x1cf,
-	0x1d0,
-	0x1d1,
-	0x1d2,
-	0x1d3,
-	0x1d4,
-	0x1d5,
-	0x1d6,
-	0x1d7,
-	0x1d8,
-	0x1d9,
-	0x1da,
-	0x1db,
-	0x1dc,
-	0x1de,
-	0x1df,
-	0x1e0,
-	0x1e1,
-	0x1e2,
-	0x1e3,
-	0x1e4,
-	0x1e5,
-	0x1e6,
-	0x1e7,
-	0x1e8,
-	0x1e9,
-	0x1ea,
-	0x1eb,
-	0x1ec,
-	0x1ed,
-	0x1ee,
-	0x1ef,
-	0x1f0,
-	0x1f1,
-	0x1f2,
-	0x1f3,
-	0x1f4,
-	0x1f5,
-	0x1f8,
-	0x1f9,
-	0x1fa,
-	0x1fb,
-	0x1fc,
-	0x1fd,
-	0x1fe,
-	0x1ff,
-	0x200,
-	0x201,
-	0x202,
-	0x203,
-	0x204,
-	0x205,
-	0x206,
-	0x207,
-	0x208,
-	0x209,
-	0x20a,
-	0x20b,
-	0x20c,
-	0x20d,
-	0x20e,
-	0x20f,
-	0x210,
-	0x211,
-	0x212,
-	0x213,
-	0x214,
-	0x215,
-	0x216,
-	0x217,
-	0x218,
-	0x219,
-	0x21a,
-	0x21b,
-	0x21c,
-	0x21e,
-	0x21f,
-	0x222,
-	0x223,
-	0x224,
-	0x225,
-	0x226,
-	0x227,
-	0x228,
-	0x229,
-	0x22a,
-	0x22b,
-	0x22c,
-	0x22d,
-	0x22e,
-	0x22f,
-	0x230,
-	0x231,
-	0x232,
-	0x233,
-	0x23c,
-	0x23e,
-	0x241,
-	0x244,
-	0x246,
-	0x247,
-	0x248,
-	0x249,
-	0x24d,
-	0x24e,
-	0x24f,
-	0x251,
-	0x253,
-	0x256,
-	0x257,
-	0x259,
-	0x25a,
-	0x25b,
-	0x260,
-	0x261,
-	0x263,
-	0x266,
-	0x268,
-	0x269,
-	0x26a,
-	0x26b,
-	0x26d,
-	0x26e,
-	0x26f,
-	0x271,
-	0x273,
-	0x275,
-	0x276,
-	0x27c,
-	0x27d,
-	0x282,
-	0x28b,
-	0x28f,
-	0x290,
-	0x292,
-	0x294,
-	0x2a0,
-	0x2a3,
-	0x2a4,
-	0x2a5,
-	0x2a6,
-	0x2a7,
-	0x2a8,
-	0x2a9,
-	0x2aa,
-	0x2ab,
-	0x2b3,
-	0x2b9,
-	0x2ba,
-	0x2bb,
-	0x2bc,
-	0x2bd,
-	0x2be,
-	0x2bf,
-	0x2c2,
-	0x2c3,
-	0x2c4,
-	0x2c6,
-	0x2c8,
-	0x2ca,
-	0x2cb,
-	0x2d0,
-	0x2d3,
-	0x2d7,
-	0x2d8,
-	0x2d9,
-	0x2da,
-	0x2db,
-	0x2dc,
-	0x2dd,
-	0x2e1,
-	0x2e2,
-	0x2e4,
-	0x2ee,
-	0x2f4,
-	0x2f6,
-	0x2f8,
-	0x2fb,
-	0x300,
-	0x301,
-	0x302,
-	0x303,
-	0x304,
-	0x305,
-	0x306,
-	0x307,
-	0x308,
-	0x309,
-	0x30a,
-	0x30b,
-	0x30c,
-	0x30d,
-	0x30e,
-	0x30f,
-	0x310,
-	0x311,
-	0x312,
-	0x313,
-	0x314,
-	0x315,
-	0x316,
-	0x317,
-	0x318,
-	0x319,
-	0x31a,
-	0x31b,
-	0x31c,
-	0x31d,
-	0x31e,
-	0x31f,
-	0x320,
-	0x321,
-	0x322,
-	0x323,
-	0x324,
-	0x325,
-	0x326,
-	0x327,
-	0x328,
-	0x329,
-	0x32a,
-	0x32b,
-	0x32c,
-	0x32d,
-	0x32e,
-	0x32f,
-	0x330,
-	0x331,
-	0x332,
-	0x333,
-	0x334,
-	0x335,
-	0x336,
-	0x337,
-	0x338,
-	0x339,
-	0x33a,
-	0x33b,
-	0x33c,
-	0x33d,
-	0x33e,
-	0x33f,
-	0x340,
-	0x341,
-	0x342,
-	0x343,
-	0x344,
-	0x345,
-	0x346,
-	0x347,
-	0x348,
-	0x349,
-	0x34a,
-	0x34b,
-	0x34c,
-	0x34d,
-	0x34e,
-	0x34f,
-	0x350,
-	0x351,
-	0x352,
-	0x353,
-	0x354,
-	0x355,
-	0x356,
-	0x357,
-	0x358,
-	0x359,
-	0x35a,
-	0x35b,
-	0x35c,
-	0x35d,
-	0x35e,
-	0x35f,
-	0x360,
-	0x361,
-	0x362,
-	0x363,
-	0x364,
-	0x365,
-	0x366,
-	0x367,
-	0x368,
-	0x369,
-	0x36a,
-	0x36b,
-	0x36c,
-	0x36d,
-	0x36e,
-	0x36f,
-	0x370,
-	0x374,
-	0x375,
-	0x376,
-	0x377,
-	0x37a,
-	0x37b,
-	0x37d,
-	0x37e,
-	0x37f,
-	0x384,
-	0x385,
-	0x386,
-	0x387,
-	0x388,
-	0x389,
-	0x38a,
-	0x38c,
-	0x38e,
-	0x38f,
-	0x390,
-	0x391,
-	0x392,
-	0x395,
-	0x396,
-	0x397,
-	0x398,
-	0x399,
-	0x39a,
-	0x39b,
-	0x39c,
-	0x39d,
-	0x39f,
-	0x3a1,
-	0x3a3,
-	0x3a4,
-	0x3a5,
-	0x3a7,
-	0x3aa,
-	0x3ab,
-	0x3ac,
-	0x3ad,
-	0x3ae,
-	0x3af,
-	0x3b0,
-	0x3b1,
-	0x3b2,
-	0x3b3,
-	0x3b4,
-	0x3b5,
-	0x3b7,
-	0x3b8,
-	0x3b9,
-	0x3ba,
-	0x3bd,
-	0x3bf,
-	0x3c1,
-	0x3c3,
-	0x3c4,
-	0x3c5,
-	0x3c6,
-	0x3ca,
-	0x3cb,
-	0x3cc,
-	0x3cd,
-	0x3ce,
-	0x3d0,
-	0x3d1,
-	0x3d2,
-	0x3d3,
-	0x3d4,
-	0x3d5,
-	0x3d6,
-	0x3db,
-	0x3dc,
-	0x3e8,
-	0x3e9,
-	0x3f0,
-	0x3f1,
-	0x3f2,
-	0x3f3,
-	0x3f4,
-	0x3f5,
-	0x3f7,
-	0x3f8,
-	0x3f9,
-	0x3fa,
-	0x3fd,
-	0x3ff,
-	0x400,
-	0x401,
-	0x403,
-	0x404,
-	0x405,
-	0x406,
-	0x407,
-	0x408,
-	0x40c,
-	0x40d,
-	0x40e,
-	0x410,
-	0x411,
-	0x412,
-	0x413,
-	0x415,
-	0x417,
-	0x419,
-	0x41a,
-	0x41b,
-	0x41c,
-	0x41d,
-	0x41e,
-	0x41f,
-	0x420,
-	0x421,
-	0x422,
-	0x423,
-	0x424,
-	0x425,
-	0x42b,
-	0x42c,
-	0x42e,
-	0x430,
-	0x431,
-	0x432,
-	0x433,
-	0x435,
-	0x437,
-	0x438,
-	0x439,
-	0x43a,
-	0x43c,
-	0x43d,
-	0x43e,
-	0x43f,
-	0x440,
-	0x441,
-	0x442,
-	0x443,
-	0x444,
-	0x445,
-	0x44a,
-	0x44b,
-	0x44c,
-	0x44f,
-	0x450,
-	0x451,
-	0x453,
-	0x454,
-	0x455,
-	0x456,
-	0x457,
-	0x458,
-	0x45b,
-	0x45c,
-	0x45d,
-	0x45e,
-	0x461,
-	0x462,
-	0x463,
-	0x470,
-	0x471,
-	0x472,
-	0x473,
-	0x474,
-	0x475,
-	0x476,
-	0x477,
-	0x47c,
-	0x47d,
-	0x483,
-	0x484,
-	0x485,
-	0x486,
-	0x487,
-	0x488,
-	0x489,
-	0x48a,
-	0x48b,
-	0x48c,
-	0x48d,
-	0x490,
-	0x491,
-	0x492,
-	0x493,
-	0x496,
-	0x497,
-	0x498,
-	0x499,
-	0x49a,
-	0x49b,
-	0x49e,
-	0x49f,
-	0x4a2,
-	0x4a3,
-	0x4aa,
-	0x4ab,
-	0x4ac,
-	0x4ad,
-	0x4ae,
-	0x4af,
-	0x4b0,
-	0x4b1,
-	0x4b2,
-	0x4bb,
-	0x4bd,
-	0x4be,
-	0x4bf,
-	0x4c0,
-	0x4c1,
-	0x4c2,
-	0x4c5,
-	0x4c6,
-	0x4c7,
-	0x4c8,
-	0x4c9,
-	0x4ca,
-	0x4cb,
-	0x4cc,
-	0x4cd,
-	0x4ce,
-	0x4cf,
-	0x4d0,
-	0x4d1,
-	0x4d2,
-	0x4d3,
-	0x4d4,
-	0x4d5,
-	0x4d6,
-	0x4d7,
-	0x4d8,
-	0x4d9,
-	0x4da,
-	0x4db,
-	0x4dc,
-	0x4dd,
-	0x4de,
-	0x4df,
-	0x4e0,
-	0x4e1,
-	0x4e2,
-	0x4e3,
-	0x4e4,
-	0x4e5,
-	0x4e6,
-	0x4e7,
-	0x4e8,
-	0x4e9,
-	0x4ea,
-	0x4eb,
-	0x4ec,
-	0x4ed,
-	0x4ee,
-	0x4ef,
-	0x4f0,
-	0x4f1,
-	0x4f2,
-	0x4f3,
-	0x4f4,
-	0x4f5,
-	0x4f8,
-	0x4f9,
-	0x501,
-	0x50a,
-	0x50c,
-	0x50d,
-	0x510,
-	0x511,
-	0x51b,
-	0x51c,
-	0x51d,
-	0x53b,
-	0x544,
-	0x54a,
-	0x54c,
-	0x54d,
-	0x54f,
-	0x553,
-	0x555,
-	0x55a,
-	0x55d,
-	0x561,
-	0x563,
-	0x566,
-	0x56e,
-	0x570,
-	0x575,
-	0x578,
-	0x57a,
-	0x57c,
-	0x57d,
-	0x581,
-	0x584,
-	0x585,
-	0x587,
-	0x589,
-	0x591,
-	0x592,
-	0x593,
-	0x594,
-	0x595,
-	0x596,
-	0x597,
-	0x598,
-	0x599,
-	0x59a,
-	0x59b,
-	0x59c,
-	0x59d,
-	0x59e,
-	0x59f,
-	0x5a0,
-	0x5a1,
-	0x5a2,
-	0x5a3,
-	0x5a4,
-	0x5a5,
-	0x5a6,
-	0x5a7,
-	0x5a8,
-	0x5a9,
-	0x5aa,
-	0x5ab,
-	0x5ac,
-	0x5ad,
-	0x5ae,
-	0x5af,
-	0x5b0,
-	0x5b1,
-	0x5b2,
-	0x5b3,
-	0x5b4,
-	0x5b5,
-	0x5b6,
-	0x5b7,
-	0x5b8,
-	0x5b9,
-	0x5ba,
-	0x5bb,
-	0x5bc,
-	0x5bd,
-	0x5bf,
-	0x5c0,
-	0x5c1,
-	0x5c2,
-	0x5c3,
-	0x5c4,
-	0x5c5,
-	0x5c7,
-	0x5d5,
-	0x5d8,
-	0x5d9,
-	0x5df,
-	0x5e1,
-	0x5f0,
-	0x5f1,
-	0x5f2,
-	0x5f3,
-	0x5f4,
-	0x600,
-	0x601,
-	0x602,
-	0x603,
-	0x604,
-	0x605,
-	0x609,
-	0x60a,
-	0x60d,
-	0x60f,
-	0x610,
-	0x611,
-	0x612,
-	0x613,
-	0x614,
-	0x615,
-	0x616,
-	0x617,
-	0x618,
-	0x619,
-	0x61a,
-	0x61c,
-	0x622,
-	0x623,
-	0x624,
-	0x625,
-	0x626,
-	0x627,
-	0x62b,
-	0x634,
-	0x63d,
-	0x63f,
-	0x647,
-	0x64a,
-	0x64b,
-	0x64c,
-	0x64d,
-	0x64e,
-	0x64f,
-	0x650,
-	0x651,
-	0x652,
-	0x653,
-	0x654,
-	0x655,
-	0x656,
-	0x657,
-	0x658,
-	0x659,
-	0x65a,
-	0x65b,
-	0x65c,
-	0x65d,
-	0x65e,
-	0x65f,
-	0x660,
-	0x661,
-	0x665,
-	0x667,
-	0x668,
-	0x66a,
-	0x66b,
-	0x66c,
-	0x66d,
-	0x66e,
-	0x66f,
-	0x670,
-	0x672,
-	0x673,
-	0x675,
-	0x676,
-	0x677,
-	0x678,
-	0x679,
-	0x67e,
-	0x681,
-	0x685,
-	0x688,
-	0x68b,
-	0x68e,
-	0x691,
-	0x692,
-	0x698,
-	0x69e,
-	0x69f,
-	0x6a4,
-	0x6a7,
-	0x6a8,
-	0x6a9,
-	0x6aa,
-	0x6ad,
-	0x6b4,
-	0x6b5,
-	0x6b7,
-	0x6ba,
-	0x6bb,
-	0x6bd,
-	0x6be,
-	0x6c0,
-	0x6c1,
-	0x6c2,
-	0x6c3,
-	0x6c6,
-	0x6c7,
-	0x6c8,
-	0x6c9,
-	0x6cb,
-	0x6cc,
-	0x6ce,
-	0x6d0,
-	0x6d1,
-	0x6d2,
-	0x6d3,
-	0x6d4,
-	0x6d5,
-	0x6d6,
-	0x6d7,
-	0x6d8,
-	0x6d9,
-	0x6da,
-	0x6db,
-	0x6dc,
-	0x6dd,
-	0x6df,
-	0x6e0,
-	0x6e1,
-	0x6e2,
-	0x6e3,
-	0x6e4,
-	0x6e7,
-	0x6e8,
-	0x6ea,
-	0x6eb,
-	0x6ec,
-	0x6ed,
-	0x6ee,
-	0x6ef,
-	0x6f0,
-	0x6f1,
-	0x6f2,
-	0x6f3,
-	0x6f4,
-	0x6f5,
-	0x6f6,
-	0x6f7,
-	0x6f8,
-	0x6f9,
-	0x6fd,
-	0x6fe,
-	0x6ff,
-	0x701,
-	0x702,
-	0x703,
-	0x704,
-	0x70f,
-	0x711,
-	0x730,
-	0x731,
-	0x732,
-	0x733,
-	0x734,
-	0x735,
-	0x736,
-	0x737,
-	0x738,
-	0x739,
-	0x73a,
-	0x73b,
-	0x73c,
-	0x73d,
-	0x73e,
-	0x73f,
-	0x740,
-	0x741,
-	0x742,
-	0x743,
-	0x744,
-	0x745,
-	0x746,
-	0x747,
-	0x748,
-	0x749,
-	0x74a,
-	0x751,
-	0x756,
-	0x762,
-	0x763,
-	0x767,
-	0x768,
-	0x769,
-	0x76c,
-	0x771,
-	0x772,
-	0x77e,
-	0x7a6,
-	0x7a7,
-	0x7a8,
-	0x7a9,
-	0x7aa,
-	0x7ab,
-	0x7ac,
-	0x7ad,
-	0x7ae,
-	0x7af,
-	0x7b0,
-	0x7c0,
-	0x7ca,
-	0x7eb,
-	0x7ec,
-	0x7ed,
-	0x7ee,
-	0x7ef,
-	0x7f0,
-	0x7f1,
-	0x7f2,
-	0x7f3,
-	0x7f4,
-	0x7f5,
-	0x7fa,
-	0x7fd,
-	0x816,
-	0x817,
-	0x818,
-	0x819,
-	0x81b,
-	0x81c,
-	0x81d,
-	0x81e,
-	0x81f,
-	0x820,
-	0x821,
-	0x822,
-	0x823,
-	0x825,
-	0x826,
-	0x827,
-	0x829,
-	0x82a,
-	0x82b,
-	0x82c,
-	0x82d,
-	0x859,
-	0x85a,
-	0x85b,
-	0x8a1,
-	0x8a4,
-	0x8a7,
-	0x8a8,
-	0x8a9,
-	0x8ae,
-	0x8af,
-	0x8b0,
-	0x8b1,
-	0x8b2,
-	0x8b6,
-	0x8b7,
-	0x8b9,
-	0x8ba,
-	0x8bb,
-	0x8bc,
-	0x8bd,
-	0x8d3,
-	0x8d4,
-	0x8d5,
-	0x8d6,
-	0x8d7,
-	0x8d8,
-	0x8d9,
-	0x8da,
-	0x8db,
-	0x8dc,
-	0x8dd,
-	0x8de,
-	0x8df,
-	0x8e0,
-	0x8e1,
-	0x8e2,
-	0x8e3,
-	0x8e4,
-	0x8e5,
-	0x8e6,
-	0x8e7,
-	0x8e8,
-	0x8e9,
-	0x8ea,
-	0x8eb,
-	0x8ec,
-	0x8ed,
-	0x8ee,
-	0x8ef,
-	0x8f0,
-	0x8f1,
-	0x8f2,
-	0x8f3,
-	0x8f4,
-	0x8f5,
-	0x8f6,
-	0x8f7,
-	0x8f8,
-	0x8f9,
-	0x8fa,
-	0x8fb,
-	0x8fc,
-	0x8fd,
-	0x8fe,
-	0x8ff,
-	0x900,
-	0x901,
-	0x902,
-	0x903,
-	0x904,
-	0x906,
-	0x908,
-	0x90d,
-	0x90e,
-	0x910,
-	0x911,
-	0x912,
-	0x913,
-	0x914,
-	0x929,
-	0x931,
-	0x934,
-	0x93a,
-	0x93b,
-	0x93c,
-	0x93e,
-	0x93f,
-	0x940,
-	0x941,
-	0x942,
-	0x943,
-	0x944,
-	0x945,
-	0x946,
-	0x947,
-	0x948,
-	0x949,
-	0x94a,
-	0x94b,
-	0x94c,
-	0x94d,
-	0x94e,
-	0x94f,
-	0x951,
-	0x952,
-	0x953,
-	0x954,
-	0x955,
-	0x956,
-	0x957,
-	0x958,
-	0x959,
-	0x95a,
-	0x95b,
-	0x95c,
-	0x95d,
-	0x95e,
-	0x95f,
-	0x962,
-	0x963,
-	0x965,
-	0x966,
-	0x967,
-	0x97d,
-	0x981,
-	0x982,
-	0x983,
-	0x986,
-	0x9bc,
-	0x9be,
-	0x9bf,
-	0x9c0,
-	0x9c1,
-	0x9c2,
-	0x9c3,
-	0x9c4,
-	0x9c7,
-	0x9c8,
-	0x9cb,
-	0x9cc,
-	0x9cd,
-	0x9d7,
-	0x9dc,
-	0x9dd,
-	0x9df,
-	0x9e0,
-	0x9e1,
-	0x9e2,
-	0x9e3,
-	0x9e6,
-	0x9ea,
-	0x9ed,
-	0x9fe,
-	0xa01,
-	0xa02,
-	0xa03,
-	0xa06,
-	0xa07,
-	0xa08,
-	0xa09,
-	0xa0a,
-	0xa0f,
-	0xa10,
-	0xa14,
-	0xa33,
-	0xa36,
-	0xa3c,
-	0xa3e,
-	0xa3f,
-	0xa40,
-	0xa41,
-	0xa42,
-	0xa47,
-	0xa48,
-	0xa4b,
-	0xa4c,
-	0xa4d,
-	0xa51,
-	0xa59,
-	0xa5a,
-	0xa5b,
-	0xa5e,
-	0xa66,
-	0xa67,
-	0xa6a,
-	0xa70,
-	0xa71,
-	0xa75,
-	0xa81,
-	0xa82,
-	0xa83,
-	0xa86,
-	0xa8d,
-	0xa8f,
-	0xa90,
-	0xa91,
-	0xa93,
-	0xa94,
-	0xabc,
-	0xabd,
-	0xabe,
-	0xabf,
-	0xac0,
-	0xac1,
-	0xac2,
-	0xac3,
-	0xac4,
-	0xac5,
-	0xac7,
-	0xac8,
-	0xac9,
-	0xacb,
-	0xacc,
-	0xacd,
-	0xae2,
-	0xae3,
-	0xae6,
-	0xae8,
-	0xae9,
-	0xaea,
-	0xaee,
-	0xaf0,
-	0xafa,
-	0xafb,
-	0xafc,
-	0xafd,
-	0xafe,
-	0xaff,
-	0xb01,
-	0xb02,
-	0xb03,
-	0xb06,
-	0xb20,
-	0xb3c,
-	0xb3e,
-	0xb3f,
-	0xb40,
-	0xb41,
-	0xb42,
-	0xb43,
-	0xb44,
-	0xb47,
-	0xb48,
-	0xb4b,
-	0xb4c,
-	0xb4d,
-	0xb56,
-	0xb57,
-	0xb5c,
-	0xb5d,
-	0xb62,
-	0xb63,
-	0xb66,
-	0xb68,
-	0xb82,
-	0xb8a,
-	0xb94,
-	0xb9c,
-	0xbb0,
-	0xbbe,
-	0xbbf,
-	0xbc0,
-	0xbc1,
-	0xbc2,
-	0xbc6,
-	0xbc7,
-	0xbc8,
-	0xbca,
-	0xbcb,
-	0xbcc,
-	0xbcd,
-	0xbd7,
-	0xbe6,
-	0xbe7,
-	0xbe8,
-	0xbea,
-	0xbeb,
-	0xbec,
-	0xbed,
-	0xbee,
-	0xbf0,
-	0xbf2,
-	0xbf4,
-	0xbf5,
-	0xbf7,
-	0xbf8,
-	0xbfa,
-	0xc00,
-	0xc01,
-	0xc02,
-	0xc03,
-	0xc04,
-	0xc13,
-	0xc14,
-	0xc20,
-	0xc22,
-	0xc25,
-	0xc2d,
-	0xc2e,
-	0xc37,
-	0xc39,
-	0xc3e,
-	0xc3f,
-	0xc40,
-	0xc41,
-	0xc42,
-	0xc43,
-	0xc44,
-	0xc46,
-	0xc47,
-	0xc48,
-	0xc4a,
-	0xc4b,
-	0xc4c,
-	0xc4d,
-	0xc55,
-	0xc56,
-	0xc60,
-	0xc61,
-	0xc62,
-	0xc63,
-	0xc66,
-	0xc81,
-	0xc82,
-	0xc83,
-	0xc85,
-	0xc86,
-	0xc87,
-	0xc92,
-	0xc93,
-	0xc94,
-	0xc9c,
-	0xc9e,
-	0xca3,
-	0xcaf,
-	0xcb1,
-	0xcb2,
-	0xcbc,
-	0xcbe,
-	0xcbf,
-	0xcc0,
-	0xcc1,
-	0xcc2,
-	0xcc3,
-	0xcc4,
-	0xcc6,
-	0xcc7,
-	0xcc8,
-	0xcca,
-	0xccb,
-	0xccc,
-	0xccd,
-	0xcd5,
-	0xcd6,
-	0xce1,
-	0xce2,
-	0xce3,
-	0xce6,
-	0xce7,
-	0xce8,
-	0xcef,
-	0xd00,
-	0xd01,
-	0xd02,
-	0xd03,
-	0xd08,
-	0xd09,
-	0xd0a,
-	0xd0c,
-	0xd10,
-	0xd13,
-	0xd14,
-	0xd19,
-	0xd1c,
-	0xd20,
-	0xd23,
-	0xd31,
-	0xd34,
-	0xd36,
-	0xd3a,
-	0xd3b,
-	0xd3c,
-	0xd3e,
-	0xd3f,
-	0xd40,
-	0xd41,
-	0xd42,
-	0xd43,
-	0xd44,
-	0xd46,
-	0xd47,
-	0xd48,
-	0xd4a,
-	0xd4b,
-	0xd4c,
-	0xd4d,
-	0xd4e,
-	0xd57,
-	0xd5a,
-	0xd5f,
-	0xd61,
-	0xd62,
-	0xd63,
-	0xd66,
-	0xd6a,
-	0xd6b,
-	0xd6c,
-	0xd6d,
-	0xd6e,
-	0xd6f,
-	0xd76,
-	0xd79,
-	0xd7b,
-	0xd7c,
-	0xd82,
-	0xd83,
-	0xdca,
-	0xdcf,
-	0xdd0,
-	0xdd1,
-	0xdd2,
-	0xdd3,
-	0xdd4,
-	0xdd6,
-	0xdd8,
-	0xdd9,
-	0xdda,
-	0xddb,
-	0xddc,
-	0xddd,
-	0xdde,
-	0xddf,
-	0xde9,
-	0xdea,
-	0xdeb,
-	0xdef,
-	0xdf2,
-	0xdf3,
-	0xe03,
-	0xe0b,
-	0xe0f,
-	0xe14,
-	0xe15,
-	0xe17,
-	0xe21,
-	0xe26,
-	0xe31,
-	0xe33,
-	0xe34,
-	0xe35,
-	0xe36,
-	0xe37,
-	0xe38,
-	0xe39,
-	0xe3a,
-	0xe41,
-	0xe45,
-	0xe47,
-	0xe48,
-	0xe49,
-	0xe4a,
-	0xe4b,
-	0xe4c,
-	0xe4d,
-	0xe4e,
-	0xe50,
-	0xe88,
-	0xe8d,
-	0xe9a,
-	0xe9b,
-	0xe9d,
-	0xe9e,
-	0xe9f,
-	0xeb1,
-	0xeb3,
-	0xeb4,
-	0xeb5,
-	0xeb6,
-	0xeb7,
-	0xeb8,
-	0xeb9,
-	0xeba,
-	0xebb,
-	0xebc,
-	0xec8,
-	0xec9,
-	0xeca,
-	0xecb,
-	0xecc,
-	0xecd,
-	0xed0,
-	0xedc,
-	0xedd,
-	0xf00,
-	0xf02,
-	0xf03,
-	0xf0c,
-	0xf0e,
-	0xf18,
-	0xf19,
-	0xf1b,
-	0xf1e,
-	0xf1f,
-	0xf35,
-	0xf37,
-	0xf39,
-	0xf3e,
-	0xf3f,
-	0xf43,
-	0xf4d,
-	0xf52,
-	0xf57,
-	0xf5c,
-	0xf69,
-	0xf6a,
-	0xf71,
-	0xf72,
-	0xf73,
-	0xf74,
-	0xf75,
-	0xf76,
-	0xf77,
-	0xf78,
-	0xf79,
-	0xf7a,
-	0xf7b,
-	0xf7c,
-	0xf7d,
-	0xf7e,
-	0xf7f,
-	0xf80,
-	0xf81,
-	0xf82,
-	0xf83,
-	0xf84,
-	0xf86,
-	0xf87,
-	0xf8d,
-	0xf8e,
-	0xf8f,
-	0xf90,
-	0xf91,
-	0xf92,
-	0xf93,
-	0xf94,
-	0xf95,
-	0xf96,
-	0xf97,
-	0xf99,
-	0xf9a,
-	0xf9b,
-	0xf9c,
-	0xf9d,
-	0xf9e,
-	0xf9f,
-	0xfa0,
-	0xfa1,
-	0xfa2,
-	0xfa3,
-	0xfa4,
-	0xfa5,
-	0xfa6,
-	0xfa7,
-	0xfa8,
-	0xfa9,
-	0xfaa,
-	0xfab,
-	0xfac,
-	0xfad,
-	0xfae,
-	0xfaf,
-	0xfb0,
-	0xfb1,
-	0xfb2,
-	0xfb3,
-	0xfb4,
-	0xfb5,
-	0xfb6,
-	0xfb7,
-	0xfb8,
-	0xfb9,
-	0xfba,
-	0xfbb,
-	0xfbc,
-	0xfc6,
-	0xfce,
-	0xfd5,
-	0xfd6,
-	0x1000,
-	0x1010,
-	0x101d,
-	0x101f,
-	0x1026,
-	0x1029,
-	0x102a,
-	0x102b,
-	0x102c,
-	0x102d,
-	0x102e,
-	0x102f,
-	0x1030,
-	0x1031,
-	0x1032,
-	0x1033,
-	0x1034,
-	0x1035,
-	0x1036,
-	0x1037,
-	0x1038,
-	0x1039,
-	0x103a,
-	0x103b,
-	0x103c,
-	0x103d,
-	0x103e,
-	0x1040,
-	0x104b,
-	0x1056,
-	0x1057,
-	0x1058,
-	0x1059,
-	0x105e,
-	0x105f,
-	0x1060,
-	0x1062,
-	0x1063,
-	0x1064,
-	0x1065,
-	0x1066,
-	0x1067,
-	0x1068,
-	0x1069,
-	0x106a,
-	0x106b,
-	0x106c,
-	0x106d,
-	0x106f,
-	0x1070,
-	0x1071,
-	0x1072,
-	0x1073,
-	0x1074,
-	0x107e,
-	0x1081,
-	0x1082,
-	0x1083,
-	0x1084,
-	0x1085,
-	0x1086,
-	0x1087,
-	0x1088,
-	0x1089,
-	0x108a,
-	0x108b,
-	0x108c,
-	0x108d,
-	0x108f,
-	0x109a,
-	0x109b,
-	0x109c,
-	0x109d,
-	0x109e,
-	0x10a0,
-	0x10e7,
-	0x10f3,
-	0x10ff,
-	0x1101,
-	0x1104,
-	0x1108,
-	0x110a,
-	0x110d,
-	0x1113,
-	0x1114,
-	0x1115,
-	0x1116,
-	0x1117,
-	0x1118,
-	0x1119,
-	0x111a,
-	0x111b,
-	0x111c,
-	0x111d,
-	0x111e,
-	0x111f,
-	0x1120,
-	0x1121,
-	0x1122,
-	0x1123,
-	0x1124,
-	0x1125,
-	0x1126,
-	0x1127,
-	0x1128,
-	0x1129,
-	0x112a,
-	0x112b,
-	0x112c,
-	0x112d,
-	0x112e,
-	0x112f,
-	0x1130,
-	0x1131,
-	0x1132,
-	0x1133,
-	0x1134,
-	0x1135,
-	0x1136,
-	0x1137,
-	0x1138,
-	0x1139,
-	0x113a,
-	0x113b,
-	0x113d,
-	0x113f,
-	0x1141,
-	0x1142,
-	0x1143,
-	0x1144,
-	0x1145,
-	0x1146,
-	0x1147,
-	0x1148,
-	0x1149,
-	0x114a,
-	0x114b,
-	0x114d,
-	0x114f,
-	0x1151,
-	0x1152,
-	0x1153,
-	0x1156,
-	0x1157,
-	0x1158,
-	0x115a,
-	0x115b,
-	0x115c,
-	0x115d,
-	0x115e,
-	0x1162,
-	0x1164,
-	0x1166,
-	0x1168,
-	0x116a,
-	0x116b,
-	0x116c,
-	0x116f,
-	0x1170,
-	0x1171,
-	0x1173,
-	0x1174,
-	0x1175,
-	0x1176,
-	0x1177,
-	0x1178,
-	0x1179,
-	0x117a,
-	0x117b,
-	0x117c,
-	0x117d,
-	0x117e,
-	0x117f,
-	0x1180,
-	0x1181,
-	0x1182,
-	0x1183,
-	0x1184,
-	0x1185,
-	0x1186,
-	0x1187,
-	0x1188,
-	0x1189,
-	0x118a,
-	0x118b,
-	0x118c,
-	0x118d,
-	0x118e,
-	0x118f,
-	0x1190,
-	0x1191,
-	0x1192,
-	0x1193,
-	0x1194,
-	0x1195,
-	0x1196,
-	0x1197,
-	0x1198,
-	0x1199,
-	0x119a,
-	0x119b,
-	0x119c,
-	0x119d,
-	0x119f,
-	0x11a0,
-	0x11a1,
-	0x11a2,
-	0x11a3,
-	0x11a4,
-	0x11a5,
-	0x11a6,
-	0x11a7,
-	0x11a8,
-	0x11a9,
-	0x11aa,
-	0x11ab,
-	0x11ac,
-	0x11ad,
-	0x11ae,
-	0x11af,
-	0x11b0,
-	0x11b1,
-	0x11b2,
-	0x11b3,
-	0x11b4,
-	0x11b5,
-	0x11b6,
-	0x11b7,
-	0x11b8,
-	0x11b9,
-	0x11ba,
-	0x11bb,
-	0x11bc,
-	0x11bd,
-	0x11be,
-	0x11bf,
-	0x11c0,
-	0x11c1,
-	0x11c2,
-	0x11c3,
-	0x11c4,
-	0x11c5,
-	0x11c6,
-	0x11c7,
-	0x11c8,
-	0x11c9,
-	0x11ca,
-	0x11cb,
-	0x11cc,
-	0x11cd,
-	0x11ce,
-	0x11cf,
-	0x11d0,
-	0x11d1,
-	0x11d2,
-	0x11d3,
-	0x11d4,
-	0x11d5,
-	0x11d6,
-	0x11d7,
-	0x11d8,
-	0x11d9,
-	0x11da,
-	0x11db,
-	0x11dc,
-	0x11dd,
-	0x11de,
-	0x11df,
-	0x11e0,
-	0x11e1,
-	0x11e2,
-	0x11e3,
-	0x11e4,
-	0x11e5,
-	0x11e6,
-	0x11e7,
-	0x11e8,
-	0x11e9,
-	0x11ea,
-	0x11eb,
-	0x11ec,
-	0x11ed,
-	0x11ee,
-	0x11ef,
-	0x11f0,
-	0x11f1,
-	0x11f2,
-	0x11f3,
-	0x11f4,
-	0x11f5,
-	0x11f6,
-	0x11f7,
-	0x11f8,
-	0x11f9,
-	0x11fa,
-	0x11fb,
-	0x11fc,
-	0x11fd,
-	0x11fe,
-	0x11ff,
-	0x1200,
-	0x1223,
-	0x1240,
-	0x1260,
-	0x1294,
-	0x12d0,
-	0x135d,
-	0x135e,
-	0x135f,
-	0x13a0,
-	0x13a1,
-	0x13a2,
-	0x13a4,
-	0x13a5,
-	0x13a8,
-	0x13a9,
-	0x13aa,
-	0x13ab,
-	0x13ac,
-	0x13ae,
-	0x13b0,
-	0x13b1,
-	0x13b3,
-	0x13b7,
-	0x13bb,
-	0x13bd,
-	0x13be,
-	0x13bf,
-	0x13c0,
-	0x13c2,
-	0x13c3,
-	0x13c7,
-	0x13cb,
-	0x13cc,
-	0x13ce,
-	0x13cf,
-	0x13d2,
-	0x13d4,
-	0x13d5,
-	0x13d9,
-	0x13da,
-	0x13de,
-	0x13df,
-	0x13e2,
-	0x13e6,
-	0x13e7,
-	0x13eb,
-	0x13ee,
-	0x13f0,
-	0x13f2,
-	0x13f3,
-	0x13f4,
-	0x13fb,
-	0x13fc,
-	0x1400,
-	0x1403,
-	0x140c,
-	0x140d,
-	0x140e,
-	0x140f,
-	0x1410,
-	0x1411,
-	0x1412,
-	0x1413,
-	0x1414,
-	0x1415,
-	0x1417,
-	0x1418,
-	0x1419,
-	0x141a,
-	0x1427,
-	0x142b,
-	0x142c,
-	0x142d,
-	0x142e,
-	0x142f,
-	0x1431,
-	0x1433,
-	0x1437,
-	0x1438,
-	0x143a,
-	0x143b,
-	0x143c,
-	0x143d,
-	0x143e,
-	0x143f,
-	0x1440,
-	0x1441,
-	0x1442,
-	0x1443,
-	0x1444,
-	0x1445,
-	0x1446,
-	0x1447,
-	0x144a,
-	0x144c,
-	0x144e,
-	0x1454,
-	0x1457,
-	0x1458,
-	0x1459,
-	0x145a,
-	0x145b,
-	0x145c,
-	0x145d,
-	0x145e,
-	0x145f,
-	0x1460,
-	0x1461,
-	0x1462,
-	0x1463,
-	0x1464,
-	0x1467,
-	0x1468,
-	0x1469,
-	0x146a,
-	0x146d,
-	0x146f,
-	0x1472,
-	0x1473,
-	0x1474,
-	0x1475,
-	0x1476,
-	0x1477,
-	0x1478,
-	0x1479,
-	0x147a,
-	0x147b,
-	0x147c,
-	0x147d,
-	0x147e,
-	0x147f,
-	0x1480,
-	0x1481,
-	0x1485,
-	0x1486,
-	0x1487,
-	0x1488,
-	0x148d,
-	0x1492,
-	0x1493,
-	0x1494,
-	0x1495,
-	0x1496,
-	0x1497,
-	0x1498,
-	0x1499,
-	0x149a,
-	0x149b,
-	0x149c,
-	0x149d,
-	0x149e,
-	0x149f,
-	0x14a5,
-	0x14aa,
-	0x14ac,
-	0x14ad,
-	0x14ae,
-	0x14af,
-	0x14b0,
-	0x14b1,
-	0x14b2,
-	0x14b3,
-	0x14b4,
-	0x14b5,
-	0x14b6,
-	0x14b7,
-	0x14b8,
-	0x14b9,
-	0x14bf,
-	0x14c9,
-	0x14ca,
-	0x14cb,
-	0x14cc,
-	0x14cd,
-	0x14ce,
-	0x14d1,
-	0x14dc,
-	0x14dd,
-	0x14de,
-	0x14df,
-	0x14e0,
-	0x14e1,
-	0x14e2,
-	0x14e3,
-	0x14e4,
-	0x14e5,
-	0x14e6,
-	0x14e7,
-	0x14e8,
-	0x14e9,
-	0x14f6,
-	0x14f7,
-	0x14f8,
-	0x14f9,
-	0x14fa,
-	0x14fb,
-	0x14fc,
-	0x14fd,
-	0x14fe,
-	0x14ff,
-	0x1500,
-	0x1501,
-	0x1502,
-	0x1503,
-	0x150c,
-	0x150d,
-	0x150e,
-	0x150f,
-	0x1517,
-	0x1518,
-	0x1519,
-	0x151a,
-	0x151b,
-	0x151c,
-	0x151d,
-	0x151e,
-	0x151f,
-	0x1520,
-	0x1521,
-	0x1522,
-	0x1523,
-	0x1524,
-	0x152f,
-	0x1530,
-	0x1531,
-	0x1532,
-	0x1533,
-	0x1534,
-	0x1535,
-	0x1536,
-	0x1537,
-	0x1538,
-	0x1539,
-	0x153a,
-	0x153b,
-	0x153c,
-	0x1540,
-	0x1541,
-	0x154e,
-	0x154f,
-	0x155b,
-	0x155c,
-	0x1568,
-	0x1569,
-	0x1577,
-	0x157c,
-	0x157d,
-	0x157e,
-	0x157f,
-	0x1580,
-	0x1581,
-	0x1582,
-	0x1583,
-	0x1584,
-	0x1585,
-	0x1587,
-	0x158e,
-	0x158f,
-	0x1590,
-	0x1591,
-	0x1592,
-	0x1593,
-	0x1594,
-	0x15af,
-	0x15b4,
-	0x15b5,
-	0x15b7,
-	0x15c4,
-	0x15c5,
-	0x15de,
-	0x15ea,
-	0x15ef,
-	0x15f0,
-	0x15f7,
-	0x1602,
-	0x1603,
-	0x1604,
-	0x1607,
-	0x1622,
-	0x1623,
-	0x1624,
-	0x162e,
-	0x162f,
-	0x1634,
-	0x1635,
-	0x166d,
-	0x166e,
-	0x166f,
-	0x1670,
-	0x1671,
-	0x1672,
-	0x1673,
-	0x1674,
-	0x1675,
-	0x1676,
-	0x1677,
-	0x1678,
-	0x1679,
-	0x167a,
-	0x167b,
-	0x167c,
-	0x167d,
-	0x1680,
-	0x16b2,
-	0x16b7,
-	0x16c1,
-	0x16c2,
-	0x16cc,
-	0x16d5,
-	0x16d6,
-	0x16d8,
-	0x16e1,
-	0x16eb,
-	0x16ec,
-	0x16ed,
-	0x16f0,
-	0x1712,
-	0x1713,
-	0x1714,
-	0x1732,
-	0x1733,
-	0x1734,
-	0x1735,
-	0x1752,
-	0x1753,
-	0x1772,
-	0x1773,
-	0x17a3,
-	0x17b4,
-	0x17b5,
-	0x17b6,
-	0x17b7,
-	0x17b8,
-	0x17b9,
-	0x17ba,
-	0x17bb,
-	0x17bc,
-	0x17bd,
-	0x17be,
-	0x17bf,
-	0x17c0,
-	0x17c1,
-	0x17c2,
-	0x17c3,
-	0x17c4,
-	0x17c5,
-	0x17c6,
-	0x17c7,
-	0x17c8,
-	0x17c9,
-	0x17ca,
-	0x17cb,
-	0x17cc,
-	0x17cd,
-	0x17ce,
-	0x17cf,
-	0x17d0,
-	0x17d1,
-	0x17d2,
-	0x17d3,
-	0x17d4,
-	0x17d5,
-	0x17d9,
-	0x17da,
-	0x17dd,
-	0x1803,
-	0x1809,
-	0x180b,
-	0x180c,
-	0x180d,
-	0x180e,
-	0x1855,
-	0x1885,
-	0x1886,
-	0x1896,
-	0x18a9,
-	0x18b3,
-	0x18b6,
-	0x18b9,
-	0x18c2,
-	0x18c6,
-	0x18c7,
-	0x18c8,
-	0x18c9,
-	0x18ca,
-	0x18cb,
-	0x18cc,
-	0x18cd,
-	0x18ce,
-	0x18cf,
-	0x18d0,
-	0x18d1,
-	0x18d2,
-	0x18d3,
-	0x18db,
-	0x18dc,
-	0x18dd,
-	0x18e0,
-	0x18e3,
-	0x18e4,
-	0x18e5,
-	0x18e8,
-	0x18ea,
-	0x18ed,
-	0x18f0,
-	0x18f2,
-	0x1920,
-	0x1921,
-	0x1922,
-	0x1923,
-	0x1924,
-	0x1925,
-	0x1926,
-	0x1927,
-	0x1928,
-	0x1929,
-	0x192a,
-	0x192b,
-	0x1930,
-	0x1931,
-	0x1932,
-	0x1933,
-	0x1934,
-	0x1935,
-	0x1936,
-	0x1937,
-	0x1938,
-	0x1939,
-	0x193a,
-	0x193b,
-	0x19d0,
-	0x19d1,
-	0x1a17,
-	0x1a18,
-	0x1a19,
-	0x1a1a,
-	0x1a1b,
-	0x1a55,
-	0x1a56,
-	0x1a57,
-	0x1a58,
-	0x1a59,
-	0x1a5a,
-	0x1a5b,
-	0x1a5c,
-	0x1a5d,
-	0x1a5e,
-	0x1a60,
-	0x1a61,
-	0x1a62,
-	0x1a63,
-	0x1a64,
-	0x1a65,
-	0x1a66,
-	0x1a67,
-	0x1a68,
-	0x1a69,
-	0x1a6a,
-	0x1a6b,
-	0x1a6c,
-	0x1a6d,
-	0x1a6e,
-	0x1a6f,
-	0x1a70,
-	0x1a71,
-	0x1a72,
-	0x1a73,
-	0x1a74,
-	0x1a75,
-	0x1a76,
-	0x1a77,
-	0x1a78,
-	0x1a79,
-	0x1a7a,
-	0x1a7b,
-	0x1a7c,
-	0x1a7f,
-	0x1a80,
-	0x1a90,
-	0x1aa9,
-	0x1aab,
-	0x1ab0,
-	0x1ab1,
-	0x1ab2,
-	0x1ab3,
-	0x1ab4,
-	0x1ab5,
-	0x1ab6,
-	0x1ab7,
-	0x1ab8,
-	0x1ab9,
-	0x1aba,
-	0x1abb,
-	0x1abc,
-	0x1abd,
-	0x1abe,
-	0x1b00,
-	0x1b01,
-	0x1b02,
-	0x1b03,
-	0x1b04,
-	0x1b06,
-	0x1b08,
-	0x1b0a,
-	0x1b0c,
-	0x1b0e,
-	0x1b12,
-	0x1b34,
-	0x1b35,
-	0x1b36,
-	0x1b37,
-	0x1b38,
-	0x1b39,
-	0x1b3a,
-	0x1b3b,
-	0x1b3c,
-	0x1b3d,
-	0x1b3e,
-	0x1b3f,
-	0x1b40,
-	0x1b41,
-	0x1b42,
-	0x1b43,
-	0x1b44,
-	0x1b52,
-	0x1b53,
-	0x1b58,
-	0x1b5c,
-	0x1b5f,
-	0x1b6b,
-	0x1b6c,
-	0x1b6d,
-	0x1b6e,
-	0x1b6f,
-	0x1b70,
-	0x1b71,
-	0x1b72,
-	0x1b73,
-	0x1b80,
-	0x1b81,
-	0x1b82,
-	0x1ba1,
-	0x1ba2,
-	0x1ba3,
-	0x1ba4,
-	0x1ba5,
-	0x1ba6,
-	0x1ba7,
-	0x1ba8,
-	0x1ba9,
-	0x1baa,
-	0x1bab,
-	0x1bac,
-	0x1bad,
-	0x1be6,
-	0x1be7,
-	0x1be8,
-	0x1be9,
-	0x1bea,
-	0x1beb,
-	0x1bec,
-	0x1bed,
-	0x1bee,
-	0x1bef,
-	0x1bf0,
-	0x1bf1,
-	0x1bf2,
-	0x1bf3,
-	0x1c24,
-	0x1c25,
-	0x1c26,
-	0x1c27,
-	0x1c28,
-	0x1c29,
-	0x1c2a,
-	0x1c2b,
-	0x1c2c,
-	0x1c2d,
-	0x1c2e,
-	0x1c2f,
-	0x1c30,
-	0x1c31,
-	0x1c32,
-	0x1c33,
-	0x1c34,
-	0x1c35,
-	0x1c36,
-	0x1c37,
-	0x1c3c,
-	0x1c7f,
-	0x1cd0,
-	0x1cd1,
-	0x1cd2,
-	0x1cd3,
-	0x1cd4,
-	0x1cd5,
-	0x1cd6,
-	0x1cd7,
-	0x1cd8,
-	0x1cd9,
-	0x1cda,
-	0x1cdb,
-	0x1cdc,
-	0x1cdd,
-	0x1cde,
-	0x1cdf,
-	0x1ce0,
-	0x1ce1,
-	0x1ce2,
-	0x1ce3,
-	0x1ce4,
-	0x1ce5,
-	0x1ce6,
-	0x1ce7,
-	0x1ce8,
-	0x1ced,
-	0x1cf4,
-	0x1cf7,
-	0x1cf8,
-	0x1cf9,
-	0x1d04,
-	0x1d08,
-	0x1d0b,
-	0x1d0d,
-	0x1d0f,
-	0x1d10,
-	0x1d11,
-	0x1d14,
-	0x1d1c,
-	0x1d20,
-	0x1d21,
-	0x1d22,
-	0x1d24,
-	0x1d26,
-	0x1d27,
-	0x1d28,
-	0x1d29,
-	0x1d2b,
-	0x1d3e,
-	0x1d52,
-	0x1d6b,
-	0x1d6e,
-	0x1d6f,
-	0x1d70,
-	0x1d72,
-	0x1d73,
-	0x1d74,
-	0x1d75,
-	0x1d76,
-	0x1d78,
-	0x1d7b,
-	0x1d7c,
-	0x1d7d,
-	0x1d7e,
-	0x1d7f,
-	0x1d83,
-	0x1d8c,
-	0x1d90,
-	0x1d9f,
-	0x1da2,
-	0x1dba,
-	0x1dbb,
-	0x1dc0,
-	0x1dc1,
-	0x1dc2,
-	0x1dc3,
-	0x1dc4,
-	0x1dc5,
-	0x1dc6,
-	0x1dc7,
-	0x1dc8,
-	0x1dc9,
-	0x1dca,
-	0x1dcb,
-	0x1dcc,
-	0x1dcd,
-	0x1dce,
-	0x1dcf,
-	0x1dd0,
-	0x1dd1,
-	0x1dd2,
-	0x1dd3,
-	0x1dd4,
-	0x1dd5,
-	0x1dd6,
-	0x1dd7,
-	0x1dd8,
-	0x1dd9,
-	0x1dda,
-	0x1ddb,
-	0x1ddc,
-	0x1ddd,
-	0x1dde,
-	0x1ddf,
-	0x1de0,
-	0x1de1,
-	0x1de2,
-	0x1de3,
-	0x1de4,
-	0x1de5,
-	0x1de6,
-	0x1de7,
-	0x1de8,
-	0x1de9,
-	0x1dea,
-	0x1deb,
-	0x1dec,
-	0x1ded,
-	0x1dee,
-	0x1def,
-	0x1df0,
-	0x1df1,
-	0x1df2,
-	0x1df3,
-	0x1df4,
-	0x1df5,
-	0x1df6,
-	0x1df7,
-	0x1df8,
-	0x1df9,
-	0x1dfb,
-	0x1dfc,
-	0x1dfd,
-	0x1dfe,
-	0x1dff,
-	0x1e00,
-	0x1e01,
-	0x1e02,
-	0x1e03,
-	0x1e04,
-	0x1e05,
-	0x1e06,
-	0x1e07,
-	0x1e08,
-	0x1e09,
-	0x1e0a,
-	0x1e0b,
-	0x1e0c,
-	0x1e0d,
-	0x1e0e,
-	0x1e0f,
-	0x1e10,
-	0x1e11,
-	0x1e12,
-	0x1e13,
-	0x1e14,
-	0x1e15,
-	0x1e16,
-	0x1e17,
-	0x1e18,
-	0x1e19,
-	0x1e1a,
-	0x1e1b,
-	0x1e1c,
-	0x1e1d,
-	0x1e1e,
-	0x1e1f,
-	0x1e20,
-	0x1e21,
-	0x1e22,
-	0x1e23,
-	0x1e24,
-	0x1e25,
-	0x1e26,
-	0x1e27,
-	0x1e28,
-	0x1e29,
-	0x1e2a,
-	0x1e2b,
-	0x1e2c,
-	0x1e2d,
-	0x1e2e,
-	0x1e2f,
-	0x1e30,
-	0x1e31,
-	0x1e32,
-	0x1e33,
-	0x1e34,
-	0x1e35,
-	0x1e36,
-	0x1e37,
-	0x1e38,
-	0x1e39,
-	0x1e3a,
-	0x1e3b,
-	0x1e3c,
-	0x1e3d,
-	0x1e3e,
-	0x1e3f,
-	0x1e40,
-	0x1e41,
-	0x1e42,
-	0x1e43,
-	0x1e44,
-	0x1e45,
-	0x1e46,
-	0x1e47,
-	0x1e48,
-	0x1e49,
-	0x1e4a,
-	0x1e4b,
-	0x1e4c,
-	0x1e4d,
-	0x1e4e,
-	0x1e4f,
-	0x1e50,
-	0x1e51,
-	0x1e52,
-	0x1e53,
-	0x1e54,
-	0x1e55,
-	0x1e56,
-	0x1e57,
-	0x1e58,
-	0x1e59,
-	0x1e5a,
-	0x1e5b,
-	0x1e5c,
-	0x1e5d,
-	0x1e5e,
-	0x1e5f,
-	0x1e60,
-	0x1e61,
-	0x1e62,
-	0x1e63,
-	0x1e64,
-	0x1e65,
-	0x1e66,
-	0x1e67,
-	0x1e68,
-	0x1e69,
-	0x1e6a,
-	0x1e6b,
-	0x1e6c,
-	0x1e6d,
-	0x1e6e,
-	0x1e6f,
-	0x1e70,
-	0x1e71,
-	0x1e72,
-	0x1e73,
-	0x1e74,
-	0x1e75,
-	0x1e76,
-	0x1e77,
-	0x1e78,
-	0x1e79,
-	0x1e7a,
-	0x1e7b,
-	0x1e7c,
-	0x1e7d,
-	0x1e7e,
-	0x1e7f,
-	0x1e80,
-	0x1e81,
-	0x1e82,
-	0x1e83,
-	0x1e84,
-	0x1e85,
-	0x1e86,
-	0x1e87,
-	0x1e88,
-	0x1e89,
-	0x1e8a,
-	0x1e8b,
-	0x1e8c,
-	0x1e8d,
-	0x1e8e,
-	0x1e8f,
-	0x1e90,
-	0x1e91,
-	0x1e92,
-	0x1e93,
-	0x1e94,
-	0x1e95,
-	0x1e96,
-	0x1e97,
-	0x1e98,
-	0x1e99,
-	0x1e9a,
-	0x1e9b,
-	0x1e9d,
-	0x1ea0,
-	0x1ea1,
-	0x1ea2,
-	0x1ea3,
-	0x1ea4,
-	0x1ea5,
-	0x1ea6,
-	0x1ea7,
-	0x1ea8,
-	0x1ea9,
-	0x1eaa,
-	0x1eab,
-	0x1eac,
-	0x1ead,
-	0x1eae,
-	0x1eaf,
-	0x1eb0,
-	0x1eb1,
-	0x1eb2,
-	0x1eb3,
-	0x1eb4,
-	0x1eb5,
-	0x1eb6,
-	0x1eb7,
-	0x1eb8,
-	0x1eb9,
-	0x1eba,
-	0x1ebb,
-	0x1ebc,
-	0x1ebd,
-	0x1ebe,
-	0x1ebf,
-	0x1ec0,
-	0x1ec1,
-	0x1ec2,
-	0x1ec3,
-	0x1ec4,
-	0x1ec5,
-	0x1ec6,
-	0x1ec7,
-	0x1ec8,
-	0x1ec9,
-	0x1eca,
-	0x1ecb,
-	0x1ecc,
-	0x1ecd,
-	0x1ece,
-	0x1ecf,
-	0x1ed0,
-	0x1ed1,
-	0x1ed2,
-	0x1ed3,
-	0x1ed4,
-	0x1ed5,
-	0x1ed6,
-	0x1ed7,
-	0x1ed8,
-	0x1ed9,
-	0x1eda,
-	0x1edb,
-	0x1edc,
-	0x1edd,
-	0x1ede,
-	0x1edf,
-	0x1ee0,
-	0x1ee1,
-	0x1ee2,
-	0x1ee3,
-	0x1ee4,
-	0x1ee5,
-	0x1ee6,
-	0x1ee7,
-	0x1ee8,
-	0x1ee9,
-	0x1eea,
-	0x1eeb,
-	0x1eec,
-	0x1eed,
-	0x1eee,
-	0x1eef,
-	0x1ef0,
-	0x1ef1,
-	0x1ef2,
-	0x1ef3,
-	0x1ef4,
-	0x1ef5,
-	0x1ef6,
-	0x1ef7,
-	0x1ef8,
-	0x1ef9,
-	0x1eff,
-	0x1f00,
-	0x1f01,
-	0x1f02,
-	0x1f03,
-	0x1f04,
-	0x1f05,
-	0x1f06,
-	0x1f07,
-	0x1f08,
-	0x1f09,
-	0x1f0a,
-	0x1f0b,
-	0x1f0c,
-	0x1f0d,
-	0x1f0e,
-	0x1f0f,
-	0x1f10,
-	0x1f11,
-	0x1f12,
-	0x1f13,
-	0x1f14,
-	0x1f15,
-	0x1f18,
-	0x1f19,
-	0x1f1a,
-	0x1f1b,
-	0x1f1c,
-	0x1f1d,
-	0x1f20,
-	0x1f21,
-	0x1f22,
-	0x1f23,
-	0x1f24,
-	0x1f25,
-	0x1f26,
-	0x1f27,
-	0x1f28,
-	0x1f29,
-	0x1f2a,
-	0x1f2b,
-	0x1f2c,
-	0x1f2d,
-	0x1f2e,
-	0x1f2f,
-	0x1f30,
-	0x1f31,
-	0x1f32,
-	0x1f33,
-	0x1f34,
-	0x1f35,
-	0x1f36,
-	0x1f37,
-	0x1f38,
-	0x1f39,
-	0x1f3a,
-	0x1f3b,
-	0x1f3c,
-	0x1f3d,
-	0x1f3e,
-	0x1f3f,
-	0x1f40,
-	0x1f41,
-	0x1f42,
-	0x1f43,
-	0x1f44,
-	0x1f45,
-	0x1f48,
-	0x1f49,
-	0x1f4a,
-	0x1f4b,
-	0x1f4c,
-	0x1f4d,
-	0x1f50,
-	0x1f51,
-	0x1f52,
-	0x1f53,
-	0x1f54,
-	0x1f55,
-	0x1f56,
-	0x1f57,
-	0x1f59,
-	0x1f5b,
-	0x1f5d,
-	0x1f5f,
-	0x1f60,
-	0x1f61,
-	0x1f62,
-	0x1f63,
-	0x1f64,
-	0x1f65,
-	0x1f66,
-	0x1f67,
-	0x1f68,
-	0x1f69,
-	0x1f6a,
-	0x1f6b,
-	0x1f6c,
-	0x1f6d,
-	0x1f6e,
-	0x1f6f,
-	0x1f70,
-	0x1f71,
-	0x1f72,
-	0x1f73,
-	0x1f74,
-	0x1f75,
-	0x1f76,
-	0x1f77,
-	0x1f78,
-	0x1f79,
-	0x1f7a,
-	0x1f7b,
-	0x1f7c,
-	0x1f7d,
-	0x1f80,
-	0x1f81,
-	0x1f82,
-	0x1f83,
-	0x1f84,
-	0x1f85,
-	0x1f86,
-	0x1f87,
-	0x1f88,
-	0x1f89,
-	0x1f8a,
-	0x1f8b,
-	0x1f8c,
-	0x1f8d,
-	0x1f8e,
-	0x1f8f,
-	0x1f90,
-	0x1f91,
-	0x1f92,
-	0x1f93,
-	0x1f94,
-	0x1f95,
-	0x1f96,
-	0x1f97,
-	0x1f98,
-	0x1f99,
-	0x1f9a,
-	0x1f9b,
-	0x1f9c,
-	0x1f9d,
-	0x1f9e,
-	0x1f9f,
-	0x1fa0,
-	0x1fa1,
-	0x1fa2,
-	0x1fa3,
-	0x1fa4,
-	0x1fa5,
-	0x1fa6,
-	0x1fa7,
-	0x1fa8,
-	0x1fa9,
-	0x1faa,
-	0x1fab,
-	0x1fac,
-	0x1fad,
-	0x1fae,
-	0x1faf,
-	0x1fb0,
-	0x1fb1,
-	0x1fb2,
-	0x1fb3,
-	0x1fb4,
-	0x1fb6,
-	0x1fb7,
-	0x1fb8,
-	0x1fb9,
-	0x1fba,
-	0x1fbb,
-	0x1fbc,
-	0x1fbd,
-	0x1fbe,
-	0x1fbf,
-	0x1fc0,
-	0x1fc1,
-	0x1fc2,
-	0x1fc3,
-	0x1fc4,
-	0x1fc6,
-	0x1fc7,
-	0x1fc8,
-	0x1fc9,
-	0x1fca,
-	0x1fcb,
-	0x1fcc,
-	0x1fcd,
-	0x1fce,
-	0x1fcf,
-	0x1fd0,
-	0x1fd1,
-	0x1fd2,
-	0x1fd3,
-	0x1fd6,
-	0x1fd7,
-	0x1fd8,
-	0x1fd9,
-	0x1fda,
-	0x1fdb,
-	0x1fdd,
-	0x1fde,
-	0x1fdf,
-	0x1fe0,
-	0x1fe1,
-	0x1fe2,
-	0x1fe3,
-	0x1fe4,
-	0x1fe5,
-	0x1fe6,
-	0x1fe7,
-	0x1fe8,
-	0x1fe9,
-	0x1fea,
-	0x1feb,
-	0x1fec,
-	0x1fed,
-	0x1fee,
-	0x1fef,
-	0x1ff2,
-	0x1ff3,
-	0x1ff4,
-	0x1ff6,
-	0x1ff7,
-	0x1ff8,
-	0x1ff9,
-	0x1ffa,
-	0x1ffb,
-	0x1ffc,
-	0x1ffd,
-	0x1ffe,
-	0x2000,
-	0x2001,
-	0x2002,
-	0x2003,
-	0x2004,
-	0x2005,
-	0x2006,
-	0x2007,
-	0x2008,
-	0x2009,
-	0x200a,
-	0x200b,
-	0x200c,
-	0x200d,
-	0x200e,
-	0x200f,
-	0x2010,
-	0x2011,
-	0x2012,
-	0x2013,
-	0x2014,
-	0x2015,
-	0x2016,
-	0x2018,
-	0x2019,
-	0x201a,
-	0x201b,
-	0x201c,
-	0x201d,
-	0x201f,
-	0x2022,
-	0x2024,
-	0x2025,
-	0x2026,
-	0x2027,
-	0x2028,
-	0x2029,
-	0x202a,
-	0x202b,
-	0x202c,
-	0x202d,
-	0x202e,
-	0x202f,
-	0x2030,
-	0x2031,
-	0x2032,
-	0x2033,
-	0x2034,
-	0x2035,
-	0x2036,
-	0x2037,
-	0x2039,
-	0x203a,
-	0x203c,
-	0x203e,
-	0x2041,
-	0x2043,
-	0x2044,
-	0x2047,
-	0x2048,
-	0x2049,
-	0x204e,
-	0x2052,
-	0x2053,
-	0x2057,
-	0x205a,
-	0x205d,
-	0x205e,
-	0x205f,
-	0x2060,
-	0x2061,
-	0x2062,
-	0x2063,
-	0x2064,
-	0x2066,
-	0x2067,
-	0x2068,
-	0x2069,
-	0x206a,
-	0x206b,
-	0x206c,
-	0x206d,
-	0x206e,
-	0x206f,
-	0x2070,
-	0x2079,
-	0x20a1,
-	0x20a4,
-	0x20a5,
-	0x20a8,
-	0x20a9,
-	0x20ab,
-	0x20ac,
-	0x20ad,
-	0x20ae,
-	0x20b6,
-	0x20bd,
-	0x20d0,
-	0x20d1,
-	0x20d2,
-	0x20d3,
-	0x20d4,
-	0x20d5,
-	0x20d6,
-	0x20d7,
-	0x20d8,
-	0x20d9,
-	0x20da,
-	0x20db,
-	0x20dc,
-	0x20dd,
-	0x20de,
-	0x20df,
-	0x20e0,
-	0x20e1,
-	0x20e2,
-	0x20e3,
-	0x20e4,
-	0x20e5,
-	0x20e6,
-	0x20e7,
-	0x20e8,
-	0x20e9,
-	0x20ea,
-	0x20eb,
-	0x20ec,
-	0x20ed,
-	0x20ee,
-	0x20ef,
-	0x20f0,
-	0x2100,
-	0x2101,
-	0x2102,
-	0x2103,
-	0x2105,
-	0x2106,
-	0x2107,
-	0x2108,
-	0x2109,
-	0x210a,
-	0x210b,
-	0x210c,
-	0x210d,
-	0x210e,
-	0x210f,
-	0x2110,
-	0x2111,
-	0x2112,
-	0x2113,
-	0x2115,
-	0x2116,
-	0x2119,
-	0x211a,
-	0x211b,
-	0x211c,
-	0x211d,
-	0x2121,
-	0x2124,
-	0x2126,
-	0x2127,
-	0x2128,
-	0x2129,
-	0x212a,
-	0x212b,
-	0x212c,
-	0x212d,
-	0x212e,
-	0x212f,
-	0x2130,
-	0x2131,
-	0x2133,
-	0x2134,
-	0x2135,
-	0x2136,
-	0x2137,
-	0x2138,
-	0x2139,
-	0x213b,
-	0x213c,
-	0x213d,
-	0x213e,
-	0x213f,
-	0x2140,
-	0x2141,
-	0x2142,
-	0x2143,
-	0x2145,
-	0x2146,
-	0x2147,
-	0x2148,
-	0x2149,
-	0x2160,
-	0x2161,
-	0x2162,
-	0x2163,
-	0x2164,
-	0x2165,
-	0x2166,
-	0x2167,
-	0x2168,
-	0x2169,
-	0x216a,
-	0x216b,
-	0x216c,
-	0x216d,
-	0x216e,
-	0x216f,
-	0x2170,
-	0x2171,
-	0x2172,
-	0x2173,
-	0x2174,
-	0x2175,
-	0x2176,
-	0x2177,
-	0x2178,
-	0x2179,
-	0x217a,
-	0x217b,
-	0x217c,
-	0x217d,
-	0x217e,
-	0x217f,
-	0x2183,
-	0x2184,
-	0x2191,
-	0x2195,
-	0x219a,
-	0x219b,
-	0x21ae,
-	0x21b5,
-	0x21be,
-	0x21bf,
-	0x21cd,
-	0x21ce,
-	0x21cf,
-	0x2200,
-	0x2203,
-	0x2204,
-	0x2206,
-	0x2209,
-	0x220c,
-	0x220f,
-	0x2211,
-	0x2212,
-	0x2214,
-	0x2215,
-	0x2216,
-	0x2217,
-	0x2218,
-	0x2219,
-	0x221e,
-	0x2223,
-	0x2224,
-	0x2225,
-	0x2226,
-	0x2228,
-	0x2229,
-	0x222a,
-	0x222b,
-	0x222c,
-	0x222d,
-	0x222f,
-	0x2230,
-	0x2236,
-	0x2238,
-	0x223c,
-	0x2241,
-	0x2244,
-	0x2247,
-	0x2249,
-	0x2250,
-	0x2251,
-	0x2257,
-	0x2259,
-	0x225a,
-	0x225e,
-	0x2260,
-	0x2262,
-	0x2263,
-	0x226a,
-	0x226b,
-	0x226d,
-	0x226e,
-	0x226f,
-	0x2270,
-	0x2271,
-	0x2274,
-	0x2275,
-	0x2278,
-	0x2279,
-	0x2280,
-	0x2281,
-	0x2282,
-	0x2283,
-	0x2284,
-	0x2285,
-	0x2288,
-	0x2289,
-	0x2295,
-	0x2296,
-	0x2299,
-	0x229d,
-	0x22a4,
-	0x22a5,
-	0x22ac,
-	0x22ad,
-	0x22ae,
-	0x22af,
-	0x22c0,
-	0x22c1,
-	0x22c2,
-	0x22c3,
-	0x22c4,
-	0x22c5,
-	0x22c8,
-	0x22d6,
-	0x22d7,
-	0x22d8,
-	0x22d9,
-	0x22e0,
-	0x22e1,
-	0x22e2,
-	0x22e3,
-	0x22ea,
-	0x22eb,
-	0x22ec,
-	0x22ed,
-	0x22ee,
-	0x22ef,
-	0x22f4,
-	0x22ff,
-	0x2300,
-	0x2325,
-	0x2329,
-	0x232a,
-	0x2341,
-	0x2359,
-	0x235a,
-	0x235c,
-	0x235f,
-	0x2361,
-	0x2362,
-	0x2363,
-	0x2364,
-	0x2365,
-	0x2368,
-	0x2369,
-	0x236b,
-	0x236c,
-	0x2373,
-	0x2374,
-	0x2375,
-	0x2376,
-	0x2377,
-	0x2378,
-	0x2379,
-	0x237a,
-	0x237f,
-	0x239c,
-	0x239f,
-	0x23a2,
-	0x23a5,
-	0x23aa,
-	0x23ae,
-	0x23c1,
-	0x23c2,
-	0x23c3,
-	0x23c6,
-	0x23e8,
-	0x23fc,
-	0x23fd,
-	0x23fe,
-	0x244a,
-	0x2460,
-	0x2461,
-	0x2462,
-	0x2463,
-	0x2464,
-	0x2465,
-	0x2466,
-	0x2467,
-	0x2468,
-	0x2469,
-	0x2474,
-	0x2475,
-	0x2476,
-	0x2477,
-	0x2478,
-	0x2479,
-	0x247a,
-	0x247b,
-	0x247c,
-	0x247d,
-	0x247e,
-	0x247f,
-	0x2480,
-	0x2481,
-	0x2482,
-	0x2483,
-	0x2484,
-	0x2485,
-	0x2486,
-	0x2487,
-	0x2488,
-	0x2489,
-	0x248a,
-	0x248b,
-	0x248c,
-	0x248d,
-	0x248e,
-	0x248f,
-	0x2490,
-	0x2491,
-	0x2492,
-	0x2493,
-	0x2494,
-	0x2495,
-	0x2496,
-	0x2497,
-	0x2498,
-	0x2499,
-	0x249a,
-	0x249b,
-	0x249c,
-	0x249d,
-	0x249e,
-	0x249f,
-	0x24a0,
-	0x24a1,
-	0x24a2,
-	0x24a3,
-	0x24a4,
-	0x24a5,
-	0x24a6,
-	0x24a7,
-	0x24a8,
-	0x24a9,
-	0x24aa,
-	0x24ab,
-	0x24ac,
-	0x24ad,
-	0x24ae,
-	0x24af,
-	0x24b0,
-	0x24b1,
-	0x24b2,
-	0x24b3,
-	0x24b4,
-	0x24b5,
-	0x24b8,
-	0x24c5,
-	0x24c7,
-	0x24db,
-	0x2500,
-	0x2501,
-	0x2503,
-	0x250f,
-	0x2523,
-	0x2571,
-	0x2573,
-	0x2588,
-	0x2590,
-	0x2594,
-	0x2597,
-	0x259d,
-	0x25a0,
-	0x25b1,
-	0x25b3,
-	0x25b7,
-	0x25b8,
-	0x25ba,
-	0x25bd,
-	0x25c1,
-	0x25c7,
-	0x25ca,
-	0x25cb,
-	0x25ce,
-	0x25e0,
-	0x25e6,
-	0x2609,
-	0x2610,
-	0x2625,
-	0x2630,
-	0x2638,
-	0x264e,
-	0x2662,
-	0x2669,
-	0x266a,
-	0x26ac,
-	0x2768,
-	0x2769,
-	0x276e,
-	0x276f,
-	0x2772,
-	0x2773,
-	0x2774,
-	0x2775,
-	0x2795,
-	0x2796,
-	0x2797,
-	0x27c2,
-	0x27c8,
-	0x27c9,
-	0x27cb,
-	0x27cd,
-	0x27d9,
-	0x27e8,
-	0x27e9,
-	0x2800,
-	0x292b,
-	0x292c,
-	0x2963,
-	0x2965,
-	0x296e,
-	0x296f,
-	0x2999,
-	0x29b0,
-	0x29be,
-	0x29c4,
-	0x29c5,
-	0x29c7,
-	0x29d6,
-	0x29d9,
-	0x29f4,
-	0x29f5,
-	0x29f6,
-	0x29f8,
-	0x29f9,
-	0x2a00,
-	0x2a01,
-	0x2a02,
-	0x2a03,
-	0x2a04,
-	0x2a05,
-	0x2a06,
-	0x2a0c,
-	0x2a1d,
-	0x2a20,
-	0x2a21,
-	0x2a22,
-	0x2a23,
-	0x2a24,
-	0x2a25,
-	0x2a26,
-	0x2a27,
-	0x2a29,
-	0x2a2a,
-	0x2a2f,
-	0x2a30,
-	0x2a3d,
-	0x2a3e,
-	0x2a3f,
-	0x2a6a,
-	0x2a6e,
-	0x2a74,
-	0x2a75,
-	0x2a76,
-	0x2aa5,
-	0x2aaa,
-	0x2aab,
-	0x2ad7,
-	0x2adc,
-	0x2afb,
-	0x2afd,
-	0x2bec,
-	0x2bed,
-	0x2bee,
-	0x2bef,
-	0x2c67,
-	0x2c69,
-	0x2c84,
-	0x2c85,
-	0x2c86,
-	0x2c88,
-	0x2c89,
-	0x2c8e,
-	0x2c92,
-	0x2c94,
-	0x2c95,
-	0x2c96,
-	0x2c98,
-	0x2c9a,
-	0x2c9e,
-	0x2c9f,
-	0x2ca0,
-	0x2ca2,
-	0x2ca3,
-	0x2ca4,
-	0x2ca5,
-	0x2ca6,
-	0x2ca8,
-	0x2caa,
-	0x2cab,
-	0x2cac,
-	0x2cad,
-	0x2cae,
-	0x2cb1,
-	0x2cb4,
-	0x2cba,
-	0x2cbc,
-	0x2cbd,
-	0x2cc6,
-	0x2cca,
-	0x2ccc,
-	0x2ccd,
-	0x2cd0,
-	0x2cd1,
-	0x2cd2,
-	0x2cdc,
-	0x2ce4,
-	0x2ce9,
-	0x2cef,
-	0x2cf0,
-	0x2cf1,
-	0x2cf9,
-	0x2d31,
-	0x2d37,
-	0x2d38,
-	0x2d39,
-	0x2d3a,
-	0x2d41,
-	0x2d48,
-	0x2d49,
-	0x2d4f,
-	0x2d51,
-	0x2d54,
-	0x2d55,
-	0x2d59,
-	0x2d5d,
-	0x2d60,
-	0x2d63,
-	0x2d7f,
-	0x2de0,
-	0x2de1,
-	0x2de2,
-	0x2de3,
-	0x2de4,
-	0x2de5,
-	0x2de6,
-	0x2de7,
-	0x2de8,
-	0x2de9,
-	0x2dea,
-	0x2deb,
-	0x2dec,
-	0x2ded,
-	0x2dee,
-	0x2def,
-	0x2df0,
-	0x2df1,
-	0x2df2,
-	0x2df3,
-	0x2df4,
-	0x2df5,
-	0x2df6,
-	0x2df7,
-	0x2df8,
-	0x2df9,
-	0x2dfa,
-	0x2dfb,
-	0x2dfc,
-	0x2dfd,
-	0x2dfe,
-	0x2dff,
-	0x2e1a,
-	0x2e1e,
-	0x2e1f,
-	0x2e26,
-	0x2e27,
-	0x2e28,
-	0x2e29,
-	0x2e2a,
-	0x2e2b,
-	0x2e2c,
-	0x2e2e,
-	0x2e30,
-	0x2e31,
-	0x2e32,
-	0x2e35,
-	0x2e39,
-	0x2e3d,
-	0x2e3f,
-	0x2e40,
-	0x2e82,
-	0x2e83,
-	0x2e85,
-	0x2e89,
-	0x2e8b,
-	0x2e8e,
-	0x2e8f,
-	0x2e90,
-	0x2e92,
-	0x2e93,
-	0x2e94,
-	0x2e96,
-	0x2e97,
-	0x2e98,
-	0x2e99,
-	0x2e9b,
-	0x2e9e,
-	0x2e9f,
-	0x2ea0,
-	0x2ea1,
-	0x2ea2,
-	0x2ea3,
-	0x2ea4,
-	0x2ea6,
-	0x2ea8,
-	0x2eab,
-	0x2ead,
-	0x2eaf,
-	0x2eb1,
-	0x2eb2,
-	0x2eb9,
-	0x2eba,
-	0x2ebe,
-	0x2ebf,
-	0x2ec0,
-	0x2ec1,
-	0x2ec2,
-	0x2ec3,
-	0x2ec4,
-	0x2ec5,
-	0x2ec8,
-	0x2ec9,
-	0x2ecb,
-	0x2ecc,
-	0x2ecd,
-	0x2ecf,
-	0x2ed0,
-	0x2ed1,
-	0x2ed2,
-	0x2ed3,
-	0x2ed4,
-	0x2ed6,
-	0x2ed8,
-	0x2ed9,
-	0x2eda,
-	0x2edb,
-	0x2edc,
-	0x2edd,
-	0x2edf,
-	0x2ee0,
-	0x2ee2,
-	0x2ee4,
-	0x2ee5,
-	0x2ee8,
-	0x2ee9,
-	0x2eeb,
-	0x2eec,
-	0x2eed,
-	0x2eee,
-	0x2eef,
-	0x2ef0,
-	0x2ef2,
-	0x2ef3,
-	0x2f00,
-	0x2f01,
-	0x2f02,
-	0x2f03,
-	0x2f04,
-	0x2f05,
-	0x2f06,
-	0x2f07,
-	0x2f08,
-	0x2f09,
-	0x2f0a,
-	0x2f0b,
-	0x2f0c,
-	0x2f0d,
-	0x2f0e,
-	0x2f0f,
-	0x2f10,
-	0x2f11,
-	0x2f12,
-	0x2f13,
-	0x2f14,
-	0x2f15,
-	0x2f16,
-	0x2f17,
-	0x2f18,
-	0x2f19,
-	0x2f1a,
-	0x2f1b,
-	0x2f1c,
-	0x2f1d,
-	0x2f1e,
-	0x2f1f,
-	0x2f20,
-	0x2f21,
-	0x2f22,
-	0x2f23,
-	0x2f24,
-	0x2f25,
-	0x2f26,
-	0x2f27,
-	0x2f28,
-	0x2f29,
-	0x2f2a,
-	0x2f2b,
-	0x2f2c,
-	0x2f2d,
-	0x2f2e,
-	0x2f2f,
-	0x2f30,
-	0x2f31,
-	0x2f32,
-	0x2f33,
-	0x2f34,
-	0x2f35,
-	0x2f36,
-	0x2f37,
-	0x2f38,
-	0x2f39,
-	0x2f3a,
-	0x2f3b,
-	0x2f3c,
-	0x2f3d,
-	0x2f3e,
-	0x2f3f,
-	0x2f40,
-	0x2f41,
-	0x2f42,
-	0x2f43,
-	0x2f44,
-	0x2f45,
-	0x2f46,
-	0x2f47,
-	0x2f48,
-	0x2f49,
-	0x2f4a,
-	0x2f4b,
-	0x2f4c,
-	0x2f4d,
-	0x2f4e,
-	0x2f4f,
-	0x2f50,
-	0x2f51,
-	0x2f52,
-	0x2f53,
-	0x2f54,
-	0x2f55,
-	0x2f56,
-	0x2f57,
-	0x2f58,
-	0x2f59,
-	0x2f5a,
-	0x2f5b,
-	0x2f5c,
-	0x2f5d,
-	0x2f5e,
-	0x2f5f,
-	0x2f60,
-	0x2f61,
-	0x2f62,
-	0x2f63,
-	0x2f64,
-	0x2f65,
-	0x2f66,
-	0x2f67,
-	0x2f68,
-	0x2f69,
-	0x2f6a,
-	0x2f6b,
-	0x2f6c,
-	0x2f6d,
-	0x2f6e,
-	0x2f6f,
-	0x2f70,
-	0x2f71,
-	0x2f72,
-	0x2f73,
-	0x2f74,
-	0x2f75,
-	0x2f76,
-	0x2f77,
-	0x2f78,
-	0x2f79,
-	0x2f7a,
-	0x2f7b,
-	0x2f7c,
-	0x2f7d,
-	0x2f7e,
-	0x2f7f,
-	0x2f80,
-	0x2f81,
-	0x2f82,
-	0x2f83,
-	0x2f84,
-	0x2f85,
-	0x2f86,
-	0x2f87,
-	0x2f88,
-	0x2f89,
-	0x2f8a,
-	0x2f8b,
-	0x2f8c,
-	0x2f8d,
-	0x2f8e,
-	0x2f8f,
-	0x2f90,
-	0x2f91,
-	0x2f92,
-	0x2f93,
-	0x2f94,
-	0x2f95,
-	0x2f96,
-	0x2f97,
-	0x2f98,
-	0x2f99,
-	0x2f9a,
-	0x2f9b,
-	0x2f9c,
-	0x2f9d,
-	0x2f9e,
-	0x2f9f,
-	0x2fa0,
-	0x2fa1,
-	0x2fa2,
-	0x2fa3,
-	0x2fa4,
-	0x2fa5,
-	0x2fa6,
-	0x2fa7,
-	0x2fa8,
-	0x2fa9,
-	0x2faa,
-	0x2fab,
-	0x2fac,
-	0x2fad,
-	0x2fae,
-	0x2faf,
-	0x2fb0,
-	0x2fb1,
-	0x2fb2,
-	0x2fb3,
-	0x2fb4,
-	0x2fb5,
-	0x2fb6,
-	0x2fb7,
-	0x2fb8,
-	0x2fb9,
-	0x2fba,
-	0x2fbb,
-	0x2fbc,
-	0x2fbd,
-	0x2fbe,
-	0x2fbf,
-	0x2fc0,
-	0x2fc1,
-	0x2fc2,
-	0x2fc3,
-	0x2fc4,
-	0x2fc5,
-	0x2fc6,
-	0x2fc7,
-	0x2fc8,
-	0x2fc9,
-	0x2fca,
-	0x2fcb,
-	0x2fcc,
-	0x2fcd,
-	0x2fce,
-	0x2fcf,
-	0x2fd0,
-	0x2fd1,
-	0x2fd2,
-	0x2fd3,
-	0x2fd4,
-	0x2fd5,
-	0x3000,
-	0x3002,
-	0x3003,
-	0x3007,
-	0x3008,
-	0x3009,
-	0x3012,
-	0x3014,
-	0x3015,
-	0x301a,
-	0x301b,
-	0x302a,
-	0x302b,
-	0x302c,
-	0x302d,
-	0x302e,
-	0x302f,
-	0x3033,
-	0x3036,
-	0x3038,
-	0x3039,
-	0x303a,
-	0x304c,
-	0x304e,
-	0x304f,
-	0x3050,
-	0x3052,
-	0x3054,
-	0x3056,
-	0x3058,
-	0x305a,
-	0x305c,
-	0x305e,
-	0x3060,
-	0x3062,
-	0x3065,
-	0x3067,
-	0x3069,
-	0x3070,
-	0x3071,
-	0x3073,
-	0x3074,
-	0x3076,
-	0x3077,
-	0x3079,
-	0x307a,
-	0x307c,
-	0x307d,
-	0x3094,
-	0x3099,
-	0x309a,
-	0x309b,
-	0x309c,
-	0x309e,
-	0x30a0,
-	0x30a4,
-	0x30a8,
-	0x30ab,
-	0x30ac,
-	0x30ae,
-	0x30b0,
-	0x30b2,
-	0x30b4,
-	0x30b6,
-	0x30b8,
-	0x30ba,
-	0x30bc,
-	0x30be,
-	0x30bf,
-	0x30c0,
-	0x30c2,
-	0x30c5,
-	0x30c7,
-	0x30c8,
-	0x30c9,
-	0x30cb,
-	0x30ce,
-	0x30cf,
-	0x30d0,
-	0x30d1,
-	0x30d3,
-	0x30d4,
-	0x30d6,
-	0x30d7,
-	0x30d8,
-	0x30d9,
-	0x30da,
-	0x30dc,
-	0x30dd,
-	0x30ed,
-	0x30f4,
-	0x30f7,
-	0x30f8,
-	0x30f9,
-	0x30fa,
-	0x30fb,
-	0x30fe,
-	0x3131,
-	0x3132,
-	0x3133,
-	0x3134,
-	0x3135,
-	0x3136,
-	0x3137,
-	0x3138,
-	0x3139,
-	0x313a,
-	0x313b,
-	0x313c,
-	0x313d,
-	0x313e,
-	0x313f,
-	0x3140,
-	0x3141,
-	0x3142,
-	0x3143,
-	0x3144,
-	0x3145,
-	0x3146,
-	0x3147,
-	0x3148,
-	0x3149,
-	0x314a,
-	0x314b,
-	0x314c,
-	0x314d,
-	0x314e,
-	0x314f,
-	0x3150,
-	0x3151,
-	0x3152,
-	0x3153,
-	0x3154,
-	0x3155,
-	0x3156,
-	0x3157,
-	0x3158,
-	0x3159,
-	0x315a,
-	0x315b,
-	0x315c,
-	0x315d,
-	0x315e,
-	0x315f,
-	0x3160,
-	0x3161,
-	0x3162,
-	0x3163,
-	0x3164,
-	0x3165,
-	0x3166,
-	0x3167,
-	0x3168,
-	0x3169,
-	0x316a,
-	0x316b,
-	0x316c,
-	0x316d,
-	0x316e,
-	0x316f,
-	0x3170,
-	0x3171,
-	0x3172,
-	0x3173,
-	0x3174,
-	0x3175,
-	0x3176,
-	0x3177,
-	0x3178,
-	0x3179,
-	0x317a,
-	0x317b,
-	0x317c,
-	0x317d,
-	0x317e,
-	0x317f,
-	0x3180,
-	0x3181,
-	0x3182,
-	0x3183,
-	0x3184,
-	0x3185,
-	0x3186,
-	0x3187,
-	0x3188,
-	0x3189,
-	0x318a,
-	0x318b,
-	0x318c,
-	0x318d,
-	0x318e,
-	0x31d0,
-	0x31d1,
-	0x31d3,
-	0x31d4,
-	0x31d6,
-	0x31da,
-	0x31db,
-	0x31df,
-	0x31e0,
-	0x3200,
-	0x3201,
-	0x3202,
-	0x3203,
-	0x3204,
-	0x3205,
-	0x3206,
-	0x3207,
-	0x3208,
-	0x3209,
-	0x320a,
-	0x320b,
-	0x320c,
-	0x320d,
-	0x320e,
-	0x320f,
-	0x3210,
-	0x3211,
-	0x3212,
-	0x3213,
-	0x3214,
-	0x3215,
-	0x3216,
-	0x3217,
-	0x3218,
-	0x3219,
-	0x321a,
-	0x321b,
-	0x321c,
-	0x321d,
-	0x321e,
-	0x3220,
-	0x3221,
-	0x3222,
-	0x3223,
-	0x3224,
-	0x3225,
-	0x3226,
-	0x3227,
-	0x3228,
-	0x3229,
-	0x322a,
-	0x322b,
-	0x322c,
-	0x322d,
-	0x322e,
-	0x322f,
-	0x3230,
-	0x3231,
-	0x3232,
-	0x3233,
-	0x3234,
-	0x3235,
-	0x3236,
-	0x3237,
-	0x3238,
-	0x3239,
-	0x323a,
-	0x323b,
-	0x323c,
-	0x323d,
-	0x323e,
-	0x323f,
-	0x3240,
-	0x3241,
-	0x3242,
-	0x3243,
-	0x32c0,
-	0x32c1,
-	0x32c2,
-	0x32c3,
-	0x32c4,
-	0x32c5,
-	0x32c6,
-	0x32c7,
-	0x32c8,
-	0x32c9,
-	0x32ca,
-	0x32cb,
-	0x3358,
-	0x3359,
-	0x335a,
-	0x335b,
-	0x335c,
-	0x335d,
-	0x335e,
-	0x335f,
-	0x3360,
-	0x3361,
-	0x3362,
-	0x3363,
-	0x3364,
-	0x3365,
-	0x3366,
-	0x3367,
-	0x3368,
-	0x3369,
-	0x336a,
-	0x336b,
-	0x336c,
-	0x336d,
-	0x336e,
-	0x336f,
-	0x3370,
-	0x33e0,
-	0x33e1,
-	0x33e2,
-	0x33e3,
-	0x33e4,
-	0x33e5,
-	0x33e6,
-	0x33e7,
-	0x33e8,
-	0x33e9,
-	0x33ea,
-	0x33eb,
-	0x33ec,
-	0x33ed,
-	0x33ee,
-	0x33ef,
-	0x33f0,
-	0x33f1,
-	0x33f2,
-	0x33f3,
-	0x33f4,
-	0x33f5,
-	0x33f6,
-	0x33f7,
-	0x33f8,
-	0x33f9,
-	0x33fa,
-	0x33fb,
-	0x33fc,
-	0x33fd,
-	0x33fe,
-	0x39b3,
-	0x439b,
-	0x4420,
-	0x4e00,
-	0x4e36,
-	0x4e3f,
-	0x5002,
-	0x503c,
-	0x555f,
-	0x56d7,
-	0x586b,
-	0x58eb,
-	0x58ff,
-	0x5b00,
-	0x5e32,
-	0x5e50,
-	0x6238,
-	0x6409,
-	0x6663,
-	0x6669,
-	0x66f6,
-	0x6726,
-	0x67ff,
-	0x69e9,
-	0x6a27,
-	0x6f59,
-	0x784f,
-	0x7d76,
-	0x80a6,
-	0x80ca,
-	0x80d0,
-	0x80f6,
-	0x8101,
-	0x8127,
-	0x8141,
-	0x81a7,
-	0x853f,
-	0x8641,
-	0x8a1e,
-	0x8a7d,
-	0x8b8f,
-	0x8c63,
-	0x8d86,
-	0x8dfa,
-	0x8e9b,
-	0x8f27,
-	0x90de,
-	0x93ae,
-	0x96b8,
-	0x9e43,
-	0x9ed2,
-	0x9fc3,
-	0xa494,
-	0xa49c,
-	0xa49e,
-	0xa4a7,
-	0xa4a8,
-	0xa4ac,
-	0xa4b0,
-	0xa4ba,
-	0xa4be,
-	0xa4bf,
-	0xa4c0,
-	0xa4c2,
-	0xa4d0,
-	0xa4d1,
-	0xa4d2,
-	0xa4d3,
-	0xa4d4,
-	0xa4d6,
-	0xa4d7,
-	0xa4d9,
-	0xa4da,
-	0xa4db,
-	0xa4dc,
-	0xa4dd,
-	0xa4de,
-	0xa4df,
-	0xa4e0,
-	0xa4e1,
-	0xa4e2,
-	0xa4e3,
-	0xa4e5,
-	0xa4e6,
-	0xa4e7,
-	0xa4ea,
-	0xa4eb,
-	0xa4ec,
-	0xa4ed,
-	0xa4ee,
-	0xa4ef,
-	0xa4f0,
-	0xa4f1,
-	0xa4f2,
-	0xa4f3,
-	0xa4f4,
-	0xa4f5,
-	0xa4f7,
-	0xa4f8,
-	0xa4f9,
-	0xa4fa,
-	0xa4fb,
-	0xa4fd,
-	0xa4fe,
-	0xa4ff,
-	0xa60e,
-	0xa644,
-	0xa645,
-	0xa647,
-	0xa64d,
-	0xa650,
-	0xa651,
-	0xa668,
-	0xa66f,
-	0xa670,
-	0xa671,
-	0xa672,
-	0xa674,
-	0xa675,
-	0xa676,
-	0xa677,
-	0xa678,
-	0xa679,
-	0xa67a,
-	0xa67b,
-	0xa67c,
-	0xa67d,
-	0xa67e,
-	0xa695,
-	0xa698,
-	0xa699,
-	0xa69a,
-	0xa69e,
-	0xa69f,
-	0xa6a1,
-	0xa6b0,
-	0xa6b1,
-	0xa6cd,
-	0xa6ce,
-	0xa6db,
-	0xa6df,
-	0xa6eb,
-	0xa6ef,
-	0xa6f0,
-	0xa6f1,
-	0xa6f4,
-	0xa714,
-	0xa716,
-	0xa728,
-	0xa729,
-	0xa731,
-	0xa732,
-	0xa733,
-	0xa734,
-	0xa735,
-	0xa736,
-	0xa737,
-	0xa738,
-	0xa739,
-	0xa73a,
-	0xa73b,
-	0xa73c,
-	0xa73d,
-	0xa740,
-	0xa74a,
-	0xa74b,
-	0xa74e,
-	0xa74f,
-	0xa75a,
-	0xa761,
-	0xa76a,
-	0xa76b,
-	0xa76e,
-	0xa777,
-	0xa778,
-	0xa77a,
-	0xa789,
-	0xa78c,
-	0xa78f,
-	0xa795,
-	0xa798,
-	0xa799,
-	0xa79a,
-	0xa79b,
-	0xa79d,
-	0xa79e,
-	0xa79f,
-	0xa7ab,
-	0xa7b1,
-	0xa7b2,
-	0xa7b3,
-	0xa7b4,
-	0xa7b5,
-	0xa7b6,
-	0xa7b7,
-	0xa7f7,
-	0xa802,
-	0xa806,
-	0xa80b,
-	0xa823,
-	0xa824,
-	0xa825,
-	0xa826,
-	0xa827,
-	0xa830,
-	0xa880,
-	0xa881,
-	0xa8b4,
-	0xa8b5,
-	0xa8b6,
-	0xa8b7,
-	0xa8b8,
-	0xa8b9,
-	0xa8ba,
-	0xa8bb,
-	0xa8bc,
-	0xa8bd,
-	0xa8be,
-	0xa8bf,
-	0xa8c0,
-	0xa8c1,
-	0xa8c2,
-	0xa8c3,
-	0xa8c4,
-	0xa8c5,
-	0xa8e0,
-	0xa8e1,
-	0xa8e2,
-	0xa8e3,
-	0xa8e4,
-	0xa8e5,
-	0xa8e6,
-	0xa8e7,
-	0xa8e8,
-	0xa8e9,
-	0xa8ea,
-	0xa8eb,
-	0xa8ec,
-	0xa8ed,
-	0xa8ee,
-	0xa8ef,
-	0xa8f0,
-	0xa8f1,
-	0xa8ff,
-	0xa926,
-	0xa927,
-	0xa928,
-	0xa929,
-	0xa92a,
-	0xa92b,
-	0xa92c,
-	0xa92d,
-	0xa947,
-	0xa948,
-	0xa949,
-	0xa94a,
-	0xa94b,
-	0xa94c,
-	0xa94d,
-	0xa94e,
-	0xa94f,
-	0xa950,
-	0xa951,
-	0xa952,
-	0xa953,
-	0xa960,
-	0xa961,
-	0xa962,
-	0xa963,
-	0xa964,
-	0xa965,
-	0xa966,
-	0xa967,
-	0xa968,
-	0xa969,
-	0xa96a,
-	0xa96b,
-	0xa96c,
-	0xa96d,
-	0xa96e,
-	0xa96f,
-	0xa970,
-	0xa971,
-	0xa972,
-	0xa973,
-	0xa974,
-	0xa975,
-	0xa976,
-	0xa977,
-	0xa978,
-	0xa979,
-	0xa97a,
-	0xa97b,
-	0xa97c,
-	0xa980,
-	0xa981,
-	0xa982,
-	0xa983,
-	0xa992,
-	0xa9a3,
-	0xa9b3,
-	0xa9b4,
-	0xa9b5,
-	0xa9b6,
-	0xa9b7,
-	0xa9b8,
-	0xa9b9,
-	0xa9ba,
-	0xa9bb,
-	0xa9bc,
-	0xa9bd,
-	0xa9be,
-	0xa9bf,
-	0xa9c0,
-	0xa9c6,
-	0xa9cf,
-	0xa9e5,
-	0xaa29,
-	0xaa2a,
-	0xaa2b,
-	0xaa2c,
-	0xaa2d,
-	0xaa2e,
-	0xaa2f,
-	0xaa30,
-	0xaa31,
-	0xaa32,
-	0xaa33,
-	0xaa34,
-	0xaa35,
-	0xaa36,
-	0xaa43,
-	0xaa4c,
-	0xaa4d,
-	0xaa53,
-	0xaa56,
-	0xaa7b,
-	0xaa7c,
-	0xaa7d,
-	0xaab0,
-	0xaab2,
-	0xaab3,
-	0xaab4,
-	0xaab7,
-	0xaab8,
-	0xaabe,
-	0xaabf,
-	0xaac1,
-	0xaaeb,
-	0xaaec,
-	0xaaed,
-	0xaaee,
-	0xaaef,
-	0xaaf5,
-	0xaaf6,
-	0xab32,
-	0xab35,
-	0xab3d,
-	0xab3e,
-	0xab3f,
-	0xab41,
-	0xab42,
-	0xab47,
-	0xab48,
-	0xab4d,
-	0xab4e,
-	0xab52,
-	0xab53,
-	0xab55,
-	0xab5a,
-	0xab60,
-	0xab62,
-	0xab63,
-	0xab70,
-	0xab71,
-	0xab72,
-	0xab74,
-	0xab75,
-	0xab7a,
-	0xab7b,
-	0xab7c,
-	0xab7e,
-	0xab80,
-	0xab81,
-	0xab83,
-	0xab87,
-	0xab8b,
-	0xab8e,
-	0xab90,
-	0xab93,
-	0xab9b,
-	0xab9c,
-	0xab9f,
-	0xaba2,
-	0xaba9,
-	0xabaa,
-	0xabae,
-	0xabaf,
-	0xabb2,
-	0xabb6,
-	0xabbb,
-	0xabe3,
-	0xabe4,
-	0xabe5,
-	0xabe6,
-	0xabe7,
-	0xabe8,
-	0xabe9,
-	0xabea,
-	0xabec,
-	0xabed,
-	0xd7b0,
-	0xd7b1,
-	0xd7b2,
-	0xd7b3,
-	0xd7b4,
-	0xd7b5,
-	0xd7b6,
-	0xd7b7,
-	0xd7b8,
-	0xd7b9,
-	0xd7ba,
-	0xd7bb,
-	0xd7bc,
-	0xd7bd,
-	0xd7be,
-	0xd7bf,
-	0xd7c0,
-	0xd7c1,
-	0xd7c2,
-	0xd7c3,
-	0xd7c4,
-	0xd7c5,
-	0xd7c6,
-	0xd7cb,
-	0xd7cc,
-	0xd7cd,
-	0xd7ce,
-	0xd7cf,
-	0xd7d0,
-	0xd7d1,
-	0xd7d2,
-	0xd7d3,
-	0xd7d4,
-	0xd7d5,
-	0xd7d6,
-	0xd7d7,
-	0xd7d8,
-	0xd7d9,
-	0xd7da,
-	0xd7db,
-	0xd7dc,
-	0xd7dd,
-	0xd7de,
-	0xd7df,
-	0xd7e0,
-	0xd7e1,
-	0xd7e2,
-	0xd7e3,
-	0xd7e4,
-	0xd7e5,
-	0xd7e6,
-	0xd7e7,
-	0xd7e8,
-	0xd7e9,
-	0xd7ea,
-	0xd7eb,
-	0xd7ec,
-	0xd7ed,
-	0xd7ee,
-	0xd7ef,
-	0xd7f0,
-	0xd7f1,
-	0xd7f2,
-	0xd7f3,
-	0xd7f4,
-	0xd7f5,
-	0xd7f6,
-	0xd7f7,
-	0xd7f8,
-	0xd7f9,
-	0xd7fa,
-	0xd7fb,
-	0xd800,
-	0xdb7f,
-	0xdb80,
-	0xdbff,
-	0xdc00,
-	0xdfff,
-	0xe000,
-	0xf8ff,
-	0xf900,
-	0xf901,
-	0xf902,
-	0xf903,
-	0xf904,
-	0xf905,
-	0xf906,
-	0xf907,
-	0xf908,
-	0xf909,
-	0xf90a,
-	0xf90b,
-	0xf90c,
-	0xf90d,
-	0xf90e,
-	0xf90f,
-	0xf910,
-	0xf911,
-	0xf912,
-	0xf913,
-	0xf914,
-	0xf915,
-	0xf916,
-	0xf917,
-	0xf918,
-	0xf919,
-	0xf91a,
-	0xf91b,
-	0xf91c,
-	0xf91d,
-	0xf91e,
-	0xf91f,
-	0xf920,
-	0xf921,
-	0xf922,
-	0xf923,
-	0xf924,
-	0xf925,
-	0xf926,
-	0xf927,
-	0xf928,
-	0xf929,
-	0xf92a,
-	0xf92b,
-	0xf92c,
-	0xf92d,
-	0xf92e,
-	0xf92f,
-	0xf930,
-	0xf931,
-	0xf932,
-	0xf933,
-	0xf934,
-	0xf935,
-	0xf936,
-	0xf937,
-	0xf938,
-	0xf939,
-	0xf93a,
-	0xf93b,
-	0xf93c,
-	0xf93d,
-	0xf93e,
-	0xf93f,
-	0xf940,
-	0xf941,
-	0xf942,
-	0xf943,
-	0xf944,
-	0xf945,
-	0xf946,
-	0xf947,
-	0xf948,
-	0xf949,
-	0xf94a,
-	0xf94b,
-	0xf94c,
-	0xf94d,
-	0xf94e,
-	0xf94f,
-	0xf950,
-	0xf951,
-	0xf952,
-	0xf953,
-	0xf954,
-	0xf955,
-	0xf956,
-	0xf957,
-	0xf958,
-	0xf959,
-	0xf95a,
-	0xf95b,
-	0xf95c,
-	0xf95d,
-	0xf95e,
-	0xf95f,
-	0xf960,
-	0xf961,
-	0xf962,
-	0xf963,
-	0xf964,
-	0xf965,
-	0xf966,
-	0xf967,
-	0xf968,
-	0xf969,
-	0xf96a,
-	0xf96b,
-	0xf96c,
-	0xf96d,
-	0xf96e,
-	0xf96f,
-	0xf970,
-	0xf971,
-	0xf972,
-	0xf973,
-	0xf974,
-	0xf975,
-	0xf976,
-	0xf977,
-	0xf978,
-	0xf979,
-	0xf97a,
-	0xf97b,
-	0xf97c,
-	0xf97d,
-	0xf97e,
-	0xf97f,
-	0xf980,
-	0xf981,
-	0xf982,
-	0xf983,
-	0xf984,
-	0xf985,
-	0xf986,
-	0xf987,
-	0xf988,
-	0xf989,
-	0xf98a,
-	0xf98b,
-	0xf98c,
-	0xf98d,
-	0xf98e,
-	0xf98f,
-	0xf990,
-	0xf991,
-	0xf992,
-	0xf993,
-	0xf994,
-	0xf995,
-	0xf996,
-	0xf997,
-	0xf998,
-	0xf999,
-	0xf99a,
-	0xf99b,
-	0xf99c,
-	0xf99d,
-	0xf99e,
-	0xf99f,
-	0xf9a0,
-	0xf9a1,
-	0xf9a2,
-	0xf9a3,
-	0xf9a4,
-	0xf9a5,
-	0xf9a6,
-	0xf9a7,
-	0xf9a8,
-	0xf9a9,
-	0xf9aa,
-	0xf9ab,
-	0xf9ac,
-	0xf9ad,
-	0xf9ae,
-	0xf9af,
-	0xf9b0,
-	0xf9b1,
-	0xf9b2,
-	0xf9b3,
-	0xf9b4,
-	0xf9b5,
-	0xf9b6,
-	0xf9b7,
-	0xf9b8,
-	0xf9b9,
-	0xf9ba,
-	0xf9bb,
-	0xf9bc,
-	0xf9bd,
-	0xf9be,
-	0xf9bf,
-	0xf9c0,
-	0xf9c1,
-	0xf9c2,
-	0xf9c3,
-	0xf9c4,
-	0xf9c5,
-	0xf9c6,
-	0xf9c7,
-	0xf9c8,
-	0xf9c9,
-	0xf9ca,
-	0xf9cb,
-	0xf9cc,
-	0xf9cd,
-	0xf9ce,
-	0xf9cf,
-	0xf9d0,
-	0xf9d1,
-	0xf9d2,
-	0xf9d3,
-	0xf9d4,
-	0xf9d5,
-	0xf9d6,
-	0xf9d7,
-	0xf9d8,
-	0xf9d9,
-	0xf9da,
-	0xf9db,
-	0xf9dc,
-	0xf9dd,
-	0xf9de,
-	0xf9df,
-	0xf9e0,
-	0xf9e1,
-	0xf9e2,
-	0xf9e3,
-	0xf9e4,
-	0xf9e5,
-	0xf9e6,
-	0xf9e7,
-	0xf9e8,
-	0xf9e9,
-	0xf9ea,
-	0xf9eb,
-	0xf9ec,
-	0xf9ed,
-	0xf9ee,
-	0xf9ef,
-	0xf9f0,
-	0xf9f1,
-	0xf9f2,
-	0xf9f3,
-	0xf9f4,
-	0xf9f5,
-	0xf9f6,
-	0xf9f7,
-	0xf9f8,
-	0xf9f9,
-	0xf9fa,
-	0xf9fb,
-	0xf9fc,
-	0xf9fd,
-	0xf9fe,
-	0xf9ff,
-	0xfa00,
-	0xfa01,
-	0xfa02,
-	0xfa03,
-	0xfa04,
-	0xfa05,
-	0xfa06,
-	0xfa07,
-	0xfa08,
-	0xfa09,
-	0xfa0a,
-	0xfa0b,
-	0xfa0c,
-	0xfa0d,
-	0xfa10,
-	0xfa12,
-	0xfa15,
-	0xfa16,
-	0xfa17,
-	0xfa18,
-	0xfa19,
-	0xfa1a,
-	0xfa1b,
-	0xfa1c,
-	0xfa1d,
-	0xfa1e,
-	0xfa20,
-	0xfa22,
-	0xfa25,
-	0xfa26,
-	0xfa2a,
-	0xfa2b,
-	0xfa2c,
-	0xfa2d,
-	0xfa2e,
-	0xfa2f,
-	0xfa30,
-	0xfa31,
-	0xfa32,
-	0xfa33,
-	0xfa34,
-	0xfa35,
-	0xfa36,
-	0xfa37,
-	0xfa38,
-	0xfa39,
-	0xfa3a,
-	0xfa3b,
-	0xfa3c,
-	0xfa3d,
-	0xfa3e,
-	0xfa3f,
-	0xfa40,
-	0xfa41,
-	0xfa42,
-	0xfa43,
-	0xfa44,
-	0xfa45,
-	0xfa46,
-	0xfa47,
-	0xfa48,
-	0xfa49,
-	0xfa4a,
-	0xfa4b,
-	0xfa4c,
-	0xfa4d,
-	0xfa4e,
-	0xfa4f,
-	0xfa50,
-	0xfa51,
-	0xfa52,
-	0xfa53,
-	0xfa54,
-	0xfa55,
-	0xfa56,
-	0xfa57,
-	0xfa58,
-	0xfa59,
-	0xfa5a,
-	0xfa5b,
-	0xfa5c,
-	0xfa5d,
-	0xfa5e,
-	0xfa5f,
-	0xfa60,
-	0xfa61,
-	0xfa62,
-	0xfa63,
-	0xfa64,
-	0xfa65,
-	0xfa66,
-	0xfa67,
-	0xfa68,
-	0xfa69,
-	0xfa6a,
-	0xfa6b,
-	0xfa6c,
-	0xfa6d,
-	0xfa70,
-	0xfa71,
-	0xfa72,
-	0xfa73,
-	0xfa74,
-	0xfa75,
-	0xfa76,
-	0xfa77,
-	0xfa78,
-	0xfa79,
-	0xfa7a,
-	0xfa7b,
-	0xfa7c,
-	0xfa7d,
-	0xfa7e,
-	0xfa7f,
-	0xfa80,
-	0xfa81,
-	0xfa82,
-	0xfa83,
-	0xfa84,
-	0xfa85,
-	0xfa86,
-	0xfa87,
-	0xfa88,
-	0xfa89,
-	0xfa8a,
-	0xfa8b,
-	0xfa8c,
-	0xfa8d,
-	0xfa8e,
-	0xfa8f,
-	0xfa90,
-	0xfa91,
-	0xfa92,
-	0xfa93,
-	0xfa94,
-	0xfa95,
-	0xfa96,
-	0xfa97,
-	0xfa98,
-	0xfa99,
-	0xfa9a,
-	0xfa9b,
-	0xfa9c,
-	0xfa9d,
-	0xfa9e,
-	0xfa9f,
-	0xfaa0,
-	0xfaa1,
-	0xfaa2,
-	0xfaa3,
-	0xfaa4,
-	0xfaa5,
-	0xfaa6,
-	0xfaa7,
-	0xfaa8,
-	0xfaa9,
-	0xfaaa,
-	0xfaab,
-	0xfaac,
-	0xfaad,
-	0xfaae,
-	0xfaaf,
-	0xfab0,
-	0xfab1,
-	0xfab2,
-	0xfab3,
-	0xfab4,
-	0xfab5,
-	0xfab6,
-	0xfab7,
-	0xfab8,
-	0xfab9,
-	0xfaba,
-	0xfabb,
-	0xfabc,
-	0xfabd,
-	0xfabe,
-	0xfabf,
-	0xfac0,
-	0xfac1,
-	0xfac2,
-	0xfac3,
-	0xfac4,
-	0xfac5,
-	0xfac6,
-	0xfac7,
-	0xfac8,
-	0xfac9,
-	0xfaca,
-	0xfacb,
-	0xfacc,
-	0xfacd,
-	0xface,
-	0xfacf,
-	0xfad0,
-	0xfad1,
-	0xfad2,
-	0xfad3,
-	0xfad4,
-	0xfad5,
-	0xfad6,
-	0xfad7,
-	0xfad8,
-	0xfad9,
-	0xfb00,
-	0xfb01,
-	0xfb02,
-	0xfb03,
-	0xfb04,
-	0xfb06,
-	0xfb13,
-	0xfb14,
-	0xfb15,
-	0xfb16,
-	0xfb17,
-	0xfb1d,
-	0xfb1e,
-	0xfb1f,
-	0xfb20,
-	0xfb21,
-	0xfb22,
-	0xfb23,
-	0xfb24,
-	0xfb25,
-	0xfb26,
-	0xfb27,
-	0xfb28,
-	0xfb29,
-	0xfb2a,
-	0xfb2b,
-	0xfb2c,
-	0xfb2d,
-	0xfb2e,
-	0xfb2f,
-	0xfb30,
-	0xfb31,
-	0xfb32,
-	0xfb33,
-	0xfb34,
-	0xfb35,
-	0xfb36,
-	0xfb38,
-	0xfb39,
-	0xfb3a,
-	0xfb3b,
-	0xfb3c,
-	0xfb3e,
-	0xfb40,
-	0xfb41,
-	0xfb43,
-	0xfb44,
-	0xfb46,
-	0xfb47,
-	0xfb48,
-	0xfb49,
-	0xfb4a,
-	0xfb4b,
-	0xfb4c,
-	0xfb4d,
-	0xfb4e,
-	0xfb4f,
-	0xfb50,
-	0xfb51,
-	0xfb52,
-	0xfb53,
-	0xfb54,
-	0xfb55,
-	0xfb56,
-	0xfb57,
-	0xfb58,
-	0xfb59,
-	0xfb5a,
-	0xfb5b,
-	0xfb5c,
-	0xfb5d,
-	0xfb5e,
-	0xfb5f,
-	0xfb60,
-	0xfb61,
-	0xfb62,
-	0xfb63,
-	0xfb64,
-	0xfb65,
-	0xfb66,
-	0xfb67,
-	0xfb68,
-	0xfb69,
-	0xfb6a,
-	0xfb6b,
-	0xfb6c,
-	0xfb6d,
-	0xfb6e,
-	0xfb6f,
-	0xfb70,
-	0xfb71,
-	0xfb72,
-	0xfb73,
-	0xfb74,
-	0xfb75,
-	0xfb76,
-	0xfb77,
-	0xfb78,
-	0xfb79,
-	0xfb7a,
-	0xfb7b,
-	0xfb7c,
-	0xfb7d,
-	0xfb7e,
-	0xfb7f,
-	0xfb80,
-	0xfb81,
-	0xfb82,
-	0xfb83,
-	0xfb84,
-	0xfb85,
-	0xfb86,
-	0xfb87,
-	0xfb88,
-	0xfb89,
-	0xfb8a,
-	0xfb8b,
-	0xfb8c,
-	0xfb8d,
-	0xfb8e,
-	0xfb8f,
-	0xfb90,
-	0xfb91,
-	0xfb92,
-	0xfb93,
-	0xfb94,
-	0xfb95,
-	0xfb96,
-	0xfb97,
-	0xfb98,
-	0xfb99,
-	0xfb9a,
-	0xfb9b,
-	0xfb9c,
-	0xfb9d,
-	0xfb9e,
-	0xfb9f,
-	0xfba0,
-	0xfba1,
-	0xfba2,
-	0xfba3,
-	0xfba4,
-	0xfba5,
-	0xfba6,
-	0xfba7,
-	0xfba8,
-	0xfba9,
-	0xfbaa,
-	0xfbab,
-	0xfbac,
-	0xfbad,
-	0xfbae,
-	0xfbaf,
-	0xfbb0,
-	0xfbb1,
-	0xfbd3,
-	0xfbd4,
-	0xfbd5,
-	0xfbd6,
-	0xfbd7,
-	0xfbd8,
-	0xfbd9,
-	0xfbda,
-	0xfbdb,
-	0xfbdc,
-	0xfbdd,
-	0xfbde,
-	0xfbdf,
-	0xfbe0,
-	0xfbe1,
-	0xfbe2,
-	0xfbe3,
-	0xfbe4,
-	0xfbe5,
-	0xfbe6,
-	0xfbe7,
-	0xfbe8,
-	0xfbe9,
-	0xfbea,
-	0xfbeb,
-	0xfbec,
-	0xfbed,
-	0xfbee,
-	0xfbef,
-	0xfbf0,
-	0xfbf1,
-	0xfbf2,
-	0xfbf3,
-	0xfbf4,
-	0xfbf5,
-	0xfbf6,
-	0xfbf7,
-	0xfbf8,
-	0xfbf9,
-	0xfbfa,
-	0xfbfb,
-	0xfbfc,
-	0xfbfd,
-	0xfbfe,
-	0xfbff,
-	0xfc00,
-	0xfc01,
-	0xfc02,
-	0xfc03,
-	0xfc04,
-	0xfc05,
-	0xfc06,
-	0xfc07,
-	0xfc08,
-	0xfc09,
-	0xfc0a,
-	0xfc0b,
-	0xfc0c,
-	0xfc0d,
-	0xfc0e,
-	0xfc0f,
-	0xfc10,
-	0xfc11,
-	0xfc12,
-	0xfc13,
-	0xfc14,
-	0xfc15,
-	0xfc16,
-	0xfc17,
-	0xfc18,
-	0xfc19,
-	0xfc1a,
-	0xfc1b,
-	0xfc1c,
-	0xfc1d,
-	0xfc1e,
-	0xfc1f,
-	0xfc20,
-	0xfc21,
-	0xfc22,
-	0xfc23,
-	0xfc24,
-	0xfc25,
-	0xfc26,
-	0xfc27,
-	0xfc28,
-	0xfc29,
-	0xfc2a,
-	0xfc2b,
-	0xfc2c,
-	0xfc2d,
-	0xfc2e,
-	0xfc2f,
-	0xfc30,
-	0xfc31,
-	0xfc32,
-	0xfc33,
-	0xfc34,
-	0xfc35,
-	0xfc36,
-	0xfc37,
-	0xfc38,
-	0xfc39,
-	0xfc3a,
-	0xfc3b,
-	0xfc3c,
-	0xfc3d,
-	0xfc3e,
-	0xfc3f,
-	0xfc40,
-	0xfc41,
-	0xfc42,
-	0xfc43,
-	0xfc44,
-	0xfc45,
-	0xfc46,
-	0xfc47,
-	0xfc48,
-	0xfc49,
-	0xfc4a,
-	0xfc4b,
-	0xfc4c,
-	0xfc4d,
-	0xfc4e,
-	0xfc4f,
-	0xfc50,
-	0xfc51,
-	0xfc52,
-	0xfc53,
-	0xfc54,
-	0xfc55,
-	0xfc56,
-	0xfc57,
-	0xfc58,
-	0xfc59,
-	0xfc5a,
-	0xfc5b,
-	0xfc5c,
-	0xfc5d,
-	0xfc5e,
-	0xfc5f,
-	0xfc60,
-	0xfc61,
-	0xfc62,
-	0xfc63,
-	0xfc64,
-	0xfc65,
-	0xfc66,
-	0xfc67,
-	0xfc68,
-	0xfc69,
-	0xfc6a,
-	0xfc6b,
-	0xfc6c,
-	0xfc6d,
-	0xfc6e,
-	0xfc6f,
-	0xfc70,
-	0xfc71,
-	0xfc72,
-	0xfc73,
-	0xfc74,
-	0xfc75,
-	0xfc76,
-	0xfc77,
-	0xfc78,
-	0xfc79,
-	0xfc7a,
-	0xfc7b,
-	0xfc7c,
-	0xfc7d,
-	0xfc7e,
-	0xfc7f,
-	0xfc80,
-	0xfc81,
-	0xfc82,
-	0xfc83,
-	0xfc84,
-	0xfc85,
-	0xfc86,
-	0xfc87,
-	0xfc88,
-	0xfc89,
-	0xfc8a,
-	0xfc8b,
-	0xfc8c,
-	0xfc8d,
-	0xfc8e,
-	0xfc8f,
-	0xfc90,
-	0xfc91,
-	0xfc92,
-	0xfc93,
-	0xfc94,
-	0xfc95,
-	0xfc96,
-	0xfc97,
-	0xfc98,
-	0xfc99,
-	0xfc9a,
-	0xfc9b,
-	0xfc9c,
-	0xfc9d,
-	0xfc9e,
-	0xfc9f,
-	0xfca0,
-	0xfca1,
-	0xfca2,
-	0xfca3,
-	0xfca4,
-	0xfca5,
-	0xfca6,
-	0xfca7,
-	0xfca8,
-	0xfca9,
-	0xfcaa,
-	0xfcab,
-	0xfcac,
-	0xfcad,
-	0xfcae,
-	0xfcaf,
-	0xfcb0,
-	0xfcb1,
-	0xfcb2,
-	0xfcb3,
-	0xfcb4,
-	0xfcb5,
-	0xfcb6,
-	0xfcb7,
-	0xfcb8,
-	0xfcb9,
-	0xfcba,
-	0xfcbb,
-	0xfcbc,
-	0xfcbd,
-	0xfcbe,
-	0xfcbf,
-	0xfcc0,
-	0xfcc1,
-	0xfcc2,
-	0xfcc3,
-	0xfcc4,
-	0xfcc5,
-	0xfcc6,
-	0xfcc7,
-	0xfcc8,
-	0xfcc9,
-	0xfcca,
-	0xfccb,
-	0xfccc,
-	0xfccd,
-	0xfcce,
-	0xfccf,
-	0xfcd0,
-	0xfcd1,
-	0xfcd2,
-	0xfcd3,
-	0xfcd4,
-	0xfcd5,
-	0xfcd6,
-	0xfcd7,
-	0xfcd8,
-	0xfcd9,
-	0xfcda,
-	0xfcdb,
-	0xfcdc,
-	0xfcdd,
-	0xfcde,
-	0xfcdf,
-	0xfce0,
-	0xfce1,
-	0xfce2,
-	0xfce3,
-	0xfce4,
-	0xfce5,
-	0xfce6,
-	0xfce7,
-	0xfce8,
-	0xfce9,
-	0xfcea,
-	0xfceb,
-	0xfcec,
-	0xfced,
-	0xfcee,
-	0xfcef,
-	0xfcf0,
-	0xfcf1,
-	0xfcf2,
-	0xfcf3,
-	0xfcf4,
-	0xfcf5,
-	0xfcf6,
-	0xfcf7,
-	0xfcf8,
-	0xfcf9,
-	0xfcfa,
-	0xfcfb,
-	0xfcfc,
-	0xfcfd,
-	0xfcfe,
-	0xfcff,
-	0xfd00,
-	0xfd01,
-	0xfd02,
-	0xfd03,
-	0xfd04,
-	0xfd05,
-	0xfd06,
-	0xfd07,
-	0xfd08,
-	0xfd09,
-	0xfd0a,
-	0xfd0b,
-	0xfd0c,
-	0xfd0d,
-	0xfd0e,
-	0xfd0f,
-	0xfd10,
-	0xfd11,
-	0xfd12,
-	0xfd13,
-	0xfd14,
-	0xfd15,
-	0xfd16,
-	0xfd17,
-	0xfd18,
-	0xfd19,
-	0xfd1a,
-	0xfd1b,
-	0xfd1c,
-	0xfd1d,
-	0xfd1e,
-	0xfd1f,
-	0xfd20,
-	0xfd21,
-	0xfd22,
-	0xfd23,
-	0xfd24,
-	0xfd25,
-	0xfd26,
-	0xfd27,
-	0xfd28,
-	0xfd29,
-	0xfd2a,
-	0xfd2b,
-	0xfd2c,
-	0xfd2d,
-	0xfd2e,
-	0xfd2f,
-	0xfd30,
-	0xfd31,
-	0xfd32,
-	0xfd33,
-	0xfd34,
-	0xfd35,
-	0xfd36,
-	0xfd37,
-	0xfd38,
-	0xfd39,
-	0xfd3a,
-	0xfd3b,
-	0xfd3c,
-	0xfd3d,
-	0xfd3e,
-	0xfd3f,
-	0xfd50,
-	0xfd51,
-	0xfd52,
-	0xfd53,
-	0xfd54,
-	0xfd55,
-	0xfd56,
-	0xfd57,
-	0xfd58,
-	0xfd59,
-	0xfd5a,
-	0xfd5b,
-	0xfd5c,
-	0xfd5d,
-	0xfd5e,
-	0xfd5f,
-	0xfd60,
-	0xfd61,
-	0xfd62,
-	0xfd63,
-	0xfd64,
-	0xfd65,
-	0xfd66,
-	0xfd67,
-	0xfd68,
-	0xfd69,
-	0xfd6a,
-	0xfd6b,
-	0xfd6c,
-	0xfd6d,
-	0xfd6e,
-	0xfd6f,
-	0xfd70,
-	0xfd71,
-	0xfd72,
-	0xfd73,
-	0xfd74,
-	0xfd75,
-	0xfd76,
-	0xfd77,
-	0xfd78,
-	0xfd79,
-	0xfd7a,
-	0xfd7b,
-	0xfd7c,
-	0xfd7d,
-	0xfd7e,
-	0xfd7f,
-	0xfd80,
-	0xfd81,
-	0xfd82,
-	0xfd83,
-	0xfd84,
-	0xfd85,
-	0xfd86,
-	0xfd87,
-	0xfd88,
-	0xfd89,
-	0xfd8a,
-	0xfd8b,
-	0xfd8c,
-	0xfd8d,
-	0xfd8e,
-	0xfd8f,
-	0xfd92,
-	0xfd93,
-	0xfd94,
-	0xfd95,
-	0xfd96,
-	0xfd97,
-	0xfd98,
-	0xfd99,
-	0xfd9a,
-	0xfd9b,
-	0xfd9c,
-	0xfd9d,
-	0xfd9e,
-	0xfd9f,
-	0xfda0,
-	0xfda1,
-	0xfda2,
-	0xfda3,
-	0xfda4,
-	0xfda5,
-	0xfda6,
-	0xfda7,
-	0xfda8,
-	0xfda9,
-	0xfdaa,
-	0xfdab,
-	0xfdac,
-	0xfdad,
-	0xfdae,
-	0xfdaf,
-	0xfdb0,
-	0xfdb1,
-	0xfdb2,
-	0xfdb3,
-	0xfdb4,
-	0xfdb5,
-	0xfdb6,
-	0xfdb7,
-	0xfdb8,
-	0xfdb9,
-	0xfdba,
-	0xfdbb,
-	0xfdbc,
-	0xfdbd,
-	0xfdbe,
-	0xfdbf,
-	0xfdc0,
-	0xfdc1,
-	0xfdc2,
-	0xfdc3,
-	0xfdc4,
-	0xfdc5,
-	0xfdc6,
-	0xfdc7,
-	0xfdf0,
-	0xfdf1,
-	0xfdf2,
-	0xfdf3,
-	0xfdf4,
-	0xfdf5,
-	0xfdf6,
-	0xfdf7,
-	0xfdf8,
-	0xfdf9,
-	0xfdfa,
-	0xfdfb,
-	0xfdfc,
-	0xfe00,
-	0xfe01,
-	0xfe02,
-	0xfe03,
-	0xfe04,
-	0xfe05,
-	0xfe06,
-	0xfe07,
-	0xfe08,
-	0xfe09,
-	0xfe0a,
-	0xfe0b,
-	0xfe0c,
-	0xfe0d,
-	0xfe0e,
-	0xfe0f,
-	0xfe19,
-	0xfe20,
-	0xfe21,
-	0xfe22,
-	0xfe23,
-	0xfe24,
-	0xfe25,
-	0xfe26,
-	0xfe27,
-	0xfe28,
-	0xfe29,
-	0xfe2a,
-	0xfe2b,
-	0xfe2c,
-	0xfe2d,
-	0xfe2e,
-	0xfe2f,
-	0xfe30,
-	0xfe31,
-	0xfe34,
-	0xfe35,
-	0xfe36,
-	0xfe37,
-	0xfe38,
-	0xfe39,
-	0xfe3a,
-	0xfe49,
-	0xfe4a,
-	0xfe4b,
-	0xfe4c,
-	0xfe4d,
-	0xfe4e,
-	0xfe4f,
-	0xfe58,
-	0xfe68,
-	0xfe80,
-	0xfe81,
-	0xfe82,
-	0xfe83,
-	0xfe84,
-	0xfe85,
-	0xfe86,
-	0xfe87,
-	0xfe88,
-	0xfe89,
-	0xfe8a,
-	0xfe8b,
-	0xfe8c,
-	0xfe8d,
-	0xfe8e,
-	0xfe8f,
-	0xfe90,
-	0xfe91,
-	0xfe92,
-	0xfe93,
-	0xfe94,
-	0xfe95,
-	0xfe96,
-	0xfe97,
-	0xfe98,
-	0xfe99,
-	0xfe9a,
-	0xfe9b,
-	0xfe9c,
-	0xfe9d,
-	0xfe9e,
-	0xfe9f,
-	0xfea0,
-	0xfea1,
-	0xfea2,
-	0xfea3,
-	0xfea4,
-	0xfea5,
-	0xfea6,
-	0xfea7,
-	0xfea8,
-	0xfea9,
-	0xfeaa,
-	0xfeab,
-	0xfeac,
-	0xfead,
-	0xfeae,
-	0xfeaf,
-	0xfeb0,
-	0xfeb1,
-	0xfeb2,
-	0xfeb3,
-	0xfeb4,
-	0xfeb5,
-	0xfeb6,
-	0xfeb7,
-	0xfeb8,
-	0xfeb9,
-	0xfeba,
-	0xfebb,
-	0xfebc,
-	0xfebd,
-	0xfebe,
-	0xfebf,
-	0xfec0,
-	0xfec1,
-	0xfec2,
-	0xfec3,
-	0xfec4,
-	0xfec5,
-	0xfec6,
-	0xfec7,
-	0xfec8,
-	0xfec9,
-	0xfeca,
-	0xfecb,
-	0xfecc,
-	0xfecd,
-	0xfece,
-	0xfecf,
-	0xfed0,
-	0xfed1,
-	0xfed2,
-	0xfed3,
-	0xfed4,
-	0xfed5,
-	0xfed6,
-	0xfed7,
-	0xfed8,
-	0xfed9,
-	0xfeda,
-	0xfedb,
-	0xfedc,
-	0xfedd,
-	0xfede,
-	0xfedf,
-	0xfee0,
-	0xfee1,
-	0xfee2,
-	0xfee3,
-	0xfee4,
-	0xfee5,
-	0xfee6,
-	0xfee7,
-	0xfee8,
-	0xfee9,
-	0xfeea,
-	0xfeeb,
-	0xfeec,
-	0xfeed,
-	0xfeee,
-	0xfeef,
-	0xfef0,
-	0xfef1,
-	0xfef2,
-	0xfef3,
-	0xfef4,
-	0xfef5,
-	0xfef6,
-	0xfef7,
-	0xfef8,
-	0xfef9,
-	0xfefa,
-	0xfefb,
-	0xfefc,
-	0xfeff,
-	0xff01,
-	0xff02,
-	0xff07,
-	0xff0d,
-	0xff1a,
-	0xff21,
-	0xff22,
-	0xff23,
-	0xff25,
-	0xff28,
-	0xff29,
-	0xff2a,
-	0xff2b,
-	0xff2d,
-	0xff2e,
-	0xff2f,
-	0xff30,
-	0xff33,
-	0xff34,
-	0xff38,
-	0xff39,
-	0xff3a,
-	0xff3b,
-	0xff3c,
-	0xff3d,
-	0xff3e,
-	0xff40,
-	0xff41,
-	0xff43,
-	0xff45,
-	0xff47,
-	0xff48,
-	0xff49,
-	0xff4a,
-	0xff4c,
-	0xff4f,
-	0xff50,
-	0xff53,
-	0xff56,
-	0xff58,
-	0xff59,
-	0xff5c,
-	0xff5e,
-	0xff65,
-	0xffe3,
-	0xffe8,
-	0xffed,
-	0xfff9,
-	0xfffa,
-	0xfffb,
-	0xfffc,
-	0x10101,
-	0x1018e,
-	0x10196,
-	0x10197,
-	0x10198,
-	0x10199,
-	0x101a0,
-	0x101fd,
-	0x10282,
-	0x10285,
-	0x10286,
-	0x10287,
-	0x1028a,
-	0x1028d,
-	0x10290,
-	0x10292,
-	0x10294,
-	0x10295,
-	0x10296,
-	0x10297,
-	0x1029b,
-	0x102a0,
-	0x102a1,
-	0x102a2,
-	0x102a3,
-	0x102a5,
-	0x102ab,
-	0x102ad,
-	0x102b0,
-	0x102b1,
-	0x102b2,
-	0x102b3,
-	0x102b4,
-	0x102b5,
-	0x102b6,
-	0x102b8,
-	0x102cf,
-	0x102e0,
-	0x102e1,
-	0x102e4,
-	0x102e8,
-	0x102f2,
-	0x102f5,
-	0x10301,
-	0x10302,
-	0x10309,
-	0x10311,
-	0x10312,
-	0x10315,
-	0x10317,
-	0x1031a,
-	0x1031f,
-	0x10320,
-	0x10322,
-	0x10376,
-	0x10377,
-	0x10378,
-	0x10379,
-	0x1037a,
-	0x103d1,
-	0x103d3,
-	0x10401,
-	0x10404,
-	0x10411,
-	0x10415,
-	0x1041b,
-	0x1041f,
-	0x10420,
-	0x10423,
-	0x10425,
-	0x10429,
-	0x1042a,
-	0x1042c,
-	0x1043d,
-	0x1043f,
-	0x10442,
-	0x10443,
-	0x10448,
-	0x1044b,
-	0x1044d,
-	0x104a0,
-	0x104b0,
-	0x104b4,
-	0x104bc,
-	0x104c2,
-	0x104c3,
-	0x104c4,
-	0x104cd,
-	0x104ce,
-	0x104d0,
-	0x104d1,
-	0x104d2,
-	0x104d8,
-	0x104db,
-	0x104ea,
-	0x104eb,
-	0x104f6,
-	0x104f9,
-	0x10513,
-	0x10516,
-	0x10518,
-	0x1051c,
-	0x1051d,
-	0x10525,
-	0x10526,
-	0x10527,
-	0x10a01,
-	0x10a02,
-	0x10a03,
-	0x10a05,
-	0x10a06,
-	0x10a0c,
-	0x10a0d,
-	0x10a0e,
-	0x10a0f,
-	0x10a38,
-	0x10a39,
-	0x10a3a,
-	0x10a3f,
-	0x10a50,
-	0x10a57,
-	0x10ae5,
-	0x10ae6,
-	0x10cfa,
-	0x10cfc,
-	0x10d24,
-	0x10d25,
-	0x10d26,
-	0x10d27,
-	0x10f46,
-	0x10f47,
-	0x10f48,
-	0x10f49,
-	0x10f4a,
-	0x10f4b,
-	0x10f4c,
-	0x10f4d,
-	0x10f4e,
-	0x10f4f,
-	0x10f50,
-	0x11000,
-	0x11001,
-	0x11002,
-	0x11038,
-	0x11039,
-	0x1103a,
-	0x1103b,
-	0x1103c,
-	0x1103d,
-	0x1103e,
-	0x1103f,
-	0x11040,
-	0x11041,
-	0x11042,
-	0x11043,
-	0x11044,
-	0x11045,
-	0x11046,
-	0x1107f,
-	0x11080,
-	0x11081,
-	0x11082,
-	0x1109a,
-	0x1109c,
-	0x110ab,
-	0x110b0,
-	0x110b1,
-	0x110b2,
-	0x110b3,
-	0x110b4,
-	0x110b5,
-	0x110b6,
-	0x110b7,
-	0x110b8,
-	0x110b9,
-	0x110ba,
-	0x110bb,
-	0x110bd,
-	0x110cd,
-	0x11100,
-	0x11101,
-	0x11102,
-	0x11127,
-	0x11128,
-	0x11129,
-	0x1112a,
-	0x1112b,
-	0x1112c,
-	0x1112d,
-	0x1112e,
-	0x1112f,
-	0x11130,
-	0x11131,
-	0x11132,
-	0x11133,
-	0x11134,
-	0x11145,
-	0x11146,
-	0x11173,
-	0x11180,
-	0x11181,
-	0x11182,
-	0x111b3,
-	0x111b4,
-	0x111b5,
-	0x111b6,
-	0x111b7,
-	0x111b8,
-	0x111b9,
-	0x111ba,
-	0x111bb,
-	0x111bc,
-	0x111bd,
-	0x111be,
-	0x111bf,
-	0x111c0,
-	0x111c7,
-	0x111c9,
-	0x111ca,
-	0x111cb,
-	0x111cc,
-	0x111db,
-	0x111dc,
-	0x111de,
-	0x1122c,
-	0x1122d,
-	0x1122e,
-	0x1122f,
-	0x11230,
-	0x11231,
-	0x11232,
-	0x11233,
-	0x11234,
-	0x11235,
-	0x11236,
-	0x11237,
-	0x1123e,
-	0x112df,
-	0x112e0,
-	0x112e1,
-	0x112e2,
-	0x112e3,
-	0x112e4,
-	0x112e5,
-	0x112e6,
-	0x112e7,
-	0x112e8,
-	0x112e9,
-	0x112ea,
-	0x11300,
-	0x11301,
-	0x11302,
-	0x11303,
-	0x1133b,
-	0x1133c,
-	0x1133e,
-	0x1133f,
-	0x11340,
-	0x11341,
-	0x11342,
-	0x11343,
-	0x11344,
-	0x11347,
-	0x11348,
-	0x1134b,
-	0x1134c,
-	0x1134d,
-	0x11357,
-	0x11362,
-	0x11363,
-	0x11366,
-	0x11367,
-	0x11368,
-	0x11369,
-	0x1136a,
-	0x1136b,
-	0x1136c,
-	0x11370,
-	0x11371,
-	0x11372,
-	0x11373,
-	0x11374,
-	0x11413,
-	0x11419,
-	0x11424,
-	0x1142a,
-	0x1142d,
-	0x1142f,
-	0x11435,
-	0x11436,
-	0x11437,
-	0x11438,
-	0x11439,
-	0x1143a,
-	0x1143b,
-	0x1143c,
-	0x1143d,
-	0x1143e,
-	0x1143f,
-	0x11440,
-	0x11441,
-	0x11442,
-	0x11443,
-	0x11444,
-	0x11445,
-	0x11446,
-	0x1144c,
-	0x1145e,
-	0x11492,
-	0x11494,
-	0x11496,
-	0x11498,
-	0x11499,
-	0x1149b,
-	0x1149d,
-	0x1149e,
-	0x1149f,
-	0x114a0,
-	0x114a1,
-	0x114a2,
-	0x114a3,
-	0x114a7,
-	0x114a8,
-	0x114a9,
-	0x114aa,
-	0x114ab,
-	0x114ad,
-	0x114ae,
-	0x114b0,
-	0x114b1,
-	0x114b2,
-	0x114b3,
-	0x114b4,
-	0x114b5,
-	0x114b6,
-	0x114b7,
-	0x114b8,
-	0x114b9,
-	0x114ba,
-	0x114bb,
-	0x114bc,
-	0x114bd,
-	0x114be,
-	0x114bf,
-	0x114c0,
-	0x114c1,
-	0x114c2,
-	0x114c3,
-	0x114c4,
-	0x114c5,
-	0x114d0,
-	0x114d1,
-	0x114d2,
-	0x114d6,
-	0x115af,
-	0x115b0,
-	0x115b1,
-	0x115b2,
-	0x115b3,
-	0x115b4,
-	0x115b5,
-	0x115b8,
-	0x115b9,
-	0x115ba,
-	0x115bb,
-	0x115bc,
-	0x115bd,
-	0x115be,
-	0x115bf,
-	0x115c0,
-	0x115d8,
-	0x115d9,
-	0x115da,
-	0x115db,
-	0x115dc,
-	0x115dd,
-	0x11630,
-	0x11631,
-	0x11632,
-	0x11633,
-	0x11634,
-	0x11635,
-	0x11636,
-	0x11637,
-	0x11638,
-	0x11639,
-	0x1163a,
-	0x1163b,
-	0x1163c,
-	0x1163d,
-	0x1163e,
-	0x1163f,
-	0x11640,
-	0x11642,
-	0x116ab,
-	0x116ac,
-	0x116ad,
-	0x116ae,
-	0x116af,
-	0x116b0,
-	0x116b1,
-	0x116b2,
-	0x116b3,
-	0x116b4,
-	0x116b5,
-	0x116b6,
-	0x116b7,
-	0x11700,
-	0x11706,
-	0x1170a,
-	0x1170e,
-	0x1170f,
-	0x1171d,
-	0x1171e,
-	0x1171f,
-	0x11720,
-	0x11721,
-	0x11722,
-	0x11723,
-	0x11724,
-	0x11725,
-	0x11726,
-	0x11727,
-	0x11728,
-	0x11729,
-	0x1172a,
-	0x1172b,
-	0x1182c,
-	0x1182d,
-	0x1182e,
-	0x1182f,
-	0x11830,
-	0x11831,
-	0x11832,
-	0x11833,
-	0x11834,
-	0x11835,
-	0x11836,
-	0x11837,
-	0x11838,
-	0x11839,
-	0x1183a,
-	0x118a0,
-	0x118a2,
-	0x118a3,
-	0x118a4,
-	0x118a6,
-	0x118a8,
-	0x118a9,
-	0x118ac,
-	0x118ae,
-	0x118af,
-	0x118b2,
-	0x118b5,
-	0x118b7,
-	0x118b8,
-	0x118bb,
-	0x118bc,
-	0x118c0,
-	0x118c1,
-	0x118c2,
-	0x118c3,
-	0x118c4,
-	0x118c6,
-	0x118c8,
-	0x118ca,
-	0x118cc,
-	0x118ce,
-	0x118d5,
-	0x118d6,
-	0x118d7,
-	0x118d8,
-	0x118dc,
-	0x118e0,
-	0x118e3,
-	0x118e4,
-	0x118e5,
-	0x118e6,
-	0x118e9,
-	0x118ec,
-	0x118ef,
-	0x118f2,
-	0x119d1,
-	0x119d2,
-	0x119d3,
-	0x119d4,
-	0x119d5,
-	0x119d6,
-	0x119d7,
-	0x119da,
-	0x119db,
-	0x119dc,
-	0x119dd,
-	0x119de,
-	0x119df,
-	0x119e0,
-	0x119e4,
-	0x11a01,
-	0x11a02,
-	0x11a03,
-	0x11a04,
-	0x11a05,
-	0x11a06,
-	0x11a07,
-	0x11a08,
-	0x11a09,
-	0x11a0a,
-	0x11a33,
-	0x11a34,
-	0x11a35,
-	0x11a36,
-	0x11a37,
-	0x11a38,
-	0x11a39,
-	0x11a3b,
-	0x11a3c,
-	0x11a3d,
-	0x11a3e,
-	0x11a47,
-	0x11a51,
-	0x11a52,
-	0x11a53,
-	0x11a54,
-	0x11a55,
-	0x11a56,
-	0x11a57,
-	0x11a58,
-	0x11a59,
-	0x11a5a,
-	0x11a5b,
-	0x11a8a,
-	0x11a8b,
-	0x11a8c,
-	0x11a8d,
-	0x11a8e,
-	0x11a8f,
-	0x11a90,
-	0x11a91,
-	0x11a92,
-	0x11a93,
-	0x11a94,
-	0x11a95,
-	0x11a96,
-	0x11a97,
-	0x11a98,
-	0x11a99,
-	0x11ae6,
-	0x11ae7,
-	0x11ae8,
-	0x11ae9,
-	0x11aea,
-	0x11aec,
-	0x11aed,
-	0x11aee,
-	0x11af4,
-	0x11af5,
-	0x11af6,
-	0x11af7,
-	0x11af8,
-	0x11c2f,
-	0x11c30,
-	0x11c31,
-	0x11c32,
-	0x11c33,
-	0x11c34,
-	0x11c35,
-	0x11c36,
-	0x11c38,
-	0x11c39,
-	0x11c3a,
-	0x11c3b,
-	0x11c3c,
-	0x11c3d,
-	0x11c3e,
-	0x11c3f,
-	0x11c42,
-	0x11c92,
-	0x11c93,
-	0x11c94,
-	0x11c95,
-	0x11c96,
-	0x11c97,
-	0x11c98,
-	0x11c99,
-	0x11c9a,
-	0x11c9b,
-	0x11c9c,
-	0x11c9d,
-	0x11c9e,
-	0x11c9f,
-	0x11ca0,
-	0x11ca1,
-	0x11ca2,
-	0x11ca3,
-	0x11ca4,
-	0x11ca5,
-	0x11ca6,
-	0x11ca7,
-	0x11ca9,
-	0x11caa,
-	0x11cab,
-	0x11cac,
-	0x11cad,
-	0x11cae,
-	0x11caf,
-	0x11cb0,
-	0x11cb1,
-	0x11cb2,
-	0x11cb3,
-	0x11cb4,
-	0x11cb5,
-	0x11cb6,
-	0x11d31,
-	0x11d32,
-	0x11d33,
-	0x11d34,
-	0x11d35,
-	0x11d36,
-	0x11d3a,
-	0x11d3c,
-	0x11d3d,
-	0x11d3f,
-	0x11d40,
-	0x11d41,
-	0x11d42,
-	0x11d43,
-	0x11d44,
-	0x11d45,
-	0x11d47,
-	0x11d8a,
-	0x11d8b,
-	0x11d8c,
-	0x11d8d,
-	0x11d8e,
-	0x11d90,
-	0x11d91,
-	0x11d93,
-	0x11d94,
-	0x11d95,
-	0x11d96,
-	0x11d97,
-	0x11ef3,
-	0x11ef4,
-	0x11ef5,
-	0x11ef6,
-	0x12038,
-	0x132f9,
-	0x13430,
-	0x13431,
-	0x13432,
-	0x13433,
-	0x13434,
-	0x13435,
-	0x13436,
-	0x13437,
-	0x13438,
-	0x16af0,
-	0x16af1,
-	0x16af2,
-	0x16af3,
-	0x16af4,
-	0x16b30,
-	0x16b31,
-	0x16b32,
-	0x16b33,
-	0x16b34,
-	0x16b35,
-	0x16b36,
-	0x16f07,
-	0x16f08,
-	0x16f0a,
-	0x16f16,
-	0x16f1a,
-	0x16f1c,
-	0x16f26,
-	0x16f28,
-	0x16f2d,
-	0x16f35,
-	0x16f3a,
-	0x16f3b,
-	0x16f3d,
-	0x16f3f,
-	0x16f40,
-	0x16f42,
-	0x16f43,
-	0x16f4f,
-	0x16f51,
-	0x16f52,
-	0x16f53,
-	0x16f54,
-	0x16f55,
-	0x16f56,
-	0x16f57,
-	0x16f58,
-	0x16f59,
-	0x16f5a,
-	0x16f5b,
-	0x16f5c,
-	0x16f5d,
-	0x16f5e,
-	0x16f5f,
-	0x16f60,
-	0x16f61,
-	0x16f62,
-	0x16f63,
-	0x16f64,
-	0x16f65,
-	0x16f66,
-	0x16f67,
-	0x16f68,
-	0x16f69,
-	0x16f6a,
-	0x16f6b,
-	0x16f6c,
-	0x16f6d,
-	0x16f6e,
-	0x16f6f,
-	0x16f70,
-	0x16f71,
-	0x16f72,
-	0x16f73,
-	0x16f74,
-	0x16f75,
-	0x16f76,
-	0x16f77,
-	0x16f78,
-	0x16f79,
-	0x16f7a,
-	0x16f7b,
-	0x16f7c,
-	0x16f7d,
-	0x16f7e,
-	0x16f7f,
-	0x16f80,
-	0x16f81,
-	0x16f82,
-	0x16f83,
-	0x16f84,
-	0x16f85,
-	0x16f86,
-	0x16f87,
-	0x16f8f,
-	0x16f90,
-	0x16f91,
-	0x16f92,
-	0x1bc9d,
-	0x1bc9e,
-	0x1bca0,
-	0x1bca1,
-	0x1bca2,
-	0x1bca3,
-	0x1d114,
-	0x1d15e,
-	0x1d15f,
-	0x1d160,
-	0x1d161,
-	0x1d162,
-	0x1d163,
-	0x1d164,
-	0x1d165,
-	0x1d166,
-	0x1d167,
-	0x1d168,
-	0x1d169,
-	0x1d16d,
-	0x1d16e,
-	0x1d16f,
-	0x1d170,
-	0x1d171,
-	0x1d172,
-	0x1d173,
-	0x1d174,
-	0x1d175,
-	0x1d176,
-	0x1d177,
-	0x1d178,
-	0x1d179,
-	0x1d17a,
-	0x1d17b,
-	0x1d17c,
-	0x1d17d,
-	0x1d17e,
-	0x1d17f,
-	0x1d180,
-	0x1d181,
-	0x1d182,
-	0x1d185,
-	0x1d186,
-	0x1d187,
-	0x1d188,
-	0x1d189,
-	0x1d18a,
-	0x1d18b,
-	0x1d1aa,
-	0x1d1ab,
-	0x1d1ac,
-	0x1d1ad,
-	0x1d1bb,
-	0x1d1bc,
-	0x1d1bd,
-	0x1d1be,
-	0x1d1bf,
-	0x1d1c0,
-	0x1d202,
-	0x1d206,
-	0x1d20b,
-	0x1d20d,
-	0x1d20f,
-	0x1d212,
-	0x1d213,
-	0x1d214,
-	0x1d215,
-	0x1d216,
-	0x1d217,
-	0x1d21a,
-	0x1d21b,
-	0x1d21c,
-	0x1d221,
-	0x1d222,
-	0x1d22a,
-	0x1d22b,
-	0x1d230,
-	0x1d236,
-	0x1d237,
-	0x1d238,
-	0x1d239,
-	0x1d23a,
-	0x1d23b,
-	0x1d23f,
-	0x1d242,
-	0x1d243,
-	0x1d244,
-	0x1d245,
-	0x1d400,
-	0x1d401,
-	0x1d402,
-	0x1d403,
-	0x1d404,
-	0x1d405,
-	0x1d406,
-	0x1d407,
-	0x1d408,
-	0x1d409,
-	0x1d40a,
-	0x1d40b,
-	0x1d40c,
-	0x1d40d,
-	0x1d40e,
-	0x1d40f,
-	0x1d410,
-	0x1d411,
-	0x1d412,
-	0x1d413,
-	0x1d414,
-	0x1d415,
-	0x1d416,
-	0x1d417,
-	0x1d418,
-	0x1d419,
-	0x1d41a,
-	0x1d41b,
-	0x1d41c,
-	0x1d41d,
-	0x1d41e,
-	0x1d41f,
-	0x1d420,
-	0x1d421,
-	0x1d422,
-	0x1d423,
-	0x1d424,
-	0x1d425,
-	0x1d426,
-	0x1d427,
-	0x1d428,
-	0x1d429,
-	0x1d42a,
-	0x1d42b,
-	0x1d42c,
-	0x1d42d,
-	0x1d42e,
-	0x1d42f,
-	0x1d430,
-	0x1d431,
-	0x1d432,
-	0x1d433,
-	0x1d434,
-	0x1d435,
-	0x1d436,
-	0x1d437,
-	0x1d438,
-	0x1d439,
-	0x1d43a,
-	0x1d43b,
-	0x1d43c,
-	0x1d43d,
-	0x1d43e,
-	0x1d43f,
-	0x1d440,
-	0x1d441,
-	0x1d442,
-	0x1d443,
-	0x1d444,
-	0x1d445,
-	0x1d446,
-	0x1d447,
-	0x1d448,
-	0x1d449,
-	0x1d44a,
-	0x1d44b,
-	0x1d44c,
-	0x1d44d,
-	0x1d44e,
-	0x1d44f,
-	0x1d450,
-	0x1d451,
-	0x1d452,
-	0x1d453,
-	0x1d454,
-	0x1d456,
-	0x1d457,
-	0x1d458,
-	0x1d459,
-	0x1d45a,
-	0x1d45b,
-	0x1d45c,
-	0x1d45d,
-	0x1d45e,
-	0x1d45f,
-	0x1d460,
-	0x1d461,
-	0x1d462,
-	0x1d463,
-	0x1d464,
-	0x1d465,
-	0x1d466,
-	0x1d467,
-	0x1d468,
-	0x1d469,
-	0x1d46a,
-	0x1d46b,
-	0x1d46c,
-	0x1d46d,
-	0x1d46e,
-	0x1d46f,
-	0x1d470,
-	0x1d471,
-	0x1d472,
-	0x1d473,
-	0x1d474,
-	0x1d475,
-	0x1d476,
-	0x1d477,
-	0x1d478,
-	0x1d479,
-	0x1d47a,
-	0x1d47b,
-	0x1d47c,
-	0x1d47d,
-	0x1d47e,
-	0x1d47f,
-	0x1d480,
-	0x1d481,
-	0x1d482,
-	0x1d483,
-	0x1d484,
-	0x1d485,
-	0x1d486,
-	0x1d487,
-	0x1d488,
-	0x1d489,
-	0x1d48a,
-	0x1d48b,
-	0x1d48c,
-	0x1d48d,
-	0x1d48e,
-	0x1d48f,
-	0x1d490,
-	0x1d491,
-	0x1d492,
-	0x1d493,
-	0x1d494,
-	0x1d495,
-	0x1d496,
-	0x1d497,
-	0x1d498,
-	0x1d499,
-	0x1d49a,
-	0x1d49b,
-	0x1d49c,
-	0x1d49e,
-	0x1d49f,
-	0x1d4a2,
-	0x1d4a5,
-	0x1d4a6,
-	0x1d4a9,
-	0x1d4aa,
-	0x1d4ab,
-	0x1d4ac,
-	0x1d4ae,
-	0x1d4af,
-	0x1d4b0,
-	0x1d4b1,
-	0x1d4b2,
-	0x1d4b3,
-	0x1d4b4,
-	0x1d4b5,
-	0x1d4b6,
-	0x1d4b7,
-	0x1d4b8,
-	0x1d4b9,
-	0x1d4bb,
-	0x1d4bd,
-	0x1d4be,
-	0x1d4bf,
-	0x1d4c0,
-	0x1d4c1,
-	0x1d4c2,
-	0x1d4c3,
-	0x1d4c5,
-	0x1d4c6,
-	0x1d4c7,
-	0x1d4c8,
-	0x1d4c9,
-	0x1d4ca,
-	0x1d4cb,
-	0x1d4cc,
-	0x1d4cd,
-	0x1d4ce,
-	0x1d4cf,
-	0x1d4d0,
-	0x1d4d1,
-	0x1d4d2,
-	0x1d4d3,
-	0x1d4d4,
-	0x1d4d5,
-	0x1d4d6,
-	0x1d4d7,
-	0x1d4d8,
-	0x1d4d9,
-	0x1d4da,
-	0x1d4db,
-	0x1d4dc,
-	0x1d4dd,
-	0x1d4de,
-	0x1d4df,
-	0x1d4e0,
-	0x1d4e1,
-	0x1d4e2,
-	0x1d4e3,
-	0x1d4e4,
-	0x1d4e5,
-	0x1d4e6,
-	0x1d4e7,
-	0x1d4e8,
-	0x1d4e9,
-	0x1d4ea,
-	0x1d4eb,
-	0x1d4ec,
-	0x1d4ed,
-	0x1d4ee,
-	0x1d4ef,
-	0x1d4f0,
-	0x1d4f1,
-	0x1d4f2,
-	0x1d4f3,
-	0x1d4f4,
-	0x1d4f5,
-	0x1d4f6,
-	0x1d4f7,
-	0x1d4f8,
-	0x1d4f9,
-	0x1d4fa,
-	0x1d4fb,
-	0x1d4fc,
-	0x1d4fd,
-	0x1d4fe,
-	0x1d4ff,
-	0x1d500,
-	0x1d501,
-	0x1d502,
-	0x1d503,
-	0x1d504,
-	0x1d505,
-	0x1d507,
-	0x1d508,
-	0x1d509,
-	0x1d50a,
-	0x1d50d,
-	0x1d50e,
-	0x1d50f,
-	0x1d510,
-	0x1d511,
-	0x1d512,
-	0x1d513,
-	0x1d514,
-	0x1d516,
-	0x1d517,
-	0x1d518,
-	0x1d519,
-	0x1d51a,
-	0x1d51b,
-	0x1d51c,
-	0x1d51e,
-	0x1d51f,
-	0x1d520,
-	0x1d521,
-	0x1d522,
-	0x1d523,
-	0x1d524,
-	0x1d525,
-	0x1d526,
-	0x1d527,
-	0x1d528,
-	0x1d529,
-	0x1d52a,
-	0x1d52b,
-	0x1d52c,
-	0x1d52d,
-	0x1d52e,
-	0x1d52f,
-	0x1d530,
-	0x1d531,
-	0x1d532,
-	0x1d533,
-	0x1d534,
-	0x1d535,
-	0x1d536,
-	0x1d537,
-	0x1d538,
-	0x1d539,
-	0x1d53b,
-	0x1d53c,
-	0x1d53d,
-	0x1d53e,
-	0x1d540,
-	0x1d541,
-	0x1d542,
-	0x1d543,
-	0x1d544,
-	0x1d546,
-	0x1d54a,
-	0x1d54b,
-	0x1d54c,
-	0x1d54d,
-	0x1d54e,
-	0x1d54f,
-	0x1d550,
-	0x1d552,
-	0x1d553,
-	0x1d554,
-	0x1d555,
-	0x1d556,
-	0x1d557,
-	0x1d558,
-	0x1d559,
-	0x1d55a,
-	0x1d55b,
-	0x1d55c,
-	0x1d55d,
-	0x1d55e,
-	0x1d55f,
-	0x1d560,
-	0x1d561,
-	0x1d562,
-	0x1d563,
-	0x1d564,
-	0x1d565,
-	0x1d566,
-	0x1d567,
-	0x1d568,
-	0x1d569,
-	0x1d56a,
-	0x1d56b,
-	0x1d56c,
-	0x1d56d,
-	0x1d56e,
-	0x1d56f,
-	0x1d570,
-	0x1d571,
-	0x1d572,
-	0x1d573,
-	0x1d574,
-	0x1d575,
-	0x1d576,
-	0x1d577,
-	0x1d578,
-	0x1d579,
-	0x1d57a,
-	0x1d57b,
-	0x1d57c,
-	0x1d57d,
-	0x1d57e,
-	0x1d57f,
-	0x1d580,
-	0x1d581,
-	0x1d582,
-	0x1d583,
-	0x1d584,
-	0x1d585,
-	0x1d586,
-	0x1d587,
-	0x1d588,
-	0x1d589,
-	0x1d58a,
-	0x1d58b,
-	0x1d58c,
-	0x1d58d,
-	0x1d58e,
-	0x1d58f,
-	0x1d590,
-	0x1d591,
-	0x1d592,
-	0x1d593,
-	0x1d594,
-	0x1d595,
-	0x1d596,
-	0x1d597,
-	0x1d598,
-	0x1d599,
-	0x1d59a,
-	0x1d59b,
-	0x1d59c,
-	0x1d59d,
-	0x1d59e,
-	0x1d59f,
-	0x1d5a0,
-	0x1d5a1,
-	0x1d5a2,
-	0x1d5a3,
-	0x1d5a4,
-	0x1d5a5,
-	0x1d5a6,
-	0x1d5a7,
-	0x1d5a8,
-	0x1d5a9,
-	0x1d5aa,
-	0x1d5ab,
-	0x1d5ac,
-	0x1d5ad,
-	0x1d5ae,
-	0x1d5af,
-	0x1d5b0,
-	0x1d5b1,
-	0x1d5b2,
-	0x1d5b3,
-	0x1d5b4,
-	0x1d5b5,
-	0x1d5b6,
-	0x1d5b7,
-	0x1d5b8,
-	0x1d5b9,
-	0x1d5ba,
-	0x1d5bb,
-	0x1d5bc,
-	0x1d5bd,
-	0x1d5be,
-	0x1d5bf,
-	0x1d5c0,
-	0x1d5c1,
-	0x1d5c2,
-	0x1d5c3,
-	0x1d5c4,
-	0x1d5c5,
-	0x1d5c6,
-	0x1d5c7,
-	0x1d5c8,
-	0x1d5c9,
-	0x1d5ca,
-	0x1d5cb,
-	0x1d5cc,
-	0x1d5cd,
-	0x1d5ce,
-	0x1d5cf,
-	0x1d5d0,
-	0x1d5d1,
-	0x1d5d2,
-	0x1d5d3,
-	0x1d5d4,
-	0x1d5d5,
-	0x1d5d6,
-	0x1d5d7,
-	0x1d5d8,
-	0x1d5d9,
-	0x1d5da,
-	0x1d5db,
-	0x1d5dc,
-	0x1d5dd,
-	0x1d5de,
-	0x1d5df,
-	0x1d5e0,
-	0x1d5e1,
-	0x1d5e2,
-	0x1d5e3,
-	0x1d5e4,
-	0x1d5e5,
-	0x1d5e6,
-	0x1d5e7,
-	0x1d5e8,
-	0x1d5e9,
-	0x1d5ea,
-	0x1d5eb,
-	0x1d5ec,
-	0x1d5ed,
-	0x1d5ee,
-	0x1d5ef,
-	0x1d5f0,
-	0x1d5f1,
-	0x1d5f2,
-	0x1d5f3,
-	0x1d5f4,
-	0x1d5f5,
-	0x1d5f6,
-	0x1d5f7,
-	0x1d5f8,
-	0x1d5f9,
-	0x1d5fa,
-	0x1d5fb,
-	0x1d5fc,
-	0x1d5fd,
-	0x1d5fe,
-	0x1d5ff,
-	0x1d600,
-	0x1d601,
-	0x1d602,
-	0x1d603,
-	0x1d604,
-	0x1d605,
-	0x1d606,
-	0x1d607,
-	0x1d608,
-	0x1d609,
-	0x1d60a,
-	0x1d60b,
-	0x1d60c,
-	0x1d60d,
-	0x1d60e,
-	0x1d60f,
-	0x1d610,
-	0x1d611,
-	0x1d612,
-	0x1d613,
-	0x1d614,
-	0x1d615,
-	0x1d616,
-	0x1d617,
-	0x1d618,
-	0x1d619,
-	0x1d61a,
-	0x1d61b,
-	0x1d61c,
-	0x1d61d,
-	0x1d61e,
-	0x1d61f,
-	0x1d620,
-	0x1d621,
-	0x1d622,
-	0x1d623,
-	0x1d624,
-	0x1d625,
-	0x1d626,
-	0x1d627,
-	0x1d628,
-	0x1d629,
-	0x1d62a,
-	0x1d62b,
-	0x1d62c,
-	0x1d62d,
-	0x1d62e,
-	0x1d62f,
-	0x1d630,
-	0x1d631,
-	0x1d632,
-	0x1d633,
-	0x1d634,
-	0x1d635,
-	0x1d636,
-	0x1d637,
-	0x1d638,
-	0x1d639,
-	0x1d63a,
-	0x1d63b,
-	0x1d63c,
-	0x1d63d,
-	0x1d63e,
-	0x1d63f,
-	0x1d640,
-	0x1d641,
-	0x1d642,
-	0x1d643,
-	0x1d644,
-	0x1d645,
-	0x1d646,
-	0x1d647,
-	0x1d648,
-	0x1d649,
-	0x1d64a,
-	0x1d64b,
-	0x1d64c,
-	0x1d64d,
-	0x1d64e,
-	0x1d64f,
-	0x1d650,
-	0x1d651,
-	0x1d652,
-	0x1d653,
-	0x1d654,
-	0x1d655,
-	0x1d656,
-	0x1d657,
-	0x1d658,
-	0x1d659,
-	0x1d65a,
-	0x1d65b,
-	0x1d65c,
-	0x1d65d,
-	0x1d65e,
-	0x1d65f,
-	0x1d660,
-	0x1d661,
-	0x1d662,
-	0x1d663,
-	0x1d664,
-	0x1d665,
-	0x1d666,
-	0x1d667,
-	0x1d668,
-	0x1d669,
-	0x1d66a,
-	0x1d66b,
-	0x1d66c,
-	0x1d66d,
-	0x1d66e,
-	0x1d66f,
-	0x1d670,
-	0x1d671,
-	0x1d672,
-	0x1d673,
-	0x1d674,
-	0x1d675,
-	0x1d676,
-	0x1d677,
-	0x1d678,
-	0x1d679,
-	0x1d67a,
-	0x1d67b,
-	0x1d67c,
-	0x1d67d,
-	0x1d67e,
-	0x1d67f,
-	0x1d680,
-	0x1d681,
-	0x1d682,
-	0x1d683,
-	0x1d684,
-	0x1d685,
-	0x1d686,
-	0x1d687,
-	0x1d688,
-	0x1d689,
-	0x1d68a,
-	0x1d68b,
-	0x1d68c,
-	0x1d68d,
-	0x1d68e,
-	0x1d68f,
-	0x1d690,
-	0x1d691,
-	0x1d692,
-	0x1d693,
-	0x1d694,
-	0x1d695,
-	0x1d696,
-	0x1d697,
-	0x1d698,
-	0x1d699,
-	0x1d69a,
-	0x1d69b,
-	0x1d69c,
-	0x1d69d,
-	0x1d69e,
-	0x1d69f,
-	0x1d6a0,
-	0x1d6a1,
-	0x1d6a2,
-	0x1d6a3,
-	0x1d6a4,
-	0x1d6a5,
-	0x1d6a8,
-	0x1d6a9,
-	0x1d6aa,
-	0x1d6ab,
-	0x1d6ac,
-	0x1d6ad,
-	0x1d6ae,
-	0x1d6af,
-	0x1d6b0,
-	0x1d6b1,
-	0x1d6b2,
-	0x1d6b3,
-	0x1d6b4,
-	0x1d6b5,
-	0x1d6b6,
-	0x1d6b7,
-	0x1d6b8,
-	0x1d6b9,
-	0x1d6ba,
-	0x1d6bb,
-	0x1d6bc,
-	0x1d6bd,
-	0x1d6be,
-	0x1d6bf,
-	0x1d6c0,
-	0x1d6c1,
-	0x1d6c2,
-	0x1d6c3,
-	0x1d6c4,
-	0x1d6c5,
-	0x1d6c6,
-	0x1d6c7,
-	0x1d6c8,
-	0x1d6c9,
-	0x1d6ca,
-	0x1d6cb,
-	0x1d6cc,
-	0x1d6cd,
-	0x1d6ce,
-	0x1d6cf,
-	0x1d6d0,
-	0x1d6d1,
-	0x1d6d2,
-	0x1d6d3,
-	0x1d6d4,
-	0x1d6d5,
-	0x1d6d6,
-	0x1d6d7,
-	0x1d6d8,
-	0x1d6d9,
-	0x1d6da,
-	0x1d6db,
-	0x1d6dc,
-	0x1d6dd,
-	0x1d6de,
-	0x1d6df,
-	0x1d6e0,
-	0x1d6e1,
-	0x1d6e2,
-	0x1d6e3,
-	0x1d6e4,
-	0x1d6e5,
-	0x1d6e6,
-	0x1d6e7,
-	0x1d6e8,
-	0x1d6e9,
-	0x1d6ea,
-	0x1d6eb,
-	0x1d6ec,
-	0x1d6ed,
-	0x1d6ee,
-	0x1d6ef,
-	0x1d6f0,
-	0x1d6f1,
-	0x1d6f2,
-	0x1d6f3,
-	0x1d6f4,
-	0x1d6f5,
-	0x1d6f6,
-	0x1d6f7,
-	0x1d6f8,
-	0x1d6f9,
-	0x1d6fa,
-	0x1d6fb,
-	0x1d6fc,
-	0x1d6fd,
-	0x1d6fe,
-	0x1d6ff,
-	0x1d700,
-	0x1d701,
-	0x1d702,
-	0x1d703,
-	0x1d704,
-	0x1d705,
-	0x1d706,
-	0x1d707,
-	0x1d708,
-	0x1d709,
-	0x1d70a,
-	0x1d70b,
-	0x1d70c,
-	0x1d70d,
-	0x1d70e,
-	0x1d70f,
-	0x1d710,
-	0x1d711,
-	0x1d712,
-	0x1d713,
-	0x1d714,
-	0x1d715,
-	0x1d716,
-	0x1d717,
-	0x1d718,
-	0x1d719,
-	0x1d71a,
-	0x1d71b,
-	0x1d71c,
-	0x1d71d,
-	0x1d71e,
-	0x1d71f,
-	0x1d720,
-	0x1d721,
-	0x1d722,
-	0x1d723,
-	0x1d724,
-	0x1d725,
-	0x1d726,
-	0x1d727,
-	0x1d728,
-	0x1d729,
-	0x1d72a,
-	0x1d72b,
-	0x1d72c,
-	0x1d72d,
-	0x1d72e,
-	0x1d72f,
-	0x1d730,
-	0x1d731,
-	0x1d732,
-	0x1d733,
-	0x1d734,
-	0x1d735,
-	0x1d736,
-	0x1d737,
-	0x1d738,
-	0x1d739,
-	0x1d73a,
-	0x1d73b,
-	0x1d73c,
-	0x1d73d,
-	0x1d73e,
-	0x1d73f,
-	0x1d740,
-	0x1d741,
-	0x1d742,
-	0x1d743,
-	0x1d744,
-	0x1d745,
-	0x1d746,
-	0x1d747,
-	0x1d748,
-	0x1d749,
-	0x1d74a,
-	0x1d74b,
-	0x1d74c,
-	0x1d74d,
-	0x1d74e,
-	0x1d74f,
-	0x1d750,
-	0x1d751,
-	0x1d752,
-	0x1d753,
-	0x1d754,
-	0x1d755,
-	0x1d756,
-	0x1d757,
-	0x1d758,
-	0x1d759,
-	0x1d75a,
-	0x1d75b,
-	0x1d75c,
-	0x1d75d,
-	0x1d75e,
-	0x1d75f,
-	0x1d760,
-	0x1d761,
-	0x1d762,
-	0x1d763,
-	0x1d764,
-	0x1d765,
-	0x1d766,
-	0x1d767,
-	0x1d768,
-	0x1d769,
-	0x1d76a,
-	0x1d76b,
-	0x1d76c,
-	0x1d76d,
-	0x1d76e,
-	0x1d76f,
-	0x1d770,
-	0x1d771,
-	0x1d772,
-	0x1d773,
-	0x1d774,
-	0x1d775,
-	0x1d776,
-	0x1d777,
-	0x1d778,
-	0x1d779,
-	0x1d77a,
-	0x1d77b,
-	0x1d77c,
-	0x1d77d,
-	0x1d77e,
-	0x1d77f,
-	0x1d780,
-	0x1d781,
-	0x1d782,
-	0x1d783,
-	0x1d784,
-	0x1d785,
-	0x1d786,
-	0x1d787,
-	0x1d788,
-	0x1d789,
-	0x1d78a,
-	0x1d78b,
-	0x1d78c,
-	0x1d78d,
-	0x1d78e,
-	0x1d78f,
-	0x1d790,
-	0x1d791,
-	0x1d792,
-	0x1d793,
-	0x1d794,
-	0x1d795,
-	0x1d796,
-	0x1d797,
-	0x1d798,
-	0x1d799,
-	0x1d79a,
-	0x1d79b,
-	0x1d79c,
-	0x1d79d,
-	0x1d79e,
-	0x1d79f,
-	0x1d7a0,
-	0x1d7a1,
-	0x1d7a2,
-	0x1d7a3,
-	0x1d7a4,
-	0x1d7a5,
-	0x1d7a6,
-	0x1d7a7,
-	0x1d7a8,
-	0x1d7a9,
-	0x1d7aa,
-	0x1d7ab,
-	0x1d7ac,
-	0x1d7ad,
-	0x1d7ae,
-	0x1d7af,
-	0x1d7b0,
-	0x1d7b1,
-	0x1d7b2,
-	0x1d7b3,
-	0x1d7b4,
-	0x1d7b5,
-	0x1d7b6,
-	0x1d7b7,
-	0x1d7b8,
-	0x1d7b9,
-	0x1d7ba,
-	0x1d7bb,
-	0x1d7bc,
-	0x1d7bd,
-	0x1d7be,
-	0x1d7bf,
-	0x1d7c0,
-	0x1d7c1,
-	0x1d7c2,
-	0x1d7c3,
-	0x1d7c4,
-	0x1d7c5,
-	0x1d7c6,
-	0x1d7c7,
-	0x1d7c8,
-	0x1d7c9,
-	0x1d7ca,
-	0x1d7cb,
-	0x1d7ce,
-	0x1d7cf,
-	0x1d7d0,
-	0x1d7d1,
-	0x1d7d2,
-	0x1d7d3,
-	0x1d7d4,
-	0x1d7d5,
-	0x1d7d6,
-	0x1d7d7,
-	0x1d7d8,
-	0x1d7d9,
-	0x1d7da,
-	0x1d7db,
-	0x1d7dc,
-	0x1d7dd,
-	0x1d7de,
-	0x1d7df,
-	0x1d7e0,
-	0x1d7e1,
-	0x1d7e2,
-	0x1d7e3,
-	0x1d7e4,
-	0x1d7e5,
-	0x1d7e6,
-	0x1d7e7,
-	0x1d7e8,
-	0x1d7e9,
-	0x1d7ea,
-	0x1d7eb,
-	0x1d7ec,
-	0x1d7ed,
-	0x1d7ee,
-	0x1d7ef,
-	0x1d7f0,
-	0x1d7f1,
-	0x1d7f2,
-	0x1d7f3,
-	0x1d7f4,
-	0x1d7f5,
-	0x1d7f6,
-	0x1d7f7,
-	0x1d7f8,
-	0x1d7f9,
-	0x1d7fa,
-	0x1d7fb,
-	0x1d7fc,
-	0x1d7fd,
-	0x1d7fe,
-	0x1d7ff,
-	0x1da00,
-	0x1da01,
-	0x1da02,
-	0x1da03,
-	0x1da04,
-	0x1da05,
-	0x1da06,
-	0x1da07,
-	0x1da08,
-	0x1da09,
-	0x1da0a,
-	0x1da0b,
-	0x1da0c,
-	0x1da0d,
-	0x1da0e,
-	0x1da0f,
-	0x1da10,
-	0x1da11,
-	0x1da12,
-	0x1da13,
-	0x1da14,
-	0x1da15,
-	0x1da16,
-	0x1da17,
-	0x1da18,
-	0x1da19,
-	0x1da1a,
-	0x1da1b,
-	0x1da1c,
-	0x1da1d,
-	0x1da1e,
-	0x1da1f,
-	0x1da20,
-	0x1da21,
-	0x1da22,
-	0x1da23,
-	0x1da24,
-	0x1da25,
-	0x1da26,
-	0x1da27,
-	0x1da28,
-	0x1da29,
-	0x1da2a,
-	0x1da2b,
-	0x1da2c,
-	0x1da2d,
-	0x1da2e,
-	0x1da2f,
-	0x1da30,
-	0x1da31,
-	0x1da32,
-	0x1da33,
-	0x1da34,
-	0x1da35,
-	0x1da36,
-	0x1da3b,
-	0x1da3c,
-	0x1da3d,
-	0x1da3e,
-	0x1da3f,
-	0x1da40,
-	0x1da41,
-	0x1da42,
-	0x1da43,
-	0x1da44,
-	0x1da45,
-	0x1da46,
-	0x1da47,
-	0x1da48,
-	0x1da49,
-	0x1da4a,
-	0x1da4b,
-	0x1da4c,
-	0x1da4d,
-	0x1da4e,
-	0x1da4f,
-	0x1da50,
-	0x1da51,
-	0x1da52,
-	0x1da53,
-	0x1da54,
-	0x1da55,
-	0x1da56,
-	0x1da57,
-	0x1da58,
-	0x1da59,
-	0x1da5a,
-	0x1da5b,
-	0x1da5c,
-	0x1da5d,
-	0x1da5e,
-	0x1da5f,
-	0x1da60,
-	0x1da61,
-	0x1da62,
-	0x1da63,
-	0x1da64,
-	0x1da65,
-	0x1da66,
-	0x1da67,
-	0x1da68,
-	0x1da69,
-	0x1da6a,
-	0x1da6b,
-	0x1da6c,
-	0x1da75,
-	0x1da84,
-	0x1da9b,
-	0x1da9c,
-	0x1da9d,
-	0x1da9e,
-	0x1da9f,
-	0x1daa1,
-	0x1daa2,
-	0x1daa3,
-	0x1daa4,
-	0x1daa5,
-	0x1daa6,
-	0x1daa7,
-	0x1daa8,
-	0x1daa9,
-	0x1daaa,
-	0x1daab,
-	0x1daac,
-	0x1daad,
-	0x1daae,
-	0x1daaf,
-	0x1e000,
-	0x1e001,
-	0x1e002,
-	0x1e003,
-	0x1e004,
-	0x1e005,
-	0x1e006,
-	0x1e008,
-	0x1e009,
-	0x1e00a,
-	0x1e00b,
-	0x1e00c,
-	0x1e00d,
-	0x1e00e,
-	0x1e00f,
-	0x1e010,
-	0x1e011,
-	0x1e012,
-	0x1e013,
-	0x1e014,
-	0x1e015,
-	0x1e016,
-	0x1e017,
-	0x1e018,
-	0x1e01b,
-	0x1e01c,
-	0x1e01d,
-	0x1e01e,
-	0x1e01f,
-	0x1e020,
-	0x1e021,
-	0x1e023,
-	0x1e024,
-	0x1e026,
-	0x1e027,
-	0x1e028,
-	0x1e029,
-	0x1e02a,
-	0x1e130,
-	0x1e131,
-	0x1e132,
-	0x1e133,
-	0x1e134,
-	0x1e135,
-	0x1e136,
-	0x1e2ec,
-	0x1e2ed,
-	0x1e2ee,
-	0x1e2ef,
-	0x1e8c7,
-	0x1e8c8,
-	0x1e8c9,
-	0x1e8cb,
-	0x1e8cc,
-	0x1e8cd,
-	0x1e8d0,
-	0x1e8d1,
-	0x1e8d2,
-	0x1e8d3,
-	0x1e8d4,
-	0x1e8d5,
-	0x1e8d6,
-	0x1e944,
-	0x1e945,
-	0x1e946,
-	0x1e947,
-	0x1e948,
-	0x1e949,
-	0x1e94a,
-	0x1ee00,
-	0x1ee01,
-	0x1ee02,
-	0x1ee03,
-	0x1ee05,
-	0x1ee06,
-	0x1ee07,
-	0x1ee08,
-	0x1ee09,
-	0x1ee0a,
-	0x1ee0b,
-	0x1ee0c,
-	0x1ee0d,
-	0x1ee0e,
-	0x1ee0f,
-	0x1ee10,
-	0x1ee11,
-	0x1ee12,
-	0x1ee13,
-	0x1ee14,
-	0x1ee15,
-	0x1ee16,
-	0x1ee17,
-	0x1ee18,
-	0x1ee19,
-	0x1ee1a,
-	0x1ee1b,
-	0x1ee1c,
-	0x1ee1d,
-	0x1ee1e,
-	0x1ee1f,
-	0x1ee21,
-	0x1ee22,
-	0x1ee24,
-	0x1ee27,
-	0x1ee29,
-	0x1ee2a,
-	0x1ee2b,
-	0x1ee2c,
-	0x1ee2d,
-	0x1ee2e,
-	0x1ee2f,
-	0x1ee30,
-	0x1ee31,
-	0x1ee32,
-	0x1ee34,
-	0x1ee35,
-	0x1ee36,
-	0x1ee37,
-	0x1ee39,
-	0x1ee3b,
-	0x1ee42,
-	0x1ee47,
-	0x1ee49,
-	0x1ee4b,
-	0x1ee4d,
-	0x1ee4e,
-	0x1ee4f,
-	0x1ee51,
-	0x1ee52,
-	0x1ee54,
-	0x1ee57,
-	0x1ee59,
-	0x1ee5b,
-	0x1ee5d,
-	0x1ee5f,
-	0x1ee61,
-	0x1ee62,
-	0x1ee64,
-	0x1ee67,
-	0x1ee68,
-	0x1ee69,
-	0x1ee6a,
-	0x1ee6c,
-	0x1ee6d,
-	0x1ee6e,
-	0x1ee6f,
-	0x1ee70,
-	0x1ee71,
-	0x1ee72,
-	0x1ee74,
-	0x1ee75,
-	0x1ee76,
-	0x1ee77,
-	0x1ee79,
-	0x1ee7a,
-	0x1ee7b,
-	0x1ee7c,
-	0x1ee7e,
-	0x1ee80,
-	0x1ee81,
-	0x1ee82,
-	0x1ee83,
-	0x1ee84,
-	0x1ee85,
-	0x1ee86,
-	0x1ee87,
-	0x1ee88,
-	0x1ee89,
-	0x1ee8b,
-	0x1ee8c,
-	0x1ee8d,
-	0x1ee8e,
-	0x1ee8f,
-	0x1ee90,
-	0x1ee91,
-	0x1ee92,
-	0x1ee93,
-	0x1ee94,
-	0x1ee95,
-	0x1ee96,
-	0x1ee97,
-	0x1ee98,
-	0x1ee99,
-	0x1ee9a,
-	0x1ee9b,
-	0x1eea1,
-	0x1eea2,
-	0x1eea3,
-	0x1eea5,
-	0x1eea6,
-	0x1eea7,
-	0x1eea8,
-	0x1eea9,
-	0x1eeab,
-	0x1eeac,
-	0x1eead,
-	0x1eeae,
-	0x1eeaf,
-	0x1eeb0,
-	0x1eeb1,
-	0x1eeb2,
-	0x1eeb3,
-	0x1eeb4,
-	0x1eeb5,
-	0x1eeb6,
-	0x1eeb7,
-	0x1eeb8,
-	0x1eeb9,
-	0x1eeba,
-	0x1eebb,
-	0x1f100,
-	0x1f101,
-	0x1f102,
-	0x1f103,
-	0x1f104,
-	0x1f105,
-	0x1f106,
-	0x1f107,
-	0x1f108,
-	0x1f109,
-	0x1f10a,
-	0x1f110,
-	0x1f111,
-	0x1f112,
-	0x1f113,
-	0x1f114,
-	0x1f115,
-	0x1f116,
-	0x1f117,
-	0x1f118,
-	0x1f119,
-	0x1f11a,
-	0x1f11b,
-	0x1f11c,
-	0x1f11d,
-	0x1f11e,
-	0x1f11f,
-	0x1f120,
-	0x1f121,
-	0x1f122,
-	0x1f123,
-	0x1f124,
-	0x1f125,
-	0x1f126,
-	0x1f127,
-	0x1f128,
-	0x1f129,
-	0x1f12a,
-	0x1f240,
-	0x1f241,
-	0x1f242,
-	0x1f243,
-	0x1f244,
-	0x1f245,
-	0x1f246,
-	0x1f247,
-	0x1f248,
-	0x1f312,
-	0x1f318,
-	0x1f319,
-	0x1f700,
-	0x1f701,
-	0x1f702,
-	0x1f704,
-	0x1f707,
-	0x1f708,
-	0x1f70a,
-	0x1f714,
-	0x1f728,
-	0x1f73a,
-	0x1f74c,
-	0x1f754,
-	0x1f755,
-	0x1f75c,
-	0x1f75e,
-	0x1f768,
-	0x1f76b,
-	0x1f76c,
-	0x1f771,
-	0x21fe8,
-	0x2f800,
-	0x2f801,
-	0x2f802,
-	0x2f803,
-	0x2f804,
-	0x2f805,
-	0x2f806,
-	0x2f807,
-	0x2f808,
-	0x2f809,
-	0x2f80a,
-	0x2f80b,
-	0x2f80c,
-	0x2f80d,
-	0x2f80e,
-	0x2f80f,
-	0x2f810,
-	0x2f811,
-	0x2f812,
-	0x2f813,
-	0x2f814,
-	0x2f815,
-	0x2f816,
-	0x2f817,
-	0x2f818,
-	0x2f819,
-	0x2f81a,
-	0x2f81b,
-	0x2f81c,
-	0x2f81d,
-	0x2f81e,
-	0x2f81f,
-	0x2f820,
-	0x2f821,
-	0x2f822,
-	0x2f823,
-	0x2f824,
-	0x2f825,
-	0x2f826,
-	0x2f827,
-	0x2f828,
-	0x2f829,
-	0x2f82a,
-	0x2f82b,
-	0x2f82c,
-	0x2f82d,
-	0x2f82e,
-	0x2f82f,
-	0x2f830,
-	0x2f831,
-	0x2f832,
-	0x2f833,
-	0x2f834,
-	0x2f835,
-	0x2f836,
-	0x2f837,
-	0x2f838,
-	0x2f839,
-	0x2f83a,
-	0x2f83b,
-	0x2f83c,
-	0x2f83d,
-	0x2f83e,
-	0x2f83f,
-	0x2f840,
-	0x2f841,
-	0x2f842,
-	0x2f843,
-	0x2f844,
-	0x2f845,
-	0x2f846,
-	0x2f847,
-	0x2f848,
-	0x2f849,
-	0x2f84a,
-	0x2f84b,
-	0x2f84c,
-	0x2f84d,
-	0x2f84e,
-	0x2f84f,
-	0x2f850,
-	0x2f851,
-	0x2f852,
-	0x2f853,
-	0x2f854,
-	0x2f855,
-	0x2f856,
-	0x2f857,
-	0x2f858,
-	0x2f859,
-	0x2f85a,
-	0x2f85b,
-	0x2f85c,
-	0x2f85d,
-	0x2f85e,
-	0x2f85f,
-	0x2f860,
-	0x2f861,
-	0x2f862,
-	0x2f863,
-	0x2f864,
-	0x2f865,
-	0x2f866,
-	0x2f867,
-	0x2f868,
-	0x2f869,
-	0x2f86a,
-	0x2f86b,
-	0x2f86c,
-	0x2f86d,
-	0x2f86e,
-	0x2f86f,
-	0x2f870,
-	0x2f871,
-	0x2f872,
-	0x2f873,
-	0x2f874,
-	0x2f875,
-	0x2f876,
-	0x2f877,
-	0x2f878,
-	0x2f879,
-	0x2f87a,
-	0x2f87b,
-	0x2f87c,
-	0x2f87d,
-	0x2f87e,
-	0x2f87f,
-	0x2f880,
-	0x2f881,
-	0x2f882,
-	0x2f883,
-	0x2f884,
-	0x2f885,
-	0x2f886,
-	0x2f887,
-	0x2f888,
-	0x2f889,
-	0x2f88a,
-	0x2f88b,
-	0x2f88c,
-	0x2f88d,
-	0x2f88e,
-	0x2f88f,
-	0x2f890,
-	0x2f891,
-	0x2f892,
-	0x2f893,
-	0x2f894,
-	0x2f895,
-	0x2f896,
-	0x2f897,
-	0x2f898,
-	0x2f899,
-	0x2f89a,
-	0x2f89b,
-	0x2f89c,
-	0x2f89d,
-	0x2f89e,
-	0x2f89f,
-	0x2f8a0,
-	0x2f8a1,
-	0x2f8a2,
-	0x2f8a3,
-	0x2f8a4,
-	0x2f8a5,
-	0x2f8a6,
-	0x2f8a7,
-	0x2f8a8,
-	0x2f8a9,
-	0x2f8aa,
-	0x2f8ab,
-	0x2f8ac,
-	0x2f8ad,
-	0x2f8ae,
-	0x2f8af,
-	0x2f8b0,
-	0x2f8b1,
-	0x2f8b2,
-	0x2f8b3,
-	0x2f8b4,
-	0x2f8b5,
-	0x2f8b6,
-	0x2f8b7,
-	0x2f8b8,
-	0x2f8b9,
-	0x2f8ba,
-	0x2f8bb,
-	0x2f8bc,
-	0x2f8bd,
-	0x2f8be,
-	0x2f8bf,
-	0x2f8c0,
-	0x2f8c1,
-	0x2f8c2,
-	0x2f8c3,
-	0x2f8c4,
-	0x2f8c5,
-	0x2f8c6,
-	0x2f8c7,
-	0x2f8c8,
-	0x2f8c9,
-	0x2f8ca,
-	0x2f8cb,
-	0x2f8cc,
-	0x2f8cd,
-	0x2f8ce,
-	0x2f8cf,
-	0x2f8d0,
-	0x2f8d1,
-	0x2f8d2,
-	0x2f8d3,
-	0x2f8d4,
-	0x2f8d5,
-	0x2f8d6,
-	0x2f8d7,
-	0x2f8d8,
-	0x2f8d9,
-	0x2f8da,
-	0x2f8db,
-	0x2f8dc,
-	0x2f8dd,
-	0x2f8de,
-	0x2f8df,
-	0x2f8e0,
-	0x2f8e1,
-	0x2f8e2,
-	0x2f8e3,
-	0x2f8e4,
-	0x2f8e5,
-	0x2f8e6,
-	0x2f8e7,
-	0x2f8e8,
-	0x2f8e9,
-	0x2f8ea,
-	0x2f8eb,
-	0x2f8ec,
-	0x2f8ed,
-	0x2f8ee,
-	0x2f8ef,
-	0x2f8f0,
-	0x2f8f1,
-	0x2f8f2,
-	0x2f8f3,
-	0x2f8f4,
-	0x2f8f5,
-	0x2f8f6,
-	0x2f8f7,
-	0x2f8f8,
-	0x2f8f9,
-	0x2f8fa,
-	0x2f8fb,
-	0x2f8fc,
-	0x2f8fd,
-	0x2f8fe,
-	0x2f8ff,
-	0x2f900,
-	0x2f901,
-	0x2f902,
-	0x2f903,
-	0x2f904,
-	0x2f905,
-	0x2f906,
-	0x2f907,
-	0x2f908,
-	0x2f909,
-	0x2f90a,
-	0x2f90b,
-	0x2f90c,
-	0x2f90d,
-	0x2f90e,
-	0x2f90f,
-	0x2f910,
-	0x2f911,
-	0x2f912,
-	0x2f913,
-	0x2f914,
-	0x2f915,
-	0x2f916,
-	0x2f917,
-	0x2f918,
-	0x2f919,
-	0x2f91a,
-	0x2f91b,
-	0x2f91c,
-	0x2f91d,
-	0x2f91e,
-	0x2f91f,
-	0x2f920,
-	0x2f921,
-	0x2f922,
-	0x2f923,
-	0x2f924,
-	0x2f925,
-	0x2f926,
-	0x2f927,
-	0x2f928,
-	0x2f929,
-	0x2f92a,
-	0x2f92b,
-	0x2f92c,
-	0x2f92d,
-	0x2f92e,
-	0x2f92f,
-	0x2f930,
-	0x2f931,
-	0x2f932,
-	0x2f933,
-	0x2f934,
-	0x2f935,
-	0x2f936,
-	0x2f937,
-	0x2f938,
-	0x2f939,
-	0x2f93a,
-	0x2f93b,
-	0x2f93c,
-	0x2f93d,
-	0x2f93e,
-	0x2f93f,
-	0x2f940,
-	0x2f941,
-	0x2f942,
-	0x2f943,
-	0x2f944,
-	0x2f945,
-	0x2f946,
-	0x2f947,
-	0x2f948,
-	0x2f949,
-	0x2f94a,
-	0x2f94b,
-	0x2f94c,
-	0x2f94d,
-	0x2f94e,
-	0x2f94f,
-	0x2f950,
-	0x2f951,
-	0x2f952,
-	0x2f953,
-	0x2f954,
-	0x2f955,
-	0x2f956,
-	0x2f957,
-	0x2f958,
-	0x2f959,
-	0x2f95a,
-	0x2f95b,
-	0x2f95c,
-	0x2f95d,
-	0x2f95e,
-	0x2f95f,
-	0x2f960,
-	0x2f961,
-	0x2f962,
-	0x2f963,
-	0x2f964,
-	0x2f965,
-	0x2f966,
-	0x2f967,
-	0x2f968,
-	0x2f969,
-	0x2f96a,
-	0x2f96b,
-	0x2f96c,
-	0x2f96d,
-	0x2f96e,
-	0x2f96f,
-	0x2f970,
-	0x2f971,
-	0x2f972,
-	0x2f973,
-	0x2f974,
-	0x2f975,
-	0x2f976,
-	0x2f977,
-	0x2f978,
-	0x2f979,
-	0x2f97a,
-	0x2f97b,
-	0x2f97c,
-	0x2f97d,
-	0x2f97e,
-	0x2f97f,
-	0x2f980,
-	0x2f981,
-	0x2f982,
-	0x2f983,
-	0x2f984,
-	0x2f985,
-	0x2f986,
-	0x2f987,
-	0x2f988,
-	0x2f989,
-	0x2f98a,
-	0x2f98b,
-	0x2f98c,
-	0x2f98d,
-	0x2f98e,
-	0x2f98f,
-	0x2f990,
-	0x2f991,
-	0x2f992,
-	0x2f993,
-	0x2f994,
-	0x2f995,
-	0x2f996,
-	0x2f997,
-	0x2f998,
-	0x2f999,
-	0x2f99a,
-	0x2f99b,
-	0x2f99c,
-	0x2f99d,
-	0x2f99e,
-	0x2f99f,
-	0x2f9a0,
-	0x2f9a1,
-	0x2f9a2,
-	0x2f9a3,
-	0x2f9a4,
-	0x2f9a5,
-	0x2f9a6,
-	0x2f9a7,
-	0x2f9a8,
-	0x2f9a9,
-	0x2f9aa,
-	0x2f9ab,
-	0x2f9ac,
-	0x2f9ad,
-	0x2f9ae,
-	0x2f9af,
-	0x2f9b0,
-	0x2f9b1,
-	0x2f9b2,
-	0x2f9b3,
-	0x2f9b4,
-	0x2f9b5,
-	0x2f9b6,
-	0x2f9b7,
-	0x2f9b8,
-	0x2f9b9,
-	0x2f9ba,
-	0x2f9bb,
-	0x2f9bc,
-	0x2f9bd,
-	0x2f9be,
-	0x2f9bf,
-	0x2f9c0,
-	0x2f9c1,
-	0x2f9c2,
-	0x2f9c3,
-	0x2f9c4,
-	0x2f9c5,
-	0x2f9c6,
-	0x2f9c7,
-	0x2f9c8,
-	0x2f9c9,
-	0x2f9ca,
-	0x2f9cb,
-	0x2f9cc,
-	0x2f9cd,
-	0x2f9ce,
-	0x2f9cf,
-	0x2f9d0,
-	0x2f9d1,
-	0x2f9d2,
-	0x2f9d3,
-	0x2f9d4,
-	0x2f9d5,
-	0x2f9d6,
-	0x2f9d7,
-	0x2f9d8,
-	0x2f9d9,
-	0x2f9da,
-	0x2f9db,
-	0x2f9dc,
-	0x2f9dd,
-	0x2f9de,
-	0x2f9df,
-	0x2f9e0,
-	0x2f9e1,
-	0x2f9e2,
-	0x2f9e3,
-	0x2f9e4,
-	0x2f9e5,
-	0x2f9e6,
-	0x2f9e7,
-	0x2f9e8,
-	0x2f9e9,
-	0x2f9ea,
-	0x2f9eb,
-	0x2f9ec,
-	0x2f9ed,
-	0x2f9ee,
-	0x2f9ef,
-	0x2f9f0,
-	0x2f9f1,
-	0x2f9f2,
-	0x2f9f3,
-	0x2f9f4,
-	0x2f9f5,
-	0x2f9f6,
-	0x2f9f7,
-	0x2f9f8,
-	0x2f9f9,
-	0x2f9fa,
-	0x2f9fb,
-	0x2f9fc,
-	0x2f9fd,
-	0x2f9fe,
-	0x2f9ff,
-	0x2fa00,
-	0x2fa01,
-	0x2fa02,
-	0x2fa03,
-	0x2fa04,
-	0x2fa05,
-	0x2fa06,
-	0x2fa07,
-	0x2fa08,
-	0x2fa09,
-	0x2fa0a,
-	0x2fa0b,
-	0x2fa0c,
-	0x2fa0d,
-	0x2fa0e,
-	0x2fa0f,
-	0x2fa10,
-	0x2fa11,
-	0x2fa12,
-	0x2fa13,
-	0x2fa14,
-	0x2fa15,
-	0x2fa16,
-	0x2fa17,
-	0x2fa18,
-	0x2fa19,
-	0x2fa1a,
-	0x2fa1b,
-	0x2fa1c,
-	0x2fa1d,
-	0xe0001,
-	0xe0020,
-	0xe0021,
-	0xe0022,
-	0xe0023,
-	0xe0024,
-	0xe0025,
-	0xe0026,
-	0xe0027,
-	0xe0028,
-	0xe0029,
-	0xe002a,
-	0xe002b,
-	0xe002c,
-	0xe002d,
-	0xe002e,
-	0xe002f,
-	0xe0030,
-	0xe0031,
-	0xe0032,
-	0xe0033,
-	0xe0034,
-	0xe0035,
-	0xe0036,
-	0xe0037,
-	0xe0038,
-	0xe0039,
-	0xe003a,
-	0xe003b,
-	0xe003c,
-	0xe003d,
-	0xe003e,
-	0xe003f,
-	0xe0040,
-	0xe0041,
-	0xe0042,
-	0xe0043,
-	0xe0044,
-	0xe0045,
-	0xe0046,
-	0xe0047,
-	0xe0048,
-	0xe0049,
-	0xe004a,
-	0xe004b,
-	0xe004c,
-	0xe004d,
-	0xe004e,
-	0xe004f,
-	0xe0050,
-	0xe0051,
-	0xe0052,
-	0xe0053,
-	0xe0054,
-	0xe0055,
-	0xe0056,
-	0xe0057,
-	0xe0058,
-	0xe0059,
-	0xe005a,
-	0xe005b,
-	0xe005c,
-	0xe005d,
-	0xe005e,
-	0xe005f,
-	0xe0060,
-	0xe0061,
-	0xe0062,
-	0xe0063,
-	0xe0064,
-	0xe0065,
-	0xe0066,
-	0xe0067,
-	0xe0068,
-	0xe0069,
-	0xe006a,
-	0xe006b,
-	0xe006c,
-	0xe006d,
-	0xe006e,
-	0xe006f,
-	0xe0070,
-	0xe0071,
-	0xe0072,
-	0xe0073,
-	0xe0074,
-	0xe0075,
-	0xe0076,
-	0xe0077,
-	0xe0078,
-	0xe0079,
-	0xe007a,
-	0xe007b,
-	0xe007c,
-	0xe007d,
-	0xe007e,
-	0xe007f,
-	0xe0100,
-	0xe0101,
-	0xe0102,
-	0xe0103,
-	0xe0104,
-	0xe0105,
-	0xe0106,
-	0xe0107,
-	0xe0108,
-	0xe0109,
-	0xe010a,
-	0xe010b,
-	0xe010c,
-	0xe010d,
-	0xe010e,
-	0xe010f,
-	0xe0110,
-	0xe0111,
-	0xe0112,
-	0xe0113,
-	0xe0114,
-	0xe0115,
-	0xe0116,
-	0xe0117,
-	0xe0118,
-	0xe0119,
-	0xe011a,
-	0xe011b,
-	0xe011c,
-	0xe011d,
-	0xe011e,
-	0xe011f,
-	0xe0120,
-	0xe0121,
-	0xe0122,
-	0xe0123,
-	0xe0124,
-	0xe0125,
-	0xe0126,
-	0xe0127,
-	0xe0128,
-	0xe0129,
-	0xe012a,
-	0xe012b,
-	0xe012c,
-	0xe012d,
-	0xe012e,
-	0xe012f,
-	0xe0130,
-	0xe0131,
-	0xe0132,
-	0xe0133,
-	0xe0134,
-	0xe0135,
-	0xe0136,
-	0xe0137,
-	0xe0138,
-	0xe0139,
-	0xe013a,
-	0xe013b,
-	0xe013c,
-	0xe013d,
-	0xe013e,
-	0xe013f,
-	0xe0140,
-	0xe0141,
-	0xe0142,
-	0xe0143,
-	0xe0144,
-	0xe0145,
-	0xe0146,
-	0xe0147,
-	0xe0148,
-	0xe0149,
-	0xe014a,
-	0xe014b,
-	0xe014c,
-	0xe014d,
-	0xe014e,
-	0xe014f,
-	0xe0150,
-	0xe0151,
-	0xe0152,
-	0xe0153,
-	0xe0154,
-	0xe0155,
-	0xe0156,
-	0xe0157,
-	0xe0158,
-	0xe0159,
-	0xe015a,
-	0xe015b,
-	0xe015c,
-	0xe015d,
-	0xe015e,
-	0xe015f,
-	0xe0160,
-	0xe0161,
-	0xe0162,
-	0xe0163,
-	0xe0164,
-	0xe0165,
-	0xe0166,
-	0xe0167,
-	0xe0168,
-	0xe0169,
-	0xe016a,
-	0xe016b,
-	0xe016c,
-	0xe016d,
-	0xe016e,
-	0xe016f,
-	0xe0170,
-	0xe0171,
-	0xe0172,
-	0xe0173,
-	0xe0174,
-	0xe0175,
-	0xe0176,
-	0xe0177,
-	0xe0178,
-	0xe0179,
-	0xe017a,
-	0xe017b,
-	0xe017c,
-	0xe017d,
-	0xe017e,
-	0xe017f,
-	0xe0180,
-	0xe0181,
-	0xe0182,
-	0xe0183,
-	0xe0184,
-	0xe0185,
-	0xe0186,
-	0xe0187,
-	0xe0188,
-	0xe0189,
-	0xe018a,
-	0xe018b,
-	0xe018c,
-	0xe018d,
-	0xe018e,
-	0xe018f,
-	0xe0190,
-	0xe0191,
-	0xe0192,
-	0xe0193,
-	0xe0194,
-	0xe0195,
-	0xe0196,
-	0xe0197,
-	0xe0198,
-	0xe0199,
-	0xe019a,
-	0xe019b,
-	0xe019c,
-	0xe019d,
-	0xe019e,
-	0xe019f,
-	0xe01a0,
-	0xe01a1,
-	0xe01a2,
-	0xe01a3,
-	0xe01a4,
-	0xe01a5,
-	0xe01a6,
-	0xe01a7,
-	0xe01a8,
-	0xe01a9,
-	0xe01aa,
-	0xe01ab,
-	0xe01ac,
-	0xe01ad,
-	0xe01ae,
-	0xe01af,
-	0xe01b0,
-	0xe01b1,
-	0xe01b2,
-	0xe01b3,
-	0xe01b4,
-	0xe01b5,
-	0xe01b6,
-	0xe01b7,
-	0xe01b8,
-	0xe01b9,
-	0xe01ba,
-	0xe01bb,
-	0xe01bc,
-	0xe01bd,
-	0xe01be,
-	0xe01bf,
-	0xe01c0,
-	0xe01c1,
-	0xe01c2,
-	0xe01c3,
-	0xe01c4,
-	0xe01c5,
-	0xe01c6,
-	0xe01c7,
-	0xe01c8,
-	0xe01c9,
-	0xe01ca,
-	0xe01cb,
-	0xe01cc,
-	0xe01cd,
-	0xe01ce,
-	0xe01cf,
-	0xe01d0,
-	0xe01d1,
-	0xe01d2,
-	0xe01d3,
-	0xe01d4,
-	0xe01d5,
-	0xe01d6,
-	0xe01d7,
-	0xe01d8,
-	0xe01d9,
-	0xe01da,
-	0xe01db,
-	0xe01dc,
-	0xe01dd,
-	0xe01de,
-	0xe01df,
-	0xe01e0,
-	0xe01e1,
-	0xe01e2,
-	0xe01e3,
-	0xe01e4,
-	0xe01e5,
-	0xe01e6,
-	0xe01e7,
-	0xe01e8,
-	0xe01e9,
-	0xe01ea,
-	0xe01eb,
-	0xe01ec,
-	0xe01ed,
-	0xe01ee,
-	0xe01ef,
-	0xf0000,
-	0xffffd,
-	0x100000,
-	0x10fffd,
+static const uint8_t decomp_page_index[NUM_DECOMP_PAGE_INDEX] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 52, 52, 52, 52, 53, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 54, 55, 52, 52, 52, 52, 52, 52, 52, 52, 52, 56, 52,
+	57, 52, 52, 52, 52, 58, 59, 52, 60, 52, 52, 61, 52, 52, 62, 52,
+	52, 52, 63, 52, 64, 52, 65, 66, 52, 67, 68, 52, 52, 52, 52, 69,
+	52, 52, 52, 52, 52, 52, 52, 52, 70, 52, 52, 52, 52, 71, 52, 52,
+	72, 73, 52, 52, 52, 74, 75, 52, 52, 52, 76, 77, 78, 79, 80, 81,
+	82, 52, 52, 83, 52, 52, 84, 52, 52, 52, 52, 52, 52, 52, 85, 86,
+	52, 52, 52, 52, 87, 52, 88, 89, 90, 91, 92, 93, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 94, 95, 52, 52, 96, 97, 52, 52, 98,
+	99, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 100, 101, 102, 103, 104, 105, 106, 107,
+	52, 108, 109, 110, 111, 112, 52, 52, 52, 52, 113, 52, 114, 115, 52, 116,
+	117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 52, 128, 129, 130, 52,
+	131, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 132, 52, 133, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 134, 135, 52, 52, 52, 136,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 137, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 138, 139, 52, 140, 141, 142, 143, 52, 52, 144, 52, 52, 52, 52, 52,
+	145, 146, 147, 52, 52, 52, 52, 52, 148, 149, 52, 52, 52, 52, 150, 52,
+	52, 151, 152, 153, 52, 52, 52, 154, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 155,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 156, 157, 158, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	159, 160, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	161, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 162,
+	163, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 164,
+};
+
+static const uint16_t decomp_pages[NUM_DECOMP_PAGES][DECOMP_PAGE_SIZE] = {
+	{
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+	33, 0, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	36, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 43,
+	44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+	60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+	76, 0, 77, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 79, 0, 80,
+	0, 0, 0, 0, 81, 82, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0,
+	84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+	100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 0, 0,
+	114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+	130, 131, 132, 133, 134, 135, 136, 0, 137, 138, 139, 140, 141, 142, 0, 143,
+	},
+	{
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 0, 200, 201, 202, 203, 204, 205, 206,
+	207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 0, 0, 217, 218, 219, 220,
+	221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+	237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+	253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+	269, 270, 271, 272, 273, 0, 0, 274, 0, 275, 276, 0, 277, 278, 0, 0,
+	0, 279, 280, 281, 0, 0, 282, 283, 284, 285, 286, 0, 0, 287, 288, 289,
+	290, 291, 0, 0, 292, 293, 294, 295, 0, 0, 0, 0, 296, 297, 298, 299,
+	300, 0, 0, 301, 302, 303, 304, 305, 0, 0, 0, 306, 307, 308, 0, 309,
+	310, 311, 0, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+	325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 0, 338, 339,
+	340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+	356, 357, 358, 359, 360, 361, 0, 0, 362, 363, 364, 365, 366, 367, 368, 369,
+	},
+	{
+	370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+	386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 0, 399, 400,
+	0, 0, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+	415, 416, 417, 418, 0, 0, 0, 0, 0, 0, 0, 0, 419, 0, 420, 0,
+	0, 421, 0, 0, 422, 0, 423, 424, 425, 426, 0, 0, 0, 427, 428, 429,
+	0, 430, 0, 431, 0, 0, 432, 433, 0, 434, 435, 436, 0, 0, 0, 0,
+	437, 438, 0, 439, 0, 0, 440, 0, 441, 442, 443, 444, 0, 445, 446, 447,
+	0, 448, 0, 449, 0, 450, 451, 0, 0, 0, 0, 0, 452, 453, 0, 0,
+	0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0, 0, 456,
+	457, 0, 458, 0, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	460, 0, 0, 461, 462, 463, 464, 465, 466, 467, 468, 469, 0, 0, 0, 0,
+	0, 0, 0, 470, 0, 0, 0, 0, 0, 471, 472, 473, 474, 475, 476, 477,
+	0, 0, 478, 479, 480, 0, 481, 0, 482, 0, 483, 484, 0, 0, 0, 0,
+	485, 0, 0, 486, 0, 0, 0, 487, 488, 489, 490, 491, 492, 493, 0, 0,
+	0, 494, 495, 0, 496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 497, 0,
+	0, 0, 0, 0, 498, 0, 499, 0, 500, 0, 0, 501, 0, 0, 0, 0,
+	},
+	{
+	502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+	518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
+	534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+	550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565,
+	566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581,
+	582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597,
+	598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613,
+	614, 0, 0, 0, 615, 616, 617, 618, 0, 0, 619, 620, 0, 621, 622, 623,
+	0, 0, 0, 0, 624, 625, 626, 627, 628, 629, 630, 0, 631, 0, 632, 633,
+	634, 635, 636, 0, 0, 637, 638, 639, 640, 641, 642, 643, 644, 645, 0, 646,
+	0, 647, 0, 648, 649, 650, 0, 651, 0, 0, 652, 653, 654, 655, 656, 657,
+	658, 659, 660, 661, 662, 663, 0, 664, 665, 666, 667, 0, 0, 668, 0, 669,
+	0, 670, 0, 671, 672, 673, 674, 0, 0, 0, 675, 676, 677, 678, 679, 0,
+	680, 681, 682, 683, 684, 685, 686, 0, 0, 0, 0, 687, 688, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 689, 690, 0, 0, 0, 0, 0, 0,
+	691, 692, 693, 694, 695, 696, 0, 697, 698, 699, 700, 0, 0, 701, 0, 702,
+	},
+	{
+	703, 704, 0, 705, 706, 707, 708, 709, 710, 0, 0, 0, 711, 712, 713, 0,
+	714, 715, 716, 717, 0, 718, 0, 719, 0, 720, 721, 722, 723, 724, 725, 726,
+	727, 728, 729, 730, 731, 732, 0, 0, 0, 0, 0, 733, 734, 0, 735, 0,
+	736, 737, 738, 739, 0, 740, 0, 741, 742, 743, 744, 0, 745, 746, 747, 748,
+	749, 750, 751, 752, 753, 754, 0, 0, 0, 0, 755, 756, 757, 0, 0, 758,
+	759, 760, 0, 761, 762, 763, 764, 765, 766, 0, 0, 767, 768, 769, 770, 0,
+	0, 771, 772, 773, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	774, 775, 776, 777, 778, 779, 780, 781, 0, 0, 0, 0, 782, 783, 0, 0,
+	0, 0, 0, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 0, 0,
+	795, 796, 797, 798, 0, 0, 799, 800, 801, 802, 803, 804, 0, 0, 805, 806,
+	0, 0, 807, 808, 0, 0, 0, 0, 0, 0, 809, 810, 811, 812, 813, 814,
+	815, 816, 817, 0, 0, 0, 0, 0, 0, 0, 0, 818, 0, 819, 820, 821,
+	822, 823, 824, 0, 0, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835,
+	836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851,
+	852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867,
+	868, 869, 870, 871, 872, 873, 0, 0, 874, 875, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 878, 879, 0, 0,
+	880, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 882, 883, 884, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 885, 0, 0, 0, 0,
+	0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 887, 0, 888, 889, 0, 890,
+	0, 0, 0, 891, 0, 892, 0, 0, 0, 0, 893, 0, 0, 894, 0, 0,
+	0, 895, 0, 896, 0, 0, 897, 0, 0, 0, 0, 0, 0, 0, 898, 0,
+	899, 0, 0, 0, 0, 900, 0, 0, 901, 0, 902, 0, 903, 904, 0, 0,
+	0, 905, 0, 0, 906, 907, 0, 908, 0, 909, 0, 0, 0, 0, 0, 0,
+	0, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924,
+	925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940,
+	941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 0, 955,
+	956, 957, 958, 959, 960, 961, 0, 962, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 963, 0, 0, 964, 965, 0, 0, 0, 0, 0, 966,
+	0, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	968, 969, 970, 971, 972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	973, 974, 975, 976, 977, 978, 0, 0, 0, 979, 980, 0, 0, 981, 0, 982,
+	983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 0, 994, 0, 0, 0,
+	0, 0, 995, 996, 997, 998, 999, 1000, 0, 0, 0, 1001, 0, 0, 0, 0,
+	0, 0, 0, 0, 1002, 0, 0, 0, 0, 0, 0, 0, 0, 1003, 0, 1004,
+	0, 0, 0, 0, 0, 0, 0, 1005, 0, 0, 1006, 1007, 1008, 1009, 1010, 1011,
+	1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+	1028, 1029, 0, 0, 0, 1030, 0, 1031, 1032, 0, 1033, 1034, 1035, 1036, 1037, 1038,
+	1039, 0, 1040, 1041, 0, 1042, 1043, 1044, 1045, 1046, 0, 0, 0, 0, 1047, 0,
+	0, 1048, 0, 0, 0, 1049, 0, 0, 1050, 0, 0, 1051, 0, 0, 1052, 0,
+	0, 1053, 1054, 0, 0, 0, 0, 0, 1055, 0, 0, 0, 0, 0, 1056, 1057,
+	0, 0, 0, 0, 1058, 0, 0, 1059, 1060, 1061, 1062, 0, 0, 1063, 0, 0,
+	0, 0, 0, 0, 1064, 1065, 0, 1066, 0, 0, 1067, 1068, 0, 1069, 1070, 0,
+	1071, 1072, 1073, 1074, 0, 0, 1075, 1076, 1077, 1078, 0, 1079, 1080, 0, 1081, 0,
+	1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 0, 1096,
+	1097, 1098, 1099, 1100, 1101, 0, 0, 1102, 1103, 0, 1104, 1105, 1106, 1107, 1108, 1109,
+	1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 0, 0, 0, 1120, 1121, 1122,
+	},
+	{
+	0, 1123, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1127,
+	0, 1128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+	1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 0, 0, 0, 0, 0,
+	0, 1156, 0, 0, 0, 0, 1157, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1158, 1159, 0, 0, 0, 1160, 1161, 1162, 0, 0, 1163, 0, 0, 0,
+	0, 1164, 1165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+	1177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1179, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1180, 1181, 1182, 1183, 1184,
+	1185, 1186, 1187, 1188, 1189, 1190, 0, 0, 0, 0, 1191, 0, 0, 1192, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1193, 1194, 1195, 1196, 0, 1197, 1198, 1199, 1200, 1201,
+	1202, 1203, 1204, 1205, 0, 1206, 1207, 1208, 0, 1209, 1210, 1211, 1212, 1213, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1214, 1215, 1216, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1217, 0, 0, 1218, 0, 0, 1219, 1220, 1221, 0, 0, 0, 0, 1222, 1223,
+	1224, 1225, 1226, 0, 0, 0, 1227, 1228, 0, 1229, 1230, 1231, 1232, 1233, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+	1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262,
+	1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+	},
+	{
+	1279, 1280, 1281, 1282, 1283, 0, 1284, 0, 1285, 0, 0, 0, 0, 1286, 1287, 0,
+	1288, 1289, 1290, 1291, 1292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1293, 0, 0, 0, 0, 0, 0,
+	0, 1294, 0, 0, 1295, 0, 0, 0, 0, 0, 1296, 1297, 1298, 0, 1299, 1300,
+	1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+	0, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
+	0, 0, 1332, 1333, 0, 1334, 1335, 1336, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1337, 0, 0,
+	0, 1338, 1339, 1340, 0, 0, 1341, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1342, 0, 1343, 1344,
+	1345, 1346, 1347, 1348, 1349, 0, 0, 1350, 1351, 0, 0, 1352, 1353, 1354, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1355, 0, 0, 0, 0, 1356, 1357, 0, 1358,
+	1359, 1360, 1361, 1362, 0, 0, 1363, 0, 0, 0, 1364, 0, 0, 1365, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1366, 0,
+	},
+	{
+	0, 1367, 1368, 1369, 0, 0, 1370, 1371, 1372, 1373, 1374, 0, 0, 0, 0, 1375,
+	1376, 0, 0, 0, 1377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1378, 0, 0, 1379, 0, 0, 0, 0, 0, 1380, 0, 1381, 1382,
+	1383, 1384, 1385, 0, 0, 0, 0, 1386, 1387, 0, 0, 1388, 1389, 1390, 0, 0,
+	0, 1391, 0, 0, 0, 0, 0, 0, 0, 1392, 1393, 1394, 0, 0, 1395, 0,
+	0, 0, 0, 0, 0, 0, 1396, 1397, 0, 0, 1398, 0, 0, 0, 0, 0,
+	1399, 1400, 0, 0, 0, 1401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1402, 1403, 1404, 0, 0, 1405, 0, 0, 0, 0, 0, 0, 1406, 0, 1407,
+	1408, 1409, 0, 1410, 1411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1412, 1413, 1414, 1415,
+	1416, 1417, 1418, 1419, 1420, 1421, 0, 1422, 1423, 1424, 0, 1425, 1426, 1427, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1428, 1429, 0, 0, 1430, 0, 1431, 1432, 1433, 0, 0, 0, 1434, 0,
+	1435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1436, 1437, 1438, 1439, 1440, 1441,
+	},
+	{
+	0, 1442, 1443, 1444, 0, 0, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1446, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1447, 0, 1448, 1449,
+	1450, 1451, 1452, 1453, 1454, 0, 0, 1455, 1456, 0, 0, 1457, 1458, 1459, 0, 0,
+	0, 0, 0, 0, 0, 0, 1460, 1461, 0, 0, 0, 0, 1462, 1463, 0, 0,
+	0, 0, 1464, 1465, 0, 0, 1466, 0, 1467, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1468, 0, 0, 0, 0, 0, 0, 0, 1469, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1470, 0, 0, 0, 0, 0, 0, 0, 1471, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1473, 1474,
+	1475, 1476, 1477, 0, 0, 0, 1478, 1479, 1480, 0, 1481, 1482, 1483, 1484, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1485, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1486, 1487, 1488, 0, 1489, 1490, 1491, 1492, 1493, 0,
+	1494, 0, 1495, 0, 1496, 1497, 0, 1498, 1499, 0, 1500, 0, 0, 0, 0, 0,
+	},
+	{
+	1501, 1502, 1503, 1504, 1505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1506, 1507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1508, 0, 1509, 0, 0, 1510, 0, 0, 0, 0, 0, 0, 0, 1511, 1512, 0,
+	0, 0, 0, 0, 0, 0, 0, 1513, 0, 1514, 0, 0, 0, 0, 1515, 1516,
+	1517, 1518, 1519, 1520, 1521, 0, 1522, 1523, 1524, 0, 1525, 1526, 1527, 1528, 0, 0,
+	0, 0, 0, 0, 0, 1529, 1530, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1531, 1532, 1533, 1534, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1536, 1537, 1538, 0, 1539, 1540, 1541, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1542, 1543, 1544, 0, 0, 0, 0, 0, 0, 0, 1545, 0, 1546, 0,
+	0, 0, 0, 1547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1548,
+	0, 1549, 1550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1551, 0, 1552, 1553,
+	1554, 1555, 1556, 1557, 1558, 0, 1559, 1560, 1561, 0, 1562, 1563, 1564, 1565, 0, 0,
+	0, 0, 0, 0, 0, 1566, 1567, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1568, 1569, 1570, 0, 0, 1571, 1572, 1573, 0, 0, 0, 0, 0, 0, 1574,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	1575, 1576, 1577, 1578, 0, 0, 0, 0, 1579, 1580, 1581, 0, 1582, 0, 0, 0,
+	1583, 0, 0, 1584, 1585, 0, 0, 0, 0, 1586, 0, 0, 1587, 0, 0, 0,
+	1588, 0, 0, 1589, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1590, 0, 0, 1591, 0, 1592, 0, 0, 0, 1593, 1594, 1595, 0, 1596, 1597,
+	1598, 1599, 1600, 1601, 1602, 0, 1603, 1604, 1605, 0, 1606, 1607, 1608, 1609, 1610, 0,
+	0, 0, 0, 0, 0, 0, 0, 1611, 0, 0, 1612, 0, 0, 0, 0, 1613,
+	0, 1614, 1615, 1616, 0, 0, 1617, 0, 0, 0, 1618, 1619, 1620, 1621, 1622, 1623,
+	0, 0, 0, 0, 0, 0, 1624, 0, 0, 1625, 0, 1626, 1627, 0, 0, 0,
+	0, 0, 1628, 1629, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1630, 0, 0, 0, 0, 1631,
+	1632, 1633, 1634, 1635, 1636, 0, 1637, 0, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1646, 1647, 1648, 0, 0, 0, 1649,
+	0, 0, 1650, 1651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 1652, 0, 0, 0, 0, 0, 0, 0, 1653, 0, 0, 0, 1654,
+	0, 0, 0, 0, 1655, 1656, 0, 1657, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1658, 0, 0, 0, 0, 1659, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1660, 0, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 0, 0, 0, 0, 0,
+	0, 1669, 0, 0, 0, 1670, 0, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 0,
+	1679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1680, 0, 0, 0, 0, 1681, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1682, 1683, 0, 1684, 1685, 1686,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1687, 0, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1698, 1699, 1700, 1701, 1702, 1703, 0, 0,
+	1704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1705, 1706, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	1707, 0, 1708, 1709, 0, 0, 0, 0, 0, 0, 0, 0, 1710, 0, 1711, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1712, 1713, 0, 1714, 0, 0, 1715, 1716,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1717, 0, 1718, 0, 1719, 0, 0, 0, 0, 1720, 1721,
+	0, 0, 0, 1722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1723, 0, 0,
+	0, 0, 1724, 0, 0, 0, 0, 1725, 0, 0, 0, 0, 1726, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1727, 1728, 0, 0, 0, 0, 0,
+	0, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+	1744, 1745, 1746, 1747, 1748, 0, 1749, 1750, 0, 0, 0, 0, 0, 1751, 1752, 1753,
+	1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 0, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+	1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1798, 0, 0, 0, 0, 0, 0, 0, 1799, 0,
+	0, 0, 0, 0, 0, 1800, 1801, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	1802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1804, 0, 1805,
+	0, 0, 0, 0, 0, 0, 1806, 0, 0, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
+	1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 0,
+	1829, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1830, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1831, 1832, 1833, 1834, 0, 0, 0, 0, 1835, 1836,
+	1837, 0, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 0, 1850,
+	1851, 1852, 1853, 1854, 1855, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1856, 0,
+	0, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 0, 1870,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1871, 1872, 1873, 1874, 1875, 0,
+	1876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1877, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1879,
+	},
+	{
+	0, 1880, 0, 0, 1881, 0, 0, 0, 1882, 0, 1883, 0, 0, 1884, 0, 0,
+	0, 0, 0, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+	1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
+	1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 0, 1926, 0, 1927,
+	0, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 0, 1939, 0, 1940,
+	0, 1941, 1942, 1943, 0, 0, 1944, 1945, 1946, 0, 1947, 1948, 1949, 1950, 1951, 0,
+	0, 0, 1952, 0, 1953, 0, 1954, 0, 1955, 0, 1956, 1957, 1958, 0, 0, 1959,
+	1960, 1961, 0, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974,
+	1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990,
+	1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 0, 2005,
+	2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021,
+	2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+	2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+	2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069,
+	2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085,
+	2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101,
+	},
+	{
+	2102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2108, 2109, 2110,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2111, 2112, 2113, 0, 2114, 2115, 0, 0, 2116, 2117, 2118, 2119, 2120, 0, 2121, 0,
+	2122, 2123, 0, 2124, 0, 0, 0, 2125, 0, 0, 0, 2126, 0, 2127, 2128, 2129,
+	2130, 0, 2131, 2132, 0, 0, 0, 2133, 0, 0, 0, 2134, 2135, 0, 2136, 2137,
+	0, 0, 2138, 0, 2139, 2140, 0, 0, 0, 2141, 2142, 0, 0, 0, 2143, 2144,
+	0, 0, 2145, 0, 0, 0, 2146, 2147, 0, 0, 0, 2148, 0, 0, 2149, 0,
+	2150, 0, 2151, 2152, 2153, 0, 0, 0, 0, 0, 0, 2154, 2155, 0, 0, 0,
+	},
+	{
+	2156, 0, 0, 2157, 0, 0, 0, 0, 0, 0, 0, 0, 2158, 2159, 2160, 2161,
+	2162, 2163, 2164, 2165, 2166, 2167, 0, 2168, 2169, 2170, 2171, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2172, 0, 0, 0, 2173, 2174, 2175, 2176, 2177,
+	0, 2178, 0, 2179, 0, 0, 0, 2180, 2181, 0, 2182, 2183, 2184, 2185, 2186, 2187,
+	2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 0, 0, 2196, 0, 2197, 0, 2198, 0,
+	0, 0, 0, 0, 2199, 0, 0, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208,
+	2209, 2210, 2211, 2212, 2213, 0, 0, 2214, 2215, 2216, 2217, 0, 0, 2218, 0, 2219,
+	0, 0, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233,
+	2234, 2235, 0, 0, 0, 2236, 2237, 2238, 2239, 0, 0, 0, 0, 2240, 0, 0,
+	0, 0, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254,
+	0, 0, 0, 0, 0, 2255, 0, 0, 0, 0, 2256, 0, 2257, 2258, 2259, 2260,
+	2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 0, 0, 0, 0, 0, 2271,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2272, 2273, 2274, 2275, 2276, 2277, 0,
+	0, 2278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2279, 2280, 2281, 2282,
+	2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302,
+	},
+	{
+	2303, 2304, 2305, 2306, 0, 0, 0, 0, 0, 0, 0, 0, 2307, 2308, 2309, 2310,
+	0, 0, 0, 0, 0, 0, 0, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+	2320, 2321, 2322, 2323, 2324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2325,
+	2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 0, 0, 0,
+	2339, 2340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2341, 2342,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2343, 2344, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2345, 2346, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2347, 0, 0, 0, 0, 2348, 2349, 2350, 2351,
+	2352, 2353, 2354, 2355, 2356, 2357, 0, 2358, 0, 0, 0, 0, 0, 0, 2359, 2360,
+	2361, 2362, 2363, 2364, 2365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2366,
+	0, 0, 0, 0, 2367, 2368, 0, 2369, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2370, 2371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2372, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2373, 0, 0, 0, 0, 2374,
+	2375, 0, 0, 0, 0, 0, 0, 2376, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 2377, 2378, 2379, 0, 0, 2380, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2381, 2382, 2383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2384, 2385,
+	0, 0, 0, 0, 2386, 2387, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2388, 2389, 2390,
+	2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 0, 0,
+	2405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2406, 0, 0, 0, 0, 2407, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2408, 2409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2410, 0, 0, 0,
+	0, 0, 0, 0, 0, 2411, 2412, 0, 2413, 0, 0, 0, 0, 0, 0, 0,
+	0, 2414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2415, 2416, 2417, 0, 0,
+	2418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2419, 2420, 2421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2422, 2423, 2424, 2425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2426, 2427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2428, 2429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442,
+	2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458,
+	2459, 2460, 2461, 2462, 2463, 2464, 0, 0, 0, 2465, 2466, 0, 0, 2467, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 2468, 0, 0, 0, 0, 0, 2469, 0, 2470, 2471, 2472, 2473, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2475, 2476, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2477, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2478, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2479, 0, 0, 2480, 0, 0, 2481, 0, 0, 0, 0, 0, 0,
+	0, 0, 2482, 0, 0, 0, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492,
+	2493, 2494, 2495, 2496, 0, 0, 0, 0, 0, 0, 0, 2497, 2498, 2499, 0, 0,
+	2500, 0, 0, 2501, 2502, 2503, 0, 0, 2504, 0, 2505, 0, 0, 2506, 0, 0,
+	2507, 0, 2508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 0, 0, 0, 0,
+	2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2533, 2534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2535, 2536, 2537, 2538, 2539, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 0,
+	2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565,
+	2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 0, 0, 2579,
+	2580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2582, 0, 2583, 0, 0, 0, 0,
+	2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	2599, 2600, 2601, 2602, 2603, 0, 2604, 0, 2605, 0, 2606, 0, 2607, 0, 2608, 0,
+	0, 0, 2609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621,
+	2622, 2623, 2624, 2625, 2626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2627, 2628, 0, 0, 0, 0, 2629, 0, 0, 0, 2630, 0, 0, 2631,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2632, 2633, 2634, 2635, 2636,
+	2637, 2638, 2639, 2640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2641, 2642, 2643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666,
+	2667, 2668, 2669, 2670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682,
+	2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 0, 0, 0, 0, 2691, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2692,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708,
+	2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 0, 0, 0, 0, 2718, 0, 0,
+	0, 0, 0, 0, 2719, 0, 0, 2720, 2721, 2722, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 2723, 0, 0, 0, 2724, 0, 0, 2725, 0, 2726, 0, 2727,
+	2728, 2729, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 2731, 0, 0, 0,
+	2732, 2733, 2734, 0, 2735, 0, 2736, 2737, 2738, 2739, 0, 2740, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2741, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2743, 0, 0, 2744, 2745,
+	2746, 0, 2747, 2748, 2749, 2750, 2751, 0, 2752, 0, 0, 2753, 2754, 2755, 2756, 2757,
+	0, 0, 0, 2758, 0, 0, 0, 0, 0, 0, 0, 0, 2759, 0, 0, 0,
+	2760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2761,
+	0, 0, 2762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2763, 2764, 0, 0, 0, 0,
+	2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780,
+	2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796,
+	2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812,
+	2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 0, 2823, 2824, 2825, 2826, 2827,
+	},
+	{
+	2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843,
+	2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859,
+	2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875,
+	2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891,
+	2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907,
+	2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923,
+	2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939,
+	2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955,
+	2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971,
+	2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 0, 2984, 0, 0,
+	2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000,
+	3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016,
+	3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032,
+	3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048,
+	3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064,
+	3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 0, 0, 0, 0, 0, 3075,
+	},
+	{
+	3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091,
+	3092, 3093, 3094, 3095, 3096, 3097, 0, 0, 3098, 3099, 3100, 3101, 3102, 3103, 0, 0,
+	3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119,
+	3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135,
+	3136, 3137, 3138, 3139, 3140, 3141, 0, 0, 3142, 3143, 3144, 3145, 3146, 3147, 0, 0,
+	3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 0, 3156, 0, 3157, 0, 3158, 0, 3159,
+	3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175,
+	3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 0, 0,
+	3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205,
+	3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221,
+	3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237,
+	3238, 3239, 3240, 3241, 3242, 0, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252,
+	3253, 3254, 3255, 3256, 3257, 0, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267,
+	3268, 3269, 3270, 3271, 0, 0, 3272, 3273, 3274, 3275, 3276, 3277, 0, 3278, 3279, 3280,
+	3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
+	0, 0, 3297, 3298, 3299, 0, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 0,
+	},
+	{
+	3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324,
+	3325, 3326, 3327, 3328, 3329, 3330, 3331, 0, 3332, 3333, 3334, 3335, 3336, 3337, 0, 3338,
+	0, 0, 3339, 0, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351,
+	3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 0, 3360, 3361, 0, 3362, 0, 3363, 0,
+	0, 3364, 0, 3365, 3366, 0, 0, 3367, 3368, 3369, 0, 0, 0, 0, 3370, 0,
+	0, 0, 3371, 3372, 0, 0, 0, 3373, 0, 0, 3374, 0, 0, 3375, 3376, 3377,
+	3378, 3379, 3380, 3381, 3382, 0, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392,
+	3393, 0, 0, 0, 0, 0, 0, 0, 0, 3394, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3395, 0, 0, 3396, 3397, 0, 0, 3398, 3399, 0, 3400, 3401, 3402, 3403, 0,
+	0, 0, 0, 0, 0, 0, 3404, 0, 0, 0, 0, 0, 0, 3405, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421,
+	3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+	3438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	3439, 3440, 3441, 3442, 0, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+	3454, 3455, 3456, 3457, 0, 3458, 3459, 0, 0, 3460, 3461, 3462, 3463, 3464, 0, 0,
+	0, 3465, 0, 0, 3466, 0, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476,
+	3477, 3478, 0, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 0, 3486, 3487, 3488, 3489, 3490,
+	3491, 3492, 3493, 3494, 0, 3495, 3496, 3497, 3498, 3499, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515,
+	3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531,
+	0, 0, 0, 3532, 3533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3534, 0, 0, 0, 3535, 0, 0, 0, 0, 3536, 3537, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3538, 0,
+	0, 0, 0, 0, 0, 3539, 0, 0, 0, 0, 0, 0, 0, 0, 3540, 3541,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3542, 3543, 3544,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	3545, 0, 0, 3546, 3547, 0, 3548, 0, 0, 3549, 0, 0, 3550, 0, 0, 3551,
+	0, 3552, 3553, 0, 3554, 3555, 3556, 3557, 3558, 3559, 0, 0, 0, 0, 3560, 0,
+	0, 0, 0, 3561, 3562, 3563, 3564, 0, 3565, 3566, 3567, 3568, 3569, 3570, 0, 3571,
+	3572, 0, 0, 0, 0, 0, 3573, 0, 3574, 0, 0, 0, 3575, 0, 0, 0,
+	0, 3576, 0, 0, 3577, 0, 0, 3578, 0, 3579, 0, 0, 0, 0, 0, 0,
+	3580, 3581, 0, 0, 0, 0, 0, 3582, 0, 3583, 3584, 0, 0, 0, 3585, 0,
+	3586, 0, 3587, 3588, 0, 0, 0, 0, 0, 0, 3589, 3590, 0, 3591, 3592, 3593,
+	3594, 3595, 0, 0, 3596, 3597, 0, 0, 3598, 3599, 0, 0, 0, 0, 0, 0,
+	3600, 3601, 3602, 3603, 3604, 3605, 0, 0, 3606, 3607, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3608, 3609, 0, 0, 3610, 0, 0, 0, 3611, 0, 0,
+	0, 0, 0, 0, 3612, 3613, 0, 0, 0, 0, 0, 0, 3614, 3615, 3616, 3617,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3618, 3619, 3620, 3621, 3622, 3623, 0, 0, 3624, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3625, 3626, 3627, 3628, 0, 0, 0, 0, 0, 0,
+	3629, 3630, 3631, 3632, 0, 0, 0, 0, 0, 0, 3633, 3634, 3635, 3636, 3637, 3638,
+	0, 0, 0, 0, 3639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640,
+	},
+	{
+	3641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3642, 0, 0, 0, 3643, 3644, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3646, 3647, 0, 3648, 0, 0, 3649,
+	0, 3650, 3651, 3652, 3653, 3654, 0, 0, 3655, 3656, 0, 3657, 3658, 0, 0, 0,
+	0, 0, 0, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 0, 0, 0, 0, 3667,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3668, 0, 0, 3669,
+	0, 0, 3670, 0, 0, 3671, 0, 0, 0, 0, 3672, 0, 0, 0, 3673, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3674, 3675, 3676, 0, 0, 3677, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3678, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3679, 3680, 3681, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3682, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704,
+	3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720,
+	3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736,
+	3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752,
+	3753, 3754, 3755, 3756, 3757, 3758, 0, 0, 3759, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3760, 0, 3761, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3762, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	3763, 3764, 0, 3765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3766,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3768, 0, 3769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3770, 0, 0, 0, 0, 0, 0, 0,
+	3771, 0, 0, 0, 3772, 0, 0, 3773, 0, 0, 0, 0, 0, 3774, 0, 0,
+	3775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3776, 0, 3777, 0, 0, 0, 3778, 3779, 0, 3780, 0, 0, 3781, 0, 0,
+	0, 3782, 0, 0, 0, 0, 0, 3783, 0, 0, 3784, 3785, 0, 0, 3786, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3787, 0, 0, 0, 0, 0, 3788, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3789, 0, 0, 0, 0, 0, 0,
+	3790, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3792, 0, 0, 0, 0, 0, 0, 0, 3793, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3794, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3795, 0, 0, 0, 0, 0, 0, 3796, 3797, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3798, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3799, 3800, 0, 0, 0, 0, 3801, 3802,
+	0, 0, 3803, 3804, 3805, 3806, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3807, 3808, 3809, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3810, 0, 0, 0, 0, 0, 3811, 3812, 0, 3813, 0, 3814, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3815, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3816, 3817, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	3818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3819, 3820, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3821, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 3823, 3824,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3825, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3827, 0,
+	0, 0, 0, 0, 3828, 3829, 0, 3830, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3831, 0, 0, 3832, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3833, 3834, 3835, 0, 3836, 3837, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	3838, 3839, 3840, 3841, 3842, 3843, 3844, 0, 0, 0, 0, 0, 3845, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3846, 0, 0,
+	3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 0, 3855, 3856, 0, 0, 0, 0, 3857,
+	3858, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3859, 3860, 3861,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3862, 0, 0, 0, 3863, 0,
+	0, 0, 0, 0, 3864, 3865, 3866, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3867, 0, 0, 0, 0, 3868, 3869, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3870, 0, 0, 0, 0, 3871, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3872, 0, 3873, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3874, 3875, 3876, 3877,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3878, 0, 3879, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3880, 3881, 3882, 0, 3883, 3884, 0, 0, 0, 0, 3885, 0,
+	0, 0, 3886, 0, 3887, 3888, 3889, 0, 3890, 0, 3891, 0, 0, 0, 3892, 3893,
+	3894, 0, 3895, 3896, 3897, 3898, 3899, 0, 3900, 0, 3901, 3902, 3903, 3904, 3905, 0,
+	0, 3906, 0, 0, 3907, 0, 0, 0, 0, 0, 3908, 0, 3909, 3910, 0, 0,
+	0, 0, 0, 0, 0, 0, 3911, 0, 0, 0, 3912, 0, 3913, 3914, 0, 0,
+	3915, 3916, 3917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3918, 0, 0, 0,
+	0, 0, 0, 0, 3919, 0, 0, 0, 0, 3920, 0, 0, 0, 0, 0, 3921,
+	3922, 3923, 0, 0, 0, 0, 0, 0, 0, 3924, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3925, 0, 0, 0, 0, 0, 3926, 3927, 3928, 3929, 0, 0, 0, 0, 0,
+	0, 3930, 0, 0, 0, 0, 0, 0, 3931, 3932, 0, 0, 0, 0, 0, 3933,
+	0, 3934, 0, 0, 3935, 3936, 0, 0, 0, 3937, 0, 0, 0, 3938, 0, 0,
+	3939, 0, 0, 3940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3941,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957,
+	3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3974, 0, 0, 0, 3975, 3976,
+	0, 0, 0, 0, 0, 0, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 0, 3984, 0,
+	3985, 3986, 3987, 0, 0, 3988, 0, 0, 0, 3989, 0, 0, 0, 3990, 0, 3991,
+	3992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3993, 3994, 0, 3995, 0, 0, 0, 3996, 0, 3997, 0, 0, 3998, 3999,
+	4000, 0, 4001, 4002, 4003, 0, 4004, 4005, 4006, 4007, 0, 4008, 0, 0, 4009, 4010,
+	4011, 4012, 4013, 4014, 4015, 0, 4016, 0, 4017, 0, 0, 4018, 0, 4019, 0, 4020,
+	0, 4021, 4022, 0, 0, 0, 0, 0, 0, 4023, 4024, 0, 0, 0, 4025, 4026,
+	4027, 4028, 4029, 4030, 4031, 4032, 0, 0, 4033, 4034, 0, 4035, 4036, 4037, 0, 4038,
+	4039, 4040, 4041, 4042, 4043, 0, 4044, 0, 4045, 4046, 4047, 4048, 4049, 4050, 0, 4051,
+	4052, 0, 4053, 0, 4054, 4055, 0, 0, 4056, 4057, 0, 4058, 4059, 4060, 4061, 4062,
+	4063, 0, 4064, 4065, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081,
+	4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097,
+	4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113,
+	4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129,
+	4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145,
+	4146, 4147, 4148, 4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161,
+	4162, 4163, 4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177,
+	4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192, 4193,
+	4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209,
+	4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224, 4225,
+	4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241,
+	4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257,
+	4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273,
+	4274, 4275, 4276, 4277, 4278, 4279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	4280, 0, 4281, 4282, 0, 0, 0, 4283, 4284, 4285, 0, 0, 0, 0, 0, 0,
+	0, 0, 4286, 0, 4287, 4288, 0, 0, 0, 0, 4289, 4290, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4291, 4292, 4293, 4294, 4295, 4296,
+	0, 0, 0, 4297, 0, 0, 4298, 0, 4299, 4300, 4301, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4302, 0, 4303, 4304,
+	4305, 0, 4306, 0, 4307, 0, 4308, 0, 4309, 0, 4310, 0, 4311, 0, 4312, 0,
+	4313, 0, 4314, 0, 0, 4315, 0, 4316, 0, 4317, 0, 0, 0, 0, 0, 0,
+	4318, 4319, 0, 4320, 4321, 0, 4322, 4323, 0, 4324, 4325, 0, 4326, 4327, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4328, 0, 0, 0, 0, 4329, 4330, 4331, 4332, 0, 4333, 0,
+	4334, 0, 0, 0, 4335, 0, 0, 0, 4336, 0, 0, 4337, 4338, 0, 4339, 0,
+	4340, 0, 4341, 0, 4342, 0, 4343, 0, 4344, 0, 4345, 0, 4346, 0, 4347, 4348,
+	4349, 0, 4350, 0, 0, 4351, 0, 4352, 4353, 4354, 0, 4355, 0, 0, 4356, 4357,
+	4358, 4359, 0, 4360, 4361, 0, 4362, 4363, 4364, 4365, 4366, 0, 4367, 4368, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4369, 0, 0,
+	0, 0, 0, 0, 4370, 0, 0, 4371, 4372, 4373, 4374, 4375, 0, 0, 4376, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386, 4387, 4388, 4389, 4390, 4391,
+	4392, 4393, 4394, 4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407,
+	4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 4419, 4420, 4421, 4422, 4423,
+	4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439,
+	4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455,
+	4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4471, 4472, 0, 4473, 4474, 0, 4475, 0, 0, 0, 4476, 4477, 0, 0, 0, 4478,
+	4479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495,
+	4496, 4497, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 0,
+	4511, 4512, 4513, 4514, 4515, 4516, 4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526,
+	4527, 4528, 4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542,
+	4543, 4544, 4545, 4546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4547, 4548, 4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4559, 4560, 4561, 4562, 4563, 4564, 4565, 4566,
+	4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582,
+	4583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599,
+	4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4616, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	4618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4619, 0, 0, 0, 0, 0, 0, 0, 0, 4620,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 4621, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4622, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4623,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4624, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4625, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4626, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4627,
+	},
+	{
+	4628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4629, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4630, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4631, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4632, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4633, 0, 0, 0, 0, 0, 4634, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4635, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4636, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4637,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4638, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4639, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4640, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4641,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4642, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4643, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4644, 0, 0, 0, 0, 0,
+	4645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4646, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 4647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4648, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4650, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4651,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4653, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4654, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4655,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4657, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4658, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4659, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4660, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4661, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4662, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4663, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4665, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4667, 0, 0, 0, 0, 0, 0, 0, 4668, 0, 4669, 0,
+	0, 0, 0, 0, 0, 0, 0, 4670, 4671, 0, 0, 0, 4672, 0, 0, 0,
+	4673, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4674, 0, 0, 0, 4675, 4676,
+	4677, 0, 4678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4679, 4680, 4681, 4682, 4683, 0, 4684, 4685, 0, 4686, 4687, 4688, 4689, 4690, 4691, 4692,
+	4693, 4694, 4695, 4696, 0, 4697, 4698, 4699, 0, 0, 4700, 4701, 4702, 4703, 4704, 4705,
+	4706, 4707, 4708, 4709, 4710, 4711, 0, 4712, 4713, 4714, 4715, 4716, 0, 4717, 4718, 4719,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4720, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4721, 4722, 0, 4723, 0, 0, 0, 0, 0, 4724, 0, 0,
+	4725, 4726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4727, 0, 0, 0, 0, 0, 0, 4728,
+	4729, 4730, 4731, 0, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4743, 0, 0, 4744, 4745, 4746, 0, 0, 0, 4747, 4748,
+	0, 4749, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4750, 4751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4752, 4753, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4754, 0, 0, 0, 4755,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4756, 0, 0, 0, 4757,
+	4758, 4759, 0, 0, 4760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4761, 0, 4762, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4763, 4764, 0, 0, 0, 0, 0, 0,
+	0, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 0, 0,
+	4778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4779, 4780, 0, 0, 4781, 4782,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4783, 0, 0, 0, 0, 0,
+	0, 4784, 0, 0, 0, 0, 0, 0, 0, 0, 4785, 4786, 0, 0, 4787, 0,
+	0, 0, 0, 0, 0, 0, 0, 4788, 4789, 0, 4790, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4791, 0, 0, 4792, 0, 0, 4793,
+	0, 0, 0, 0, 0, 4794, 0, 0, 4795, 4796, 4797, 4798, 0, 4799, 4800, 4801,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4802, 0, 0, 0, 0,
+	0, 4803, 4804, 4805, 4806, 4807, 4808, 4809, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4810, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 4811, 0, 0, 0, 4812, 0, 0, 0, 0, 4813, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4814, 4815, 4816, 4817, 4818, 0, 0, 0, 0, 0, 0, 0, 0,
+	4819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4820, 4821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833,
+	4834, 4835, 4836, 4837, 4838, 4839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855,
+	4856, 4857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4858,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875,
+	4876, 4877, 4878, 4879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895,
+	4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 0, 0, 0,
+	4909, 4910, 4911, 4912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4914, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927,
+	4928, 0, 0, 0, 0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0, 4930,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4932, 4933, 4934, 4935, 4936, 4937, 4938,
+	4939, 4940, 4941, 4942, 4943, 4944, 4945, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4946, 0, 0, 0, 0, 0, 0, 0, 0, 4947, 4948, 0, 0,
+	0, 0, 0, 4949, 0, 0, 4950, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4951, 4952, 4953, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4954, 0, 4955, 4956, 4957, 0, 0, 4958, 4959, 0, 0, 0, 0, 0, 4960, 4961,
+	0, 4962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4963, 4964, 4965, 4966, 4967,
+	0, 0, 0, 0, 0, 4968, 4969, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4970, 0, 0, 4971, 0, 0, 0, 0, 0, 0, 0, 4972, 4973, 4974,
+	0, 4975, 4976, 0, 0, 0, 0, 4977, 4978, 0, 0, 0, 0, 4979, 4980, 0,
+	0, 0, 4981, 4982, 0, 4983, 0, 0, 0, 0, 4984, 0, 0, 0, 0, 0,
+	4985, 0, 4986, 4987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4988, 4989, 4990, 0, 4991, 4992, 0, 0, 0, 0, 4993, 4994, 4995, 0, 4996, 0,
+	4997, 4998, 0, 4999, 0, 0, 0, 5000, 0, 0, 0, 5001, 0, 0, 5002, 0,
+	5003, 0, 0, 5004, 0, 0, 0, 0, 0, 0, 0, 5005, 5006, 0, 0, 5007,
+	0, 0, 5008, 0, 0, 0, 0, 0, 0, 5009, 5010, 0, 0, 0, 5011, 5012,
+	0, 0, 5013, 0, 0, 0, 5014, 0, 0, 0, 0, 5015, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 0, 5024, 5025, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041,
+	5042, 5043, 5044, 5045, 5046, 5047, 5048, 0, 0, 0, 0, 5049, 5050, 5051, 5052, 5053,
+	5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069,
+	5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085,
+	5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 0, 0, 0, 0,
+	},
+	{
+	5098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5099,
+	5100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5101,
+	},
+	{
+	5102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5103,
+	},
+	{
+	5104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5105,
+	},
+	{
+	5106, 5107, 5108, 5109, 5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5119, 5120, 5121,
+	5122, 5123, 5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137,
+	5138, 5139, 5140, 5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153,
+	5154, 5155, 5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164, 5165, 5166, 5167, 5168, 5169,
+	5170, 5171, 5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5185,
+	5186, 5187, 5188, 5189, 5190, 5191, 5192, 5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200, 5201,
+	5202, 5203, 5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215, 5216, 5217,
+	5218, 5219, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 5232, 5233,
+	5234, 5235, 5236, 5237, 5238, 5239, 5240, 5241, 5242, 5243, 5244, 5245, 5246, 5247, 5248, 5249,
+	5250, 5251, 5252, 5253, 5254, 5255, 5256, 5257, 5258, 5259, 5260, 5261, 5262, 5263, 5264, 5265,
+	5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5281,
+	5282, 5283, 5284, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295, 5296, 5297,
+	5298, 5299, 5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313,
+	5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329,
+	5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345,
+	5346, 5347, 5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5360, 5361,
+	},
+	{
+	5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 0, 0,
+	5376, 0, 5377, 0, 0, 5378, 5379, 5380, 5381, 5382, 5383, 5384, 5385, 5386, 5387, 0,
+	5388, 0, 5389, 0, 0, 5390, 5391, 0, 0, 0, 5392, 5393, 5394, 5395, 5396, 5397,
+	5398, 5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412, 5413,
+	5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423, 5424, 5425, 5426, 5427, 5428, 5429,
+	5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5445,
+	5446, 5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 5458, 5459, 0, 0,
+	5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472, 5473, 5474, 5475,
+	5476, 5477, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489, 5490, 5491,
+	5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504, 5505, 5506, 5507,
+	5508, 5509, 5510, 5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520, 5521, 5522, 5523,
+	5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539,
+	5540, 5541, 5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5551, 5552, 5553, 5554, 5555,
+	5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	5566, 5567, 5568, 5569, 5570, 0, 5571, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5572, 5573, 5574, 5575, 5576, 0, 0, 0, 0, 0, 5577, 5578, 5579,
+	5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590, 5591, 5592, 5593, 5594, 5595,
+	5596, 5597, 5598, 5599, 5600, 5601, 5602, 0, 5603, 5604, 5605, 5606, 5607, 0, 5608, 0,
+	5609, 5610, 0, 5611, 5612, 0, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5622,
+	5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636, 5637, 5638,
+	5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5653, 5654,
+	5655, 5656, 5657, 5658, 5659, 5660, 5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669, 5670,
+	5671, 5672, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683, 5684, 5685, 5686,
+	5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696, 5697, 5698, 5699, 5700, 5701, 5702,
+	5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5715, 5716, 5717, 5718,
+	5719, 5720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733,
+	5734, 5735, 5736, 5737, 5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746, 5747, 5748, 5749,
+	5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758, 5759, 5760, 5761, 5762, 5763, 5764, 5765,
+	},
+	{
+	5766, 5767, 5768, 5769, 5770, 5771, 5772, 5773, 5774, 5775, 5776, 5777, 5778, 5779, 5780, 5781,
+	5782, 5783, 5784, 5785, 5786, 5787, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795, 5796, 5797,
+	5798, 5799, 5800, 5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5810, 5811, 5812, 5813,
+	5814, 5815, 5816, 5817, 5818, 5819, 5820, 5821, 5822, 5823, 5824, 5825, 5826, 5827, 5828, 5829,
+	5830, 5831, 5832, 5833, 5834, 5835, 5836, 5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 5845,
+	5846, 5847, 5848, 5849, 5850, 5851, 5852, 5853, 5854, 5855, 5856, 5857, 5858, 5859, 5860, 5861,
+	5862, 5863, 5864, 5865, 5866, 5867, 5868, 5869, 5870, 5871, 5872, 5873, 5874, 5875, 5876, 5877,
+	5878, 5879, 5880, 5881, 5882, 5883, 5884, 5885, 5886, 5887, 5888, 5889, 5890, 5891, 5892, 5893,
+	5894, 5895, 5896, 5897, 5898, 5899, 5900, 5901, 5902, 5903, 5904, 5905, 5906, 5907, 5908, 5909,
+	5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922, 5923, 5924, 5925,
+	5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935, 5936, 5937, 5938, 5939, 5940, 5941,
+	5942, 5943, 5944, 5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952, 5953, 5954, 5955, 5956, 5957,
+	5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966, 5967, 5968, 5969, 5970, 5971, 5972, 5973,
+	5974, 5975, 5976, 5977, 5978, 5979, 5980, 5981, 5982, 5983, 5984, 5985, 5986, 5987, 5988, 5989,
+	5990, 5991, 5992, 5993, 5994, 5995, 5996, 5997, 5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005,
+	6006, 6007, 6008, 6009, 6010, 6011, 6012, 6013, 6014, 6015, 6016, 6017, 6018, 6019, 6020, 6021,
+	},
+	{
+	6022, 6023, 6024, 6025, 6026, 6027, 6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036, 6037,
+	6038, 6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046, 6047, 6048, 6049, 6050, 6051, 6052, 6053,
+	6054, 6055, 6056, 6057, 6058, 6059, 6060, 6061, 6062, 6063, 6064, 6065, 6066, 6067, 6068, 6069,
+	6070, 6071, 6072, 6073, 6074, 6075, 6076, 6077, 6078, 6079, 6080, 6081, 6082, 6083, 6084, 6085,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6086, 6087, 6088, 6089, 6090, 6091, 6092, 6093, 6094, 6095, 6096, 6097, 6098, 6099, 6100, 6101,
+	6102, 6103, 6104, 6105, 6106, 6107, 6108, 6109, 6110, 6111, 6112, 6113, 6114, 6115, 6116, 6117,
+	6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125, 6126, 6127, 6128, 6129, 6130, 6131, 6132, 6133,
+	6134, 6135, 6136, 6137, 6138, 6139, 6140, 6141, 6142, 6143, 6144, 6145, 6146, 6147, 6148, 6149,
+	0, 0, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6159, 6160, 6161, 6162, 6163,
+	6164, 6165, 6166, 6167, 6168, 6169, 6170, 6171, 6172, 6173, 6174, 6175, 6176, 6177, 6178, 6179,
+	6180, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191, 6192, 6193, 6194, 6195,
+	6196, 6197, 6198, 6199, 6200, 6201, 6202, 6203, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6204, 6205, 6206, 6207, 6208, 6209, 6210, 6211, 6212, 6213, 6214, 6215, 6216, 0, 0, 0,
+	},
+	{
+	6217, 6218, 6219, 6220, 6221, 6222, 6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 6232,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6233, 0, 0, 0, 0, 0, 0,
+	6234, 6235, 6236, 6237, 6238, 6239, 6240, 6241, 6242, 6243, 6244, 6245, 6246, 6247, 6248, 6249,
+	6250, 6251, 0, 0, 6252, 6253, 6254, 6255, 6256, 6257, 6258, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6259, 6260, 6261, 6262, 6263, 6264, 6265,
+	0, 0, 0, 0, 0, 0, 0, 0, 6266, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6267, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6279, 6280, 6281, 6282, 6283,
+	6284, 6285, 6286, 6287, 6288, 6289, 6290, 6291, 6292, 6293, 6294, 6295, 6296, 6297, 6298, 6299,
+	6300, 6301, 6302, 6303, 6304, 6305, 6306, 6307, 6308, 6309, 6310, 6311, 6312, 6313, 6314, 6315,
+	6316, 6317, 6318, 6319, 6320, 6321, 6322, 6323, 6324, 6325, 6326, 6327, 6328, 6329, 6330, 6331,
+	6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339, 6340, 6341, 6342, 6343, 6344, 6345, 6346, 6347,
+	6348, 6349, 6350, 6351, 6352, 6353, 6354, 6355, 6356, 6357, 6358, 6359, 6360, 6361, 6362, 6363,
+	6364, 6365, 6366, 6367, 6368, 6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379,
+	6380, 6381, 6382, 6383, 6384, 6385, 6386, 6387, 6388, 6389, 6390, 6391, 6392, 0, 0, 6393,
+	},
+	{
+	0, 6394, 6395, 0, 0, 0, 0, 6396, 0, 0, 0, 0, 0, 6397, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6398, 0, 0, 0, 0, 0,
+	0, 6399, 6400, 6401, 0, 6402, 0, 0, 6403, 6404, 6405, 6406, 0, 6407, 6408, 6409,
+	6410, 0, 0, 6411, 6412, 0, 0, 0, 6413, 6414, 6415, 6416, 6417, 6418, 6419, 0,
+	6420, 6421, 0, 6422, 0, 6423, 0, 6424, 6425, 6426, 6427, 0, 6428, 0, 0, 6429,
+	6430, 0, 0, 6431, 0, 0, 6432, 0, 6433, 6434, 0, 0, 6435, 0, 6436, 0,
+	0, 0, 0, 0, 0, 6437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6438, 0, 0, 0, 0, 6439, 0, 0, 0, 0, 6440, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6441, 6442, 6443, 6444, 0, 0, 0,
+	},
+	{
+	0, 6445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6446, 0,
+	0, 0, 0, 0, 0, 0, 6447, 6448, 6449, 6450, 0, 0, 0, 0, 0, 0,
+	6451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6452, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6453, 0, 0, 6454, 6455, 6456, 0, 0, 6457, 0, 0, 6458, 0, 0,
+	6459, 0, 6460, 0, 6461, 6462, 6463, 6464, 0, 0, 0, 6465, 0, 0, 0, 0,
+	6466, 6467, 6468, 6469, 0, 6470, 0, 0, 0, 0, 0, 6471, 0, 6472, 0, 0,
+	6473, 6474, 6475, 6476, 6477, 6478, 6479, 0, 6480, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6481,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6482, 6483, 0, 0, 6484, 0, 0, 0, 6485, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6486, 0, 0, 6487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 6488, 6489, 0, 0, 0, 0, 0, 0, 6490, 0, 0, 0, 0, 0, 0,
+	0, 6491, 6492, 0, 0, 6493, 0, 6494, 0, 0, 6495, 0, 0, 0, 0, 6496,
+	6497, 0, 6498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6499, 6500, 6501, 6502, 6503, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6504, 0, 6505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 6506, 0, 0, 6507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6508, 0, 0, 0, 6509, 0, 0, 0, 0, 0, 6510, 0, 0, 0, 6511,
+	6512, 0, 0, 6513, 0, 6514, 0, 0, 0, 6515, 6516, 0, 6517, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6518, 0, 6519,
+	0, 0, 6520, 6521, 0, 0, 0, 0, 6522, 0, 0, 6523, 0, 6524, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6526, 0, 0, 0, 6527, 0, 0, 0, 0, 0, 0, 0, 6528, 0, 0, 0,
+	0, 0, 6529, 6530, 6531, 0, 0, 0, 0, 0, 0, 0, 0, 6532, 6533, 0,
+	6534, 6535, 6536, 0, 0, 0, 0, 0, 6537, 0, 0, 6538, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6539, 6540, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6541, 0, 0, 6542, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6543, 0, 0, 6544, 0, 6545, 0, 0, 0, 6546, 6547, 0, 0,
+	0, 0, 0, 0, 0, 6548, 6549, 6550, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 6551, 6552, 6553, 0, 6554, 6555, 0, 0, 0, 0, 0, 6556, 6557, 6558, 6559,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6560, 6561, 6562, 0, 0, 0, 0, 6563,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6564, 0, 0, 0, 0, 0, 0, 6565, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6566, 6567, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6568, 0, 6569, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6570, 6571, 6572, 6573, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6574, 6575, 6576, 6577, 6578, 6579, 6580, 6581, 6582, 6583,
+	6584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	6585, 6586, 6587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6588, 6589, 6590, 6591, 6592, 6593, 6594, 6595,
+	6596, 6597, 6598, 6599, 6600, 6601, 6602, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6603,
+	6604, 6605, 6606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6607, 0, 6608, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6609, 0, 0, 0, 0,
+	6610, 6611, 6612, 6613, 6614, 6615, 6616, 6617, 6618, 6619, 6620, 6621, 0, 6622, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6623, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	6624, 6625, 6626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6627, 6628, 6629, 6630, 6631, 6632, 6633, 6634, 6635,
+	6636, 6637, 6638, 6639, 6640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6641, 6642, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6644, 6645, 6646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6647, 6648, 6649, 6650, 6651, 6652, 6653, 6654, 6655, 6656, 6657, 6658, 6659,
+	6660, 0, 0, 0, 0, 0, 0, 6661, 0, 6662, 6663, 6664, 6665, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6666, 6667, 0, 6668, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6669, 6670, 6671, 6672,
+	6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 0, 0, 0, 0, 0, 0, 6681, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6682,
+	6683, 6684, 6685, 6686, 6687, 6688, 6689, 6690, 6691, 6692, 6693, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	6694, 6695, 6696, 6697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6698, 6699, 0, 6700, 6701,
+	6702, 6703, 6704, 6705, 6706, 0, 0, 6707, 6708, 0, 0, 6709, 6710, 6711, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6712, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6713, 6714, 0, 0, 6715, 6716, 6717, 6718, 6719, 6720, 6721, 0, 0, 0,
+	6722, 6723, 6724, 6725, 6726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6727, 0, 0, 0, 0, 0, 6728, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6729, 0, 0, 0, 0, 0, 6730, 0, 0, 6731, 0, 6732,
+	0, 0, 0, 0, 0, 6733, 6734, 6735, 6736, 6737, 6738, 6739, 6740, 6741, 6742, 6743,
+	6744, 6745, 6746, 6747, 6748, 6749, 6750, 0, 0, 0, 0, 0, 6751, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6752, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6753, 0, 6754, 0, 6755, 0, 6756, 6757, 0, 6758, 0, 6759, 6760, 6761,
+	6762, 6763, 6764, 6765, 0, 0, 0, 6766, 6767, 6768, 6769, 6770, 0, 6771, 6772, 0,
+	6773, 6774, 6775, 6776, 6777, 6778, 6779, 6780, 6781, 6782, 6783, 6784, 6785, 6786, 6787, 6788,
+	6789, 6790, 6791, 6792, 6793, 6794, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6795, 6796, 6797, 0, 0, 0, 6798, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6799,
+	6800, 6801, 6802, 6803, 6804, 6805, 0, 0, 6806, 6807, 6808, 6809, 6810, 6811, 6812, 6813,
+	6814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6815, 6816, 6817, 6818, 6819, 6820, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6821, 6822, 6823, 6824, 6825, 6826, 6827, 6828, 6829, 6830, 6831, 6832, 6833, 6834, 6835, 6836,
+	6837, 0, 6838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6839, 6840, 6841, 6842, 6843,
+	6844, 6845, 6846, 6847, 6848, 6849, 6850, 6851, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	6852, 0, 0, 0, 0, 0, 6853, 0, 0, 0, 6854, 0, 0, 0, 6855, 6856,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6857, 6858, 6859,
+	6860, 6861, 6862, 6863, 6864, 6865, 6866, 6867, 6868, 6869, 6870, 6871, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6872, 6873, 6874, 6875,
+	6876, 6877, 6878, 6879, 6880, 6881, 6882, 6883, 6884, 6885, 6886, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6887, 0, 6888, 6889, 6890, 0, 6891, 0, 6892, 6893, 0, 0, 6894, 0, 6895, 6896,
+	0, 0, 6897, 0, 0, 6898, 0, 6899, 6900, 0, 0, 6901, 6902, 0, 0, 0,
+	6903, 6904, 6905, 6906, 6907, 0, 6908, 0, 6909, 0, 6910, 0, 6911, 0, 6912, 0,
+	0, 0, 0, 0, 0, 6913, 6914, 6915, 6916, 0, 0, 0, 6917, 0, 0, 0,
+	6918, 0, 0, 6919, 6920, 6921, 6922, 0, 0, 6923, 0, 0, 6924, 0, 0, 6925,
+	0, 0, 6926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6927, 6928, 6929, 6930, 6931, 6932, 6933, 0, 0, 6934, 6935, 6936, 6937, 6938, 6939,
+	6940, 0, 0, 0, 6941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 6942, 6943, 6944, 6945, 6946, 6947, 6948, 6949, 6950, 6951, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 0, 6959, 6960, 6961, 6962, 0,
+	0, 0, 0, 0, 0, 0, 0, 6963, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6975, 6976, 6977, 6978, 6979, 6980,
+	6981, 6982, 6983, 6984, 6985, 6986, 6987, 6988, 6989, 6990, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6991, 6992, 6993, 6994, 6995, 0, 6996, 6997, 6998, 0,
+	0, 0, 0, 0, 6999, 7000, 7001, 7002, 7003, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7004,
+	7005, 7006, 7007, 7008, 7009, 7010, 7011, 0, 7012, 7013, 7014, 7015, 7016, 7017, 7018, 7019,
+	0, 0, 7020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7021, 7022, 7023, 7024, 7025, 7026, 7027, 7028, 7029, 7030, 7031, 7032, 7033, 7034,
+	7035, 7036, 7037, 7038, 7039, 7040, 7041, 7042, 0, 7043, 7044, 7045, 7046, 7047, 7048, 7049,
+	7050, 7051, 7052, 7053, 7054, 7055, 7056, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7057, 7058, 7059, 7060, 7061, 7062, 0, 0, 0, 7063, 0, 7064, 7065, 0, 7066,
+	7067, 7068, 7069, 7070, 7071, 7072, 0, 7073, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7074, 7075, 7076, 7077, 7078, 0,
+	7079, 7080, 0, 7081, 7082, 7083, 7084, 7085, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7086, 7087, 7088, 7089, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7090, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7091, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7092, 7093, 7094, 7095, 7096, 7097, 7098, 7099, 7100, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7101, 7102, 7103, 7104, 7105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7106, 7107, 7108, 7109, 7110, 7111, 7112, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 7113, 7114, 0, 7115, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7116, 0, 0, 0, 7117, 0, 7118, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7119, 0, 7120, 0, 0, 0, 0, 7121, 0, 0,
+	0, 0, 0, 0, 0, 7122, 0, 0, 0, 0, 7123, 7124, 0, 7125, 0, 7126,
+	7127, 0, 7128, 7129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7130,
+	0, 7131, 7132, 7133, 7134, 7135, 7136, 7137, 7138, 7139, 7140, 7141, 7142, 7143, 7144, 7145,
+	7146, 7147, 7148, 7149, 7150, 7151, 7152, 7153, 7154, 7155, 7156, 7157, 7158, 7159, 7160, 7161,
+	7162, 7163, 7164, 7165, 7166, 7167, 7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175, 7176, 7177,
+	7178, 7179, 7180, 7181, 7182, 7183, 7184, 7185, 0, 0, 0, 0, 0, 0, 0, 7186,
+	7187, 7188, 7189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7190, 7191, 0,
+	7192, 7193, 7194, 7195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7197, 7198,
+	7199, 7200, 7201, 7202, 7203, 7204, 7205, 7206, 7207, 7208, 0, 0, 0, 7209, 7210, 7211,
+	7212, 7213, 7214, 7215, 7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7224, 7225, 7226, 7227,
+	7228, 7229, 7230, 0, 0, 7231, 7232, 7233, 7234, 7235, 7236, 7237, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7238, 7239, 7240, 7241, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7242, 7243, 7244, 7245, 7246,
+	7247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 7248, 0, 0, 0, 7249, 0, 0, 0, 0, 7250, 0, 7251, 0, 7252,
+	0, 0, 7253, 7254, 7255, 7256, 7257, 7258, 0, 0, 7259, 7260, 7261, 0, 0, 0,
+	0, 7262, 7263, 0, 0, 0, 0, 0, 0, 0, 7264, 7265, 0, 0, 0, 0,
+	7266, 0, 0, 0, 0, 0, 7267, 7268, 7269, 7270, 7271, 7272, 0, 0, 0, 7273,
+	0, 0, 7274, 7275, 7276, 7277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	7278, 7279, 7280, 7281, 7282, 7283, 7284, 7285, 7286, 7287, 7288, 7289, 7290, 7291, 7292, 7293,
+	7294, 7295, 7296, 7297, 7298, 7299, 7300, 7301, 7302, 7303, 7304, 7305, 7306, 7307, 7308, 7309,
+	7310, 7311, 7312, 7313, 7314, 7315, 7316, 7317, 7318, 7319, 7320, 7321, 7322, 7323, 7324, 7325,
+	7326, 7327, 7328, 7329, 7330, 7331, 7332, 7333, 7334, 7335, 7336, 7337, 7338, 7339, 7340, 7341,
+	7342, 7343, 7344, 7345, 7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356, 7357,
+	7358, 7359, 7360, 7361, 7362, 0, 7363, 7364, 7365, 7366, 7367, 7368, 7369, 7370, 7371, 7372,
+	7373, 7374, 7375, 7376, 7377, 7378, 7379, 7380, 7381, 7382, 7383, 7384, 7385, 7386, 7387, 7388,
+	7389, 7390, 7391, 7392, 7393, 7394, 7395, 7396, 7397, 7398, 7399, 7400, 7401, 7402, 7403, 7404,
+	7405, 7406, 7407, 7408, 7409, 7410, 7411, 7412, 7413, 7414, 7415, 7416, 7417, 7418, 7419, 7420,
+	7421, 7422, 7423, 7424, 7425, 7426, 7427, 7428, 7429, 7430, 7431, 7432, 7433, 0, 7434, 7435,
+	0, 0, 7436, 0, 0, 7437, 7438, 0, 0, 7439, 7440, 7441, 7442, 0, 7443, 7444,
+	7445, 7446, 7447, 7448, 7449, 7450, 7451, 7452, 7453, 7454, 0, 7455, 0, 7456, 7457, 7458,
+	7459, 7460, 7461, 7462, 0, 7463, 7464, 7465, 7466, 7467, 7468, 7469, 7470, 7471, 7472, 7473,
+	7474, 7475, 7476, 7477, 7478, 7479, 7480, 7481, 7482, 7483, 7484, 7485, 7486, 7487, 7488, 7489,
+	7490, 7491, 7492, 7493, 7494, 7495, 7496, 7497, 7498, 7499, 7500, 7501, 7502, 7503, 7504, 7505,
+	7506, 7507, 7508, 7509, 7510, 7511, 7512, 7513, 7514, 7515, 7516, 7517, 7518, 7519, 7520, 7521,
+	},
+	{
+	7522, 7523, 7524, 7525, 7526, 7527, 0, 7528, 7529, 7530, 7531, 0, 0, 7532, 7533, 7534,
+	7535, 7536, 7537, 7538, 7539, 0, 7540, 7541, 7542, 7543, 7544, 7545, 7546, 0, 7547, 7548,
+	7549, 7550, 7551, 7552, 7553, 7554, 7555, 7556, 7557, 7558, 7559, 7560, 7561, 7562, 7563, 7564,
+	7565, 7566, 7567, 7568, 7569, 7570, 7571, 7572, 7573, 7574, 0, 7575, 7576, 7577, 7578, 0,
+	7579, 7580, 7581, 7582, 7583, 0, 7584, 0, 0, 0, 7585, 7586, 7587, 7588, 7589, 7590,
+	7591, 0, 7592, 7593, 7594, 7595, 7596, 7597, 7598, 7599, 7600, 7601, 7602, 7603, 7604, 7605,
+	7606, 7607, 7608, 7609, 7610, 7611, 7612, 7613, 7614, 7615, 7616, 7617, 7618, 7619, 7620, 7621,
+	7622, 7623, 7624, 7625, 7626, 7627, 7628, 7629, 7630, 7631, 7632, 7633, 7634, 7635, 7636, 7637,
+	7638, 7639, 7640, 7641, 7642, 7643, 7644, 7645, 7646, 7647, 7648, 7649, 7650, 7651, 7652, 7653,
+	7654, 7655, 7656, 7657, 7658, 7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667, 7668, 7669,
+	7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677, 7678, 7679, 7680, 7681, 7682, 7683, 7684, 7685,
+	7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701,
+	7702, 7703, 7704, 7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717,
+	7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732, 7733,
+	7734, 7735, 7736, 7737, 7738, 7739, 7740, 7741, 7742, 7743, 7744, 7745, 7746, 7747, 7748, 7749,
+	7750, 7751, 7752, 7753, 7754, 7755, 7756, 7757, 7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765,
+	},
+	{
+	7766, 7767, 7768, 7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780, 7781,
+	7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792, 7793, 7794, 7795, 7796, 7797,
+	7798, 7799, 7800, 7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813,
+	7814, 7815, 7816, 7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828, 7829,
+	7830, 7831, 7832, 7833, 7834, 7835, 7836, 7837, 7838, 7839, 7840, 7841, 7842, 7843, 7844, 7845,
+	7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857, 7858, 7859, 7860, 7861,
+	7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7874, 7875, 7876, 7877,
+	7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893,
+	7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906, 7907, 7908, 7909,
+	7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925,
+	7926, 7927, 7928, 7929, 7930, 7931, 0, 0, 7932, 7933, 7934, 7935, 7936, 7937, 7938, 7939,
+	7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955,
+	7956, 7957, 7958, 7959, 7960, 7961, 7962, 7963, 7964, 7965, 7966, 7967, 7968, 7969, 7970, 7971,
+	7972, 7973, 7974, 7975, 7976, 7977, 7978, 7979, 7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987,
+	7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997, 7998, 7999, 8000, 8001, 8002, 8003,
+	8004, 8005, 8006, 8007, 8008, 8009, 8010, 8011, 8012, 8013, 8014, 8015, 8016, 8017, 8018, 8019,
+	},
+	{
+	8020, 8021, 8022, 8023, 8024, 8025, 8026, 8027, 8028, 8029, 8030, 8031, 8032, 8033, 8034, 8035,
+	8036, 8037, 8038, 8039, 8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051,
+	8052, 8053, 8054, 8055, 8056, 8057, 8058, 8059, 8060, 8061, 8062, 8063, 8064, 8065, 8066, 8067,
+	8068, 8069, 8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080, 8081, 8082, 8083,
+	8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098, 8099,
+	8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115,
+	8116, 8117, 8118, 8119, 8120, 8121, 8122, 8123, 8124, 8125, 8126, 8127, 8128, 8129, 8130, 8131,
+	8132, 8133, 8134, 8135, 8136, 8137, 8138, 8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146, 8147,
+	8148, 8149, 8150, 8151, 8152, 8153, 8154, 8155, 8156, 8157, 8158, 8159, 8160, 8161, 8162, 8163,
+	8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171, 8172, 8173, 8174, 8175, 8176, 8177, 8178, 8179,
+	8180, 8181, 8182, 8183, 8184, 8185, 8186, 8187, 8188, 8189, 8190, 8191, 8192, 8193, 8194, 8195,
+	8196, 8197, 8198, 8199, 8200, 8201, 8202, 8203, 8204, 8205, 8206, 8207, 8208, 8209, 8210, 8211,
+	8212, 8213, 8214, 8215, 8216, 8217, 8218, 8219, 8220, 8221, 8222, 8223, 0, 0, 8224, 8225,
+	8226, 8227, 8228, 8229, 8230, 8231, 8232, 8233, 8234, 8235, 8236, 8237, 8238, 8239, 8240, 8241,
+	8242, 8243, 8244, 8245, 8246, 8247, 8248, 8249, 8250, 8251, 8252, 8253, 8254, 8255, 8256, 8257,
+	8258, 8259, 8260, 8261, 8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 8270, 8271, 8272, 8273,
+	},
+	{
+	8274, 8275, 8276, 8277, 8278, 8279, 8280, 8281, 8282, 8283, 8284, 8285, 8286, 8287, 8288, 8289,
+	8290, 8291, 8292, 8293, 8294, 8295, 8296, 8297, 8298, 8299, 8300, 8301, 8302, 8303, 8304, 8305,
+	8306, 8307, 8308, 8309, 8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321,
+	8322, 8323, 8324, 8325, 8326, 8327, 8328, 0, 0, 0, 0, 8329, 8330, 8331, 8332, 8333,
+	8334, 8335, 8336, 8337, 8338, 8339, 8340, 8341, 8342, 8343, 8344, 8345, 8346, 8347, 8348, 8349,
+	8350, 8351, 8352, 8353, 8354, 8355, 8356, 8357, 8358, 8359, 8360, 8361, 8362, 8363, 8364, 8365,
+	8366, 8367, 8368, 8369, 8370, 8371, 8372, 8373, 8374, 8375, 8376, 8377, 8378, 0, 0, 0,
+	0, 0, 0, 0, 0, 8379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8381, 8382, 8383, 8384, 8385,
+	0, 8386, 8387, 8388, 8389, 8390, 8391, 8392, 8393, 8394, 8395, 8396, 8397, 8398, 8399, 8400,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	8401, 8402, 8403, 8404, 8405, 8406, 8407, 0, 8408, 8409, 8410, 8411, 8412, 8413, 8414, 8415,
+	8416, 8417, 8418, 8419, 8420, 8421, 8422, 8423, 8424, 0, 0, 8425, 8426, 8427, 8428, 8429,
+	8430, 8431, 0, 8432, 8433, 0, 8434, 8435, 8436, 8437, 8438, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8439, 8440, 8441, 8442, 8443, 8444, 8445, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8446, 8447, 8448, 8449,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8450, 8451, 8452, 0, 8453, 8454, 8455, 0, 0,
+	8456, 8457, 8458, 8459, 8460, 8461, 8462, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8463, 8464, 8465, 8466, 8467, 8468, 8469, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	8470, 8471, 8472, 8473, 0, 8474, 8475, 8476, 8477, 8478, 8479, 8480, 8481, 8482, 8483, 8484,
+	8485, 8486, 8487, 8488, 8489, 8490, 8491, 8492, 8493, 8494, 8495, 8496, 8497, 8498, 8499, 8500,
+	0, 8501, 8502, 0, 8503, 0, 0, 8504, 0, 8505, 8506, 8507, 8508, 8509, 8510, 8511,
+	8512, 8513, 8514, 0, 8515, 8516, 8517, 8518, 0, 8519, 0, 8520, 0, 0, 0, 0,
+	0, 0, 8521, 0, 0, 0, 0, 8522, 0, 8523, 0, 8524, 0, 8525, 8526, 8527,
+	0, 8528, 8529, 0, 8530, 0, 0, 8531, 0, 8532, 0, 8533, 0, 8534, 0, 8535,
+	0, 8536, 8537, 0, 8538, 0, 0, 8539, 8540, 8541, 8542, 0, 8543, 8544, 8545, 8546,
+	8547, 8548, 8549, 0, 8550, 8551, 8552, 8553, 0, 8554, 8555, 8556, 8557, 0, 8558, 0,
+	8559, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568, 0, 8569, 8570, 8571, 8572, 8573,
+	8574, 8575, 8576, 8577, 8578, 8579, 8580, 8581, 8582, 8583, 8584, 8585, 0, 0, 0, 0,
+	0, 8586, 8587, 8588, 0, 8589, 8590, 8591, 8592, 8593, 0, 8594, 8595, 8596, 8597, 8598,
+	8599, 8600, 8601, 8602, 8603, 8604, 8605, 8606, 8607, 8608, 8609, 8610, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	8611, 8612, 8613, 8614, 8615, 8616, 8617, 8618, 8619, 8620, 8621, 0, 0, 0, 0, 0,
+	8622, 8623, 8624, 8625, 8626, 8627, 8628, 8629, 8630, 8631, 8632, 8633, 8634, 8635, 8636, 8637,
+	8638, 8639, 8640, 8641, 8642, 8643, 8644, 8645, 8646, 8647, 8648, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8649, 8650, 8651, 8652, 8653, 8654, 8655, 8656, 8657, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8658, 0, 0, 0, 0, 0, 8659, 8660, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	8661, 8662, 8663, 0, 8664, 0, 0, 8665, 8666, 0, 8667, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 8669, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8670, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8671, 0, 0, 0,
+	0, 0, 0, 0, 8672, 8673, 0, 0, 0, 0, 0, 0, 8674, 0, 8675, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 8676, 0, 0, 8677, 8678, 0, 0, 0,
+	0, 8679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 8680, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	8681, 8682, 8683, 8684, 8685, 8686, 8687, 8688, 8689, 8690, 8691, 8692, 8693, 8694, 8695, 8696,
+	8697, 8698, 8699, 8700, 8701, 8702, 8703, 8704, 8705, 8706, 8707, 8708, 8709, 8710, 8711, 8712,
+	8713, 8714, 8715, 8716, 8717, 8718, 8719, 8720, 8721, 8722, 8723, 8724, 8725, 8726, 8727, 8728,
+	8729, 8730, 8731, 8732, 8733, 8734, 8735, 8736, 8737, 8738, 8739, 8740, 8741, 8742, 8743, 8744,
+	8745, 8746, 8747, 8748, 8749, 8750, 8751, 8752, 8753, 8754, 8755, 8756, 8757, 8758, 8759, 8760,
+	8761, 8762, 8763, 8764, 8765, 8766, 8767, 8768, 8769, 8770, 8771, 8772, 8773, 8774, 8775, 8776,
+	8777, 8778, 8779, 8780, 8781, 8782, 8783, 8784, 8785, 8786, 8787, 8788, 8789, 8790, 8791, 8792,
+	8793, 8794, 8795, 8796, 8797, 8798, 8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808,
+	8809, 8810, 8811, 8812, 8813, 8814, 8815, 8816, 8817, 8818, 8819, 8820, 8821, 8822, 8823, 8824,
+	8825, 8826, 8827, 8828, 8829, 8830, 8831, 8832, 8833, 8834, 8835, 8836, 8837, 8838, 8839, 8840,
+	8841, 8842, 8843, 8844, 8845, 8846, 8847, 8848, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8856,
+	8857, 8858, 8859, 8860, 8861, 8862, 8863, 8864, 8865, 8866, 8867, 8868, 8869, 8870, 8871, 8872,
+	8873, 8874, 8875, 8876, 8877, 8878, 8879, 8880, 8881, 8882, 8883, 8884, 8885, 8886, 8887, 8888,
+	8889, 8890, 8891, 8892, 8893, 8894, 8895, 8896, 8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904,
+	8905, 8906, 8907, 8908, 8909, 8910, 8911, 8912, 8913, 8914, 8915, 8916, 8917, 8918, 8919, 8920,
+	8921, 8922, 8923, 8924, 8925, 8926, 8927, 8928, 8929, 8930, 8931, 8932, 8933, 8934, 8935, 8936,
+	},
+	{
+	8937, 8938, 8939, 8940, 8941, 8942, 8943, 8944, 8945, 8946, 8947, 8948, 8949, 8950, 8951, 8952,
+	8953, 8954, 8955, 8956, 8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964, 8965, 8966, 8967, 8968,
+	8969, 8970, 8971, 8972, 8973, 8974, 8975, 8976, 8977, 8978, 8979, 8980, 8981, 8982, 8983, 8984,
+	8985, 8986, 8987, 8988, 8989, 8990, 8991, 8992, 8993, 8994, 8995, 8996, 8997, 8998, 8999, 9000,
+	9001, 9002, 9003, 9004, 9005, 9006, 9007, 9008, 9009, 9010, 9011, 9012, 9013, 9014, 9015, 9016,
+	9017, 9018, 9019, 9020, 9021, 9022, 9023, 9024, 9025, 9026, 9027, 9028, 9029, 9030, 9031, 9032,
+	9033, 9034, 9035, 9036, 9037, 9038, 9039, 9040, 9041, 9042, 9043, 9044, 9045, 9046, 9047, 9048,
+	9049, 9050, 9051, 9052, 9053, 9054, 9055, 9056, 9057, 9058, 9059, 9060, 9061, 9062, 9063, 9064,
+	9065, 9066, 9067, 9068, 9069, 9070, 9071, 9072, 9073, 9074, 9075, 9076, 9077, 9078, 9079, 9080,
+	9081, 9082, 9083, 9084, 9085, 9086, 9087, 9088, 9089, 9090, 9091, 9092, 9093, 9094, 9095, 9096,
+	9097, 9098, 9099, 9100, 9101, 9102, 9103, 9104, 9105, 9106, 9107, 9108, 9109, 9110, 9111, 9112,
+	9113, 9114, 9115, 9116, 9117, 9118, 9119, 9120, 9121, 9122, 9123, 9124, 9125, 9126, 9127, 9128,
+	9129, 9130, 9131, 9132, 9133, 9134, 9135, 9136, 9137, 9138, 9139, 9140, 9141, 9142, 9143, 9144,
+	9145, 9146, 9147, 9148, 9149, 9150, 9151, 9152, 9153, 9154, 9155, 9156, 9157, 9158, 9159, 9160,
+	9161, 9162, 9163, 9164, 9165, 9166, 9167, 9168, 9169, 9170, 9171, 9172, 9173, 9174, 9175, 9176,
+	9177, 9178, 9179, 9180, 9181, 9182, 9183, 9184, 9185, 9186, 9187, 9188, 9189, 9190, 9191, 9192,
+	},
+	{
+	9193, 9194, 9195, 9196, 9197, 9198, 9199, 9200, 9201, 9202, 9203, 9204, 9205, 9206, 9207, 9208,
+	9209, 9210, 9211, 9212, 9213, 9214, 9215, 9216, 9217, 9218, 9219, 9220, 9221, 9222, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 9223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9224, 9225, 9226, 9227, 9228, 9229, 9230, 9231, 9232, 9233, 9234, 9235, 9236, 9237, 9238, 9239,
+	9240, 9241, 9242, 9243, 9244, 9245, 9246, 9247, 9248, 9249, 9250, 9251, 9252, 9253, 9254, 9255,
+	9256, 9257, 9258, 9259, 9260, 9261, 9262, 9263, 9264, 9265, 9266, 9267, 9268, 9269, 9270, 9271,
+	9272, 9273, 9274, 9275, 9276, 9277, 9278, 9279, 9280, 9281, 9282, 9283, 9284, 9285, 9286, 9287,
+	9288, 9289, 9290, 9291, 9292, 9293, 9294, 9295, 9296, 9297, 9298, 9299, 9300, 9301, 9302, 9303,
+	9304, 9305, 9306, 9307, 9308, 9309, 9310, 9311, 9312, 9313, 9314, 9315, 9316, 9317, 9318, 9319,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	9320, 9321, 9322, 9323, 9324, 9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9333, 9334, 9335,
+	9336, 9337, 9338, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9346, 9347, 9348, 9349, 9350, 9351,
+	9352, 9353, 9354, 9355, 9356, 9357, 9358, 9359, 9360, 9361, 9362, 9363, 9364, 9365, 9366, 9367,
+	9368, 9369, 9370, 9371, 9372, 9373, 9374, 9375, 9376, 9377, 9378, 9379, 9380, 9381, 9382, 9383,
+	9384, 9385, 9386, 9387, 9388, 9389, 9390, 9391, 9392, 9393, 9394, 9395, 9396, 9397, 9398, 9399,
+	9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415,
+	9416, 9417, 9418, 9419, 9420, 9421, 9422, 9423, 9424, 9425, 9426, 9427, 9428, 9429, 9430, 9431,
+	9432, 9433, 9434, 9435, 9436, 9437, 9438, 9439, 9440, 9441, 9442, 9443, 9444, 9445, 9446, 9447,
+	9448, 9449, 9450, 9451, 9452, 9453, 9454, 9455, 9456, 9457, 9458, 9459, 9460, 9461, 9462, 9463,
+	9464, 9465, 9466, 9467, 9468, 9469, 9470, 9471, 9472, 9473, 9474, 9475, 9476, 9477, 9478, 9479,
+	9480, 9481, 9482, 9483, 9484, 9485, 9486, 9487, 9488, 9489, 9490, 9491, 9492, 9493, 9494, 9495,
+	9496, 9497, 9498, 9499, 9500, 9501, 9502, 9503, 9504, 9505, 9506, 9507, 9508, 9509, 9510, 9511,
+	9512, 9513, 9514, 9515, 9516, 9517, 9518, 9519, 9520, 9521, 9522, 9523, 9524, 9525, 9526, 9527,
+	9528, 9529, 9530, 9531, 9532, 9533, 9534, 9535, 9536, 9537, 9538, 9539, 9540, 9541, 9542, 9543,
+	9544, 9545, 9546, 9547, 9548, 9549, 9550, 9551, 9552, 9553, 9554, 9555, 9556, 9557, 9558, 9559,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	9560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9561, 0, 0,
+	},
+	{
+	9562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9563, 0, 0,
+	},
 };
 
 static const struct DECOMP_SLICE decomp_slices[NUM_DECOMPS] = {
@@ -1,22 +1,8 @@
-#include <stdlib.h>
-
 #include "tolower_data.h"
 
-static int compul(const void *a, const void *b)
-{
-	struct UPPER_LOWER *ul_a = (struct UPPER_LOWER *)a;
-	struct UPPER_LOWER *ul_b = (struct UPPER_LOWER *)b;
-	return ul_a->upper - ul_b->upper;
-}
-
 int str_utf8_tolower(int code)
 {
-	struct UPPER_LOWER key;
-	struct UPPER_LOWER *res;
-	key.upper = code;
-	res = bsearch(&key, tolower, NUM_TOLOWER, sizeof(struct UPPER_LOWER), compul);
-
-	if(res == NULL)
+	if(code < 0 || (code >> TOLOWER_PAGE_BITS) >= NUM_TOLOWER_PAGE_INDEX)
 		return code;
-	return res->lower;
+	return code + tolower_pages[tolower_page_index[code >> TOLOWER_PAGE_BITS]][code & (TOLOWER_PAGE_SIZE - 1)];
 }
@@ -269,6 +269,7 @@ CClient::CClient() :
 	m_pEditor = 0;
 	m_pInput = 0;
 	m_pGraphics = 0;
+	m_pTextRender = 0;
 	m_pSound = 0;
 	m_pGameClient = 0;
 	m_pMap = 0;
@@ -809,7 +810,7 @@ void CClient::Disconnect()
 	// make sure to remove replay tmp demo
 	if(g_Config.m_ClReplays)
 	{
-		Storage()->RemoveFile((&m_DemoRecorder[RECORDER_REPLAYS])->GetCurrentFilename(), IStorage::TYPE_SAVE);
+		DemoRemove(Storage(), (&m_DemoRecorder[RECORDER_REPLAYS])->GetCurrentFilename(), IStorage::TYPE_SAVE);
 	}
 }
 
@@ -981,6 +982,8 @@ void CClient::DebugRender()
 	static NETSTATS Prev, Current;
 	static int64 LastSnap = 0;
 	static float FrameTimeAvg = 0;
+	static int64 s_aPrevLayoutStats[2] = {0}, s_aLayoutStats[2] = {0};
+	static int s_NumLayouts = 0;
 	char aBuffer[512];
 
 	if(!g_Config.m_Debug)
@@ -996,6 +999,9 @@ void CClient::DebugRender()
 		LastSnap = time_get();
 		Prev = Current;
 		net_stats(&Current);
+		s_aPrevLayoutStats[0] = s_aLayoutStats[0];
+		s_aPrevLayoutStats[1] = s_aLayoutStats[1];
+		m_pTextRender->GetLayoutCacheStats(&s_aLayoutStats[0], &s_aLayoutStats[1], &s_NumLayouts);
 	}
 
 	/*
@@ -1047,6 +1053,14 @@ void CClient::DebugRender()
 
 	str_format(aBuffer, sizeof(aBuffer), "pred: %d ms", GetPredictionTime());
 	Graphics()->QuadsText(2, 70, 16, aBuffer);
+
+	{
+		int Hits = s_aLayoutStats[0] - s_aPrevLayoutStats[0];
+		int Misses = s_aLayoutStats[1] - s_aPrevLayoutStats[1];
+		str_format(aBuffer, sizeof(aBuffer), "text layouts: %d hits/s %d misses/s (%d%%) %d cached",
+			Hits, Misses, Hits + Misses ? Hits * 100 / (Hits + Misses) : 0, s_NumLayouts);
+		Graphics()->QuadsText(2, 84, 16, aBuffer);
+	}
 	Graphics()->QuadsEnd();
 
 	// render graphs
@@ -1376,7 +1390,7 @@ void CClient::ProcessServerInfo(int RawType, NETADDR *pFrom, const void *pData,
 	CServerInfo Info = {0};
 	int SavedType = SavedServerInfoType(RawType);
 	if((SavedType == SERVERINFO_64_LEGACY || SavedType == SERVERINFO_EXTENDED) &&
-		pEntry && pEntry->m_GotInfo && SavedType == pEntry->m_Info.m_Type)
+		pEntry && pEntry->m_GotInfo && !pEntry->m_CachedInfo && SavedType == pEntry->m_Info.m_Type)
 	{
 		Info = pEntry->m_Info;
 	}
@@ -1521,7 +1535,7 @@ void CClient::ProcessServerInfo(int RawType, NETADDR *pFrom, const void *pData,
 	{
 		std::sort(Info.m_aClients, Info.m_aClients + Info.m_NumReceivedClients, PlayerScoreNameLess);
 
-		if(!DuplicatedPacket && (!pEntry || !pEntry->m_GotInfo || SavedType >= pEntry->m_Info.m_Type))
+		if(!DuplicatedPacket && (!pEntry || !pEntry->m_GotInfo || pEntry->m_CachedInfo || SavedType >= pEntry->m_Info.m_Type))
 		{
 			m_ServerBrowser.Set(*pFrom, IServerBrowser::SET_TOKEN, Token, &Info);
 			pEntry = m_ServerBrowser.Find(*pFrom);
@@ -2046,6 +2060,7 @@ void CClient::ProcessServerPacket(CNetChunk *pPacket)
 						IVideo::SetLocalStartTime(m_LocalStartTime);
 #endif
 						SetState(IClient::STATE_ONLINE);
+						m_ServerBrowser.SetPlayed(m_ServerAddress);
 						DemoRecorder_HandleAutoStart();
 					}
 
@@ -2952,6 +2967,7 @@ void CClient::InitInterfaces()
 	m_pSound = Kernel()->RequestInterface<IEngineSound>();
 	m_pGameClient = Kernel()->RequestInterface<IGameClient>();
 	m_pInput = Kernel()->RequestInterface<IEngineInput>();
+	m_pTextRender = Kernel()->RequestInterface<IEngineTextRender>();
 	m_pMap = Kernel()->RequestInterface<IEngineMap>();
 	m_pMasterServer = Kernel()->RequestInterface<IEngineMasterServer>();
 #if defined(CONF_AUTOUPDATE)
@@ -3388,6 +3404,7 @@ void CClient::Run()
 
 	GameClient()->OnShutdown();
 	Disconnect();
+	m_ServerBrowser.SaveCache();
 
 	delete m_pEditor;
 	m_pGraphics->Shutdown();
@@ -3694,6 +3711,8 @@ void CClient::DemoSlice(const char *pDstPath, CLIENTFUNC_FILTER pfnFilter, void
 	{
 		const char *pDemoFileName = m_DemoPlayer.GetDemoFileName();
 		m_DemoEditor.Slice(pDemoFileName, pDstPath, g_Config.m_ClDemoSliceBegin, g_Config.m_ClDemoSliceEnd, pfnFilter, pUser);
+		g_Config.m_ClDemoSliceBegin = -1;
+		g_Config.m_ClDemoSliceEnd = -1;
 	}
 }
 
@@ -3710,6 +3729,11 @@ const char *CClient::DemoPlayer_Play(const char *pFilename, int StorageType)
 	if(m_DemoPlayer.Load(Storage(), m_pConsole, pFilename, StorageType))
 		return "error loading demo";
 
+	// reset slice markers, the player doesn't touch the config so that
+	// the demo_slice tool can load demos on several threads
+	g_Config.m_ClDemoSliceBegin = -1;
+	g_Config.m_ClDemoSliceEnd = -1;
+
 	// load map
 	Crc = m_DemoPlayer.GetMapInfo()->m_Crc;
 	SHA256_DIGEST Sha = m_DemoPlayer.GetMapInfo()->m_Sha256;
@@ -3859,7 +3883,7 @@ void CClient::DemoRecorder_Stop(int Recorder, bool RemoveFile)
 	if(RemoveFile)
 	{
 		const char *pFilename = (&m_DemoRecorder[Recorder])->GetCurrentFilename();
-		Storage()->RemoveFile(pFilename, IStorage::TYPE_SAVE);
+		DemoRemove(Storage(), pFilename, IStorage::TYPE_SAVE);
 	}
 }
 
@@ -26,6 +26,7 @@
 #include <engine/shared/network.h>
 #include <engine/sound.h>
 #include <engine/steam.h>
+#include <engine/textrender.h>
 #include <engine/warning.h>
 
 #define CONNECTLINK "ddnet:"
@@ -87,6 +88,7 @@ class CClient : public IClient, public CDemoPlayer::IListener
 	IEditor *m_pEditor;
 	IEngineInput *m_pInput;
 	IEngineGraphics *m_pGraphics;
+	IEngineTextRender *m_pTextRender;
 	IEngineSound *m_pSound;
 	IGameClient *m_pGameClient;
 	IEngineMap *m_pMap;
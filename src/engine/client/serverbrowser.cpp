@@ -6,10 +6,12 @@
 #include <base/math.h>
 #include <base/system.h>
 
+#include <engine/shared/compression.h>
 #include <engine/shared/config.h>
 #include <engine/shared/json.h>
 #include <engine/shared/memheap.h>
 #include <engine/shared/network.h>
+#include <engine/shared/packer.h>
 #include <engine/shared/protocol.h>
 
 #include <engine/config.h>
@@ -23,6 +25,10 @@
 #include <engine/external/json-parser/json.h>
 
 #include "serverbrowser.h"
+
+static const char *SERVERBROWSER_CACHE = "serverbrowser.cache";
+static const unsigned char CACHE_MAGIC[4] = {'T', 'W', 'S', 'C'};
+
 class SortWrap
 {
 	typedef bool (CServerBrowser::*SortFunc)(int, int) const;
@@ -38,6 +44,7 @@ public:
 CServerBrowser::CServerBrowser()
 {
 	m_pMasterServer = 0;
+	m_pStorage = 0;
 	m_ppServerlist = 0;
 	m_pSortedServerlist = 0;
 
@@ -52,7 +59,6 @@ CServerBrowser::CServerBrowser()
 	m_NeedRefresh = 0;
 
 	m_NumSortedServers = 0;
-	m_NumSortedServersCapacity = 0;
 	m_NumServers = 0;
 	m_NumServerCapacity = 0;
 
@@ -87,9 +93,12 @@ void CServerBrowser::SetBaseInfo(class CNetClient *pClient, const char *pNetVers
 	m_pMasterServer = Kernel()->RequestInterface<IMasterServer>();
 	m_pConsole = Kernel()->RequestInterface<IConsole>();
 	m_pFriends = Kernel()->RequestInterface<IFriends>();
+	m_pStorage = Kernel()->RequestInterface<IStorage>();
 	IConfig *pConfig = Kernel()->RequestInterface<IConfig>();
 	if(pConfig)
 		pConfig->RegisterCallback(ConfigSaveCallback, this);
+
+	LoadCache();
 }
 
 const CServerInfo *CServerBrowser::SortedGet(int Index) const
@@ -176,137 +185,134 @@ bool CServerBrowser::SortCompareNumPlayersAndPing(int Index1, int Index2) const
 		return a->m_Info.m_Latency > b->m_Info.m_Latency;
 }
 
-void CServerBrowser::Filter()
+bool CServerBrowser::IsFiltered(CServerInfo *pInfo) const
 {
-	int i = 0, p = 0;
-	m_NumSortedServers = 0;
-
-	// allocate the sorted list
-	if(m_NumSortedServersCapacity < m_NumServers)
-	{
-		if(m_pSortedServerlist)
-			free(m_pSortedServerlist);
-		m_NumSortedServersCapacity = m_NumServers;
-		m_pSortedServerlist = (int *)calloc(m_NumSortedServersCapacity, sizeof(int));
-	}
-
-	// filter the servers
-	for(i = 0; i < m_NumServers; i++)
+	int p = 0;
+	int Filtered = 0;
+
+	if(g_Config.m_BrFilterEmpty && pInfo->m_NumFilteredPlayers == 0)
+		Filtered = 1;
+	else if(g_Config.m_BrFilterFull && Players(*pInfo) == Max(*pInfo))
+		Filtered = 1;
+	else if(g_Config.m_BrFilterPw && pInfo->m_Flags & SERVER_FLAG_PASSWORD)
+		Filtered = 1;
+	else if(g_Config.m_BrFilterPing && g_Config.m_BrFilterPing < pInfo->m_Latency)
+		Filtered = 1;
+	else if(g_Config.m_BrFilterCompatversion && str_comp_num(pInfo->m_aVersion, m_aNetVersion, 3) != 0)
+		Filtered = 1;
+	else if(g_Config.m_BrFilterServerAddress[0] && !str_find_nocase(pInfo->m_aAddress, g_Config.m_BrFilterServerAddress))
+		Filtered = 1;
+	else if(g_Config.m_BrFilterGametypeStrict && g_Config.m_BrFilterGametype[0] && str_comp_nocase(pInfo->m_aGameType, g_Config.m_BrFilterGametype))
+		Filtered = 1;
+	else if(!g_Config.m_BrFilterGametypeStrict && g_Config.m_BrFilterGametype[0] && !str_find_nocase(pInfo->m_aGameType, g_Config.m_BrFilterGametype))
+		Filtered = 1;
+	else if(g_Config.m_BrFilterUnfinishedMap && pInfo->m_HasRank == 1)
+		Filtered = 1;
+	else
 	{
-		int Filtered = 0;
-
-		if(g_Config.m_BrFilterEmpty && m_ppServerlist[i]->m_Info.m_NumFilteredPlayers == 0)
-			Filtered = 1;
-		else if(g_Config.m_BrFilterFull && Players(m_ppServerlist[i]->m_Info) == Max(m_ppServerlist[i]->m_Info))
-			Filtered = 1;
-		else if(g_Config.m_BrFilterPw && m_ppServerlist[i]->m_Info.m_Flags & SERVER_FLAG_PASSWORD)
-			Filtered = 1;
-		else if(g_Config.m_BrFilterPing && g_Config.m_BrFilterPing < m_ppServerlist[i]->m_Info.m_Latency)
-			Filtered = 1;
-		else if(g_Config.m_BrFilterCompatversion && str_comp_num(m_ppServerlist[i]->m_Info.m_aVersion, m_aNetVersion, 3) != 0)
-			Filtered = 1;
-		else if(g_Config.m_BrFilterServerAddress[0] && !str_find_nocase(m_ppServerlist[i]->m_Info.m_aAddress, g_Config.m_BrFilterServerAddress))
-			Filtered = 1;
-		else if(g_Config.m_BrFilterGametypeStrict && g_Config.m_BrFilterGametype[0] && str_comp_nocase(m_ppServerlist[i]->m_Info.m_aGameType, g_Config.m_BrFilterGametype))
-			Filtered = 1;
-		else if(!g_Config.m_BrFilterGametypeStrict && g_Config.m_BrFilterGametype[0] && !str_find_nocase(m_ppServerlist[i]->m_Info.m_aGameType, g_Config.m_BrFilterGametype))
-			Filtered = 1;
-		else if(g_Config.m_BrFilterUnfinishedMap && m_ppServerlist[i]->m_Info.m_HasRank == 1)
-			Filtered = 1;
-		else
+		if(g_Config.m_BrFilterCountry)
 		{
-			if(g_Config.m_BrFilterCountry)
+			Filtered = 1;
+			// match against player country
+			for(p = 0; p < minimum(pInfo->m_NumClients, (int)MAX_CLIENTS); p++)
 			{
-				Filtered = 1;
-				// match against player country
-				for(p = 0; p < minimum(m_ppServerlist[i]->m_Info.m_NumClients, (int)MAX_CLIENTS); p++)
+				if(pInfo->m_aClients[p].m_Country == g_Config.m_BrFilterCountryIndex)
 				{
-					if(m_ppServerlist[i]->m_Info.m_aClients[p].m_Country == g_Config.m_BrFilterCountryIndex)
-					{
-						Filtered = 0;
-						break;
-					}
+					Filtered = 0;
+					break;
 				}
 			}
+		}
 
-			if(!Filtered && g_Config.m_BrFilterString[0] != 0)
-			{
-				int MatchFound = 0;
-
-				m_ppServerlist[i]->m_Info.m_QuickSearchHit = 0;
+		if(!Filtered && g_Config.m_BrFilterString[0] != 0)
+		{
+			int MatchFound = 0;
 
-				// match against server name
-				if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aName, g_Config.m_BrFilterString))
-				{
-					MatchFound = 1;
-					m_ppServerlist[i]->m_Info.m_QuickSearchHit |= IServerBrowser::QUICK_SERVERNAME;
-				}
+			pInfo->m_QuickSearchHit = 0;
 
-				// match against players
-				for(p = 0; p < minimum(m_ppServerlist[i]->m_Info.m_NumClients, (int)MAX_CLIENTS); p++)
-				{
-					if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aClients[p].m_aName, g_Config.m_BrFilterString) ||
-						str_find_nocase(m_ppServerlist[i]->m_Info.m_aClients[p].m_aClan, g_Config.m_BrFilterString))
-					{
-						MatchFound = 1;
-						m_ppServerlist[i]->m_Info.m_QuickSearchHit |= IServerBrowser::QUICK_PLAYER;
-						break;
-					}
-				}
+			// match against server name
+			if(str_find_nocase(pInfo->m_aName, g_Config.m_BrFilterString))
+			{
+				MatchFound = 1;
+				pInfo->m_QuickSearchHit |= IServerBrowser::QUICK_SERVERNAME;
+			}
 
-				// match against map
-				if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aMap, g_Config.m_BrFilterString))
+			// match against players
+			for(p = 0; p < minimum(pInfo->m_NumClients, (int)MAX_CLIENTS); p++)
+			{
+				if(str_find_nocase(pInfo->m_aClients[p].m_aName, g_Config.m_BrFilterString) ||
+					str_find_nocase(pInfo->m_aClients[p].m_aClan, g_Config.m_BrFilterString))
 				{
 					MatchFound = 1;
-					m_ppServerlist[i]->m_Info.m_QuickSearchHit |= IServerBrowser::QUICK_MAPNAME;
+					pInfo->m_QuickSearchHit |= IServerBrowser::QUICK_PLAYER;
+					break;
 				}
-
-				if(!MatchFound)
-					Filtered = 1;
 			}
 
-			if(!Filtered && g_Config.m_BrExcludeString[0] != 0)
+			// match against map
+			if(str_find_nocase(pInfo->m_aMap, g_Config.m_BrFilterString))
 			{
-				int MatchFound = 0;
+				MatchFound = 1;
+				pInfo->m_QuickSearchHit |= IServerBrowser::QUICK_MAPNAME;
+			}
 
-				// match against server name
-				if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aName, g_Config.m_BrExcludeString))
-				{
-					MatchFound = 1;
-				}
+			if(!MatchFound)
+				Filtered = 1;
+		}
 
-				// match against map
-				if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aMap, g_Config.m_BrExcludeString))
-				{
-					MatchFound = 1;
-				}
+		if(!Filtered && g_Config.m_BrExcludeString[0] != 0)
+		{
+			int MatchFound = 0;
 
-				// match against gametype
-				if(str_find_nocase(m_ppServerlist[i]->m_Info.m_aGameType, g_Config.m_BrExcludeString))
-				{
-					MatchFound = 1;
-				}
+			// match against server name
+			if(str_find_nocase(pInfo->m_aName, g_Config.m_BrExcludeString))
+			{
+				MatchFound = 1;
+			}
 
-				if(MatchFound)
-					Filtered = 1;
+			// match against map
+			if(str_find_nocase(pInfo->m_aMap, g_Config.m_BrExcludeString))
+			{
+				MatchFound = 1;
 			}
-		}
 
-		if(Filtered == 0)
-		{
-			// check for friend
-			m_ppServerlist[i]->m_Info.m_FriendState = IFriends::FRIEND_NO;
-			for(p = 0; p < minimum(m_ppServerlist[i]->m_Info.m_NumClients, (int)MAX_CLIENTS); p++)
+			// match against gametype
+			if(str_find_nocase(pInfo->m_aGameType, g_Config.m_BrExcludeString))
 			{
-				m_ppServerlist[i]->m_Info.m_aClients[p].m_FriendState = m_pFriends->GetFriendState(m_ppServerlist[i]->m_Info.m_aClients[p].m_aName,
-					m_ppServerlist[i]->m_Info.m_aClients[p].m_aClan);
-				m_ppServerlist[i]->m_Info.m_FriendState = maximum(m_ppServerlist[i]->m_Info.m_FriendState, m_ppServerlist[i]->m_Info.m_aClients[p].m_FriendState);
+				MatchFound = 1;
 			}
 
-			if(!g_Config.m_BrFilterFriends || m_ppServerlist[i]->m_Info.m_FriendState != IFriends::FRIEND_NO)
-				m_pSortedServerlist[m_NumSortedServers++] = i;
+			if(MatchFound)
+				Filtered = 1;
 		}
 	}
+
+	if(Filtered)
+		return true;
+
+	// check for friend
+	pInfo->m_FriendState = IFriends::FRIEND_NO;
+	for(p = 0; p < minimum(pInfo->m_NumClients, (int)MAX_CLIENTS); p++)
+	{
+		pInfo->m_aClients[p].m_FriendState = m_pFriends->GetFriendState(pInfo->m_aClients[p].m_aName,
+			pInfo->m_aClients[p].m_aClan);
+		pInfo->m_FriendState = maximum(pInfo->m_FriendState, pInfo->m_aClients[p].m_FriendState);
+	}
+
+	return g_Config.m_BrFilterFriends && pInfo->m_FriendState == IFriends::FRIEND_NO;
+}
+
+void CServerBrowser::Filter()
+{
+	m_NumSortedServers = 0;
+
+	// filter the servers
+	for(int i = 0; i < m_NumServers; i++)
+	{
+		m_ppServerlist[i]->m_Info.m_SortedIndex = -1;
+		if(!IsFiltered(&m_ppServerlist[i]->m_Info))
+			m_pSortedServerlist[m_NumSortedServers++] = i;
+	}
 }
 
 int CServerBrowser::SortHash() const
@@ -358,18 +364,8 @@ void CServerBrowser::Sort()
 	Filter();
 
 	// sort
-	if(g_Config.m_BrSortOrder == 2 && (g_Config.m_BrSort == IServerBrowser::SORT_NUMPLAYERS || g_Config.m_BrSort == IServerBrowser::SORT_PING))
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortCompareNumPlayersAndPing));
-	else if(g_Config.m_BrSort == IServerBrowser::SORT_NAME)
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortCompareName));
-	else if(g_Config.m_BrSort == IServerBrowser::SORT_PING)
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortComparePing));
-	else if(g_Config.m_BrSort == IServerBrowser::SORT_MAP)
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortCompareMap));
-	else if(g_Config.m_BrSort == IServerBrowser::SORT_NUMPLAYERS)
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortCompareNumPlayers));
-	else if(g_Config.m_BrSort == IServerBrowser::SORT_GAMETYPE)
-		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, &CServerBrowser::SortCompareGametype));
+	if(GetSortFunc())
+		std::stable_sort(m_pSortedServerlist, m_pSortedServerlist + m_NumSortedServers, SortWrap(this, GetSortFunc()));
 
 	// set indexes
 	for(i = 0; i < m_NumSortedServers; i++)
@@ -380,6 +376,71 @@ void CServerBrowser::Sort()
 	m_Sorthash = SortHash();
 }
 
+CServerBrowser::SortFunc CServerBrowser::GetSortFunc() const
+{
+	if(g_Config.m_BrSortOrder == 2 && (g_Config.m_BrSort == IServerBrowser::SORT_NUMPLAYERS || g_Config.m_BrSort == IServerBrowser::SORT_PING))
+		return &CServerBrowser::SortCompareNumPlayersAndPing;
+	else if(g_Config.m_BrSort == IServerBrowser::SORT_NAME)
+		return &CServerBrowser::SortCompareName;
+	else if(g_Config.m_BrSort == IServerBrowser::SORT_PING)
+		return &CServerBrowser::SortComparePing;
+	else if(g_Config.m_BrSort == IServerBrowser::SORT_MAP)
+		return &CServerBrowser::SortCompareMap;
+	else if(g_Config.m_BrSort == IServerBrowser::SORT_NUMPLAYERS)
+		return &CServerBrowser::SortCompareNumPlayers;
+	else if(g_Config.m_BrSort == IServerBrowser::SORT_GAMETYPE)
+		return &CServerBrowser::SortCompareGametype;
+	return 0;
+}
+
+void CServerBrowser::Resort(CServerEntry *pEntry)
+{
+	// the whole list gets sorted again in the next update
+	if(m_Sorthash != SortHash())
+		return;
+
+	// take it out of the sorted list
+	int First = m_NumSortedServers;
+	int Last = -1;
+	int OldIndex = pEntry->m_Info.m_SortedIndex;
+	if(OldIndex >= 0)
+	{
+		mem_move(&m_pSortedServerlist[OldIndex], &m_pSortedServerlist[OldIndex + 1], (m_NumSortedServers - OldIndex - 1) * sizeof(int));
+		m_NumSortedServers--;
+		First = OldIndex;
+		Last = m_NumSortedServers - 1;
+	}
+	pEntry->m_Info.m_SortedIndex = -1;
+
+	// and put it back where it belongs now, behind all equal entries
+	SetFilteredPlayers(pEntry->m_Info);
+	if(!IsFiltered(&pEntry->m_Info))
+	{
+		int ServerIndex = pEntry->m_Info.m_ServerIndex;
+		int *pEnd = m_pSortedServerlist + m_NumSortedServers;
+		int NewIndex = m_NumSortedServers;
+		if(GetSortFunc())
+			NewIndex = std::upper_bound(m_pSortedServerlist, pEnd, ServerIndex, SortWrap(this, GetSortFunc())) - m_pSortedServerlist;
+		mem_move(&m_pSortedServerlist[NewIndex + 1], &m_pSortedServerlist[NewIndex], (m_NumSortedServers - NewIndex) * sizeof(int));
+		m_pSortedServerlist[NewIndex] = ServerIndex;
+		m_NumSortedServers++;
+		if(OldIndex >= 0)
+		{
+			// only the entries in between moved
+			First = minimum(OldIndex, NewIndex);
+			Last = maximum(OldIndex, NewIndex);
+		}
+		else
+		{
+			First = NewIndex;
+			Last = m_NumSortedServers - 1;
+		}
+	}
+
+	for(int i = First; i <= Last; i++)
+		m_ppServerlist[m_pSortedServerlist[i]]->m_Info.m_SortedIndex = i;
+}
+
 void CServerBrowser::RemoveRequest(CServerEntry *pEntry)
 {
 	if(pEntry->m_pPrevReq || pEntry->m_pNextReq || m_pFirstReqServer == pEntry)
@@ -414,6 +475,22 @@ CServerBrowser::CServerEntry *CServerBrowser::Find(const NETADDR &Addr)
 
 void CServerBrowser::QueueRequest(CServerEntry *pEntry)
 {
+	// favorites and recently played servers are requested first
+	auto It = m_Cache.find(pEntry->m_Addr);
+	bool Played = It != m_Cache.end() && It->second.m_PlayTime > time_timestamp() - CACHE_MAX_AGE;
+	if(pEntry->m_Info.m_Favorite || Played)
+	{
+		pEntry->m_pNextReq = m_pFirstReqServer;
+		if(m_pFirstReqServer)
+			m_pFirstReqServer->m_pPrevReq = pEntry;
+		else
+			m_pLastReqServer = pEntry;
+		m_pFirstReqServer = pEntry;
+		pEntry->m_pPrevReq = 0;
+		m_NumRequests++;
+		return;
+	}
+
 	// add it to the list of servers that we should request info from
 	pEntry->m_pPrevReq = m_pLastReqServer;
 	if(m_pLastReqServer)
@@ -429,9 +506,13 @@ void CServerBrowser::SetInfo(CServerEntry *pEntry, const CServerInfo &Info)
 {
 	bool Fav = pEntry->m_Info.m_Favorite;
 	bool Off = pEntry->m_Info.m_Official;
+	int SortedIndex = pEntry->m_Info.m_SortedIndex;
+	int ServerIndex = pEntry->m_Info.m_ServerIndex;
 	pEntry->m_Info = Info;
 	pEntry->m_Info.m_Favorite = Fav;
 	pEntry->m_Info.m_Official = Off;
+	pEntry->m_Info.m_SortedIndex = SortedIndex;
+	pEntry->m_Info.m_ServerIndex = ServerIndex;
 	pEntry->m_Info.m_NetAddr = pEntry->m_Addr;
 
 	// all these are just for nice compatibility
@@ -449,6 +530,186 @@ void CServerBrowser::SetInfo(CServerEntry *pEntry, const CServerInfo &Info)
 	}*/
 
 	pEntry->m_GotInfo = 1;
+	pEntry->m_CachedInfo = false;
+}
+
+static void PackInt(std::vector<unsigned char> *pvData, int Value)
+{
+	unsigned char aBuf[8];
+	unsigned char *pEnd = CVariableInt::Pack(aBuf, Value);
+	pvData->insert(pvData->end(), aBuf, pEnd);
+}
+
+static void PackString(std::vector<unsigned char> *pvData, const char *pStr)
+{
+	pvData->insert(pvData->end(), pStr, pStr + str_length(pStr) + 1);
+}
+
+static void PackInfo(std::vector<unsigned char> *pvData, const CServerInfo &Info)
+{
+	PackInt(pvData, Info.m_Type);
+	PackInt(pvData, Info.m_MaxClients);
+	PackInt(pvData, Info.m_NumClients);
+	PackInt(pvData, Info.m_MaxPlayers);
+	PackInt(pvData, Info.m_NumPlayers);
+	PackInt(pvData, Info.m_Flags);
+	PackInt(pvData, Info.m_Latency);
+	PackInt(pvData, Info.m_MapCrc);
+	PackInt(pvData, Info.m_MapSize);
+	PackString(pvData, Info.m_aGameType);
+	PackString(pvData, Info.m_aName);
+	PackString(pvData, Info.m_aMap);
+	PackString(pvData, Info.m_aVersion);
+	PackInt(pvData, Info.m_NumReceivedClients);
+	for(int i = 0; i < Info.m_NumReceivedClients; i++)
+	{
+		PackString(pvData, Info.m_aClients[i].m_aName);
+		PackString(pvData, Info.m_aClients[i].m_aClan);
+		PackInt(pvData, Info.m_aClients[i].m_Country);
+		PackInt(pvData, Info.m_aClients[i].m_Score);
+		PackInt(pvData, Info.m_aClients[i].m_Player);
+	}
+}
+
+static bool UnpackInfo(const std::vector<unsigned char> &vData, CServerInfo *pInfo)
+{
+	CUnpacker Up;
+	Up.Reset(vData.data(), vData.size());
+	pInfo->m_Type = Up.GetInt();
+	pInfo->m_MaxClients = Up.GetInt();
+	pInfo->m_NumClients = Up.GetInt();
+	pInfo->m_MaxPlayers = Up.GetInt();
+	pInfo->m_NumPlayers = Up.GetInt();
+	pInfo->m_Flags = Up.GetInt();
+	pInfo->m_Latency = Up.GetInt();
+	pInfo->m_MapCrc = Up.GetInt();
+	pInfo->m_MapSize = Up.GetInt();
+	str_copy(pInfo->m_aGameType, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aGameType));
+	str_copy(pInfo->m_aName, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aName));
+	str_copy(pInfo->m_aMap, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aMap));
+	str_copy(pInfo->m_aVersion, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aVersion));
+	pInfo->m_NumReceivedClients = Up.GetInt();
+	if(pInfo->m_NumReceivedClients < 0 || pInfo->m_NumReceivedClients > MAX_CLIENTS)
+		return false;
+	for(int i = 0; i < pInfo->m_NumReceivedClients; i++)
+	{
+		str_copy(pInfo->m_aClients[i].m_aName, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aClients[i].m_aName));
+		str_copy(pInfo->m_aClients[i].m_aClan, Up.GetString(CUnpacker::SANITIZE_CC), sizeof(pInfo->m_aClients[i].m_aClan));
+		pInfo->m_aClients[i].m_Country = Up.GetInt();
+		pInfo->m_aClients[i].m_Score = Up.GetInt();
+		pInfo->m_aClients[i].m_Player = Up.GetInt();
+	}
+	return !Up.Error() && pInfo->m_NumClients >= 0 && pInfo->m_NumPlayers >= 0 &&
+	       pInfo->m_NumPlayers <= pInfo->m_NumClients && pInfo->m_MaxPlayers <= pInfo->m_MaxClients;
+}
+
+void CServerBrowser::CacheInfo(CServerEntry *pEntry)
+{
+	CCacheEntry &Entry = m_Cache[pEntry->m_Addr];
+	Entry.m_InfoTime = time_timestamp();
+	Entry.m_Lists |= 1 << m_ServerlistType;
+	Entry.m_vInfo.clear();
+	PackInfo(&Entry.m_vInfo, pEntry->m_Info);
+}
+
+void CServerBrowser::SetPlayed(const NETADDR &Addr)
+{
+	m_Cache[Addr].m_PlayTime = time_timestamp();
+}
+
+void CServerBrowser::LoadCache()
+{
+	IOHANDLE File = m_pStorage->OpenFile(SERVERBROWSER_CACHE, IOFLAG_READ, IStorage::TYPE_SAVE);
+	if(!File)
+		return;
+	std::vector<unsigned char> vData(io_length(File));
+	bool Read = io_read(File, vData.data(), vData.size()) == vData.size();
+	io_close(File);
+
+	CUnpacker Up;
+	Up.Reset(vData.data(), vData.size());
+	const unsigned char *pMagic = Up.GetRaw(sizeof(CACHE_MAGIC));
+	if(!Read || !pMagic || mem_comp(pMagic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || Up.GetInt() != CACHE_VERSION)
+	{
+		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "client_srvbrowse", "ignoring invalid server cache");
+		return;
+	}
+
+	int Now = time_timestamp();
+	int Num = Up.GetInt();
+	for(int i = 0; i < Num && !Up.Error(); i++)
+	{
+		NETADDR Addr;
+		bool Valid = net_addr_from_str(&Addr, Up.GetString()) == 0;
+		CCacheEntry Entry;
+		Entry.m_InfoTime = Up.GetInt();
+		Entry.m_PlayTime = Up.GetInt();
+		Entry.m_Lists = Up.GetInt();
+		int Size = Up.GetInt();
+		const unsigned char *pInfo = Size >= 0 ? Up.GetRaw(Size) : 0;
+		if(!Valid || !pInfo || maximum(Entry.m_InfoTime, Entry.m_PlayTime) < Now - CACHE_MAX_AGE)
+			continue;
+		Entry.m_vInfo.assign(pInfo, pInfo + Size);
+		m_Cache[Addr] = Entry;
+	}
+
+	char aBuf[128];
+	str_format(aBuf, sizeof(aBuf), "loaded %d cached servers", (int)m_Cache.size());
+	m_pConsole->Print(IConsole::OUTPUT_LEVEL_DEBUG, "client_srvbrowse", aBuf);
+}
+
+void CServerBrowser::SaveCache()
+{
+	std::vector<unsigned char> vData(CACHE_MAGIC, CACHE_MAGIC + sizeof(CACHE_MAGIC));
+	PackInt(&vData, CACHE_VERSION);
+	int Now = time_timestamp();
+	int Num = 0;
+	for(auto &Entry : m_Cache)
+		Num += maximum(Entry.second.m_InfoTime, Entry.second.m_PlayTime) >= Now - CACHE_MAX_AGE;
+	PackInt(&vData, Num);
+	for(auto &Entry : m_Cache)
+	{
+		if(maximum(Entry.second.m_InfoTime, Entry.second.m_PlayTime) < Now - CACHE_MAX_AGE)
+			continue;
+		char aAddr[NETADDR_MAXSTRSIZE];
+		net_addr_str(&Entry.first, aAddr, sizeof(aAddr), true);
+		PackString(&vData, aAddr);
+		PackInt(&vData, Entry.second.m_InfoTime);
+		PackInt(&vData, Entry.second.m_PlayTime);
+		PackInt(&vData, Entry.second.m_Lists);
+		PackInt(&vData, Entry.second.m_vInfo.size());
+		vData.insert(vData.end(), Entry.second.m_vInfo.begin(), Entry.second.m_vInfo.end());
+	}
+
+	// written next to it and renamed, so a crash can't leave half a cache
+	char aTmp[64];
+	str_format(aTmp, sizeof(aTmp), "%s.%d.tmp", SERVERBROWSER_CACHE, pid());
+	IOHANDLE File = m_pStorage->OpenFile(aTmp, IOFLAG_WRITE, IStorage::TYPE_SAVE);
+	if(!File)
+	{
+		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "client_srvbrowse", "failed to save the server cache");
+		return;
+	}
+	bool Written = io_write(File, vData.data(), vData.size()) == vData.size();
+	if(io_close(File) != 0 || !Written || !m_pStorage->RenameFile(aTmp, SERVERBROWSER_CACHE, IStorage::TYPE_SAVE))
+	{
+		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "client_srvbrowse", "failed to save the server cache");
+		m_pStorage->RemoveFile(aTmp, IStorage::TYPE_SAVE);
+	}
+}
+
+void CServerBrowser::ExpireCachedInfo(CServerEntry *pEntry)
+{
+	// show it like a server that hasn't answered yet
+	CServerInfo Info;
+	mem_zero(&Info, sizeof(Info));
+	Info.m_Latency = 999;
+	Info.m_HasRank = -1;
+	str_copy(Info.m_aAddress, pEntry->m_Info.m_aAddress, sizeof(Info.m_aAddress));
+	str_copy(Info.m_aName, Info.m_aAddress, sizeof(Info.m_aName));
+	SetInfo(pEntry, Info);
+	pEntry->m_GotInfo = 0;
+	Resort(pEntry);
 }
 
 CServerBrowser::CServerEntry *CServerBrowser::Add(const NETADDR &Addr)
@@ -467,6 +728,7 @@ CServerBrowser::CServerEntry *CServerBrowser::Add(const NETADDR &Addr)
 
 	pEntry->m_Info.m_Latency = 999;
 	pEntry->m_Info.m_HasRank = -1;
+	pEntry->m_Info.m_SortedIndex = -1;
 	net_addr_str(&Addr, pEntry->m_Info.m_aAddress, sizeof(pEntry->m_Info.m_aAddress), true);
 	str_copy(pEntry->m_Info.m_aName, pEntry->m_Info.m_aAddress, sizeof(pEntry->m_Info.m_aName));
 
@@ -510,6 +772,12 @@ CServerBrowser::CServerEntry *CServerBrowser::Add(const NETADDR &Addr)
 			mem_copy(ppNewlist, m_ppServerlist, m_NumServers * sizeof(CServerEntry *));
 		free(m_ppServerlist);
 		m_ppServerlist = ppNewlist;
+
+		int *pNewSorted = (int *)calloc(m_NumServerCapacity, sizeof(int));
+		if(m_NumSortedServers > 0)
+			mem_copy(pNewSorted, m_pSortedServerlist, m_NumSortedServers * sizeof(int));
+		free(m_pSortedServerlist);
+		m_pSortedServerlist = pNewSorted;
 	}
 
 	// add to list
@@ -517,6 +785,22 @@ CServerBrowser::CServerEntry *CServerBrowser::Add(const NETADDR &Addr)
 	pEntry->m_Info.m_ServerIndex = m_NumServers;
 	m_NumServers++;
 
+	// show what we knew about it last time until it answers
+	auto It = m_Cache.find(Addr);
+	if(It != m_Cache.end() && !It->second.m_vInfo.empty())
+	{
+		CServerInfo Info;
+		mem_zero(&Info, sizeof(Info));
+		if(UnpackInfo(It->second.m_vInfo, &Info))
+		{
+			str_copy(Info.m_aAddress, pEntry->m_Info.m_aAddress, sizeof(Info.m_aAddress));
+			SetInfo(pEntry, Info);
+			if(pEntry->m_Info.m_aMap[0])
+				pEntry->m_Info.m_HasRank = HasRank(pEntry->m_Info.m_aMap);
+			pEntry->m_CachedInfo = true;
+		}
+	}
+
 	return pEntry;
 }
 
@@ -621,9 +905,12 @@ void CServerBrowser::Set(const NETADDR &Addr, int Type, int Token, const CServer
 			pEntry->m_RequestTime = -1; // Request has been answered
 		}
 		RemoveRequest(pEntry);
+		if(m_ServerlistType != IServerBrowser::TYPE_LAN)
+			CacheInfo(pEntry);
 	}
 
-	Sort();
+	if(pEntry)
+		Resort(pEntry);
 }
 
 void CServerBrowser::Refresh(int Type)
@@ -676,7 +963,19 @@ void CServerBrowser::Refresh(int Type)
 			m_pConsole->Print(IConsole::OUTPUT_LEVEL_DEBUG, "client_srvbrowse", "broadcasting for servers");
 	}
 	else if(Type == IServerBrowser::TYPE_INTERNET)
+	{
 		m_NeedRefresh = 1;
+
+		// list the servers from last time while the masters are asked
+		for(auto &Entry : m_Cache)
+		{
+			if(!(Entry.second.m_Lists & (1 << IServerBrowser::TYPE_INTERNET)))
+				continue;
+			CServerEntry *pEntry = Add(Entry.first);
+			QueueRequest(pEntry);
+			Resort(pEntry);
+		}
+	}
 	else if(Type == IServerBrowser::TYPE_FAVORITES)
 	{
 		for(int i = 0; i < m_NumFavoriteServers; i++)
@@ -933,6 +1232,9 @@ void CServerBrowser::Update(bool ForceResort)
 			break;
 		if(pEntry->m_RequestTime && pEntry->m_RequestTime + Timeout < Now)
 		{
+			// the server may be gone, stop showing its old info
+			if(pEntry->m_CachedInfo)
+				ExpireCachedInfo(pEntry);
 			pEntry = pEntry->m_pNextReq;
 			continue;
 		}
@@ -977,6 +1279,8 @@ void CServerBrowser::Update(bool ForceResort)
 			if(!pEntry) // no more entries
 				break;
 			pNext = pEntry->m_pNextReq;
+			if(pEntry->m_CachedInfo)
+				ExpireCachedInfo(pEntry);
 			RemoveRequest(pEntry); //release request
 			pEntry = pNext;
 		}
@@ -1165,6 +1469,8 @@ void CServerBrowser::LoadDDNetRanks()
 		if(m_ppServerlist[i]->m_Info.m_aMap[0])
 			m_ppServerlist[i]->m_Info.m_HasRank = HasRank(m_ppServerlist[i]->m_Info.m_aMap);
 	}
+	// the unfinished map filter depends on the ranks
+	Sort();
 }
 
 int CServerBrowser::HasRank(const char *pMap)
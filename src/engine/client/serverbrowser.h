@@ -10,6 +10,9 @@
 #include <engine/shared/config.h>
 #include <engine/shared/memheap.h>
 
+#include <map>
+#include <vector>
+
 class CServerBrowser : public IServerBrowser
 {
 public:
@@ -21,6 +24,7 @@ public:
 		int m_GotInfo;
 		bool m_Request64Legacy;
 		CServerInfo m_Info;
+		bool m_CachedInfo; // m_Info is from the cache, the server hasn't answered yet
 
 		CServerEntry *m_pNextIp; // ip hashed list
 
@@ -62,6 +66,10 @@ public:
 		MAX_FAVORITES = 2048,
 		MAX_COUNTRIES = 32,
 		MAX_TYPES = 32,
+
+		CACHE_VERSION = 1,
+		// servers that weren't seen or played for a week are forgotten
+		CACHE_MAX_AGE = 60 * 60 * 24 * 7,
 	};
 
 	struct CNetwork
@@ -132,11 +140,16 @@ public:
 	CServerEntry *Find(const NETADDR &Addr);
 	int GetCurrentType() { return m_ServerlistType; };
 
+	void LoadCache();
+	void SaveCache();
+	void SetPlayed(const NETADDR &Addr);
+
 private:
 	CNetClient *m_pNetClient;
 	IMasterServer *m_pMasterServer;
 	class IConsole *m_pConsole;
 	class IFriends *m_pFriends;
+	class IStorage *m_pStorage;
 	char m_aNetVersion[128];
 
 	CHeap m_ServerlistHeap;
@@ -165,7 +178,6 @@ private:
 	int m_NeedRefresh;
 
 	int m_NumSortedServers;
-	int m_NumSortedServersCapacity;
 	int m_NumServers;
 	int m_NumServerCapacity;
 
@@ -178,11 +190,27 @@ private:
 	int m_RequestNumber;
 	unsigned char m_aTokenSeed[16];
 
+	struct CAddrLess
+	{
+		bool operator()(const NETADDR &Addr1, const NETADDR &Addr2) const { return net_addr_comp(&Addr1, &Addr2) < 0; }
+	};
+
+	// last known info of each server, kept across restarts
+	struct CCacheEntry
+	{
+		int m_InfoTime; // unix time of the last answer
+		int m_PlayTime; // unix time of the last visit, 0 if never
+		int m_Lists; // bitmask of the list types it was in
+		std::vector<unsigned char> m_vInfo; // packed server info, empty if none
+	};
+	std::map<NETADDR, CCacheEntry, CAddrLess> m_Cache;
+
 	int GenerateToken(const NETADDR &Addr) const;
 	static int GetBasicToken(int Token);
 	static int GetExtraToken(int Token);
 
 	// sorting criteria
+	typedef bool (CServerBrowser::*SortFunc)(int, int) const;
 	bool SortCompareName(int Index1, int Index2) const;
 	bool SortCompareMap(int Index1, int Index2) const;
 	bool SortComparePing(int Index1, int Index2) const;
@@ -192,8 +220,12 @@ private:
 	bool SortCompareNumPlayersAndPing(int Index1, int Index2) const;
 
 	//
+	bool IsFiltered(CServerInfo *pInfo) const;
 	void Filter();
 	void Sort();
+	SortFunc GetSortFunc() const;
+	// moves a new or changed entry to its place in the sorted list
+	void Resort(CServerEntry *pEntry);
 	int SortHash() const;
 
 	CServerEntry *Add(const NETADDR &Addr);
@@ -203,6 +235,9 @@ private:
 	void RequestImpl(const NETADDR &Addr, CServerEntry *pEntry) const;
 
 	void SetInfo(CServerEntry *pEntry, const CServerInfo &Info);
+	void CacheInfo(CServerEntry *pEntry);
+	// drops the cached info of a server that didn't answer
+	void ExpireCachedInfo(CServerEntry *pEntry);
 
 	static void ConfigSaveCallback(IConfig *pConfig, void *pUserData);
 };
@@ -2,6 +2,7 @@
 /* If you are missing that file, acquire a complete release at teeworlds.com.                */
 #include <base/math.h>
 #include <base/system.h>
+#include <base/tl/threading.h>
 #include <engine/graphics.h>
 #include <engine/shared/config.h>
 #include <engine/storage.h>
@@ -17,7 +18,14 @@ enum
 	MAX_CHARACTERS = 64,
 };
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iterator>
+#include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 struct SFontSizeChar
@@ -35,6 +43,10 @@ struct SFontSizeChar
 	float m_aUVs[4];
 	int64 m_TouchTime;
 	FT_UInt m_GlyphIndex;
+
+	// the metrics are known, but the glyph is still being rasterized in
+	// the background and the UVs aren't set yet
+	bool m_Pending;
 };
 
 struct STextCharQuadVertexColor
@@ -71,6 +83,8 @@ struct CFontSizeData
 	FT_Face *m_pFace;
 
 	std::map<int, SFontSizeChar> m_Chars;
+	// the common characters were queued for rasterization
+	bool m_Prewarmed;
 };
 
 #define MIN_FONT_SIZE 6
@@ -98,6 +112,7 @@ public:
 			m_aFontSizes[i].m_FontSize = i + MIN_FONT_SIZE;
 			m_aFontSizes[i].m_pFace = &this->m_FtFace;
 			m_aFontSizes[i].m_Chars.clear();
+			m_aFontSizes[i].m_Prewarmed = false;
 		}
 	}
 
@@ -109,12 +124,14 @@ public:
 	}
 
 	void *m_pBuf;
+	size_t m_BufSize;
 	char m_aFilename[512];
 	FT_Face m_FtFace;
 
 	struct SFontFallBack
 	{
 		void *m_pBuf;
+		size_t m_BufSize;
 		char m_aFilename[512];
 		FT_Face m_FtFace;
 	};
@@ -190,8 +207,363 @@ struct STextContainer
 	}
 };
 
+// a glyph quad of a laid out text, relative to the start of the text
+struct STextLayoutGlyph
+{
+	float m_X, m_Y;
+	float m_Width, m_Height;
+	// in texture pixels, the texture might grow
+	float m_aUVs[4];
+};
+
+// what TextEx computed for a text, to render it again without decoding,
+// measuring and kerning it
+struct STextLayout
+{
+	std::string m_Key;
+	std::vector<STextLayoutGlyph> m_vGlyphs;
+
+	// the cursor changes, positions are relative to the start of the text
+	float m_EndX, m_EndY;
+	bool m_GotNewLine;
+	int m_NumNewLines;
+	int m_GlyphCount;
+	int m_CharCount;
+	float m_MaxCharacterHeight;
+	bool m_HasLongestLine;
+	float m_LongestLineWidth;
+};
+
+// everything besides the text that the layout of a text depends on
+struct STextLayoutKey
+{
+	CFont *m_pFont;
+	int m_ActualSize;
+	float m_FakeToScreenX;
+	float m_FakeToScreenY;
+	// distances from the start of the text to the start of the line
+	float m_StartX;
+	float m_AlignedStartX;
+	unsigned int m_RenderFlags;
+	int m_Flags;
+	float m_LineWidth;
+	int m_MaxLines;
+	int m_LineCount;
+	// the last glyph is laid out differently if the text ends there
+	bool m_EndOfString;
+};
+
+// a glyph rasterized and padded for the font textures
+struct SRasterizedGlyph
+{
+	CFont *m_pFont;
+	int m_FontSize;
+	int m_Chr;
+	// everything but the UVs
+	SFontSizeChar m_Char;
+	// empty if the glyph couldn't be rasterized
+	std::vector<unsigned char> m_vData;
+	std::vector<unsigned char> m_vDataOutlined;
+};
+
+static void Grow(unsigned char *pIn, unsigned char *pOut, int w, int h, int OutlineCount)
+{
+	for(int y = 0; y < h; y++)
+		for(int x = 0; x < w; x++)
+		{
+			int c = pIn[y * w + x];
+
+			for(int sy = -OutlineCount; sy <= OutlineCount; sy++)
+				for(int sx = -OutlineCount; sx <= OutlineCount; sx++)
+				{
+					int GetX = x + sx;
+					int GetY = y + sy;
+					if(GetX >= 0 && GetY >= 0 && GetX < w && GetY < h)
+					{
+						int Index = GetY * w + GetX;
+						if(pIn[Index] > c)
+							c = pIn[Index];
+					}
+				}
+
+			pOut[y * w + x] = c;
+		}
+}
+
+static int AdjustOutlineThicknessToFontSize(int OutlineThickness, int FontSize)
+{
+	if(FontSize > 48)
+		OutlineThickness *= 4;
+	else if(FontSize >= 18)
+		OutlineThickness *= 2;
+	return OutlineThickness;
+}
+
+// setting the size again, even the same one, makes FreeType run the hinting
+// program of the font again for the next glyph
+static void SetPixelSize(FT_Face FtFace, int FontSize)
+{
+	if(FtFace->size->metrics.x_ppem != FontSize || FtFace->size->metrics.y_ppem != FontSize)
+		FT_Set_Pixel_Sizes(FtFace, 0, FontSize);
+}
+
+// returns the glyph of the character in the first face that has it, the
+// others are fallbacks, 0 if none has it. the face is set to the font size.
+static FT_UInt FindGlyph(const FT_Face *pFaces, int NumFaces, int Chr, int FontSize, bool Replace, FT_Face *pFace)
+{
+	for(int i = 0; i < NumFaces; i++)
+	{
+		*pFace = pFaces[i];
+		SetPixelSize(*pFace, FontSize);
+		if((*pFace)->charmap)
+		{
+			FT_UInt GlyphIndex = FT_Get_Char_Index(*pFace, (FT_ULong)Chr);
+			if(GlyphIndex != 0)
+				return GlyphIndex;
+		}
+	}
+
+	if(!Replace)
+		return 0;
+
+	const int ReplacementChr = 0x25a1; // White square to indicate missing glyph
+	*pFace = pFaces[0];
+	SetPixelSize(*pFace, FontSize);
+	FT_UInt GlyphIndex = FT_Get_Char_Index(*pFace, (FT_ULong)ReplacementChr);
+	if(GlyphIndex == 0)
+		dbg_msg("textrender", "font has no glyph for either %d or replacement char %d", Chr, ReplacementChr);
+	return GlyphIndex;
+}
+
+// sets the metrics of the glyph that was last loaded into the face. the
+// bitmap size is preset by FreeType even if the glyph wasn't rendered.
+static void SetGlyphMetrics(FT_Face FtFace, FT_UInt GlyphIndex, int Chr, int FontSize, SFontSizeChar *pFontchr)
+{
+	FT_Bitmap *pBitmap = &FtFace->glyph->bitmap; // ignore_convention
+	int Padding = 1 + AdjustOutlineThicknessToFontSize(1, FontSize);
+
+	pFontchr->m_ID = Chr;
+	pFontchr->m_Height = pBitmap->rows + Padding * 2;
+	pFontchr->m_Width = pBitmap->width + Padding * 2;
+	pFontchr->m_OffsetX = (FtFace->glyph->metrics.horiBearingX >> 6); // ignore_convention
+	pFontchr->m_OffsetY = -((FtFace->glyph->metrics.height >> 6) - (FtFace->glyph->metrics.horiBearingY >> 6));
+	pFontchr->m_AdvanceX = (FtFace->glyph->advance.x >> 6); // ignore_convention
+	pFontchr->m_GlyphIndex = GlyphIndex;
+	pFontchr->m_Pending = false;
+}
+
+static bool RasterizeGlyph(FT_Face FtFace, FT_UInt GlyphIndex, SRasterizedGlyph *pGlyph)
+{
+	if(FT_Load_Glyph(FtFace, GlyphIndex, FT_LOAD_RENDER | FT_LOAD_NO_BITMAP))
+	{
+		dbg_msg("textrender", "error loading glyph %d", pGlyph->m_Chr);
+		return false;
+	}
+
+	FT_Bitmap *pBitmap = &FtFace->glyph->bitmap; // ignore_convention
+
+	// adjust spacing
+	int OutlineThickness = AdjustOutlineThicknessToFontSize(1, pGlyph->m_FontSize);
+	int x = 1 + OutlineThickness;
+	int y = 1 + OutlineThickness;
+
+	unsigned int Width = pBitmap->width + x * 2;
+	unsigned int Height = pBitmap->rows + y * 2;
+
+	// prepare glyph data
+	pGlyph->m_vData.assign(Width * Height, 0);
+	pGlyph->m_vDataOutlined.resize(Width * Height);
+
+	for(unsigned int py = 0; py < pBitmap->rows; py++) // ignore_convention
+		for(unsigned int px = 0; px < pBitmap->width; px++) // ignore_convention
+			pGlyph->m_vData[(py + y) * Width + px + x] = pBitmap->buffer[py * pBitmap->width + px]; // ignore_convention
+
+	Grow(pGlyph->m_vData.data(), pGlyph->m_vDataOutlined.data(), Width, Height, OutlineThickness);
+
+	SetGlyphMetrics(FtFace, GlyphIndex, pGlyph->m_Chr, pGlyph->m_FontSize, &pGlyph->m_Char);
+	return true;
+}
+
+// Rasterizes glyphs on a background thread, so that text with characters
+// that weren't seen before doesn't stall the frame. The thread has its own
+// FreeType library and faces, FreeType objects can't be shared between
+// threads. The font buffers are only read and outlive the thread.
+class CGlyphRasterizer
+{
+public:
+	struct CRequest
+	{
+		CFont *m_pFont;
+		int m_FontSize;
+		int m_Chr;
+		// prewarmed characters that no face has are skipped instead of
+		// being replaced
+		bool m_Prewarm;
+		// the font and its fallbacks
+		std::vector<std::pair<const void *, size_t>> m_vFaces;
+	};
+
+	CGlyphRasterizer() :
+		m_pThread(0),
+		m_Shutdown(false),
+		m_HasDone(false),
+		m_FTLibrary(0)
+	{
+	}
+
+	~CGlyphRasterizer()
+	{
+		Shutdown();
+	}
+
+	bool Init()
+	{
+		if(FT_Init_FreeType(&m_FTLibrary))
+			return false;
+		m_Shutdown = false;
+		m_pThread = thread_init(WorkerThread, this, "glyph rasterizer");
+		if(!m_pThread)
+		{
+			FT_Done_FreeType(m_FTLibrary);
+			m_FTLibrary = 0;
+		}
+		return m_pThread != 0;
+	}
+
+	void Shutdown()
+	{
+		if(!m_pThread)
+			return;
+		m_Lock.take();
+		m_Shutdown = true;
+		m_Lock.release();
+		m_Semaphore.signal();
+		thread_wait(m_pThread);
+		m_pThread = 0;
+
+		for(auto &Face : m_Faces)
+			FT_Done_Face(Face.second);
+		m_Faces.clear();
+		FT_Done_FreeType(m_FTLibrary);
+		m_FTLibrary = 0;
+	}
+
+	bool IsRunning() const { return m_pThread != 0; }
+
+	// glyphs needed for the current frame go before prewarmed ones
+	void Request(CRequest &&Request)
+	{
+		m_Lock.take();
+		if(Request.m_Prewarm)
+			m_PrewarmRequests.push_back(std::move(Request));
+		else
+			m_Requests.push_back(std::move(Request));
+		m_Lock.release();
+		m_Semaphore.signal();
+	}
+
+	// appends the glyphs rasterized so far to the vector
+	void TakeDone(std::vector<SRasterizedGlyph> *pvGlyphs)
+	{
+		if(!m_HasDone.load())
+			return;
+		scope_lock Lock(&m_Lock);
+		if(pvGlyphs->empty())
+			std::swap(*pvGlyphs, m_vDone);
+		else
+		{
+			std::move(m_vDone.begin(), m_vDone.end(), std::back_inserter(*pvGlyphs));
+			m_vDone.clear();
+		}
+		m_HasDone.store(false);
+	}
+
+private:
+	static void WorkerThread(void *pUser)
+	{
+		((CGlyphRasterizer *)pUser)->Worker();
+	}
+
+	void Worker()
+	{
+		std::vector<FT_Face> vFaces;
+		while(true)
+		{
+			m_Semaphore.wait();
+			m_Lock.take();
+			if(m_Shutdown)
+			{
+				m_Lock.release();
+				return;
+			}
+			if(m_Requests.empty() && m_PrewarmRequests.empty())
+			{
+				m_Lock.release();
+				continue;
+			}
+			std::deque<CRequest> &Queue = m_Requests.empty() ? m_PrewarmRequests : m_Requests;
+			CRequest Request = std::move(Queue.front());
+			Queue.pop_front();
+			m_Lock.release();
+
+			vFaces.clear();
+			for(const auto &Source : Request.m_vFaces)
+			{
+				FT_Face &Face = m_Faces[Source.first];
+				if(!Face && FT_New_Memory_Face(m_FTLibrary, (const FT_Byte *)Source.first, Source.second, 0, &Face))
+				{
+					m_Faces.erase(Source.first);
+					continue;
+				}
+				vFaces.push_back(Face);
+			}
+
+			SRasterizedGlyph Glyph;
+			Glyph.m_pFont = Request.m_pFont;
+			Glyph.m_FontSize = Request.m_FontSize;
+			Glyph.m_Chr = Request.m_Chr;
+			FT_Face FtFace;
+			FT_UInt GlyphIndex = vFaces.empty() ? 0 : FindGlyph(vFaces.data(), vFaces.size(), Request.m_Chr, Request.m_FontSize, !Request.m_Prewarm, &FtFace);
+			if(GlyphIndex == 0 || !RasterizeGlyph(FtFace, GlyphIndex, &Glyph))
+			{
+				// a pending glyph is rendered synchronously then
+				if(Request.m_Prewarm)
+					continue;
+				Glyph.m_vData.clear();
+			}
+
+			scope_lock Lock(&m_Lock);
+			m_vDone.push_back(std::move(Glyph));
+			m_HasDone.store(true);
+		}
+	}
+
+	void *m_pThread;
+	lock m_Lock;
+	semaphore m_Semaphore;
+	bool m_Shutdown;
+	std::deque<CRequest> m_Requests;
+	std::deque<CRequest> m_PrewarmRequests;
+	std::vector<SRasterizedGlyph> m_vDone;
+	std::atomic<bool> m_HasDone;
+
+	// only used by the thread
+	FT_Library m_FTLibrary;
+	std::map<const void *, FT_Face> m_Faces;
+};
+
 class CTextRender : public IEngineTextRender
 {
+	enum
+	{
+		MAX_LAYOUT_CACHE_ENTRIES = 1024,
+		MAX_LAYOUT_CACHE_TEXT_LENGTH = 1024,
+		// large glyphs would fill the font textures quickly
+		MAX_PREWARM_FONT_SIZE = 48,
+		// each one is a texture upload, the rest waits for the next frame
+		MAX_PLACED_GLYPHS_PER_FRAME = 64,
+	};
+
 	IGraphics *m_pGraphics;
 	IGraphics *Graphics() { return m_pGraphics; }
 
@@ -206,6 +578,47 @@ class CTextRender : public IEngineTextRender
 	std::vector<CFont *> m_Fonts;
 	CFont *m_pCurFont;
 
+	// most recently used first
+	std::list<STextLayout> m_LayoutCache;
+	std::unordered_map<std::string, std::list<STextLayout>::iterator> m_LayoutCacheIndex;
+	std::string m_LayoutKey;
+	// TextEx measuring words for line breaks, these aren't cached
+	bool m_InLayout;
+	int64 m_LayoutCacheHits;
+	int64 m_LayoutCacheMisses;
+
+	CGlyphRasterizer m_GlyphRasterizer;
+	std::vector<SRasterizedGlyph> m_vRasterizedGlyphs;
+	// for rendering glyphs on this thread
+	SRasterizedGlyph m_RenderedGlyph;
+	std::vector<FT_Face> m_vFaces;
+
+	STextLayout *FindLayout(const std::string &Key)
+	{
+		auto Index = m_LayoutCacheIndex.find(Key);
+		if(Index == m_LayoutCacheIndex.end())
+			return 0;
+		m_LayoutCache.splice(m_LayoutCache.begin(), m_LayoutCache, Index->second);
+		return &m_LayoutCache.front();
+	}
+
+	void AddLayout(STextLayout &&Layout)
+	{
+		if(m_LayoutCache.size() >= MAX_LAYOUT_CACHE_ENTRIES)
+		{
+			m_LayoutCacheIndex.erase(m_LayoutCache.back().m_Key);
+			m_LayoutCache.pop_back();
+		}
+		m_LayoutCache.push_front(std::move(Layout));
+		m_LayoutCacheIndex[m_LayoutCache.front().m_Key] = m_LayoutCache.begin();
+	}
+
+	void ClearLayoutCache()
+	{
+		m_LayoutCache.clear();
+		m_LayoutCacheIndex.clear();
+	}
+
 	int GetFreeTextContainerIndex()
 	{
 		if(m_FirstFreeTextContainerIndex == -1)
@@ -277,30 +690,6 @@ class CTextRender : public IEngineTextRender
 		return m_RenderFlags;
 	}
 
-	void Grow(unsigned char *pIn, unsigned char *pOut, int w, int h, int OutlineCount)
-	{
-		for(int y = 0; y < h; y++)
-			for(int x = 0; x < w; x++)
-			{
-				int c = pIn[y * w + x];
-
-				for(int sy = -OutlineCount; sy <= OutlineCount; sy++)
-					for(int sx = -OutlineCount; sx <= OutlineCount; sx++)
-					{
-						int GetX = x + sx;
-						int GetY = y + sy;
-						if(GetX >= 0 && GetY >= 0 && GetX < w && GetY < h)
-						{
-							int Index = GetY * w + GetX;
-							if(pIn[Index] > c)
-								c = pIn[Index];
-						}
-					}
-
-				pOut[y * w + x] = c;
-			}
-	}
-
 	IGraphics::CTextureHandle InitTexture(int Width, int Height, void *pUploadData = NULL)
 	{
 		void *pMem = NULL;
@@ -349,15 +738,6 @@ class CTextRender : public IEngineTextRender
 		pFont->m_TextureSkyline[TextureIndex].m_CurHeightOfPixelColumn.resize(NewDimensions, 0);
 	}
 
-	int AdjustOutlineThicknessToFontSize(int OutlineThickness, int FontSize)
-	{
-		if(FontSize > 48)
-			OutlineThickness *= 4;
-		else if(FontSize >= 18)
-			OutlineThickness *= 2;
-		return OutlineThickness;
-	}
-
 	void UploadGlyph(CFont *pFont, int TextureIndex, int PosX, int PosY, int Width, int Height, const unsigned char *pData)
 	{
 		for(int y = 0; y < Height; ++y)
@@ -374,6 +754,10 @@ class CTextRender : public IEngineTextRender
 	unsigned char ms_aGlyphData[(1024 / 4) * (1024 / 4)];
 	unsigned char ms_aGlyphDataOutlined[(1024 / 4) * (1024 / 4)];
 
+	// for searching space in the font textures
+	std::vector<int> m_vSkylineSums;
+	std::vector<int> m_vSkylineHighest;
+
 	bool GetCharacterSpace(CFont *pFont, int TextureIndex, int Width, int Height, int &PosX, int &PosY)
 	{
 		if(pFont->m_CurTextureDimensions[TextureIndex] < Width)
@@ -389,49 +773,48 @@ class CTextRender : public IEngineTextRender
 		int SmallestPixelLossAreaY = pFont->m_CurTextureDimensions[TextureIndex] + 1;
 		int SmallestPixelLossCurPixelLoss = pFont->m_CurTextureDimensions[TextureIndex] * pFont->m_CurTextureDimensions[TextureIndex];
 
+		// the area of columns i to i + width is as high as its highest
+		// column, the pixel loss is the space below that. these are kept
+		// while moving over the columns, instead of adding up every area.
+		int NumColumns = SkylineHeights.size();
+		m_vSkylineSums.resize(NumColumns + 1);
+		m_vSkylineSums[0] = 0;
+		for(int i = 0; i < NumColumns; i++)
+			m_vSkylineSums[i + 1] = m_vSkylineSums[i] + SkylineHeights[i];
+		// columns that can still be the highest of an area, highest first
+		m_vSkylineHighest.resize(NumColumns);
+		int HighestFirst = 0;
+		int HighestEnd = 0;
+
 		bool FoundAnyArea = false;
-		for(size_t i = 0; i < SkylineHeights.size(); i++)
+		for(int i = 0, n = 0; i + Width <= NumColumns; i++)
 		{
-			int CurHeight = SkylineHeights[i];
-			int CurPixelLoss = 0;
-			// find width pixels, and we are happy
-			int AreaWidth = 1;
-			for(size_t n = i + 1; n < i + Width && n < SkylineHeights.size(); ++n)
+			for(; n < i + Width; n++)
 			{
-				++AreaWidth;
-				if(SkylineHeights[n] <= CurHeight)
-				{
-					CurPixelLoss += CurHeight - SkylineHeights[n];
-				}
-				// if the height changed, we will use that new height and adjust the pixel loss
-				else
-				{
-					CurPixelLoss = 0;
-					CurHeight = SkylineHeights[n];
-					for(size_t l = i; l <= n; ++l)
-					{
-						CurPixelLoss += CurHeight - SkylineHeights[l];
-					}
-				}
+				while(HighestEnd > HighestFirst && SkylineHeights[m_vSkylineHighest[HighestEnd - 1]] <= SkylineHeights[n])
+					HighestEnd--;
+				m_vSkylineHighest[HighestEnd++] = n;
 			}
+			if(m_vSkylineHighest[HighestFirst] < i)
+				HighestFirst++;
+
+			int CurHeight = SkylineHeights[m_vSkylineHighest[HighestFirst]];
+			int CurPixelLoss = CurHeight * Width - (m_vSkylineSums[i + Width] - m_vSkylineSums[i]);
 
 			// if the area is too high, continue
 			if(CurHeight + Height > pFont->m_CurTextureDimensions[TextureIndex])
 				continue;
-			// if the found area fits our needs, check if we can use it
-			if(AreaWidth == Width)
+			// check if we can use the area
+			if(SmallestPixelLossCurPixelLoss >= CurPixelLoss)
 			{
-				if(SmallestPixelLossCurPixelLoss >= CurPixelLoss)
+				if(CurHeight < SmallestPixelLossAreaY)
 				{
-					if(CurHeight < SmallestPixelLossAreaY)
-					{
-						SmallestPixelLossCurPixelLoss = CurPixelLoss;
-						SmallestPixelLossAreaX = (int)i;
-						SmallestPixelLossAreaY = CurHeight;
-						FoundAnyArea = true;
-						if(CurPixelLoss == 0)
-							break;
-					}
+					SmallestPixelLossCurPixelLoss = CurPixelLoss;
+					SmallestPixelLossAreaX = i;
+					SmallestPixelLossAreaY = CurHeight;
+					FoundAnyArea = true;
+					if(CurPixelLoss == 0)
+						break;
 				}
 			}
 		}
@@ -450,125 +833,203 @@ class CTextRender : public IEngineTextRender
 			return false;
 	}
 
-	void RenderGlyph(CFont *pFont, CFontSizeData *pSizeData, int Chr)
+	void PlaceGlyph(SRasterizedGlyph *pGlyph, SFontSizeChar *pFontchr)
 	{
-		FT_Bitmap *pBitmap;
+		CFont *pFont = pGlyph->m_pFont;
+		int Width = pGlyph->m_Char.m_Width;
+		int Height = pGlyph->m_Char.m_Height;
+
+		// upload the glyph
+		int X = 0;
+		int Y = 0;
+		while(!GetCharacterSpace(pFont, 0, Width, Height, X, Y))
+		{
+			IncreaseFontTexture(pFont, 0);
+		}
+		UploadGlyph(pFont, 0, X, Y, Width, Height, pGlyph->m_vData.data());
 
-		int x = 1;
-		int y = 1;
-		unsigned int px, py;
+		while(!GetCharacterSpace(pFont, 1, Width, Height, X, Y))
+		{
+			IncreaseFontTexture(pFont, 1);
+		}
+		UploadGlyph(pFont, 1, X, Y, Width, Height, pGlyph->m_vDataOutlined.data());
 
-		FT_Face FtFace = pFont->m_FtFace;
+		// set char info
+		*pFontchr = pGlyph->m_Char;
+		pFontchr->m_aUVs[0] = X;
+		pFontchr->m_aUVs[1] = Y;
+		pFontchr->m_aUVs[2] = pFontchr->m_aUVs[0] + Width;
+		pFontchr->m_aUVs[3] = pFontchr->m_aUVs[1] + Height;
+	}
 
-		FT_Set_Pixel_Sizes(FtFace, 0, pSizeData->m_FontSize);
+	void GetFaces(CFont *pFont, std::vector<FT_Face> *pvFaces)
+	{
+		pvFaces->clear();
+		pvFaces->push_back(pFont->m_FtFace);
+		for(CFont::SFontFallBack &FallbackFont : pFont->m_FtFallbackFonts)
+			pvFaces->push_back(FallbackFont.m_FtFace);
+	}
 
-		FT_UInt GlyphIndex = 0;
-		if(FtFace->charmap)
-			GlyphIndex = FT_Get_Char_Index(FtFace, (FT_ULong)Chr);
+	void RenderGlyph(CFont *pFont, CFontSizeData *pSizeData, int Chr)
+	{
+		// a glyph that is still being rasterized in the background is
+		// replaced, the result of the thread is dropped then
+		pSizeData->m_Chars[Chr].m_Pending = false;
 
+		GetFaces(pFont, &m_vFaces);
+		FT_Face FtFace;
+		FT_UInt GlyphIndex = FindGlyph(m_vFaces.data(), m_vFaces.size(), Chr, pSizeData->m_FontSize, true, &FtFace);
 		if(GlyphIndex == 0)
-		{
-			for(CFont::SFontFallBack &FallbackFont : pFont->m_FtFallbackFonts)
-			{
-				FtFace = FallbackFont.m_FtFace;
-				FT_Set_Pixel_Sizes(FtFace, 0, pSizeData->m_FontSize);
-
-				if(FtFace->charmap)
-					GlyphIndex = FT_Get_Char_Index(FtFace, (FT_ULong)Chr);
+			return;
 
-				if(GlyphIndex != 0)
-					break;
-			}
+		m_RenderedGlyph.m_pFont = pFont;
+		m_RenderedGlyph.m_FontSize = pSizeData->m_FontSize;
+		m_RenderedGlyph.m_Chr = Chr;
+		if(RasterizeGlyph(FtFace, GlyphIndex, &m_RenderedGlyph))
+			PlaceGlyph(&m_RenderedGlyph, &pSizeData->m_Chars[Chr]);
+		else
+		{
+			// the metrics may already be set, don't draw it without UVs
+			pSizeData->m_Chars[Chr] = SFontSizeChar();
+		}
+	}
 
-			if(GlyphIndex == 0)
-			{
-				const int ReplacementChr = 0x25a1; // White square to indicate missing glyph
-				FtFace = pFont->m_FtFace;
-				GlyphIndex = FT_Get_Char_Index(FtFace, (FT_ULong)ReplacementChr);
+	void QueueGlyph(CFont *pFont, CFontSizeData *pSizeData, int Chr, bool Prewarm)
+	{
+		CGlyphRasterizer::CRequest Request;
+		Request.m_pFont = pFont;
+		Request.m_FontSize = pSizeData->m_FontSize;
+		Request.m_Chr = Chr;
+		Request.m_Prewarm = Prewarm;
+		Request.m_vFaces.emplace_back(pFont->m_pBuf, pFont->m_BufSize);
+		for(CFont::SFontFallBack &FallbackFont : pFont->m_FtFallbackFonts)
+			Request.m_vFaces.emplace_back(FallbackFont.m_pBuf, FallbackFont.m_BufSize);
+		m_GlyphRasterizer.Request(std::move(Request));
+	}
 
-				if(GlyphIndex == 0)
-				{
-					dbg_msg("textrender", "font has no glyph for either %d or replacement char %d", Chr, ReplacementChr);
-					return;
-				}
-			}
-		}
+	// only loads the metrics of the glyph, so that the text can be laid
+	// out, and leaves rasterizing it to the thread
+	void RequestGlyph(CFont *pFont, CFontSizeData *pSizeData, int Chr)
+	{
+		GetFaces(pFont, &m_vFaces);
+		FT_Face FtFace;
+		FT_UInt GlyphIndex = FindGlyph(m_vFaces.data(), m_vFaces.size(), Chr, pSizeData->m_FontSize, true, &FtFace);
+		if(GlyphIndex == 0)
+			return;
 
-		if(FT_Load_Glyph(FtFace, GlyphIndex, FT_LOAD_RENDER | FT_LOAD_NO_BITMAP))
+		if(FT_Load_Glyph(FtFace, GlyphIndex, FT_LOAD_NO_BITMAP))
 		{
 			dbg_msg("textrender", "error loading glyph %d", Chr);
 			return;
 		}
+		SFontSizeChar *pFontchr = &pSizeData->m_Chars[Chr];
+		SetGlyphMetrics(FtFace, GlyphIndex, Chr, pSizeData->m_FontSize, pFontchr);
+		pFontchr->m_Pending = true;
+		QueueGlyph(pFont, pSizeData, Chr, false);
+	}
 
-		pBitmap = &FtFace->glyph->bitmap; // ignore_convention
-
-		// adjust spacing
-		int OutlineThickness = AdjustOutlineThicknessToFontSize(1, pSizeData->m_FontSize);
-		x += OutlineThickness;
-		y += OutlineThickness;
-
-		unsigned int Width = pBitmap->width + x * 2;
-		unsigned int Height = pBitmap->rows + y * 2;
-
-		// prepare glyph data
-		mem_zero(ms_aGlyphData, Width * Height);
-
-		for(py = 0; py < pBitmap->rows; py++) // ignore_convention
-			for(px = 0; px < pBitmap->width; px++) // ignore_convention
-				ms_aGlyphData[(py + y) * Width + px + x] = pBitmap->buffer[py * pBitmap->width + px]; // ignore_convention
+	// queues the characters of gfx_text_prewarm that weren't rendered yet
+	void PrewarmGlyphs(CFont *pFont, CFontSizeData *pSizeData)
+	{
+		pSizeData->m_Prewarmed = true;
 
-		// upload the glyph
-		int X = 0;
-		int Y = 0;
-		while(!GetCharacterSpace(pFont, 0, (int)Width, (int)Height, X, Y))
+		char aRanges[sizeof(g_Config.m_GfxTextPrewarm)];
+		str_copy(aRanges, g_Config.m_GfxTextPrewarm, sizeof(aRanges));
+		char *pRange = aRanges;
+		while(*pRange)
 		{
-			IncreaseFontTexture(pFont, 0);
+			char *pNext = pRange;
+			while(*pNext && *pNext != ',')
+				pNext++;
+			if(*pNext)
+				*pNext++ = 0;
+
+			// "first-last" or a single character, in hex
+			char *pSeparator = pRange;
+			while(*pSeparator && *pSeparator != '-')
+				pSeparator++;
+			int Last = str_toint_base(*pSeparator ? pSeparator + 1 : pRange, 16);
+			*pSeparator = 0;
+			int First = str_toint_base(pRange, 16);
+			for(int Chr = maximum(First, 1); Chr <= minimum(Last, 0x10ffff); Chr++)
+			{
+				if(pSizeData->m_Chars.find(Chr) == pSizeData->m_Chars.end())
+					QueueGlyph(pFont, pSizeData, Chr, true);
+			}
+			pRange = pNext;
 		}
-		UploadGlyph(pFont, 0, X, Y, (int)Width, (int)Height, ms_aGlyphData);
+	}
 
-		Grow(ms_aGlyphData, ms_aGlyphDataOutlined, Width, Height, OutlineThickness);
+	bool IsPending(const SRasterizedGlyph &Glyph)
+	{
+		CFontSizeData *pSizeData = Glyph.m_pFont->GetFontSize(Glyph.m_FontSize);
+		std::map<int, SFontSizeChar>::iterator it = pSizeData->m_Chars.find(Glyph.m_Chr);
+		return it != pSizeData->m_Chars.end() && it->second.m_Pending;
+	}
 
-		while(!GetCharacterSpace(pFont, 1, (int)Width, (int)Height, X, Y))
-		{
-			IncreaseFontTexture(pFont, 1);
-		}
-		UploadGlyph(pFont, 1, X, Y, (int)Width, (int)Height, ms_aGlyphDataOutlined);
+	// puts the glyphs that the thread rasterized into the font textures,
+	// the ones that text is waiting for before the prewarmed ones
+	void PlaceRasterizedGlyphs()
+	{
+		m_GlyphRasterizer.TakeDone(&m_vRasterizedGlyphs);
+		if(m_vRasterizedGlyphs.empty())
+			return;
+		std::stable_partition(m_vRasterizedGlyphs.begin(), m_vRasterizedGlyphs.end(),
+			[this](const SRasterizedGlyph &Glyph) { return IsPending(Glyph); });
 
-		// set char info
+		int NumPlaced = 0;
+		size_t i = 0;
+		for(; i < m_vRasterizedGlyphs.size() && NumPlaced < MAX_PLACED_GLYPHS_PER_FRAME; i++)
 		{
-			SFontSizeChar *pFontchr = &pSizeData->m_Chars[Chr];
-			int BMPHeight = pBitmap->rows + y * 2;
-			int BMPWidth = pBitmap->width + x * 2;
-
-			pFontchr->m_ID = Chr;
-			pFontchr->m_Height = Height;
-			pFontchr->m_Width = Width;
-			pFontchr->m_OffsetX = (FtFace->glyph->metrics.horiBearingX >> 6); // ignore_convention
-			pFontchr->m_OffsetY = -((FtFace->glyph->metrics.height >> 6) - (FtFace->glyph->metrics.horiBearingY >> 6));
-			pFontchr->m_AdvanceX = (FtFace->glyph->advance.x >> 6); // ignore_convention
-
-			pFontchr->m_aUVs[0] = X;
-			pFontchr->m_aUVs[1] = Y;
-			pFontchr->m_aUVs[2] = pFontchr->m_aUVs[0] + BMPWidth;
-			pFontchr->m_aUVs[3] = pFontchr->m_aUVs[1] + BMPHeight;
-			pFontchr->m_GlyphIndex = GlyphIndex;
+			SRasterizedGlyph &Glyph = m_vRasterizedGlyphs[i];
+			CFontSizeData *pSizeData = Glyph.m_pFont->GetFontSize(Glyph.m_FontSize);
+			std::map<int, SFontSizeChar>::iterator it = pSizeData->m_Chars.find(Glyph.m_Chr);
+			if(it == pSizeData->m_Chars.end())
+			{
+				// prewarmed
+				if(!Glyph.m_vData.empty())
+				{
+					PlaceGlyph(&Glyph, &pSizeData->m_Chars[Glyph.m_Chr]);
+					NumPlaced++;
+				}
+			}
+			else if(it->second.m_Pending)
+			{
+				if(!Glyph.m_vData.empty())
+					PlaceGlyph(&Glyph, &it->second);
+				else
+					RenderGlyph(Glyph.m_pFont, pSizeData, Glyph.m_Chr);
+				NumPlaced++;
+			}
 		}
+		m_vRasterizedGlyphs.erase(m_vRasterizedGlyphs.begin(), m_vRasterizedGlyphs.begin() + i);
 	}
 
-	SFontSizeChar *GetChar(CFont *pFont, CFontSizeData *pSizeData, int Chr)
+	// with `Async`, a new glyph is rasterized in the background and returned
+	// as pending until then, otherwise pending glyphs are finished right away
+	SFontSizeChar *GetChar(CFont *pFont, CFontSizeData *pSizeData, int Chr, bool Async = false)
 	{
+		Async = Async && m_GlyphRasterizer.IsRunning();
+		if(Async && !pSizeData->m_Prewarmed && pSizeData->m_FontSize <= MAX_PREWARM_FONT_SIZE)
+			PrewarmGlyphs(pFont, pSizeData);
+
 		std::map<int, SFontSizeChar>::iterator it = pSizeData->m_Chars.find(Chr);
 		if(it == pSizeData->m_Chars.end())
 		{
 			// render and add character
 			SFontSizeChar &FontSizeChr = pSizeData->m_Chars[Chr];
 
-			RenderGlyph(pFont, pSizeData, Chr);
+			if(Async)
+				RequestGlyph(pFont, pSizeData, Chr);
+			else
+				RenderGlyph(pFont, pSizeData, Chr);
 
 			return &FontSizeChr;
 		}
 		else
 		{
+			if(it->second.m_Pending && !Async)
+				RenderGlyph(pFont, pSizeData, Chr);
 			return &it->second;
 		}
 	}
@@ -596,10 +1057,16 @@ public:
 		//m_FontTextureFormat = GL_ALPHA;
 
 		m_RenderFlags = 0;
+
+		m_InLayout = false;
+		m_LayoutCacheHits = 0;
+		m_LayoutCacheMisses = 0;
 	}
 
 	virtual ~CTextRender()
 	{
+		m_GlyphRasterizer.Shutdown();
+
 		for(size_t i = 0; i < m_Fonts.size(); ++i)
 		{
 			FT_Done_Face(m_Fonts[i]->m_FtFace);
@@ -626,6 +1093,14 @@ public:
 			FT_Library_Version(m_FTLibrary, &LMajor, &LMinor, &LPatch);
 			dbg_msg("freetype", "freetype version %d.%d.%d (compiled = %d.%d.%d)", LMajor, LMinor, LPatch,
 				FREETYPE_MAJOR, FREETYPE_MINOR, FREETYPE_PATCH);
+
+			// glyphs are laid out before they are rasterized with the
+			// bitmap size that FreeType presets since 2.10
+			if(g_Config.m_GfxTextAsync && LMajor * 10000 + LMinor * 100 + LPatch >= 21000)
+			{
+				if(!m_GlyphRasterizer.Init())
+					dbg_msg("textrender", "failed to start the glyph rasterizer, rendering glyphs synchronously");
+			}
 		}
 
 		m_FirstFreeTextContainerIndex = -1;
@@ -686,6 +1161,7 @@ public:
 		dbg_msg("textrender", "loaded pFont from '%s'", pFilename);
 
 		pFont->m_pBuf = (void *)pBuf;
+		pFont->m_BufSize = Size;
 		pFont->m_CurTextureDimensions[0] = 1024;
 		pFont->m_TextureData[0] = new unsigned char[pFont->m_CurTextureDimensions[0] * pFont->m_CurTextureDimensions[0]];
 		mem_zero(pFont->m_TextureData[0], (size_t)pFont->m_CurTextureDimensions[0] * pFont->m_CurTextureDimensions[0] * sizeof(unsigned char));
@@ -710,12 +1186,15 @@ public:
 	{
 		CFont::SFontFallBack FallbackFont;
 		FallbackFont.m_pBuf = (void *)pBuf;
+		FallbackFont.m_BufSize = Size;
 		str_copy(FallbackFont.m_aFilename, pFilename, sizeof(FallbackFont.m_aFilename));
 
 		if(FT_New_Memory_Face(m_FTLibrary, pBuf, Size, 0, &FallbackFont.m_FtFace) == 0)
 		{
 			dbg_msg("textrender", "loaded fallback font from '%s'", pFilename);
 			pFont->m_FtFallbackFonts.emplace_back(std::move(FallbackFont));
+			// glyphs that were missing might be there now
+			ClearLayoutCache();
 
 			return true;
 		}
@@ -886,6 +1365,9 @@ public:
 		if(!pFont)
 			return;
 
+		if(!m_InLayout)
+			PlaceRasterizedGlyphs();
+
 		pSizeData = pFont->GetFontSize(ActualSize);
 
 		// set length
@@ -912,6 +1394,37 @@ public:
 		}
 
 		LineCount = pCursor->m_LineCount;
+		float StartDrawX = DrawX, StartDrawY = DrawY;
+
+		// look up the text in the layout cache, the words measured for
+		// line breaks while laying out a text aren't cached on their own
+		bool UseCache = !m_InLayout && Length <= MAX_LAYOUT_CACHE_TEXT_LENGTH;
+		STextLayout *pCached = 0;
+		bool HasPendingGlyphs = false;
+		if(UseCache)
+		{
+			STextLayoutKey Key;
+			mem_zero(&Key, sizeof(Key)); // padding is part of the key
+			Key.m_pFont = pFont;
+			Key.m_ActualSize = ActualSize;
+			Key.m_FakeToScreenX = FakeToScreenX;
+			Key.m_FakeToScreenY = FakeToScreenY;
+			Key.m_StartX = pCursor->m_StartX - DrawX;
+			Key.m_AlignedStartX = (int)(pCursor->m_StartX * FakeToScreenX) / FakeToScreenX - DrawX;
+			Key.m_RenderFlags = m_RenderFlags;
+			Key.m_Flags = pCursor->m_Flags & ~TEXTFLAG_RENDER;
+			Key.m_LineWidth = pCursor->m_LineWidth;
+			Key.m_MaxLines = pCursor->m_MaxLines;
+			Key.m_LineCount = pCursor->m_MaxLines > 0 ? LineCount : 0;
+			Key.m_EndOfString = pText[Length] == 0;
+			m_LayoutKey.assign((const char *)&Key, sizeof(Key));
+			m_LayoutKey.append(pText, Length);
+			pCached = FindLayout(m_LayoutKey);
+			if(pCached)
+				m_LayoutCacheHits++;
+			else
+				m_LayoutCacheMisses++;
+		}
 
 		if(pCursor->m_Flags & TEXTFLAG_RENDER)
 		{
@@ -932,6 +1445,39 @@ public:
 			}
 		}
 
+		STextLayout Layout;
+		Layout.m_GlyphCount = 0;
+		Layout.m_CharCount = 0;
+		Layout.m_MaxCharacterHeight = 0;
+		Layout.m_HasLongestLine = false;
+		Layout.m_LongestLineWidth = 0;
+		const STextLayout *pLayout = &Layout;
+		if(pCached)
+		{
+			if(pCursor->m_Flags & TEXTFLAG_RENDER && m_Color.a != 0.f)
+			{
+				for(const STextLayoutGlyph &Glyph : pCached->m_vGlyphs)
+				{
+					if(Graphics()->IsTextBufferingEnabled())
+						Graphics()->QuadsSetSubset(Glyph.m_aUVs[0], Glyph.m_aUVs[3], Glyph.m_aUVs[2], Glyph.m_aUVs[1]);
+					else
+						Graphics()->QuadsSetSubset(Glyph.m_aUVs[0] * UVScale, Glyph.m_aUVs[3] * UVScale, Glyph.m_aUVs[2] * UVScale, Glyph.m_aUVs[1] * UVScale);
+					IGraphics::CQuadItem QuadItem(StartDrawX + Glyph.m_X, StartDrawY + Glyph.m_Y, Glyph.m_Width, Glyph.m_Height);
+					Graphics()->QuadsDrawTL(&QuadItem, 1);
+				}
+			}
+			DrawX = StartDrawX + pCached->m_EndX;
+			DrawY = StartDrawY + pCached->m_EndY;
+			GotNewLine = pCached->m_GotNewLine;
+			LineCount += pCached->m_NumNewLines;
+			pLayout = pCached;
+			// nothing left to lay out
+			pCurrent = pEnd;
+		}
+
+		bool WasInLayout = m_InLayout;
+		m_InLayout = true;
+
 		FT_UInt LastCharGlyphIndex = 0;
 		size_t CharacterCounter = 0;
 
@@ -981,7 +1527,7 @@ public:
 			int NextCharacter = str_utf8_decode(&pTmp);
 			while(pCurrent < pBatchEnd)
 			{
-				pCursor->m_CharCount += pTmp - pCurrent;
+				Layout.m_CharCount += pTmp - pCurrent;
 				int Character = NextCharacter;
 				pCurrent = pTmp;
 				NextCharacter = str_utf8_decode(&pTmp);
@@ -1004,7 +1550,7 @@ public:
 					continue;
 				}
 
-				SFontSizeChar *pChr = GetChar(pFont, pSizeData, Character);
+				SFontSizeChar *pChr = GetChar(pFont, pSizeData, Character, true);
 				if(pChr)
 				{
 					bool ApplyBearingX = !(((m_RenderFlags & TEXT_RENDER_FLAG_NO_X_BEARING) != 0) || (CharacterCounter == 0 && (m_RenderFlags & TEXT_RENDER_FLAG_NO_FIRST_CHARACTER_X_BEARING) != 0));
@@ -1040,7 +1586,17 @@ public:
 						}
 					}
 
-					if(pCursor->m_Flags & TEXTFLAG_RENDER && m_Color.a != 0.f)
+					// a pending glyph takes its space, but appears only once
+					// it was rasterized
+					HasPendingGlyphs |= pChr->m_Pending;
+					if(UseCache && !pChr->m_Pending)
+					{
+						STextLayoutGlyph Glyph = {(DrawX + CharKerning) + BearingX - StartDrawX, (DrawY + Size) - BearingY - StartDrawY, CharWidth, -CharHeight,
+							{pChr->m_aUVs[0], pChr->m_aUVs[1], pChr->m_aUVs[2], pChr->m_aUVs[3]}};
+						Layout.m_vGlyphs.push_back(Glyph);
+					}
+
+					if(pCursor->m_Flags & TEXTFLAG_RENDER && m_Color.a != 0.f && !pChr->m_Pending)
 					{
 						if(Graphics()->IsTextBufferingEnabled())
 							Graphics()->QuadsSetSubset(pChr->m_aUVs[0], pChr->m_aUVs[3], pChr->m_aUVs[2], pChr->m_aUVs[1]);
@@ -1052,19 +1608,22 @@ public:
 						Graphics()->QuadsDrawTL(&QuadItem, 1);
 					}
 
-					pCursor->m_MaxCharacterHeight = maximum(pCursor->m_MaxCharacterHeight, CharHeight + BearingY);
+					Layout.m_MaxCharacterHeight = maximum(Layout.m_MaxCharacterHeight, CharHeight + BearingY);
 
 					if(NextCharacter == 0 && (m_RenderFlags & TEXT_RENDER_FLAG_NO_LAST_CHARACTER_ADVANCE) != 0 && Character != ' ')
 						DrawX += BearingX + CharKerning + CharWidth;
 					else
 						DrawX += Advance * Size + CharKerning;
-					pCursor->m_GlyphCount++;
+					Layout.m_GlyphCount++;
 
 					++CharacterCounter;
 				}
 
-				if(DrawX > pCursor->m_LongestLineWidth)
-					pCursor->m_LongestLineWidth = DrawX;
+				if(!Layout.m_HasLongestLine || DrawX - StartDrawX > Layout.m_LongestLineWidth)
+				{
+					Layout.m_HasLongestLine = true;
+					Layout.m_LongestLineWidth = DrawX - StartDrawX;
+				}
 			}
 
 			if(NewLine)
@@ -1084,6 +1643,22 @@ public:
 				GotNewLineLast = 0;
 		}
 
+		m_InLayout = WasInLayout;
+
+		if(!pCached)
+		{
+			Layout.m_EndX = DrawX - StartDrawX;
+			Layout.m_EndY = DrawY - StartDrawY;
+			Layout.m_GotNewLine = GotNewLine;
+			Layout.m_NumNewLines = LineCount - pCursor->m_LineCount;
+		}
+
+		pCursor->m_CharCount += pLayout->m_CharCount;
+		pCursor->m_GlyphCount += pLayout->m_GlyphCount;
+		pCursor->m_MaxCharacterHeight = maximum(pCursor->m_MaxCharacterHeight, pLayout->m_MaxCharacterHeight);
+		if(pLayout->m_HasLongestLine && StartDrawX + pLayout->m_LongestLineWidth > pCursor->m_LongestLineWidth)
+			pCursor->m_LongestLineWidth = StartDrawX + pLayout->m_LongestLineWidth;
+
 		if(pCursor->m_Flags & TEXTFLAG_RENDER)
 		{
 			if(Graphics()->IsTextBufferingEnabled())
@@ -1108,6 +1683,12 @@ public:
 
 		if(GotNewLine)
 			pCursor->m_Y = DrawY;
+
+		if(UseCache && !pCached && !HasPendingGlyphs)
+		{
+			Layout.m_Key = m_LayoutKey;
+			AddLayout(std::move(Layout));
+		}
 	}
 
 	virtual int CreateTextContainer(CTextCursor *pCursor, const char *pText, int Length = -1)
@@ -1998,6 +2579,14 @@ public:
 
 			m_Fonts[i]->InitFontSizes();
 		}
+		ClearLayoutCache();
+	}
+
+	virtual void GetLayoutCacheStats(int64 *pHits, int64 *pMisses, int *pNumEntries)
+	{
+		*pHits = m_LayoutCacheHits;
+		*pMisses = m_LayoutCacheMisses;
+		*pNumEntries = m_LayoutCache.size();
 	}
 };
 
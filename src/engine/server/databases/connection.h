@@ -3,6 +3,8 @@
 
 #include <base/system.h>
 
+#include "statement_cache.h"
+
 class IConsole;
 
 // can hold one PreparedStatement with Results
@@ -51,8 +53,19 @@ public:
 	virtual void Lock(const char *pTable) = 0;
 	virtual void Unlock() = 0;
 
+	// groups the following statements into one transaction, must not be
+	// combined with `Lock`. Statements since `BeginTransaction` are
+	// discarded if `CommitTransaction` isn't reached
+	virtual void BeginTransaction() = 0;
+	virtual void CommitTransaction() = 0;
+	virtual void RollbackTransaction() = 0;
+
 	// ? for Placeholders, connection has to be established, can overwrite previous prepared statements
+	// reuses a cached statement with the same text, resetting its bindings
 	virtual void PrepareStatement(const char *pStmt) = 0;
+	// number of prepared statements kept per connection, 0 disables the cache
+	virtual void SetStatementCacheSize(int Size) = 0;
+	virtual void GetStatementCacheStats(CStatementCacheStats *pStats) const = 0;
 
 	// PrepareStatement has to be called beforehand,
 	virtual void BindString(int Idx, const char *pString) = 0;
@@ -1,6 +1,8 @@
 #include "connection_pool.h"
 #include "connection.h"
 
+#include <base/math.h>
+
 #include <engine/console.h>
 #if defined(CONF_SQL)
 #include <cppconn/exception.h>
@@ -17,7 +19,8 @@ struct CSqlExecData
 	CSqlExecData(
 		CDbConnectionPool::FWrite pFunc,
 		std::unique_ptr<const ISqlData> pThreadData,
-		const char *pName);
+		const char *pName,
+		bool Batch);
 	~CSqlExecData() {}
 
 	enum
@@ -33,6 +36,8 @@ struct CSqlExecData
 
 	std::unique_ptr<const ISqlData> m_pThreadData;
 	const char *m_pName;
+	int64 m_QueueTime;
+	bool m_Batch;
 };
 
 CSqlExecData::CSqlExecData(
@@ -41,7 +46,9 @@ CSqlExecData::CSqlExecData(
 	const char *pName) :
 	m_Mode(READ_ACCESS),
 	m_pThreadData(std::move(pThreadData)),
-	m_pName(pName)
+	m_pName(pName),
+	m_QueueTime(0),
+	m_Batch(false)
 {
 	m_Ptr.m_pReadFunc = pFunc;
 }
@@ -49,20 +56,31 @@ CSqlExecData::CSqlExecData(
 CSqlExecData::CSqlExecData(
 	CDbConnectionPool::FWrite pFunc,
 	std::unique_ptr<const ISqlData> pThreadData,
-	const char *pName) :
+	const char *pName,
+	bool Batch) :
 	m_Mode(WRITE_ACCESS),
 	m_pThreadData(std::move(pThreadData)),
-	m_pName(pName)
+	m_pName(pName),
+	m_QueueTime(0),
+	m_Batch(Batch)
 {
 	m_Ptr.m_pWriteFunc = pFunc;
 }
 
+const int CDbConnectionPool::ms_aLatencyBuckets[NUM_LATENCY_BUCKETS - 1] = {1, 5, 10, 50, 100, 500, 1000};
+
 CDbConnectionPool::CDbConnectionPool() :
-	m_NumElem(),
-	FirstElem(0),
-	LastElem(0)
+	m_MaxQueued(512),
+	m_WriteBatchMs(0),
+	m_StatementCacheSize(-1),
+	m_Shutdown(false),
+	m_NumRunning(0)
 {
-	thread_init_and_detach(CDbConnectionPool::Worker, this, "database worker thread");
+	for(auto &Queue : m_aQueues)
+	{
+		Queue.m_NumWorkers = 0;
+		mem_zero(&Queue.m_Stats, sizeof(Queue.m_Stats));
+	}
 }
 
 CDbConnectionPool::~CDbConnectionPool()
@@ -72,133 +90,446 @@ CDbConnectionPool::~CDbConnectionPool()
 void CDbConnectionPool::Print(IConsole *pConsole, Mode DatabaseMode)
 {
 	const char *ModeDesc[] = {"Read", "Write", "WriteBackup"};
+	scope_lock Lock(&m_ConnectionsLock);
 	for(unsigned int i = 0; i < m_aapDbConnections[DatabaseMode].size(); i++)
 	{
 		m_aapDbConnections[DatabaseMode][i]->Print(pConsole, ModeDesc[DatabaseMode]);
 	}
 }
 
+void CDbConnectionPool::GetStats(Mode DatabaseMode, CStats *pStats)
+{
+	CQueue *pQueue = &m_aQueues[DatabaseMode];
+	scope_lock Lock(&pQueue->m_Lock);
+	*pStats = pQueue->m_Stats;
+	pStats->m_NumWorkers = pQueue->m_NumWorkers;
+	pStats->m_Queued = pQueue->m_Tasks.size();
+}
+
+// formats the upper bound of the bucket containing the 99th percentile
+static void FormatP99(const int64 *paLatency, int64 Total, char *pBuf, int BufSize)
+{
+	const int NumBuckets = CDbConnectionPool::NUM_LATENCY_BUCKETS;
+	int P99 = 0;
+	int64 Sum = 0;
+	for(; P99 < NumBuckets - 1; P99++)
+	{
+		Sum += paLatency[P99];
+		if(Sum * 100 >= Total * 99)
+			break;
+	}
+	if(P99 < NumBuckets - 1)
+		str_format(pBuf, BufSize, "<=%dms", CDbConnectionPool::ms_aLatencyBuckets[P99]);
+	else
+		str_format(pBuf, BufSize, ">%dms", CDbConnectionPool::ms_aLatencyBuckets[NumBuckets - 2]);
+}
+
+void CDbConnectionPool::PrintStats(IConsole *pConsole)
+{
+	const char *ModeDesc[] = {"Read", "Write", "WriteBackup"};
+	for(int i = 0; i < NUM_MODES; i++)
+	{
+		CStats Stats;
+		GetStats((Mode)i, &Stats);
+		int64 Finished = Stats.m_Done + Stats.m_Failed;
+
+		char aP99[32];
+		FormatP99(Stats.m_aLatency, Finished, aP99, sizeof(aP99));
+		char aBuf[512];
+		str_format(aBuf, sizeof(aBuf),
+			"%s: workers=%d queued=%d max_queued=%d done=%lld failed=%lld overflows=%lld avg=%.1fms p99%s",
+			ModeDesc[i], Stats.m_NumWorkers, Stats.m_Queued, Stats.m_MaxQueued,
+			Stats.m_Done, Stats.m_Failed, Stats.m_Overflows,
+			Finished ? Stats.m_TotalLatency / 1000.0 / Finished : 0.0, aP99);
+		pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "sql", aBuf);
+
+		if(Stats.m_Batches)
+		{
+			FormatP99(Stats.m_aCommitLatency, Stats.m_Batches, aP99, sizeof(aP99));
+			str_format(aBuf, sizeof(aBuf),
+				"%s batches: batches=%lld writes=%lld avg_size=%.1f avg_commit=%.1fms p99_commit%s",
+				ModeDesc[i], Stats.m_Batches, Stats.m_BatchedWrites,
+				(double)Stats.m_BatchedWrites / Stats.m_Batches,
+				Stats.m_TotalCommitLatency / 1000.0 / Stats.m_Batches, aP99);
+			pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "sql", aBuf);
+		}
+	}
+}
+
 void CDbConnectionPool::RegisterDatabase(std::unique_ptr<IDbConnection> pDatabase, Mode DatabaseMode)
 {
 	if(DatabaseMode < 0 || NUM_MODES <= DatabaseMode)
 		return;
+	scope_lock Lock(&m_ConnectionsLock);
 	m_aapDbConnections[DatabaseMode].push_back(std::move(pDatabase));
 }
 
-void CDbConnectionPool::Execute(
+void CDbConnectionPool::Start(int NumReadWorkers, int NumWriteWorkers, int MaxQueued, int WriteBatchMs, int StatementCacheSize)
+{
+	if(!m_vpWorkers.empty())
+		return;
+	m_MaxQueued = maximum(MaxQueued, 1);
+	m_WriteBatchMs = maximum(WriteBatchMs, 0);
+	m_StatementCacheSize = StatementCacheSize;
+
+	// fallback writes are rare, one worker is enough
+	const int aNumWorkers[NUM_MODES] = {maximum(NumReadWorkers, 1), maximum(NumWriteWorkers, 1), 1};
+	const char *apThreadNames[NUM_MODES] = {"database read worker", "database write worker", "database backup worker"};
+	for(int i = 0; i < NUM_MODES; i++)
+	{
+		for(int j = 0; j < aNumWorkers[i]; j++)
+		{
+			CWorker *pWorker = new CWorker;
+			pWorker->m_pPool = this;
+			pWorker->m_Mode = (Mode)i;
+			pWorker->m_LastServer = 0;
+			m_vpWorkers.emplace_back(pWorker);
+			m_aQueues[i].m_NumWorkers++;
+			m_NumRunning++;
+			thread_init_and_detach(CDbConnectionPool::Worker, pWorker, apThreadNames[i]);
+		}
+	}
+}
+
+bool CDbConnectionPool::Enqueue(Mode DatabaseMode, std::unique_ptr<CSqlExecData> pData, bool Reject)
+{
+	CQueue *pQueue = &m_aQueues[DatabaseMode];
+	pQueue->m_Lock.take();
+	if((int)pQueue->m_Tasks.size() >= m_MaxQueued)
+	{
+		pQueue->m_Stats.m_Overflows++;
+		if(Reject)
+		{
+			pQueue->m_Lock.release();
+			dbg_msg("sql", "%s rejected, queue full", pData->m_pName);
+			return false;
+		}
+	}
+	pData->m_QueueTime = time_get();
+	pQueue->m_Tasks.push_back(std::move(pData));
+	pQueue->m_Stats.m_MaxQueued = maximum(pQueue->m_Stats.m_MaxQueued, (int)pQueue->m_Tasks.size());
+	pQueue->m_Lock.release();
+	pQueue->m_NumElem.signal();
+	return true;
+}
+
+bool CDbConnectionPool::Execute(
 	FRead pFunc,
 	std::unique_ptr<const ISqlData> pThreadData,
 	const char *pName)
 {
-	m_aTasks[FirstElem++].reset(new CSqlExecData(pFunc, std::move(pThreadData), pName));
-	FirstElem %= sizeof(m_aTasks) / sizeof(m_aTasks[0]);
-	m_NumElem.signal();
+	return Enqueue(Mode::READ, std::unique_ptr<CSqlExecData>(new CSqlExecData(pFunc, std::move(pThreadData), pName)), true);
 }
 
-void CDbConnectionPool::ExecuteWrite(
+bool CDbConnectionPool::ExecuteWrite(
 	FWrite pFunc,
 	std::unique_ptr<const ISqlData> pThreadData,
-	const char *pName)
+	const char *pName,
+	bool Batch)
 {
-	m_aTasks[FirstElem++].reset(new CSqlExecData(pFunc, std::move(pThreadData), pName));
-	FirstElem %= sizeof(m_aTasks) / sizeof(m_aTasks[0]);
-	m_NumElem.signal();
+	return Enqueue(Mode::WRITE, std::unique_ptr<CSqlExecData>(new CSqlExecData(pFunc, std::move(pThreadData), pName, Batch)), false);
 }
 
 void CDbConnectionPool::OnShutdown()
 {
+	if(m_vpWorkers.empty())
+		return;
+
+	// work through all database jobs before exiting the threads. reads and
+	// writes first, failed writes can still be passed to the backup worker
 	m_Shutdown.store(true);
-	m_NumElem.signal();
-	int i = 0;
-	while(m_Shutdown.load())
+	int Waited = 0;
+	StopWorkers(Mode::READ);
+	StopWorkers(Mode::WRITE);
+	if(!WaitForWorkers(m_aQueues[Mode::WRITE_BACKUP].m_NumWorkers, &Waited))
+		return;
+	StopWorkers(Mode::WRITE_BACKUP);
+	WaitForWorkers(0, &Waited);
+}
+
+void CDbConnectionPool::StopWorkers(Mode DatabaseMode)
+{
+	// every worker exits once it finds the queue empty
+	for(int i = 0; i < m_aQueues[DatabaseMode].m_NumWorkers; i++)
+		m_aQueues[DatabaseMode].m_NumElem.signal();
+}
+
+bool CDbConnectionPool::WaitForWorkers(int NumRemaining, int *pWaited)
+{
+	while(m_NumRunning.load() > NumRemaining)
 	{
-		if(i > 600)
+		if(*pWaited > 600)
 		{
 			dbg_msg("sql", "Waited 60 seconds for score-threads to complete, quitting anyway");
-			break;
+			return false;
 		}
 
 		// print a log about every two seconds
-		if(i % 20 == 0)
-			dbg_msg("sql", "Waiting for score-threads to complete (%ds)", i / 10);
-		++i;
+		if(*pWaited % 20 == 0)
+			dbg_msg("sql", "Waiting for score-threads to complete (%ds)", *pWaited / 10);
+		++*pWaited;
 		thread_sleep(100000);
 	}
+	return true;
+}
+
+void CDbConnectionPool::SyncConnections(CWorker *pWorker)
+{
+	scope_lock Lock(&m_ConnectionsLock);
+	for(int i = 0; i < NUM_MODES; i++)
+	{
+		for(unsigned j = pWorker->m_aapConnections[i].size(); j < m_aapDbConnections[i].size(); j++)
+		{
+			pWorker->m_aapConnections[i].emplace_back(m_aapDbConnections[i][j]->Copy());
+			if(m_StatementCacheSize >= 0)
+				pWorker->m_aapConnections[i].back()->SetStatementCacheSize(m_StatementCacheSize);
+		}
+	}
 }
 
 void CDbConnectionPool::Worker(void *pUser)
 {
-	CDbConnectionPool *pThis = (CDbConnectionPool *)pUser;
-	pThis->Worker();
+	CWorker *pWorker = (CWorker *)pUser;
+	pWorker->m_pPool->Worker(pWorker);
 }
 
-void CDbConnectionPool::Worker()
+void CDbConnectionPool::Worker(CWorker *pWorker)
 {
-	// remember last working server and try to connect to it first
-	int ReadServer = 0;
-	int WriteServer = 0;
+	CQueue *pQueue = &m_aQueues[pWorker->m_Mode];
 	while(1)
 	{
-		m_NumElem.wait();
-		auto pThreadData = std::move(m_aTasks[LastElem++]);
-		// work through all database jobs after OnShutdown is called before exiting the thread
-		if(pThreadData == nullptr)
+		// batched tasks are taken without waiting for their signal, their
+		// wakeups find the queue empty
+		pQueue->m_NumElem.wait();
+		pQueue->m_Lock.take();
+		if(pQueue->m_Tasks.empty())
 		{
-			m_Shutdown.store(false);
-			return;
+			pQueue->m_Lock.release();
+			if(m_Shutdown.load())
+				break;
+			continue;
 		}
-		LastElem %= sizeof(m_aTasks) / sizeof(m_aTasks[0]);
-		bool Success = false;
-		switch(pThreadData->m_Mode)
+		auto pThreadData = std::move(pQueue->m_Tasks.front());
+		pQueue->m_Tasks.pop_front();
+		pQueue->m_Lock.release();
+
+		SyncConnections(pWorker);
+
+		if(pWorker->m_Mode == Mode::WRITE && pThreadData->m_Batch && m_WriteBatchMs > 0)
 		{
-		case CSqlExecData::READ_ACCESS:
+			std::vector<std::unique_ptr<CSqlExecData>> vpBatch;
+			vpBatch.push_back(std::move(pThreadData));
+			CollectBatch(pQueue, &vpBatch);
+			if(vpBatch.size() > 1 && ExecBatch(pWorker, vpBatch))
+				continue;
+			// find the failing writes, they are passed to the backup
+			for(auto &pData : vpBatch)
+				ExecTask(pWorker, std::move(pData));
+			continue;
+		}
+		ExecTask(pWorker, std::move(pThreadData));
+	}
+	m_NumRunning--;
+}
+
+void CDbConnectionPool::ExecTask(CWorker *pWorker, std::unique_ptr<CSqlExecData> pThreadData)
+{
+	bool Success = false;
+	bool PassedOn = false;
+	switch(pWorker->m_Mode)
+	{
+	case Mode::READ:
+	{
+		auto &aapConnections = pWorker->m_aapConnections[Mode::READ];
+		for(int i = 0; i < (int)aapConnections.size(); i++)
 		{
-			for(int i = 0; i < (int)m_aapDbConnections[Mode::READ].size(); i++)
+			int CurServer = (pWorker->m_LastServer + i) % (int)aapConnections.size();
+			if(ExecSqlFunc(aapConnections[CurServer].get(), pThreadData.get(), false))
 			{
-				int CurServer = (ReadServer + i) % (int)m_aapDbConnections[Mode::READ].size();
-				if(ExecSqlFunc(m_aapDbConnections[Mode::READ][CurServer].get(), pThreadData.get(), false))
-				{
-					ReadServer = CurServer;
-					dbg_msg("sql", "%s done on read database %d", pThreadData->m_pName, CurServer);
-					Success = true;
-					break;
-				}
+				pWorker->m_LastServer = CurServer;
+				dbg_msg("sql", "%s done on read database %d", pThreadData->m_pName, CurServer);
+				Success = true;
+				break;
 			}
 		}
-		break;
-		case CSqlExecData::WRITE_ACCESS:
+	}
+	break;
+	case Mode::WRITE:
+	{
+		auto &aapConnections = pWorker->m_aapConnections[Mode::WRITE];
+		for(int i = 0; i < (int)aapConnections.size(); i++)
 		{
-			for(int i = 0; i < (int)m_aapDbConnections[Mode::WRITE].size(); i++)
+			int CurServer = (pWorker->m_LastServer + i) % (int)aapConnections.size();
+			if(ExecSqlFunc(aapConnections[CurServer].get(), pThreadData.get(), false))
 			{
-				int CurServer = (WriteServer + i) % (int)m_aapDbConnections[Mode::WRITE].size();
-				if(ExecSqlFunc(m_aapDbConnections[Mode::WRITE][i].get(), pThreadData.get(), false))
-				{
-					WriteServer = CurServer;
-					dbg_msg("sql", "%s done on write database %d", pThreadData->m_pName, CurServer);
-					Success = true;
-					break;
-				}
+				pWorker->m_LastServer = CurServer;
+				dbg_msg("sql", "%s done on write database %d", pThreadData->m_pName, CurServer);
+				Success = true;
+				break;
 			}
-			if(!Success)
+		}
+		if(!Success && !pWorker->m_aapConnections[Mode::WRITE_BACKUP].empty())
+			PassedOn = true;
+	}
+	break;
+	case Mode::WRITE_BACKUP:
+	{
+		auto &aapConnections = pWorker->m_aapConnections[Mode::WRITE_BACKUP];
+		for(int i = 0; i < (int)aapConnections.size(); i++)
+		{
+			if(ExecSqlFunc(aapConnections[i].get(), pThreadData.get(), true))
 			{
-				for(int i = 0; i < (int)m_aapDbConnections[Mode::WRITE_BACKUP].size(); i++)
-				{
-					if(ExecSqlFunc(m_aapDbConnections[Mode::WRITE_BACKUP][i].get(), pThreadData.get(), true))
-					{
-						dbg_msg("sql", "%s done on write backup database %d", pThreadData->m_pName, i);
-						Success = true;
-						break;
-					}
-				}
+				dbg_msg("sql", "%s done on write backup database %d", pThreadData->m_pName, i);
+				Success = true;
+				break;
 			}
 		}
+	}
+	break;
+	default:
 		break;
+	}
+
+	if(Success && pWorker->m_Mode != Mode::READ)
+		pThreadData->m_pThreadData->OnCommit();
+	FinishTask(&m_aQueues[pWorker->m_Mode], pThreadData.get(), Success);
+
+	if(PassedOn)
+		Enqueue(Mode::WRITE_BACKUP, std::move(pThreadData), false);
+	else if(!Success)
+		dbg_msg("sql", "%s failed on all databases", pThreadData->m_pName);
+}
+
+static int LatencyBucket(int64 Latency)
+{
+	int Bucket = 0;
+	while(Bucket < CDbConnectionPool::NUM_LATENCY_BUCKETS - 1 && Latency > CDbConnectionPool::ms_aLatencyBuckets[Bucket] * 1000)
+		Bucket++;
+	return Bucket;
+}
+
+void CDbConnectionPool::FinishTask(CQueue *pQueue, const CSqlExecData *pThreadData, bool Success)
+{
+	int64 Latency = (time_get() - pThreadData->m_QueueTime) * 1000000 / time_freq();
+
+	scope_lock Lock(&pQueue->m_Lock);
+	pQueue->m_Stats.m_aLatency[LatencyBucket(Latency)]++;
+	pQueue->m_Stats.m_TotalLatency += Latency;
+	if(Success)
+		pQueue->m_Stats.m_Done++;
+	else
+		pQueue->m_Stats.m_Failed++;
+}
+
+void CDbConnectionPool::CollectBatch(CQueue *pQueue, std::vector<std::unique_ptr<CSqlExecData>> *pvpBatch)
+{
+	int64 End = time_get() + time_freq() * m_WriteBatchMs / 1000;
+	while(1)
+	{
+		bool Blocked;
+		{
+			scope_lock Lock(&pQueue->m_Lock);
+			while((int)pvpBatch->size() < MAX_WRITE_BATCH && !pQueue->m_Tasks.empty() && pQueue->m_Tasks.front()->m_Batch)
+			{
+				pvpBatch->push_back(std::move(pQueue->m_Tasks.front()));
+				pQueue->m_Tasks.pop_front();
+			}
+			// a write that can't be batched keeps its place in the order
+			Blocked = !pQueue->m_Tasks.empty();
 		}
-		if(!Success)
-			dbg_msg("sql", "%s failed on all databases", pThreadData->m_pName);
+		if(Blocked || (int)pvpBatch->size() >= MAX_WRITE_BATCH || m_Shutdown.load() || time_get() >= End)
+			break;
+		thread_sleep(1000);
 	}
 }
 
+bool CDbConnectionPool::ExecBatch(CWorker *pWorker, std::vector<std::unique_ptr<CSqlExecData>> &vpBatch)
+{
+	auto &aapConnections = pWorker->m_aapConnections[Mode::WRITE];
+	for(int i = 0; i < (int)aapConnections.size(); i++)
+	{
+		int CurServer = (pWorker->m_LastServer + i) % (int)aapConnections.size();
+		int64 CommitLatency;
+		if(!ExecSqlBatch(aapConnections[CurServer].get(), vpBatch, &CommitLatency))
+			continue;
+
+		pWorker->m_LastServer = CurServer;
+		dbg_msg("sql", "batch of %d writes done on write database %d", (int)vpBatch.size(), CurServer);
+		CQueue *pQueue = &m_aQueues[Mode::WRITE];
+		for(auto &pData : vpBatch)
+		{
+			pData->m_pThreadData->OnCommit();
+			FinishTask(pQueue, pData.get(), true);
+		}
+		scope_lock Lock(&pQueue->m_Lock);
+		pQueue->m_Stats.m_Batches++;
+		pQueue->m_Stats.m_BatchedWrites += vpBatch.size();
+		pQueue->m_Stats.m_aCommitLatency[LatencyBucket(CommitLatency)]++;
+		pQueue->m_Stats.m_TotalCommitLatency += CommitLatency;
+		return true;
+	}
+	dbg_msg("sql", "batch of %d writes failed, retrying one by one", (int)vpBatch.size());
+	return false;
+}
+
+bool CDbConnectionPool::ExecSqlBatch(IDbConnection *pConnection, std::vector<std::unique_ptr<CSqlExecData>> &vpBatch, int64 *pCommitLatency)
+{
+	if(pConnection->Connect() != IDbConnection::SUCCESS)
+		return false;
+	bool Success = true;
+	const char *pName = "write batch";
+	try
+	{
+		pConnection->BeginTransaction();
+		for(auto &pData : vpBatch)
+		{
+			pName = pData->m_pName;
+			if(!pData->m_Ptr.m_pWriteFunc(pConnection, pData->m_pThreadData.get(), false))
+			{
+				Success = false;
+				break;
+			}
+		}
+		if(Success)
+		{
+			pName = "write batch commit";
+			int64 Start = time_get();
+			pConnection->CommitTransaction();
+			*pCommitLatency = (time_get() - Start) * 1000000 / time_freq();
+		}
+	}
+#if defined(CONF_SQL)
+	catch(sql::SQLException &e)
+	{
+		dbg_msg("sql", "%s MySQL Error: %s", pName, e.what());
+		Success = false;
+	}
+#endif
+	catch(std::runtime_error &e)
+	{
+		dbg_msg("sql", "%s SQLite Error: %s", pName, e.what());
+		Success = false;
+	}
+	catch(...)
+	{
+		dbg_msg("sql", "%s Unexpected exception caught", pName);
+		Success = false;
+	}
+	if(!Success)
+	{
+		try
+		{
+			pConnection->RollbackTransaction();
+		}
+		catch(...)
+		{
+			dbg_msg("sql", "Unexpected exception caught during rollback");
+		}
+	}
+	pConnection->Disconnect();
+	return Success;
+}
+
 bool CDbConnectionPool::ExecSqlFunc(IDbConnection *pConnection, CSqlExecData *pData, bool Failure)
 {
 	if(pConnection->Connect() != IDbConnection::SUCCESS)
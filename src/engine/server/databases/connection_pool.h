@@ -2,7 +2,9 @@
 #define ENGINE_SERVER_DATABASES_CONNECTION_POOL_H
 
 #include <atomic>
+#include <base/system.h>
 #include <base/tl/threading.h>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -11,10 +13,17 @@ class IDbConnection;
 struct ISqlData
 {
 	virtual ~ISqlData(){};
+	// called after a write was committed, a write function can run several
+	// times when a batch is rolled back, so results are published here
+	virtual void OnCommit() const {}
 };
 
 class IConsole;
 
+// Reads, writes and fallback writes to the backup databases have separate
+// queues, each drained by its own worker threads, so a slow read can't
+// delay a write. Every worker uses its own copy of the registered
+// connections.
 class CDbConnectionPool
 {
 public:
@@ -33,34 +42,114 @@ public:
 		NUM_MODES,
 	};
 
+	enum
+	{
+		// upper bounds of the latency histogram buckets in milliseconds,
+		// the last bucket has no upper bound
+		NUM_LATENCY_BUCKETS = 8,
+		MAX_WRITE_BATCH = 64,
+	};
+	static const int ms_aLatencyBuckets[NUM_LATENCY_BUCKETS - 1];
+
+	struct CStats
+	{
+		int m_NumWorkers;
+		int m_Queued;
+		int m_MaxQueued;
+		int64 m_Done;
+		int64 m_Failed;
+		// tasks rejected or accepted over the queue limit
+		int64 m_Overflows;
+		// time from queueing until the task finished
+		int64 m_aLatency[NUM_LATENCY_BUCKETS];
+		int64 m_TotalLatency; // in microseconds
+		// writes sharing one transaction
+		int64 m_Batches;
+		int64 m_BatchedWrites;
+		int64 m_aCommitLatency[NUM_LATENCY_BUCKETS];
+		int64 m_TotalCommitLatency; // in microseconds
+	};
+
 	void Print(IConsole *pConsole, Mode DatabaseMode);
+	void PrintStats(IConsole *pConsole);
+	void GetStats(Mode DatabaseMode, CStats *pStats);
 
 	void RegisterDatabase(std::unique_ptr<IDbConnection> pDatabase, Mode DatabaseMode);
 
-	void Execute(
+	// Starts the worker threads, tasks queued before are kept. More than
+	// one write worker can reorder writes. At most `MaxQueued` tasks wait
+	// per mode, further reads are rejected. Writes are never rejected,
+	// they are only counted as overflows. Batched writes arriving within
+	// `WriteBatchMs` milliseconds share a transaction, 0 disables this.
+	// Each worker connection keeps up to `StatementCacheSize` prepared
+	// statements, a negative size keeps the connection's default.
+	void Start(int NumReadWorkers, int NumWriteWorkers, int MaxQueued, int WriteBatchMs = 0, int StatementCacheSize = -1);
+
+	// returns false if the read was rejected because the queue is full
+	bool Execute(
 		FRead pFunc,
 		std::unique_ptr<const ISqlData> pSqlRequestData,
 		const char *pName);
-	// writes to WRITE_BACKUP server in case of failure
-	void ExecuteWrite(
+	// writes to WRITE_BACKUP server in case of failure. Batched writes
+	// can be committed together with other batched writes, `pFunc` must
+	// not call `Lock` then. If the transaction fails, they are retried
+	// one by one.
+	bool ExecuteWrite(
 		FWrite pFunc,
 		std::unique_ptr<const ISqlData> pSqlRequestData,
-		const char *pName);
+		const char *pName,
+		bool Batch = false);
 
 	void OnShutdown();
 
 private:
+	struct CQueue
+	{
+		lock m_Lock;
+		semaphore m_NumElem;
+		std::deque<std::unique_ptr<struct CSqlExecData>> m_Tasks;
+		int m_NumWorkers;
+		CStats m_Stats;
+	};
+
+	struct CWorker
+	{
+		CDbConnectionPool *m_pPool;
+		Mode m_Mode;
+		// copies of the registered connections, synced before every task
+		std::vector<std::unique_ptr<IDbConnection>> m_aapConnections[NUM_MODES];
+		// remember last working server and try to connect to it first
+		int m_LastServer;
+	};
+
+	// registered connections, only used as templates for the workers
+	lock m_ConnectionsLock;
 	std::vector<std::unique_ptr<IDbConnection>> m_aapDbConnections[NUM_MODES];
 
+	CQueue m_aQueues[NUM_MODES];
+	std::vector<std::unique_ptr<CWorker>> m_vpWorkers;
+	int m_MaxQueued;
+	int m_WriteBatchMs;
+	int m_StatementCacheSize;
+
+	bool Enqueue(Mode DatabaseMode, std::unique_ptr<struct CSqlExecData> pData, bool Reject);
+	void SyncConnections(CWorker *pWorker);
+	void StopWorkers(Mode DatabaseMode);
+	bool WaitForWorkers(int NumRemaining, int *pWaited);
+
 	static void Worker(void *pUser);
-	void Worker();
+	void Worker(CWorker *pWorker);
+	void ExecTask(CWorker *pWorker, std::unique_ptr<struct CSqlExecData> pThreadData);
+	void FinishTask(CQueue *pQueue, const struct CSqlExecData *pThreadData, bool Success);
 	bool ExecSqlFunc(IDbConnection *pConnection, struct CSqlExecData *pData, bool Failure);
 
+	// takes further batched writes from the front of the queue
+	void CollectBatch(CQueue *pQueue, std::vector<std::unique_ptr<struct CSqlExecData>> *pvpBatch);
+	bool ExecBatch(CWorker *pWorker, std::vector<std::unique_ptr<struct CSqlExecData>> &vpBatch);
+	bool ExecSqlBatch(IDbConnection *pConnection, std::vector<std::unique_ptr<struct CSqlExecData>> &vpBatch, int64 *pCommitLatency);
+
 	std::atomic_bool m_Shutdown;
-	semaphore m_NumElem;
-	int FirstElem;
-	int LastElem;
-	std::unique_ptr<struct CSqlExecData> m_aTasks[512];
+	std::atomic_int m_NumRunning;
 };
 
 #endif // ENGINE_SERVER_DATABASES_CONNECTION_POOL_H
@@ -23,6 +23,7 @@ CMysqlConnection::CMysqlConnection(
 	bool Setup) :
 	IDbConnection(pPrefix),
 #if defined(CONF_SQL)
+	m_pPreparedStmt(nullptr),
 	m_NewQuery(false),
 	m_Locked(false),
 #endif
@@ -43,7 +44,8 @@ CMysqlConnection::~CMysqlConnection()
 {
 #if defined(CONF_SQL)
 	m_pStmt.release();
-	m_pPreparedStmt.release();
+	m_pPreparedStmt = nullptr;
+	m_StatementCache.Clear();
 	m_pConnection.release();
 #endif
 }
@@ -105,7 +107,9 @@ IDbConnection::Status CMysqlConnection::Connect()
 	try
 	{
 		m_pConnection.release();
-		m_pPreparedStmt.release();
+		// the statements belonged to the old connection
+		m_pPreparedStmt = nullptr;
+		m_StatementCache.Clear();
 		m_pResults.release();
 
 		sql::ConnectOptionsMap connection_properties;
@@ -210,14 +214,64 @@ void CMysqlConnection::Unlock()
 #endif
 }
 
+void CMysqlConnection::BeginTransaction()
+{
+#if defined(CONF_SQL)
+	m_pStmt->execute("START TRANSACTION;");
+#endif
+}
+
+void CMysqlConnection::CommitTransaction()
+{
+#if defined(CONF_SQL)
+	m_pStmt->execute("COMMIT;");
+#endif
+}
+
+void CMysqlConnection::RollbackTransaction()
+{
+#if defined(CONF_SQL)
+	m_pStmt->execute("ROLLBACK;");
+#endif
+}
+
 void CMysqlConnection::PrepareStatement(const char *pStmt)
 {
 #if defined(CONF_SQL)
-	m_pPreparedStmt.reset(m_pConnection->prepareStatement(pStmt));
+	m_pResults.reset();
+	m_pPreparedStmt = nullptr;
+	if(m_StatementCache.Capacity() > 0)
+	{
+		auto *pCached = m_StatementCache.Find(pStmt);
+		if(pCached != nullptr)
+		{
+			m_pPreparedStmt = pCached->get();
+			m_pPreparedStmt->clearParameters();
+			m_NewQuery = true;
+			return;
+		}
+	}
+	m_pPreparedStmt = m_StatementCache.Add(pStmt, std::unique_ptr<sql::PreparedStatement>(m_pConnection->prepareStatement(pStmt)))->get();
 	m_NewQuery = true;
 #endif
 }
 
+void CMysqlConnection::SetStatementCacheSize(int Size)
+{
+#if defined(CONF_SQL)
+	m_StatementCache.SetCapacity(Size);
+#endif
+}
+
+void CMysqlConnection::GetStatementCacheStats(CStatementCacheStats *pStats) const
+{
+#if defined(CONF_SQL)
+	m_StatementCache.GetStats(pStats);
+#else
+	mem_zero(pStats, sizeof(*pStats));
+#endif
+}
+
 void CMysqlConnection::BindString(int Idx, const char *pString)
 {
 #if defined(CONF_SQL)
@@ -258,7 +312,21 @@ bool CMysqlConnection::Step()
 	if(m_NewQuery)
 	{
 		m_NewQuery = false;
-		m_pResults.reset(m_pPreparedStmt->executeQuery());
+		try
+		{
+			m_pResults.reset(m_pPreparedStmt->executeQuery());
+		}
+		catch(sql::SQLException &e)
+		{
+			// ER_UNKNOWN_STMT_HANDLER: the connection was reestablished
+			// and lost the server side statements
+			if(e.getErrorCode() == 1243)
+			{
+				m_pPreparedStmt = nullptr;
+				m_StatementCache.Clear();
+			}
+			throw;
+		}
 	}
 	return m_pResults->next();
 #else
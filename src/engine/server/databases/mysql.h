@@ -42,7 +42,13 @@ public:
 	virtual void Lock(const char *pTable);
 	virtual void Unlock();
 
+	virtual void BeginTransaction();
+	virtual void CommitTransaction();
+	virtual void RollbackTransaction();
+
 	virtual void PrepareStatement(const char *pStmt);
+	virtual void SetStatementCacheSize(int Size);
+	virtual void GetStatementCacheStats(CStatementCacheStats *pStats) const;
 
 	virtual void BindString(int Idx, const char *pString);
 	virtual void BindBlob(int Idx, unsigned char *pBlob, int Size);
@@ -63,7 +69,9 @@ public:
 private:
 #if defined(CONF_SQL)
 	std::unique_ptr<sql::Connection> m_pConnection;
-	std::unique_ptr<sql::PreparedStatement> m_pPreparedStmt;
+	// owned by the statement cache, only valid for the current connection
+	sql::PreparedStatement *m_pPreparedStmt;
+	CStatementCache<std::unique_ptr<sql::PreparedStatement>> m_StatementCache;
 	std::unique_ptr<sql::Statement> m_pStmt;
 	std::unique_ptr<sql::ResultSet> m_pResults;
 	bool m_NewQuery;
@@ -9,6 +9,10 @@
 CSqliteConnection::CSqliteConnection(const char *pFilename, bool Setup) :
 	IDbConnection("record"),
 	m_Setup(Setup),
+	m_Wal(false),
+	m_Synchronous(-1),
+	m_WalAutoCheckpoint(-1),
+	m_ReadOnly(false),
 	m_pDb(nullptr),
 	m_pStmt(nullptr),
 	m_Done(true),
@@ -18,10 +22,15 @@ CSqliteConnection::CSqliteConnection(const char *pFilename, bool Setup) :
 	str_copy(m_aFilename, pFilename, sizeof(m_aFilename));
 }
 
+void CSqliteConnection::CStmtDeleter::operator()(sqlite3_stmt *pStmt) const
+{
+	sqlite3_finalize(pStmt);
+}
+
 CSqliteConnection::~CSqliteConnection()
 {
-	if(m_pStmt != nullptr)
-		sqlite3_finalize(m_pStmt);
+	m_pStmt = nullptr;
+	m_StatementCache.Clear();
 	sqlite3_close(m_pDb);
 	m_pDb = nullptr;
 }
@@ -30,8 +39,8 @@ void CSqliteConnection::Print(IConsole *pConsole, const char *Mode)
 {
 	char aBuf[512];
 	str_format(aBuf, sizeof(aBuf),
-		"SQLite-%s: DB: '%s'",
-		Mode, m_aFilename);
+		"SQLite-%s: DB: '%s'%s%s",
+		Mode, m_aFilename, m_Wal ? " (WAL)" : "", m_ReadOnly ? " (read-only)" : "");
 	pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "server", aBuf);
 }
 
@@ -42,7 +51,17 @@ void CSqliteConnection::ToUnixTimestamp(const char *pTimestamp, char *aBuf, unsi
 
 CSqliteConnection *CSqliteConnection::Copy()
 {
-	return new CSqliteConnection(m_aFilename, m_Setup);
+	CSqliteConnection *pCopy = new CSqliteConnection(m_aFilename, m_Setup);
+	pCopy->SetJournal(m_Wal, m_Synchronous, m_WalAutoCheckpoint);
+	pCopy->SetReadOnly(m_ReadOnly);
+	return pCopy;
+}
+
+void CSqliteConnection::SetJournal(bool Wal, int Synchronous, int WalAutoCheckpoint)
+{
+	m_Wal = Wal;
+	m_Synchronous = Synchronous;
+	m_WalAutoCheckpoint = WalAutoCheckpoint;
 }
 
 IDbConnection::Status CSqliteConnection::Connect()
@@ -53,19 +72,39 @@ IDbConnection::Status CSqliteConnection::Connect()
 	if(m_pDb != nullptr)
 		return Status::SUCCESS;
 
-	int Result = sqlite3_open(m_aFilename, &m_pDb);
+	int Flags = m_ReadOnly ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+	int Result = sqlite3_open_v2(m_aFilename, &m_pDb, Flags, nullptr);
 	if(Result != SQLITE_OK)
 	{
 		dbg_msg("sql", "Can't open sqlite database: '%s'", sqlite3_errmsg(m_pDb));
+		// try to open it again on the next connect
+		sqlite3_close(m_pDb);
+		m_pDb = nullptr;
+		m_InUse.store(false);
 		return Status::FAILURE;
 	}
 
-	// wait for database to unlock so we don't have to handle SQLITE_BUSY errors
-	sqlite3_busy_timeout(m_pDb, -1);
+	// wait for database to unlock so we don't have to handle SQLITE_BUSY errors,
+	// a negative timeout would disable waiting
+	sqlite3_busy_timeout(m_pDb, 0x7fffffff);
 
-	if(m_Setup)
+	char aBuf[1024];
+	// readers don't block writers and the other way around
+	if(m_Wal && !m_ReadOnly)
+		Execute("PRAGMA journal_mode=WAL;");
+	if(m_Synchronous >= 0)
+	{
+		str_format(aBuf, sizeof(aBuf), "PRAGMA synchronous=%d;", m_Synchronous);
+		Execute(aBuf);
+	}
+	if(m_Wal && m_WalAutoCheckpoint >= 0)
+	{
+		str_format(aBuf, sizeof(aBuf), "PRAGMA wal_autocheckpoint=%d;", m_WalAutoCheckpoint);
+		Execute(aBuf);
+	}
+
+	if(m_Setup && !m_ReadOnly)
 	{
-		char aBuf[1024];
 		FormatCreateRace(aBuf, sizeof(aBuf));
 		if(!Execute(aBuf))
 			return Status::FAILURE;
@@ -89,9 +128,7 @@ IDbConnection::Status CSqliteConnection::Connect()
 
 void CSqliteConnection::Disconnect()
 {
-	if(m_pStmt != nullptr)
-		sqlite3_finalize(m_pStmt);
-	m_pStmt = nullptr;
+	ResetStatement();
 	m_InUse.store(false);
 }
 
@@ -106,23 +143,65 @@ void CSqliteConnection::Unlock()
 {
 	if(m_Locked)
 	{
+		ResetStatement();
 		Execute("COMMIT TRANSACTION;");
 		m_Locked = false;
 	}
 }
 
-void CSqliteConnection::PrepareStatement(const char *pStmt)
+void CSqliteConnection::BeginTransaction()
+{
+	// take the write lock right away instead of failing on the first write
+	if(!Execute("BEGIN IMMEDIATE TRANSACTION;"))
+		throw std::runtime_error("failed to begin transaction");
+}
+
+void CSqliteConnection::CommitTransaction()
+{
+	ResetStatement();
+	if(!Execute("COMMIT TRANSACTION;"))
+		throw std::runtime_error("failed to commit transaction");
+}
+
+void CSqliteConnection::RollbackTransaction()
+{
+	ResetStatement();
+	Execute("ROLLBACK TRANSACTION;");
+}
+
+void CSqliteConnection::ResetStatement()
 {
 	if(m_pStmt != nullptr)
-		sqlite3_finalize(m_pStmt);
+	{
+		sqlite3_reset(m_pStmt);
+		sqlite3_clear_bindings(m_pStmt);
+	}
 	m_pStmt = nullptr;
+}
+
+void CSqliteConnection::PrepareStatement(const char *pStmt)
+{
+	ResetStatement();
+	if(m_StatementCache.Capacity() > 0)
+	{
+		auto *pCached = m_StatementCache.Find(pStmt);
+		if(pCached != nullptr)
+		{
+			m_pStmt = pCached->get();
+			m_Done = false;
+			return;
+		}
+	}
+
+	sqlite3_stmt *pNewStmt = nullptr;
 	int Result = sqlite3_prepare_v2(
 		m_pDb,
 		pStmt,
 		-1, // pStmt can be any length
-		&m_pStmt,
+		&pNewStmt,
 		NULL);
 	ExceptionOnError(Result);
+	m_pStmt = m_StatementCache.Add(pStmt, std::unique_ptr<sqlite3_stmt, CStmtDeleter>(pNewStmt))->get();
 	m_Done = false;
 }
 
@@ -3,6 +3,7 @@
 
 #include "connection.h"
 #include <atomic>
+#include <memory>
 
 struct sqlite3;
 struct sqlite3_stmt;
@@ -16,6 +17,12 @@ public:
 
 	virtual CSqliteConnection *Copy();
 
+	// applied on connect and kept by copies. The journal mode persists in
+	// the database file, negative values keep SQLite's defaults
+	void SetJournal(bool Wal, int Synchronous, int WalAutoCheckpoint);
+	// read-only connections skip the setup and never take the write lock
+	void SetReadOnly(bool ReadOnly) { m_ReadOnly = ReadOnly; }
+
 	virtual const char *BinaryCollate() const { return "BINARY"; }
 	virtual void ToUnixTimestamp(const char *pTimestamp, char *aBuf, unsigned int BufferSize);
 	virtual const char *InsertTimestampAsUtc() const { return "DATETIME(?, 'utc')"; }
@@ -29,7 +36,13 @@ public:
 	virtual void Lock(const char *pTable);
 	virtual void Unlock();
 
+	virtual void BeginTransaction();
+	virtual void CommitTransaction();
+	virtual void RollbackTransaction();
+
 	virtual void PrepareStatement(const char *pStmt);
+	virtual void SetStatementCacheSize(int Size) { m_StatementCache.SetCapacity(Size); }
+	virtual void GetStatementCacheStats(CStatementCacheStats *pStats) const { m_StatementCache.GetStats(pStats); }
 
 	virtual void BindString(int Idx, const char *pString);
 	virtual void BindBlob(int Idx, unsigned char *pBlob, int Size);
@@ -52,15 +65,28 @@ private:
 	// copy of config vars
 	char m_aFilename[512];
 	bool m_Setup;
+	bool m_Wal;
+	int m_Synchronous;
+	int m_WalAutoCheckpoint;
+	bool m_ReadOnly;
+
+	struct CStmtDeleter
+	{
+		void operator()(sqlite3_stmt *pStmt) const;
+	};
 
 	sqlite3 *m_pDb;
+	// owned by the statement cache
 	sqlite3_stmt *m_pStmt;
+	CStatementCache<std::unique_ptr<sqlite3_stmt, CStmtDeleter>> m_StatementCache;
 	bool m_Done; // no more rows available for Step
 	bool m_Locked;
 	// returns true, if the query succeded
 	bool Execute(const char *pQuery);
 
 	void ExceptionOnError(int Result);
+	// resets the current statement, so that it doesn't keep the database locked
+	void ResetStatement();
 
 	std::atomic_bool m_InUse;
 };
@@ -0,0 +1,90 @@
+#ifndef ENGINE_SERVER_DATABASES_STATEMENT_CACHE_H
+#define ENGINE_SERVER_DATABASES_STATEMENT_CACHE_H
+
+#include <base/math.h>
+#include <base/system.h>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+struct CStatementCacheStats
+{
+	int64 m_Hits;
+	int64 m_Misses;
+	int64 m_Evictions;
+	int m_Size;
+};
+
+// Least recently used prepared statements of a connection, keyed by their
+// SQL text. `T` owns the statement and releases it when destroyed.
+template<typename T>
+class CStatementCache
+{
+public:
+	enum
+	{
+		DEFAULT_CAPACITY = 32,
+	};
+
+	CStatementCache() :
+		m_Capacity(DEFAULT_CAPACITY)
+	{
+		mem_zero(&m_Stats, sizeof(m_Stats));
+	}
+
+	// returns the cached statement or nullptr, counts hits and misses
+	T *Find(const char *pSql)
+	{
+		auto It = m_Index.find(pSql);
+		if(It == m_Index.end())
+		{
+			m_Stats.m_Misses++;
+			return nullptr;
+		}
+		m_Stats.m_Hits++;
+		m_Entries.splice(m_Entries.begin(), m_Entries, It->second);
+		return &It->second->second;
+	}
+
+	// takes ownership, evicts the least recently used statement if full.
+	// with a capacity of 0 only the statement in use is kept, so that
+	// callers can bypass the cache by not calling `Find`
+	T *Add(const char *pSql, T Statement)
+	{
+		while(!m_Entries.empty() && (int)m_Entries.size() >= maximum(m_Capacity, 1))
+		{
+			m_Index.erase(m_Entries.back().first);
+			m_Entries.pop_back();
+			m_Stats.m_Evictions++;
+		}
+		m_Entries.emplace_front(pSql, std::move(Statement));
+		m_Index[m_Entries.front().first] = m_Entries.begin();
+		return &m_Entries.front().second;
+	}
+
+	void Clear()
+	{
+		m_Index.clear();
+		m_Entries.clear();
+	}
+
+	int Capacity() const { return m_Capacity; }
+	void SetCapacity(int Capacity) { m_Capacity = Capacity; }
+
+	void GetStats(CStatementCacheStats *pStats) const
+	{
+		*pStats = m_Stats;
+		pStats->m_Size = m_Entries.size();
+	}
+
+private:
+	typedef std::list<std::pair<std::string, T>> CEntries;
+	CEntries m_Entries;
+	std::unordered_map<std::string, typename CEntries::iterator> m_Index;
+	int m_Capacity;
+	CStatementCacheStats m_Stats;
+};
+
+#endif // ENGINE_SERVER_DATABASES_STATEMENT_CACHE_H
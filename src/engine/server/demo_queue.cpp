@@ -0,0 +1,238 @@
+#include "demo_queue.h"
+
+#include <engine/shared/demo.h>
+
+#include <game/extrainfo.h>
+
+CDemoRecordQueue::CDemoRecordQueue() :
+	m_pThread(0),
+	m_MaxQueued(0),
+	m_NumAllocated(0),
+	m_Flushing(false),
+	m_WaitingForFree(false),
+	m_Shutdown(false),
+	m_NumDropped(0),
+	m_Dropping(false)
+{
+}
+
+CDemoRecordQueue::~CDemoRecordQueue()
+{
+	Shutdown();
+	for(CRecord *pRecord : m_vpFree)
+	{
+		delete pRecord;
+	}
+}
+
+void CDemoRecordQueue::Init(int MaxQueued)
+{
+	Shutdown();
+	m_MaxQueued = MaxQueued;
+	m_Shutdown = false;
+	if(m_MaxQueued > 0)
+	{
+		m_pThread = thread_init(WorkerThread, this, "demo recorder");
+		if(!m_pThread)
+		{
+			dbg_msg("demo_recorder", "failed to start worker thread, recording synchronously");
+			m_MaxQueued = 0;
+		}
+	}
+}
+
+void CDemoRecordQueue::Shutdown()
+{
+	if(!m_pThread)
+	{
+		return;
+	}
+	m_Lock.take();
+	m_Shutdown = true;
+	m_Lock.release();
+	m_Semaphore.signal();
+	thread_wait(m_pThread);
+	m_pThread = 0;
+}
+
+CDemoRecordQueue::CRecord *CDemoRecordQueue::Allocate(bool Wait)
+{
+	CRecord *pRecord = 0;
+	m_Lock.take();
+	while(true)
+	{
+		if(!m_vpFree.empty())
+		{
+			pRecord = m_vpFree.back();
+			m_vpFree.pop_back();
+			break;
+		}
+		if(m_NumAllocated < maximum(m_MaxQueued, 1))
+		{
+			pRecord = new CRecord;
+			m_NumAllocated++;
+			break;
+		}
+		if(!Wait || !m_pThread)
+		{
+			break;
+		}
+		m_WaitingForFree = true;
+		m_Lock.release();
+		m_FreeSemaphore.wait();
+		m_Lock.take();
+	}
+	m_Lock.release();
+
+	if(!pRecord)
+	{
+		if(!m_Dropping)
+		{
+			dbg_msg("demo_recorder", "queue full, dropping snapshots");
+		}
+		m_Dropping = true;
+		m_NumDropped++;
+		return 0;
+	}
+	if(m_Dropping && !Wait)
+	{
+		dbg_msg("demo_recorder", "queue recovered, %lld snapshots dropped so far", m_NumDropped);
+		m_Dropping = false;
+	}
+	return pRecord;
+}
+
+void CDemoRecordQueue::Enqueue(CRecord *pRecord)
+{
+	if(!m_pThread)
+	{
+		Process(pRecord);
+		scope_lock Lock(&m_Lock);
+		m_vpFree.push_back(pRecord);
+		return;
+	}
+	m_Lock.take();
+	m_vpPending.push_back(pRecord);
+	m_Lock.release();
+	m_Semaphore.signal();
+}
+
+bool CDemoRecordQueue::RecordSnapshot(CDemoRecorder *pRecorder, int Tick, const void *pData, int Size)
+{
+	// skipping a snapshot is fine, the recorder deltas against the last one
+	// it actually wrote
+	CRecord *pRecord = Allocate(false);
+	if(!pRecord)
+	{
+		return false;
+	}
+	pRecord->m_Type = RECORD_SNAPSHOT;
+	pRecord->m_pRecorder = pRecorder;
+	pRecord->m_Tick = Tick;
+	mem_copy(pRecord->m_aData, pData, Size);
+	pRecord->m_Size = Size;
+	Enqueue(pRecord);
+	return true;
+}
+
+bool CDemoRecordQueue::RecordMessage(CDemoRecorder *pRecorder, const void *pData, int Size)
+{
+	if(Size > CSnapshot::MAX_SIZE)
+	{
+		return false;
+	}
+	// messages like chat or kills can't be recovered by the demo player
+	CRecord *pRecord = Allocate(true);
+	if(!pRecord)
+	{
+		return false;
+	}
+	pRecord->m_Type = RECORD_MESSAGE;
+	pRecord->m_pRecorder = pRecorder;
+	pRecord->m_Tick = -1;
+	mem_copy(pRecord->m_aData, pData, Size);
+	pRecord->m_Size = Size;
+	Enqueue(pRecord);
+	return true;
+}
+
+void CDemoRecordQueue::Flush()
+{
+	if(!m_pThread)
+	{
+		return;
+	}
+	m_Lock.take();
+	while((int)m_vpFree.size() != m_NumAllocated)
+	{
+		m_Flushing = true;
+		m_Lock.release();
+		m_FlushSemaphore.wait();
+		m_Lock.take();
+	}
+	m_Flushing = false;
+	m_Lock.release();
+}
+
+void CDemoRecordQueue::Process(CRecord *pRecord)
+{
+	if(pRecord->m_Type == RECORD_SNAPSHOT)
+	{
+		// for antiping: if the projectile netobjects contains extra data, this is removed and the original content restored before recording demo
+		SnapshotRemoveExtraInfo(pRecord->m_aData);
+		pRecord->m_pRecorder->RecordSnapshot(pRecord->m_Tick, pRecord->m_aData, pRecord->m_Size);
+	}
+	else
+	{
+		pRecord->m_pRecorder->RecordMessage(pRecord->m_aData, pRecord->m_Size);
+	}
+}
+
+void CDemoRecordQueue::WorkerThread(void *pUser)
+{
+	((CDemoRecordQueue *)pUser)->Worker();
+}
+
+void CDemoRecordQueue::Worker()
+{
+	std::vector<CRecord *> vpLocal;
+	while(true)
+	{
+		m_Lock.take();
+		while(m_vpPending.empty() && !m_Shutdown)
+		{
+			m_Lock.release();
+			m_Semaphore.wait();
+			m_Lock.take();
+		}
+		bool Shutdown = m_Shutdown;
+		std::swap(vpLocal, m_vpPending);
+		m_Lock.release();
+
+		for(CRecord *pRecord : vpLocal)
+		{
+			Process(pRecord);
+		}
+
+		m_Lock.take();
+		m_vpFree.insert(m_vpFree.end(), vpLocal.begin(), vpLocal.end());
+		bool Flushing = m_Flushing && (int)m_vpFree.size() == m_NumAllocated;
+		bool WaitingForFree = m_WaitingForFree;
+		m_WaitingForFree = false;
+		m_Lock.release();
+		vpLocal.clear();
+		if(Flushing)
+		{
+			m_FlushSemaphore.signal();
+		}
+		if(WaitingForFree)
+		{
+			m_FreeSemaphore.signal();
+		}
+
+		if(Shutdown)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#ifndef ENGINE_SERVER_DEMO_QUEUE_H
+#define ENGINE_SERVER_DEMO_QUEUE_H
+
+#include <base/system.h>
+#include <base/tl/threading.h>
+#include <engine/shared/snapshot.h>
+
+#include <vector>
+
+class CDemoRecorder;
+
+// Moves demo encoding and writing off the tick thread. Snapshots and
+// messages are copied into pooled buffers and handed to a worker thread
+// that removes the antiping extra info, deltas, compresses and writes
+// them. At most `MaxQueued` buffers are in flight. Further snapshots are
+// dropped until the worker catches up, messages can't be skipped and wait
+// for a free buffer instead.
+//
+// The recorders passed in must only be started or stopped after calling
+// `Flush`, so the worker doesn't touch them concurrently.
+class CDemoRecordQueue
+{
+public:
+	CDemoRecordQueue();
+	~CDemoRecordQueue();
+
+	// `MaxQueued` = 0 records synchronously on the calling thread.
+	void Init(int MaxQueued);
+	void Shutdown();
+
+	// Return false if the record was dropped.
+	bool RecordSnapshot(CDemoRecorder *pRecorder, int Tick, const void *pData, int Size);
+	bool RecordMessage(CDemoRecorder *pRecorder, const void *pData, int Size);
+
+	// Waits until everything queued so far has been written.
+	void Flush();
+
+	int64 NumDropped() const { return m_NumDropped; }
+
+private:
+	enum
+	{
+		RECORD_SNAPSHOT,
+		RECORD_MESSAGE,
+	};
+
+	struct CRecord
+	{
+		int m_Type;
+		CDemoRecorder *m_pRecorder;
+		int m_Tick;
+		int m_Size;
+		unsigned char m_aData[CSnapshot::MAX_SIZE];
+	};
+
+	CRecord *Allocate(bool Wait);
+	void Enqueue(CRecord *pRecord);
+	static void Process(CRecord *pRecord);
+
+	static void WorkerThread(void *pUser);
+	void Worker();
+
+	void *m_pThread;
+	int m_MaxQueued;
+
+	lock m_Lock;
+	semaphore m_Semaphore;
+	semaphore m_FlushSemaphore;
+	semaphore m_FreeSemaphore;
+	std::vector<CRecord *> m_vpPending;
+	std::vector<CRecord *> m_vpFree;
+	int m_NumAllocated;
+	bool m_Flushing;
+	bool m_WaitingForFree;
+	bool m_Shutdown;
+
+	int64 m_NumDropped;
+	bool m_Dropping;
+};
+
+#endif // ENGINE_SERVER_DEMO_QUEUE_H
@@ -1,5 +1,9 @@
 #include "name_ban.h"
 
+#include <base/math.h>
+
+#include <algorithm>
+
 CNameBan *IsNameBanned(const char *pName, CNameBan *pNameBans, int NumNameBans)
 {
 	char aTrimmed[MAX_NAME_LENGTH];
@@ -22,3 +26,228 @@ CNameBan *IsNameBanned(const char *pName, CNameBan *pNameBans, int NumNameBans)
 	}
 	return pResult;
 }
+
+CNameBans::CNameBans() :
+	m_NumRemoved(0),
+	m_MaxPieceLength(0),
+	m_Check(0),
+	m_SubstringsChanged(false)
+{
+}
+
+static uint64_t HashStart()
+{
+	return 14695981039346656037ull;
+}
+
+// FNV-1a, so that the hashes of all substrings starting at a position
+// can be computed while extending them
+static uint64_t HashNext(uint64_t Hash, int Char)
+{
+	return (Hash ^ (unsigned)Char) * 1099511628211ull;
+}
+
+static void PieceBounds(const CNameBan &Ban, int Piece, int *pStart, int *pLength)
+{
+	// the last pieces are one longer if the skeleton can't be split evenly
+	int NumPieces = Ban.m_Distance + 1;
+	int Length = Ban.m_SkeletonLength / NumPieces;
+	int NumShort = NumPieces - Ban.m_SkeletonLength % NumPieces;
+	*pStart = Piece * Length + maximum(Piece - NumShort, 0);
+	*pLength = Length + (Piece >= NumShort);
+}
+
+void CNameBans::AddPieces(int Slot)
+{
+	const CNameBan &Ban = m_vBans[Slot];
+	if(Ban.m_Distance < 0)
+		return;
+	if(Ban.m_Distance >= Ban.m_SkeletonLength)
+	{
+		m_vUnsplit.push_back(Slot);
+		return;
+	}
+	for(int i = 0; i <= Ban.m_Distance; i++)
+	{
+		int Start, Length;
+		PieceBounds(Ban, i, &Start, &Length);
+		uint64_t Hash = HashStart();
+		for(int c = Start; c < Start + Length; c++)
+			Hash = HashNext(Hash, Ban.m_aSkeleton[c]);
+		m_Pieces[Hash].push_back({Slot, Start});
+		m_MaxPieceLength = maximum(m_MaxPieceLength, Length);
+	}
+}
+
+void CNameBans::RemovePieces(int Slot)
+{
+	const CNameBan &Ban = m_vBans[Slot];
+	if(Ban.m_Distance < 0)
+		return;
+	if(Ban.m_Distance >= Ban.m_SkeletonLength)
+	{
+		m_vUnsplit.erase(std::find(m_vUnsplit.begin(), m_vUnsplit.end(), Slot));
+		return;
+	}
+	for(int i = 0; i <= Ban.m_Distance; i++)
+	{
+		int Start, Length;
+		PieceBounds(Ban, i, &Start, &Length);
+		uint64_t Hash = HashStart();
+		for(int c = Start; c < Start + Length; c++)
+			Hash = HashNext(Hash, Ban.m_aSkeleton[c]);
+		auto It = m_Pieces.find(Hash);
+		std::vector<CPiece> &vPieces = It->second;
+		vPieces.erase(std::find_if(vPieces.begin(), vPieces.end(), [&](const CPiece &Piece) { return Piece.m_Slot == Slot && Piece.m_Start == Start; }));
+		if(vPieces.empty())
+			m_Pieces.erase(It);
+	}
+}
+
+void CNameBans::Insert(const CNameBan &Ban)
+{
+	int Slot = m_vBans.size();
+	m_vBans.push_back(Ban);
+	m_vRemoved.push_back(false);
+	m_vChecked.push_back(m_Check);
+	m_Slots[Ban.m_aName] = Slot;
+	AddPieces(Slot);
+	if(Ban.m_IsSubstring == 1)
+		m_SubstringsChanged = true;
+}
+
+void CNameBans::Rebuild()
+{
+	std::vector<CNameBan> vBans;
+	vBans.reserve(NumBans());
+	for(unsigned i = 0; i < m_vBans.size(); i++)
+		if(!m_vRemoved[i])
+			vBans.push_back(m_vBans[i]);
+	m_vBans.clear();
+	m_vRemoved.clear();
+	m_vChecked.clear();
+	m_NumRemoved = 0;
+	m_Slots.clear();
+	m_Pieces.clear();
+	m_MaxPieceLength = 0;
+	m_vUnsplit.clear();
+	m_SubstringsChanged = true;
+	for(const CNameBan &Ban : vBans)
+		Insert(Ban);
+}
+
+void CNameBans::Ban(const char *pName, int Distance, int IsSubstring, const char *pReason)
+{
+	auto It = m_Slots.find(pName);
+	if(It == m_Slots.end())
+	{
+		Insert(CNameBan(pName, Distance, IsSubstring, pReason));
+		return;
+	}
+	CNameBan &Ban = m_vBans[It->second];
+	if(Ban.m_IsSubstring != IsSubstring)
+		m_SubstringsChanged = true;
+	if(Ban.m_Distance != Distance)
+	{
+		RemovePieces(It->second);
+		Ban.m_Distance = Distance;
+		AddPieces(It->second);
+	}
+	Ban.m_IsSubstring = IsSubstring;
+	str_copy(Ban.m_aReason, pReason, sizeof(Ban.m_aReason));
+}
+
+bool CNameBans::Unban(const char *pName)
+{
+	auto It = m_Slots.find(pName);
+	if(It == m_Slots.end())
+		return false;
+	int Slot = It->second;
+	m_Slots.erase(It);
+	RemovePieces(Slot);
+	m_vRemoved[Slot] = true;
+	m_NumRemoved++;
+	if(m_vBans[Slot].m_IsSubstring == 1)
+		m_SubstringsChanged = true;
+	if(m_NumRemoved > NumBans())
+		Rebuild();
+	return true;
+}
+
+const CNameBan *CNameBans::Find(const char *pName) const
+{
+	auto It = m_Slots.find(pName);
+	return It == m_Slots.end() ? 0 : &m_vBans[It->second];
+}
+
+void CNameBans::Check(int Slot, const int *pSkeleton, int SkeletonLength, int *pResult)
+{
+	if(m_vChecked[Slot] == m_Check || Slot <= *pResult)
+		return;
+	m_vChecked[Slot] = m_Check;
+	const CNameBan &Ban = m_vBans[Slot];
+	if(absolute(Ban.m_SkeletonLength - SkeletonLength) > Ban.m_Distance)
+		return;
+	int aBuffer[MAX_NAME_SKELETON_LENGTH * 2 + 2];
+	if(str_utf32_dist_buffer(pSkeleton, SkeletonLength, Ban.m_aSkeleton, Ban.m_SkeletonLength, aBuffer, sizeof(aBuffer) / sizeof(aBuffer[0])) <= Ban.m_Distance)
+		*pResult = Slot;
+}
+
+const CNameBan *CNameBans::IsBanned(const char *pName)
+{
+	char aTrimmed[MAX_NAME_LENGTH];
+	str_copy(aTrimmed, str_utf8_skip_whitespaces(pName), sizeof(aTrimmed));
+	str_utf8_trim_right(aTrimmed);
+
+	int aSkeleton[MAX_NAME_SKELETON_LENGTH];
+	int SkeletonLength = str_utf8_to_skeleton(aTrimmed, aSkeleton, sizeof(aSkeleton) / sizeof(aSkeleton[0]));
+
+	if(++m_Check == 0)
+	{
+		std::fill(m_vChecked.begin(), m_vChecked.end(), 0);
+		m_Check = 1;
+	}
+
+	// the last added ban wins like in `IsNameBanned`
+	int Result = -1;
+	for(int Slot : m_vUnsplit)
+		Check(Slot, aSkeleton, SkeletonLength, &Result);
+	for(int Start = 0; Start < SkeletonLength; Start++)
+	{
+		uint64_t Hash = HashStart();
+		for(int End = Start; End < SkeletonLength && End - Start < m_MaxPieceLength; End++)
+		{
+			Hash = HashNext(Hash, aSkeleton[End]);
+			auto It = m_Pieces.find(Hash);
+			if(It == m_Pieces.end())
+				continue;
+			// the edits before an unchanged piece move it by at most the
+			// distance
+			for(const CPiece &Piece : It->second)
+				if(absolute(Piece.m_Start - Start) <= m_vBans[Piece.m_Slot].m_Distance)
+					Check(Piece.m_Slot, aSkeleton, SkeletonLength, &Result);
+		}
+	}
+
+	if(m_SubstringsChanged)
+	{
+		std::vector<CSubstringMatcher::CWord> vWords;
+		for(unsigned i = 0; i < m_vBans.size(); i++)
+			if(!m_vRemoved[i] && m_vBans[i].m_IsSubstring == 1)
+				vWords.push_back({m_vBans[i].m_aName, (int)i + 1});
+		m_Substrings.Init(vWords);
+		m_SubstringsChanged = false;
+	}
+	if(m_Substrings.NumWords())
+	{
+		int State = 0;
+		const char *pStr = pName;
+		int Char;
+		while((Char = str_utf8_decode(&pStr)))
+		{
+			State = m_Substrings.Next(State, Char);
+			Result = maximum(Result, m_Substrings.Value(State) - 1);
+		}
+	}
+	return Result >= 0 ? &m_vBans[Result] : 0;
+}
@@ -3,6 +3,11 @@
 
 #include <base/system.h>
 #include <engine/shared/protocol.h>
+#include <engine/shared/substring_matcher.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 enum
 {
@@ -31,4 +36,64 @@ public:
 
 CNameBan *IsNameBanned(const char *pName, CNameBan *pNameBans, int NumNameBans);
 
+// Name bans indexed so that a name isn't compared against every ban.
+// Bans matching by distance are found through pieces of their skeleton:
+// a skeleton split into `m_Distance + 1` pieces keeps at least one of
+// them unchanged in any name within that distance, so only bans sharing
+// a piece with the name need the full comparison. Substring bans are
+// found by an automaton. `IsBanned` returns the same ban as
+// `IsNameBanned` on the bans in the order they were added. Both fold
+// the case of substring bans with str_utf8_tolower, not only for ASCII.
+class CNameBans
+{
+public:
+	CNameBans();
+
+	// adds a ban or changes the existing one with the same name
+	void Ban(const char *pName, int Distance, int IsSubstring, const char *pReason);
+	// returns false if there is no ban with the name
+	bool Unban(const char *pName);
+	const CNameBan *Find(const char *pName) const;
+	const CNameBan *IsBanned(const char *pName);
+
+	int NumBans() const { return m_vBans.size() - m_NumRemoved; }
+	// bans in the order they were added, removed ones are null
+	int NumSlots() const { return m_vBans.size(); }
+	const CNameBan *Get(int Slot) const { return m_vRemoved[Slot] ? 0 : &m_vBans[Slot]; }
+
+private:
+	struct CPiece
+	{
+		int m_Slot;
+		// position of the piece in the skeleton of the ban
+		int m_Start;
+	};
+
+	void Insert(const CNameBan &Ban);
+	void AddPieces(int Slot);
+	void RemovePieces(int Slot);
+	void Check(int Slot, const int *pSkeleton, int SkeletonLength, int *pResult);
+	void Rebuild();
+
+	// removed bans stay until the next rebuild to keep the order
+	std::vector<CNameBan> m_vBans;
+	std::vector<bool> m_vRemoved;
+	int m_NumRemoved;
+	std::unordered_map<std::string, int> m_Slots;
+
+	// pieces by the hash of their codepoints
+	std::unordered_map<uint64_t, std::vector<CPiece>> m_Pieces;
+	int m_MaxPieceLength;
+	// bans that can't be split because their distance isn't smaller than
+	// their skeleton, they are compared against every name
+	std::vector<int> m_vUnsplit;
+	// the check in which each ban was last compared, to compare it once
+	std::vector<unsigned> m_vChecked;
+	unsigned m_Check;
+
+	// the value of a word is its slot plus one
+	CSubstringMatcher m_Substrings;
+	bool m_SubstringsChanged;
+};
+
 #endif // ENGINE_SERVER_NAME_BAN_H
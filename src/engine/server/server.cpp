@@ -32,7 +32,6 @@
 
 // DDRace
 #include <engine/shared/linereader.h>
-#include <game/extrainfo.h>
 #include <vector>
 #include <zlib.h>
 
@@ -290,8 +289,8 @@ CServer::CServer() :
 	m_Register(false), m_RegSixup(true)
 {
 	for(int i = 0; i < MAX_CLIENTS; i++)
-		m_aDemoRecorder[i] = CDemoRecorder(&m_SnapshotDelta, true);
-	m_aDemoRecorder[MAX_CLIENTS] = CDemoRecorder(&m_SnapshotDelta, false);
+		m_aDemoRecorder[i] = CDemoRecorder(&m_DemoSnapshotDelta, true);
+	m_aDemoRecorder[MAX_CLIENTS] = CDemoRecorder(&m_DemoSnapshotDelta, false);
 
 	m_TickSpeed = SERVER_TICK_SPEED;
 
@@ -361,7 +360,7 @@ bool CServer::SetClientNameImpl(int ClientID, const char *pNameRequest, bool Set
 
 	if(Set)
 	{
-		CNameBan *pBanned = IsNameBanned(pNameRequest, m_aNameBans.base_ptr(), m_aNameBans.size());
+		const CNameBan *pBanned = m_NameBans.IsBanned(pNameRequest);
 		if(pBanned)
 		{
 			if(m_aClients[ClientID].m_State == CClient::STATE_READY)
@@ -754,8 +753,8 @@ int CServer::SendMsg(CMsgPacker *pMsg, int Flags, int ClientID)
 			return -1;
 
 		// write message to demo recorder
-		if(!(Flags & MSGFLAG_NORECORD))
-			m_aDemoRecorder[MAX_CLIENTS].RecordMessage(Pack6.Data(), Pack6.Size());
+		if(!(Flags & MSGFLAG_NORECORD) && m_aDemoRecorder[MAX_CLIENTS].IsRecording())
+			m_DemoQueue.RecordMessage(&m_aDemoRecorder[MAX_CLIENTS], Pack6.Data(), Pack6.Size());
 
 		if(!(Flags & MSGFLAG_NOSEND))
 		{
@@ -784,8 +783,10 @@ int CServer::SendMsg(CMsgPacker *pMsg, int Flags, int ClientID)
 
 		if(!(Flags & MSGFLAG_NORECORD))
 		{
-			m_aDemoRecorder[ClientID].RecordMessage(Pack.Data(), Pack.Size());
-			m_aDemoRecorder[MAX_CLIENTS].RecordMessage(Pack.Data(), Pack.Size());
+			if(m_aDemoRecorder[ClientID].IsRecording())
+				m_DemoQueue.RecordMessage(&m_aDemoRecorder[ClientID], Pack.Data(), Pack.Size());
+			if(m_aDemoRecorder[MAX_CLIENTS].IsRecording())
+				m_DemoQueue.RecordMessage(&m_aDemoRecorder[MAX_CLIENTS], Pack.Data(), Pack.Size());
 		}
 
 		if(!(Flags & MSGFLAG_NOSEND))
@@ -829,12 +830,8 @@ void CServer::DoSnapshot()
 		GameServer()->OnSnap(-1);
 		SnapshotSize = m_SnapshotBuilder.Finish(aData);
 
-		// for antiping: if the projectile netobjects contains extra data, this is removed and the original content restored before recording demo
-		unsigned char aExtraInfoRemoved[CSnapshot::MAX_SIZE];
-		mem_copy(aExtraInfoRemoved, aData, SnapshotSize);
-		SnapshotRemoveExtraInfo(aExtraInfoRemoved);
-		// write snapshot
-		m_aDemoRecorder[MAX_CLIENTS].RecordSnapshot(Tick(), aExtraInfoRemoved, SnapshotSize);
+		// write snapshot, the extra info is removed on the demo thread
+		m_DemoQueue.RecordSnapshot(&m_aDemoRecorder[MAX_CLIENTS], Tick(), aData, SnapshotSize);
 	}
 
 	// create snapshots for all clients
@@ -874,12 +871,8 @@ void CServer::DoSnapshot()
 
 			if(m_aDemoRecorder[i].IsRecording())
 			{
-				// for antiping: if the projectile netobjects contains extra data, this is removed and the original content restored before recording demo
-				unsigned char aExtraInfoRemoved[CSnapshot::MAX_SIZE];
-				mem_copy(aExtraInfoRemoved, aData, SnapshotSize);
-				SnapshotRemoveExtraInfo(aExtraInfoRemoved);
-				// write snapshot
-				m_aDemoRecorder[i].RecordSnapshot(Tick(), aExtraInfoRemoved, SnapshotSize);
+				// write snapshot, the extra info is removed on the demo thread
+				m_DemoQueue.RecordSnapshot(&m_aDemoRecorder[i], Tick(), aData, SnapshotSize);
 			}
 
 			Crc = pData->Crc();
@@ -2252,6 +2245,7 @@ int CServer::LoadMap(const char *pMapName)
 		return 0;
 
 	// stop recording when we change map
+	m_DemoQueue.Flush();
 	for(int i = 0; i < MAX_CLIENTS + 1; i++)
 	{
 		if(!m_aDemoRecorder[i].IsRecording())
@@ -2264,7 +2258,7 @@ int CServer::LoadMap(const char *pMapName)
 		{
 			char aPath[256];
 			str_format(aPath, sizeof(aPath), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, i);
-			Storage()->RemoveFile(aPath, IStorage::TYPE_SAVE);
+			DemoRemove(Storage(), aPath, IStorage::TYPE_SAVE);
 		}
 	}
 
@@ -2337,6 +2331,7 @@ int CServer::Run()
 		m_RunServer = RUNNING;
 
 	m_AuthManager.Init();
+	m_DemoQueue.Init(g_Config.m_SvDemoQueueSize);
 
 	if(g_Config.m_Debug)
 	{
@@ -2356,6 +2351,7 @@ int CServer::Run()
 	{
 		auto pSqlServers = std::unique_ptr<CSqliteConnection>(new CSqliteConnection(
 			g_Config.m_SvSqliteFile, true));
+		pSqlServers->SetJournal(g_Config.m_SvSqliteWal, g_Config.m_SvSqliteSynchronous, g_Config.m_SvSqliteWalCheckpoint);
 
 		if(g_Config.m_SvUseSQL)
 		{
@@ -2364,10 +2360,19 @@ int CServer::Run()
 		else
 		{
 			auto pCopy = std::unique_ptr<CSqliteConnection>(pSqlServers->Copy());
+			if(g_Config.m_SvSqliteWal)
+			{
+				// create the tables and switch to WAL before the read-only
+				// connections of the read workers open the database
+				if(pCopy->Connect() == IDbConnection::SUCCESS)
+					pCopy->Disconnect();
+				pSqlServers->SetReadOnly(true);
+			}
 			DbPool()->RegisterDatabase(std::move(pSqlServers), CDbConnectionPool::READ);
 			DbPool()->RegisterDatabase(std::move(pCopy), CDbConnectionPool::WRITE);
 		}
 	}
+	DbPool()->Start(g_Config.m_SvSqlReadWorkers, g_Config.m_SvSqlWriteWorkers, g_Config.m_SvSqlQueueSize, g_Config.m_SvSqlWriteBatch, g_Config.m_SvSqlStatementCache);
 
 	// start server
 	NETADDR BindAddr;
@@ -2646,6 +2651,7 @@ int CServer::Run()
 
 	GameServer()->OnShutdown();
 	m_pMap->Unload();
+	m_DemoQueue.Shutdown();
 
 	for(int i = 0; i < 2; i++)
 		free(m_apCurrentMapData[i]);
@@ -2957,22 +2963,16 @@ void CServer::ConNameBan(IConsole::IResult *pResult, void *pUser)
 	int Distance = pResult->NumArguments() > 1 ? pResult->GetInteger(1) : str_length(pName) / 3;
 	int IsSubstring = pResult->NumArguments() > 2 ? pResult->GetInteger(2) : 0;
 
-	for(int i = 0; i < pThis->m_aNameBans.size(); i++)
+	const CNameBan *pBan = pThis->m_NameBans.Find(pName);
+	if(pBan)
 	{
-		CNameBan *pBan = &pThis->m_aNameBans[i];
-		if(str_comp(pBan->m_aName, pName) == 0)
-		{
-			str_format(aBuf, sizeof(aBuf), "changed name='%s' distance=%d old_distance=%d is_substring=%d old_is_substring=%d reason='%s' old_reason='%s'", pName, Distance, pBan->m_Distance, IsSubstring, pBan->m_IsSubstring, pReason, pBan->m_aReason);
-			pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "name_ban", aBuf);
-			pBan->m_Distance = Distance;
-			pBan->m_IsSubstring = IsSubstring;
-			str_copy(pBan->m_aReason, pReason, sizeof(pBan->m_aReason));
-			return;
-		}
+		str_format(aBuf, sizeof(aBuf), "changed name='%s' distance=%d old_distance=%d is_substring=%d old_is_substring=%d reason='%s' old_reason='%s'", pName, Distance, pBan->m_Distance, IsSubstring, pBan->m_IsSubstring, pReason, pBan->m_aReason);
 	}
-
-	pThis->m_aNameBans.add(CNameBan(pName, Distance, IsSubstring, pReason));
-	str_format(aBuf, sizeof(aBuf), "added name='%s' distance=%d is_substring=%d reason='%s'", pName, Distance, IsSubstring, pReason);
+	else
+	{
+		str_format(aBuf, sizeof(aBuf), "added name='%s' distance=%d is_substring=%d reason='%s'", pName, Distance, IsSubstring, pReason);
+	}
+	pThis->m_NameBans.Ban(pName, Distance, IsSubstring, pReason);
 	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "name_ban", aBuf);
 }
 
@@ -2981,16 +2981,13 @@ void CServer::ConNameUnban(IConsole::IResult *pResult, void *pUser)
 	CServer *pThis = (CServer *)pUser;
 	const char *pName = pResult->GetString(0);
 
-	for(int i = 0; i < pThis->m_aNameBans.size(); i++)
+	const CNameBan *pBan = pThis->m_NameBans.Find(pName);
+	if(pBan)
 	{
-		CNameBan *pBan = &pThis->m_aNameBans[i];
-		if(str_comp(pBan->m_aName, pName) == 0)
-		{
-			char aBuf[128];
-			str_format(aBuf, sizeof(aBuf), "removed name='%s' distance=%d is_substring=%d reason='%s'", pBan->m_aName, pBan->m_Distance, pBan->m_IsSubstring, pBan->m_aReason);
-			pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "name_ban", aBuf);
-			pThis->m_aNameBans.remove_index(i);
-		}
+		char aBuf[128];
+		str_format(aBuf, sizeof(aBuf), "removed name='%s' distance=%d is_substring=%d reason='%s'", pBan->m_aName, pBan->m_Distance, pBan->m_IsSubstring, pBan->m_aReason);
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "name_ban", aBuf);
+		pThis->m_NameBans.Unban(pName);
 	}
 }
 
@@ -2998,9 +2995,11 @@ void CServer::ConNameBans(IConsole::IResult *pResult, void *pUser)
 {
 	CServer *pThis = (CServer *)pUser;
 
-	for(int i = 0; i < pThis->m_aNameBans.size(); i++)
+	for(int i = 0; i < pThis->m_NameBans.NumSlots(); i++)
 	{
-		CNameBan *pBan = &pThis->m_aNameBans[i];
+		const CNameBan *pBan = pThis->m_NameBans.Get(i);
+		if(!pBan)
+			continue;
 		char aBuf[128];
 		str_format(aBuf, sizeof(aBuf), "name='%s' distance=%d is_substring=%d reason='%s'", pBan->m_aName, pBan->m_Distance, pBan->m_IsSubstring, pBan->m_aReason);
 		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "name_ban", aBuf);
@@ -3016,6 +3015,7 @@ void CServer::DemoRecorder_HandleAutoStart()
 {
 	if(g_Config.m_SvAutoDemoRecord)
 	{
+		m_DemoQueue.Flush();
 		m_aDemoRecorder[MAX_CLIENTS].Stop();
 		char aFilename[128];
 		char aDate[20];
@@ -3040,6 +3040,7 @@ void CServer::SaveDemo(int ClientID, float Time)
 {
 	if(IsRecording(ClientID))
 	{
+		m_DemoQueue.Flush();
 		m_aDemoRecorder[ClientID].Stop();
 
 		// rename the demo
@@ -3047,7 +3048,7 @@ void CServer::SaveDemo(int ClientID, float Time)
 		char aNewFilename[256];
 		str_format(aOldFilename, sizeof(aOldFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
 		str_format(aNewFilename, sizeof(aNewFilename), "demos/%s_%s_%5.2f.demo", m_aCurrentMap, m_aClients[ClientID].m_aName, Time);
-		Storage()->RenameFile(aOldFilename, aNewFilename, IStorage::TYPE_SAVE);
+		DemoRename(Storage(), aOldFilename, aNewFilename, IStorage::TYPE_SAVE);
 	}
 }
 
@@ -3057,6 +3058,7 @@ void CServer::StartRecord(int ClientID)
 	{
 		char aFilename[128];
 		str_format(aFilename, sizeof(aFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
+		m_DemoQueue.Flush();
 		m_aDemoRecorder[ClientID].Start(Storage(), Console(), aFilename, GameServer()->NetVersion(), m_aCurrentMap, &m_aCurrentMapSha256[SIX], m_aCurrentMapCrc[SIX], "server", m_aCurrentMapSize[SIX], m_apCurrentMapData[SIX]);
 	}
 }
@@ -3065,11 +3067,12 @@ void CServer::StopRecord(int ClientID)
 {
 	if(IsRecording(ClientID))
 	{
+		m_DemoQueue.Flush();
 		m_aDemoRecorder[ClientID].Stop();
 
 		char aFilename[128];
 		str_format(aFilename, sizeof(aFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
-		Storage()->RemoveFile(aFilename, IStorage::TYPE_SAVE);
+		DemoRemove(Storage(), aFilename, IStorage::TYPE_SAVE);
 	}
 }
 
@@ -3091,12 +3094,15 @@ void CServer::ConRecord(IConsole::IResult *pResult, void *pUser)
 		str_timestamp(aDate, sizeof(aDate));
 		str_format(aFilename, sizeof(aFilename), "demos/demo_%s.demo", aDate);
 	}
+	pServer->m_DemoQueue.Flush();
 	pServer->m_aDemoRecorder[MAX_CLIENTS].Start(pServer->Storage(), pServer->Console(), aFilename, pServer->GameServer()->NetVersion(), pServer->m_aCurrentMap, &pServer->m_aCurrentMapSha256[SIX], pServer->m_aCurrentMapCrc[SIX], "server", pServer->m_aCurrentMapSize[SIX], pServer->m_apCurrentMapData[SIX]);
 }
 
 void CServer::ConStopRecord(IConsole::IResult *pResult, void *pUser)
 {
-	((CServer *)pUser)->m_aDemoRecorder[MAX_CLIENTS].Stop();
+	CServer *pServer = (CServer *)pUser;
+	pServer->m_DemoQueue.Flush();
+	pServer->m_aDemoRecorder[MAX_CLIENTS].Stop();
 }
 
 void CServer::ConMapReload(IConsole::IResult *pResult, void *pUser)
@@ -3196,6 +3202,12 @@ void CServer::ConDumpSqlServers(IConsole::IResult *pResult, void *pUserData)
 	}
 }
 
+void CServer::ConSqlStats(IConsole::IResult *pResult, void *pUserData)
+{
+	CServer *pSelf = (CServer *)pUserData;
+	pSelf->DbPool()->PrintStats(pSelf->Console());
+}
+
 void CServer::ConchainSpecialInfoupdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData)
 {
 	pfnCallback(pResult, pCallbackUserData);
@@ -3398,6 +3410,7 @@ void CServer::RegisterCommands()
 
 	Console()->Register("add_sqlserver", "s['r'|'w'] s[Database] s[Prefix] s[User] s[Password] s[IP] i[Port] ?i[SetUpDatabase ?]", CFGFLAG_SERVER | CFGFLAG_NONTEEHISTORIC, ConAddSqlServer, this, "add a sqlserver");
 	Console()->Register("dump_sqlservers", "s['r'|'w']", CFGFLAG_SERVER, ConDumpSqlServers, this, "dumps all sqlservers readservers = r, writeservers = w");
+	Console()->Register("sql_stats", "", CFGFLAG_SERVER, ConSqlStats, this, "Shows queue depth, latency and overflows of the database workers");
 
 	Console()->Register("auth_add", "s[ident] s[level] r[pw]", CFGFLAG_SERVER | CFGFLAG_NONTEEHISTORIC, ConAuthAdd, this, "Add a rcon key");
 	Console()->Register("auth_add_p", "s[ident] s[level] s[hash] s[salt]", CFGFLAG_SERVER | CFGFLAG_NONTEEHISTORIC, ConAuthAddHashed, this, "Add a prehashed rcon key");
@@ -3453,6 +3466,9 @@ void *CServer::SnapNewItem(int Type, int ID, int Size)
 void CServer::SnapSetStaticsize(int ItemType, int Size)
 {
 	m_SnapshotDelta.SetStaticsize(ItemType, Size);
+	// demos are always recorded with the 0.6 sizes, see `DoSnapshot`
+	if(ItemType != protocol7::NETEVENTTYPE_SOUNDWORLD && ItemType != protocol7::NETEVENTTYPE_DAMAGE)
+		m_DemoSnapshotDelta.SetStaticsize(ItemType, Size);
 }
 
 static CServer *CreateServer() { return new CServer(); }
@@ -27,6 +27,7 @@
 
 #include "antibot.h"
 #include "authmanager.h"
+#include "demo_queue.h"
 #include "name_ban.h"
 
 #if defined(CONF_UPNP)
@@ -198,6 +199,8 @@ public:
 	int IdMap[MAX_CLIENTS * VANILLA_MAX_CLIENTS];
 
 	CSnapshotDelta m_SnapshotDelta;
+	// `m_SnapshotDelta` is changed per client while the demo thread deltas
+	CSnapshotDelta m_DemoSnapshotDelta;
 	CSnapshotBuilder m_SnapshotBuilder;
 	CSnapIDPool m_IDPool;
 	CNetServer m_NetServer;
@@ -243,6 +246,7 @@ public:
 	unsigned int m_aCurrentMapSize[2];
 
 	CDemoRecorder m_aDemoRecorder[MAX_CLIENTS + 1];
+	CDemoRecordQueue m_DemoQueue;
 	CRegister m_Register;
 	CRegister m_RegSixup;
 	CAuthManager m_AuthManager;
@@ -254,7 +258,7 @@ public:
 
 	char m_aErrorShutdownReason[128];
 
-	array<CNameBan> m_aNameBans;
+	CNameBans m_NameBans;
 
 	CServer();
 
@@ -393,6 +397,7 @@ public:
 	// console commands for sqlmasters
 	static void ConAddSqlServer(IConsole::IResult *pResult, void *pUserData);
 	static void ConDumpSqlServers(IConsole::IResult *pResult, void *pUserData);
+	static void ConSqlStats(IConsole::IResult *pResult, void *pUserData);
 
 	static void ConchainSpecialInfoupdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainMaxclientsperipUpdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
@@ -13,6 +13,8 @@ MACRO_CONFIG_STR(Password, password, 32, "", CFGFLAG_CLIENT | CFGFLAG_SERVER | C
 MACRO_CONFIG_STR(Logfile, logfile, 128, "", CFGFLAG_SAVE | CFGFLAG_CLIENT | CFGFLAG_SERVER, "Filename to log all output to")
 MACRO_CONFIG_INT(ConsoleOutputLevel, console_output_level, 0, 0, 2, CFGFLAG_CLIENT | CFGFLAG_SERVER, "Adjusts the amount of information in the console")
 MACRO_CONFIG_INT(Events, events, 1, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT | CFGFLAG_SERVER, "Enable triggering of events, like the happy eye emotes on some holidays.")
+MACRO_CONFIG_INT(DemoKeyframeInterval, demo_keyframe_interval, 250, 10, 3000, CFGFLAG_SAVE | CFGFLAG_CLIENT | CFGFLAG_SERVER, "Ticks between keyframes in recorded demos, lower values make seeking faster but demos larger")
+MACRO_CONFIG_INT(DemoIndex, demo_index, 1, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT | CFGFLAG_SERVER, "Write a seek index next to recorded demos")
 
 MACRO_CONFIG_STR(SteamName, steam_name, 16, "", CFGFLAG_SAVE | CFGFLAG_CLIENT, "Last seen name of the Steam profile")
 
@@ -120,6 +122,8 @@ MACRO_CONFIG_INT(GfxRefreshRate, gfx_refresh_rate, 0, 0, 10000, CFGFLAG_SAVE | C
 MACRO_CONFIG_INT(GfxFinish, gfx_finish, 0, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT, "")
 MACRO_CONFIG_INT(GfxBackgroundRender, gfx_backgroundrender, 1, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Render graphics when window is in background")
 MACRO_CONFIG_INT(GfxTextOverlay, gfx_text_overlay, 10, 1, 100, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Stop rendering textoverlay in editor or with entities: high value = less details = more speed")
+MACRO_CONFIG_INT(GfxTextAsync, gfx_text_async, 1, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Rasterize new glyphs in the background, they appear a few frames later (needs a restart)")
+MACRO_CONFIG_STR(GfxTextPrewarm, gfx_text_prewarm, 128, "20-7e,a0-ff", CFGFLAG_SAVE | CFGFLAG_CLIENT, "Character ranges in hex that are rasterized in the background when a font size is used first")
 MACRO_CONFIG_INT(GfxAsyncRenderOld, gfx_asyncrender_old, 1, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Do rendering async from the the update")
 MACRO_CONFIG_INT(GfxTuneOverlay, gfx_tune_overlay, 20, 1, 100, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Stop rendering text overlay in tuning zone in editor: high value = less details = more speed")
 MACRO_CONFIG_INT(GfxQuadAsTriangle, gfx_quad_as_triangle, 0, 0, 1, CFGFLAG_SAVE | CFGFLAG_CLIENT, "Render quads as triangles (fixes quad coloring on some GPUs)")
@@ -148,6 +152,12 @@ MACRO_CONFIG_INT(SvRconBantime, sv_rcon_bantime, 5, 0, 1440, CFGFLAG_SERVER, "Th
 MACRO_CONFIG_INT(SvAutoDemoRecord, sv_auto_demo_record, 0, 0, 1, CFGFLAG_SERVER, "Automatically record demos")
 MACRO_CONFIG_INT(SvAutoDemoMax, sv_auto_demo_max, 10, 0, 1000, CFGFLAG_SERVER, "Maximum number of automatically recorded demos (0 = no limit)")
 MACRO_CONFIG_INT(SvTeeHistorian, sv_tee_historian, 0, 0, 1, CFGFLAG_SERVER, "Activate the tee historian that writes complete gameplay data to disk (WARNING: This will use a lot of disk space)")
+MACRO_CONFIG_INT(SvTeeHistorianCompression, sv_tee_historian_compression, 0, 0, 1, CFGFLAG_SERVER, "Compress the tee historian output (0 = none, 1 = gzip)")
+MACRO_CONFIG_INT(SvTeeHistorianCompressionLevel, sv_tee_historian_compression_level, 6, 1, 9, CFGFLAG_SERVER, "Compression level for the tee historian output (1 = fastest, 9 = smallest)")
+MACRO_CONFIG_INT(SvTeeHistorianRotateSize, sv_tee_historian_rotate_size, 0, 0, 100000, CFGFLAG_SERVER, "Start a new tee historian file after this many MiB of uncompressed data (0 = never)")
+MACRO_CONFIG_INT(SvTeeHistorianRotateTime, sv_tee_historian_rotate_time, 0, 0, 10080, CFGFLAG_SERVER, "Start a new tee historian file after this many minutes (0 = never)")
+MACRO_CONFIG_INT(SvTeeHistorianBufferSize, sv_tee_historian_buffer_size, 0, 0, 1048576, CFGFLAG_SERVER, "Maximum KiB of tee historian data waiting to be written, the recording is truncated when exceeded (0 = unlimited)")
+MACRO_CONFIG_INT(SvTeeHistorianIndexInterval, sv_tee_historian_index_interval, 0, 0, 1000000, CFGFLAG_SERVER, "Write a seek index entry for the tee historian every this many ticks (0 = no index)")
 MACRO_CONFIG_INT(SvVanillaAntiSpoof, sv_vanilla_antispoof, 0, 0, 1, CFGFLAG_SERVER, "Enable vanilla Antispoof")
 MACRO_CONFIG_INT(SvDnsbl, sv_dnsbl, 0, 0, 1, CFGFLAG_SERVER, "Enable DNSBL (DNS-based Blackhole List)")
 MACRO_CONFIG_STR(SvDnsblHost, sv_dnsbl_host, 128, "", CFGFLAG_SERVER, "Hostname of DNSBL provider to use for IP Verification")
@@ -158,6 +168,7 @@ MACRO_CONFIG_INT(SvRconVote, sv_rcon_vote, 0, 0, 1, CFGFLAG_SERVER, "Only allow
 
 MACRO_CONFIG_INT(SvPlayerDemoRecord, sv_player_demo_record, 0, 0, 1, CFGFLAG_SERVER, "Automatically record demos for each player")
 MACRO_CONFIG_INT(SvDemoChat, sv_demo_chat, 0, 0, 1, CFGFLAG_SERVER, "Record chat for demos")
+MACRO_CONFIG_INT(SvDemoQueueSize, sv_demo_queue_size, 128, 0, 4096, CFGFLAG_SERVER, "Maximum number of snapshots and messages waiting to be written to demos (0 = record on the server thread)")
 MACRO_CONFIG_INT(SvServerInfoPerSecond, sv_server_info_per_second, 50, 0, 10000, CFGFLAG_SERVER, "Maximum number of complete server info responses that are sent out per second (0 for no limit)")
 MACRO_CONFIG_INT(SvVanConnPerSecond, sv_van_conn_per_second, 10, 0, 10000, CFGFLAG_SERVER, "Antispoof specific ratelimit (0 for no limit)")
 MACRO_CONFIG_INT(SvSixup, sv_sixup, 1, 0, 1, CFGFLAG_SERVER, "Enable sixup connections")
@@ -231,9 +242,21 @@ MACRO_CONFIG_STR(SvRegionName, sv_region_name, 5, "UNK", CFGFLAG_SERVER, "Server
 MACRO_CONFIG_STR(SvSqlServerName, sv_sql_servername, 5, "UNK", CFGFLAG_SERVER, "SQL Server name that is inserted into record table")
 MACRO_CONFIG_INT(SvSaveGames, sv_savegames, 1, 0, 1, CFGFLAG_SERVER, "Enables savegames (/save and /load)")
 MACRO_CONFIG_INT(SvSaveGamesDelay, sv_savegames_delay, 60, 0, 10000, CFGFLAG_SERVER, "Delay in seconds for loading a savegame")
+MACRO_CONFIG_INT(SvSaveGamesCompact, sv_savegames_compact, 0, 0, 1, CFGFLAG_SERVER, "Store savegames in the compact format (servers before it was added can't load them)")
 MACRO_CONFIG_INT(SvUseSQL, sv_use_sql, 0, 0, 1, CFGFLAG_SERVER, "Enables MySQL backend instead of SQLite backend (sv_sqlite_file is still used as fallback write server when no MySQL server is reachable)")
 MACRO_CONFIG_INT(SvSqlQueriesDelay, sv_sql_queries_delay, 1, 0, 20, CFGFLAG_SERVER, "Delay in seconds between SQL queries of a single player")
+MACRO_CONFIG_INT(SvSqlReadWorkers, sv_sql_read_workers, 2, 1, 16, CFGFLAG_SERVER, "Number of threads running database reads (only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqlWriteWorkers, sv_sql_write_workers, 1, 1, 16, CFGFLAG_SERVER, "Number of threads running database writes, more than one can reorder writes (only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqlQueueSize, sv_sql_queue_size, 512, 16, 65536, CFGFLAG_SERVER, "Maximum number of queued database reads and writes each, further reads are rejected")
+MACRO_CONFIG_INT(SvSqlWriteBatch, sv_sql_write_batch, 50, 0, 1000, CFGFLAG_SERVER, "Milliseconds to collect finishes that are then saved in one transaction (0 to save each on its own, only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqlStatementCache, sv_sql_statement_cache, 32, 0, 1024, CFGFLAG_SERVER, "Prepared statements kept per database connection (0 to prepare each query anew, only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqlPlayerDataBatch, sv_sql_player_data_batch, 250, 0, 5000, CFGFLAG_SERVER, "Milliseconds to collect joining players whose data is then loaded with one query (0 to load each player on its own)")
+MACRO_CONFIG_INT(SvRankCache, sv_rank_cache, 1, 0, 1, CFGFLAG_SERVER, "Answer /rank, /top5, /points and /toppoints from an in-memory copy of the leaderboards")
+MACRO_CONFIG_INT(SvRankCacheRefresh, sv_rank_cache_refresh, 300, 0, 86400, CFGFLAG_SERVER, "Seconds between reloads of the cached leaderboards from the database (0 to only load them at map start)")
 MACRO_CONFIG_STR(SvSqliteFile, sv_sqlite_file, 64, "ddnet-server.sqlite", CFGFLAG_SERVER, "File to store ranks in case sv_use_sql is turned off or used as backup sql server")
+MACRO_CONFIG_INT(SvSqliteWal, sv_sqlite_wal, 0, 0, 1, CFGFLAG_SERVER, "Use write-ahead logging for the SQLite database, reads then use read-only connections that don't wait for writes (only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqliteSynchronous, sv_sqlite_synchronous, 2, 0, 3, CFGFLAG_SERVER, "How often SQLite syncs to disk: 0 = off, 1 = normal, 2 = full, 3 = extra (only has an effect at startup)")
+MACRO_CONFIG_INT(SvSqliteWalCheckpoint, sv_sqlite_wal_checkpoint, 1000, 0, 1000000, CFGFLAG_SERVER, "Pages in the SQLite write-ahead log before it is checkpointed into the database, 0 to never checkpoint automatically (only has an effect at startup)")
 
 #if defined(CONF_UPNP)
 MACRO_CONFIG_INT(SvUseUPnP, sv_use_upnp, 0, 0, 1, CFGFLAG_SERVER, "Enables UPnP support.")
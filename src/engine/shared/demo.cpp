@@ -14,6 +14,8 @@
 
 #include <game/generated/protocol.h>
 
+#include <zlib.h>
+
 #include "compression.h"
 #include "demo.h"
 #include "memheap.h"
@@ -28,9 +30,149 @@ static const unsigned char gs_VersionTickCompression = 5; // demo files with thi
 static const int gs_LengthOffset = 152;
 static const int gs_NumMarkersOffset = 176;
 
+static const unsigned char gs_aIndexMarker[8] = {'T', 'W', 'D', 'E', 'M', 'O', 'I', 'X'};
+static const unsigned char gs_IndexVersion = 2;
+static const int gs_IndexHeaderSize = sizeof(gs_aIndexMarker) + 1 + 8 + 4 + 4 + 4 + 4;
+static const int gs_IndexEntrySize = 8 + 4;
+static const int gs_IndexChecksumSize = 4096;
+
+static void WriteBigEndian(unsigned char *pBuf, int64 Value, int Size)
+{
+	for(int i = 0; i < Size; i++)
+		pBuf[i] = (Value >> ((Size - 1 - i) * 8)) & 0xff;
+}
+
+static int64 ReadBigEndian(const unsigned char *pBuf, int Size)
+{
+	uint64 Value = 0;
+	for(int i = 0; i < Size; i++)
+		Value = (Value << 8) | pBuf[i];
+	// sign extend
+	if(Size < 8 && (pBuf[0] & 0x80))
+		Value |= ~(uint64)0 << (Size * 8);
+	return (int64)Value;
+}
+
+void DemoIndexFilename(const char *pDemoFilename, char *pBuffer, int BufferSize)
+{
+	str_format(pBuffer, BufferSize, "%s.idx", pDemoFilename);
+}
+
+/*
+	Index
+		8	= Marker
+		1	= Version
+		8	= Size of the demo file
+		4	= Checksum of the demo file, see `DemoChecksum`
+		4	= First tick
+		4	= Last tick
+		4	= Number of keyframes
+		12	= Per keyframe: file position (8), tick (4)
+
+	All integers are big endian like in the demo itself.
+*/
+// crc32 of the first and last few KiB of the demo. The start covers the
+// header with the length and timeline markers that are only written when
+// recording stops, the end covers the last chunks.
+static unsigned DemoChecksum(IOHANDLE File, long DemoSize)
+{
+	long StartPos = io_tell(File);
+	unsigned char aBuf[gs_IndexChecksumSize];
+	unsigned Crc = crc32(0, 0, 0);
+
+	io_seek(File, 0, IOSEEK_START);
+	unsigned HeadSize = io_read(File, aBuf, minimum(DemoSize, (long)sizeof(aBuf)));
+	Crc = crc32(Crc, aBuf, HeadSize);
+	if(DemoSize > (long)HeadSize)
+	{
+		long TailSize = minimum(DemoSize - (long)HeadSize, (long)sizeof(aBuf));
+		io_seek(File, DemoSize - TailSize, IOSEEK_START);
+		Crc = crc32(Crc, aBuf, io_read(File, aBuf, TailSize));
+	}
+
+	io_seek(File, StartPos, IOSEEK_START);
+	return Crc;
+}
+
+// most demos don't have an index, check first so that removing or
+// renaming it doesn't log failures
+static bool IndexExists(IStorage *pStorage, const char *pIndexFilename, int StorageType)
+{
+	IOHANDLE File = pStorage->OpenFile(pIndexFilename, IOFLAG_READ, StorageType);
+	if(!File)
+		return false;
+	io_close(File);
+	return true;
+}
+
+bool DemoRemove(IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	char aIndexFilename[512];
+	DemoIndexFilename(pFilename, aIndexFilename, sizeof(aIndexFilename));
+	if(IndexExists(pStorage, aIndexFilename, StorageType))
+		pStorage->RemoveFile(aIndexFilename, StorageType);
+	return pStorage->RemoveFile(pFilename, StorageType);
+}
+
+bool DemoRename(IStorage *pStorage, const char *pOldFilename, const char *pNewFilename, int StorageType)
+{
+	if(!pStorage->RenameFile(pOldFilename, pNewFilename, StorageType))
+		return false;
+	char aOldIndexFilename[512];
+	char aNewIndexFilename[512];
+	DemoIndexFilename(pOldFilename, aOldIndexFilename, sizeof(aOldIndexFilename));
+	DemoIndexFilename(pNewFilename, aNewIndexFilename, sizeof(aNewIndexFilename));
+	if(IndexExists(pStorage, aNewIndexFilename, StorageType))
+		pStorage->RemoveFile(aNewIndexFilename, StorageType);
+	if(IndexExists(pStorage, aOldIndexFilename, StorageType))
+		pStorage->RenameFile(aOldIndexFilename, aNewIndexFilename, StorageType);
+	return true;
+}
+
+bool DemoIndexSave(IStorage *pStorage, const char *pDemoFilename, int FirstTick, int LastTick, const CDemoKeyFrame *pKeyFrames, int NumKeyFrames)
+{
+	IOHANDLE DemoFile = pStorage->OpenFile(pDemoFilename, IOFLAG_READ, IStorage::TYPE_SAVE);
+	if(!DemoFile)
+		return false;
+	long DemoSize = io_length(DemoFile);
+	unsigned Checksum = DemoChecksum(DemoFile, DemoSize);
+	io_close(DemoFile);
+
+	char aFilename[512];
+	DemoIndexFilename(pDemoFilename, aFilename, sizeof(aFilename));
+
+	std::vector<unsigned char> vData(gs_IndexHeaderSize + NumKeyFrames * gs_IndexEntrySize);
+	unsigned char *pData = vData.data();
+	mem_copy(pData, gs_aIndexMarker, sizeof(gs_aIndexMarker));
+	pData += sizeof(gs_aIndexMarker);
+	*pData++ = gs_IndexVersion;
+	WriteBigEndian(pData, DemoSize, 8);
+	WriteBigEndian(pData + 8, Checksum, 4);
+	WriteBigEndian(pData + 12, FirstTick, 4);
+	WriteBigEndian(pData + 16, LastTick, 4);
+	WriteBigEndian(pData + 20, NumKeyFrames, 4);
+	pData += 24;
+	for(int i = 0; i < NumKeyFrames; i++)
+	{
+		WriteBigEndian(pData, pKeyFrames[i].m_Filepos, 8);
+		WriteBigEndian(pData + 8, pKeyFrames[i].m_Tick, 4);
+		pData += gs_IndexEntrySize;
+	}
+
+	IOHANDLE File = pStorage->OpenFile(aFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
+	if(!File)
+		return false;
+	bool Success = io_write(File, vData.data(), vData.size()) == vData.size();
+	Success = io_close(File) == 0 && Success;
+	if(!Success)
+		pStorage->RemoveFile(aFilename, IStorage::TYPE_SAVE);
+	return Success;
+}
+
 CDemoRecorder::CDemoRecorder(class CSnapshotDelta *pSnapshotDelta, bool NoMapData)
 {
 	m_File = 0;
+	m_pStorage = 0;
 	m_aCurrentFilename[0] = '\0';
 	m_pfnFilter = 0;
 	m_pUser = 0;
@@ -47,6 +189,7 @@ int CDemoRecorder::Start(class IStorage *pStorage, class IConsole *pConsole, con
 
 	m_pMapData = pMapData;
 	m_pConsole = pConsole;
+	m_pStorage = pStorage;
 
 	IOHANDLE DemoFile = pStorage->OpenFile(pFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
 	if(!DemoFile)
@@ -171,10 +314,18 @@ int CDemoRecorder::Start(class IStorage *pStorage, class IConsole *pConsole, con
 	}
 
 	m_LastKeyFrame = -1;
+	m_KeyFrameInterval = g_Config.m_DemoKeyframeInterval;
+	m_vKeyFrames.clear();
 	m_LastTickMarker = -1;
 	m_FirstTick = -1;
 	m_NumTimelineMarkers = 0;
 
+	// an index of a previous demo with the same name would be outdated
+	char aIndexFilename[512];
+	DemoIndexFilename(pFilename, aIndexFilename, sizeof(aIndexFilename));
+	if(IndexExists(pStorage, aIndexFilename, IStorage::TYPE_SAVE))
+		pStorage->RemoveFile(aIndexFilename, IStorage::TYPE_SAVE);
+
 	if(m_pConsole)
 	{
 		char aBuf[256];
@@ -298,8 +449,14 @@ void CDemoRecorder::Write(int Type, const void *pData, int Size)
 
 void CDemoRecorder::RecordSnapshot(int Tick, const void *pData, int Size)
 {
-	if(m_LastKeyFrame == -1 || (Tick - m_LastKeyFrame) > SERVER_TICK_SPEED * 5)
+	if(m_LastKeyFrame == -1 || (Tick - m_LastKeyFrame) > m_KeyFrameInterval)
 	{
+		// remember the position for the seek index
+		CDemoKeyFrame KeyFrame;
+		KeyFrame.m_Filepos = io_tell(m_File);
+		KeyFrame.m_Tick = Tick;
+		m_vKeyFrames.push_back(KeyFrame);
+
 		// write full tickmarker
 		WriteTickMarker(Tick, 1);
 
@@ -379,6 +536,10 @@ int CDemoRecorder::Stop()
 	if(m_pConsole)
 		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", "Stopped recording");
 
+	if(g_Config.m_DemoIndex && !m_vKeyFrames.empty())
+		DemoIndexSave(m_pStorage, m_aCurrentFilename, m_FirstTick, m_LastTickMarker, m_vKeyFrames.data(), m_vKeyFrames.size());
+	m_vKeyFrames.clear();
+
 	return 0;
 }
 
@@ -540,11 +701,56 @@ void CDemoPlayer::ScanFile()
 	io_seek(m_File, StartPos, IOSEEK_START);
 }
 
+bool CDemoPlayer::LoadIndex(IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	char aIndexFilename[512];
+	DemoIndexFilename(pFilename, aIndexFilename, sizeof(aIndexFilename));
+	IOHANDLE File = pStorage->OpenFile(aIndexFilename, IOFLAG_READ, StorageType);
+	if(!File)
+		return false;
+
+	long StartPos = io_tell(m_File);
+	long DemoSize = io_length(m_File);
+	io_seek(m_File, StartPos, IOSEEK_START);
+
+	unsigned char aHeader[gs_IndexHeaderSize];
+	if(io_read(File, aHeader, sizeof(aHeader)) != sizeof(aHeader) ||
+		mem_comp(aHeader, gs_aIndexMarker, sizeof(gs_aIndexMarker)) != 0 ||
+		aHeader[sizeof(gs_aIndexMarker)] != gs_IndexVersion)
+	{
+		io_close(File);
+		return false;
+	}
+	const unsigned char *pHeader = aHeader + sizeof(gs_aIndexMarker) + 1;
+	int NumKeyFrames = ReadBigEndian(pHeader + 20, 4);
+	if(ReadBigEndian(pHeader, 8) != DemoSize || NumKeyFrames <= 0 || NumKeyFrames > DemoSize / 5 ||
+		(unsigned)ReadBigEndian(pHeader + 8, 4) != DemoChecksum(m_File, DemoSize))
+	{
+		io_close(File);
+		return false;
+	}
+
+	std::vector<unsigned char> vData(NumKeyFrames * gs_IndexEntrySize);
+	bool Success = io_read(File, vData.data(), vData.size()) == vData.size();
+	io_close(File);
+	if(!Success)
+		return false;
+
+	m_pKeyFrames = (CKeyFrame *)calloc(NumKeyFrames, sizeof(CKeyFrame));
+	for(int i = 0; i < NumKeyFrames; i++)
+	{
+		const unsigned char *pEntry = vData.data() + i * gs_IndexEntrySize;
+		m_pKeyFrames[i].m_Filepos = ReadBigEndian(pEntry, 8);
+		m_pKeyFrames[i].m_Tick = ReadBigEndian(pEntry + 8, 4);
+	}
+	m_Info.m_SeekablePoints = NumKeyFrames;
+	m_Info.m_Info.m_FirstTick = ReadBigEndian(pHeader + 12, 4);
+	m_Info.m_Info.m_LastTick = ReadBigEndian(pHeader + 16, 4);
+	return true;
+}
+
 void CDemoPlayer::DoTick()
 {
-	static char aCompresseddata[CSnapshot::MAX_SIZE];
-	static char aDecompressed[CSnapshot::MAX_SIZE];
-	static char aData[CSnapshot::MAX_SIZE];
 	int ChunkType, ChunkTick, ChunkSize;
 	int DataSize = 0;
 	int GotSnapshot = 0;
@@ -579,7 +785,7 @@ void CDemoPlayer::DoTick()
 		// read the chunk
 		if(ChunkSize)
 		{
-			if(io_read(m_File, aCompresseddata, ChunkSize) != (unsigned)ChunkSize)
+			if(io_read(m_File, m_aCompressedData, ChunkSize) != (unsigned)ChunkSize)
 			{
 				// stop on error or eof
 				if(m_pConsole)
@@ -588,7 +794,7 @@ void CDemoPlayer::DoTick()
 				break;
 			}
 
-			DataSize = CNetBase::Decompress(aCompresseddata, ChunkSize, aDecompressed, sizeof(aDecompressed));
+			DataSize = CNetBase::Decompress(m_aCompressedData, ChunkSize, m_aDecompressedData, sizeof(m_aDecompressedData));
 			if(DataSize < 0)
 			{
 				// stop on error or eof
@@ -598,7 +804,7 @@ void CDemoPlayer::DoTick()
 				break;
 			}
 
-			DataSize = CVariableInt::Decompress(aDecompressed, DataSize, aData, sizeof(aData));
+			DataSize = CVariableInt::Decompress(m_aDecompressedData, DataSize, m_aChunkData, sizeof(m_aChunkData));
 
 			if(DataSize < 0)
 			{
@@ -612,19 +818,17 @@ void CDemoPlayer::DoTick()
 		if(ChunkType == CHUNKTYPE_DELTA)
 		{
 			// process delta snapshot
-			static char aNewsnap[CSnapshot::MAX_SIZE];
-
 			GotSnapshot = 1;
 
-			DataSize = m_pSnapshotDelta->UnpackDelta((CSnapshot *)m_aLastSnapshotData, (CSnapshot *)aNewsnap, aData, DataSize);
+			DataSize = m_pSnapshotDelta->UnpackDelta((CSnapshot *)m_aLastSnapshotData, (CSnapshot *)m_aNewSnapshotData, m_aChunkData, DataSize);
 
 			if(DataSize >= 0)
 			{
 				if(m_pListener)
-					m_pListener->OnDemoPlayerSnapshot(aNewsnap, DataSize);
+					m_pListener->OnDemoPlayerSnapshot(m_aNewSnapshotData, DataSize);
 
 				m_LastSnapshotDataSize = DataSize;
-				mem_copy(m_aLastSnapshotData, aNewsnap, DataSize);
+				mem_copy(m_aLastSnapshotData, m_aNewSnapshotData, DataSize);
 			}
 			else
 			{
@@ -642,9 +846,9 @@ void CDemoPlayer::DoTick()
 			GotSnapshot = 1;
 
 			m_LastSnapshotDataSize = DataSize;
-			mem_copy(m_aLastSnapshotData, aData, DataSize);
+			mem_copy(m_aLastSnapshotData, m_aChunkData, DataSize);
 			if(m_pListener)
-				m_pListener->OnDemoPlayerSnapshot(aData, DataSize);
+				m_pListener->OnDemoPlayerSnapshot(m_aChunkData, DataSize);
 		}
 		else
 		{
@@ -664,7 +868,7 @@ void CDemoPlayer::DoTick()
 			else if(ChunkType == CHUNKTYPE_MESSAGE)
 			{
 				if(m_pListener)
-					m_pListener->OnDemoPlayerMessage(aData, DataSize);
+					m_pListener->OnDemoPlayerMessage(m_aChunkData, DataSize);
 			}
 		}
 	}
@@ -810,29 +1014,39 @@ int CDemoPlayer::Load(class IStorage *pStorage, class IConsole *pConsole, const
 		}
 	}
 
-	// scan the file for interesting points
-	ScanFile();
-
-	// reset slice markers
-	g_Config.m_ClDemoSliceBegin = -1;
-	g_Config.m_ClDemoSliceEnd = -1;
+	// scan the file for interesting points, unless there is an up to date
+	// seek index
+	if(!LoadIndex(pStorage, pFilename, StorageType))
+		ScanFile();
 
 	// ready for playback
 	return 0;
 }
 
-bool CDemoPlayer::ExtractMap(class IStorage *pStorage)
+unsigned char *CDemoPlayer::GetMapData()
 {
 	if(!m_MapInfo.m_Size)
-		return false;
+		return 0;
 
 	long CurSeek = io_tell(m_File);
 
-	// get map data
 	io_seek(m_File, m_MapOffset, IOSEEK_START);
 	unsigned char *pMapData = (unsigned char *)malloc(m_MapInfo.m_Size);
-	io_read(m_File, pMapData, m_MapInfo.m_Size);
+	if(io_read(m_File, pMapData, m_MapInfo.m_Size) != (unsigned)m_MapInfo.m_Size)
+	{
+		free(pMapData);
+		pMapData = 0;
+	}
 	io_seek(m_File, CurSeek, IOSEEK_START);
+	return pMapData;
+}
+
+bool CDemoPlayer::ExtractMap(class IStorage *pStorage)
+{
+	// get map data
+	unsigned char *pMapData = GetMapData();
+	if(!pMapData)
+		return false;
 
 	// handle sha256
 	SHA256_DIGEST Sha256 = SHA256_ZEROED;
@@ -852,7 +1066,10 @@ bool CDemoPlayer::ExtractMap(class IStorage *pStorage)
 	// save map
 	IOHANDLE MapFile = pStorage->OpenFile(aMapFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
 	if(!MapFile)
+	{
+		free(pMapData);
 		return false;
+	}
 
 	io_write(MapFile, pMapData, m_MapInfo.m_Size);
 	io_close(MapFile);
@@ -923,6 +1140,30 @@ int CDemoPlayer::SeekTime(float Seconds)
 	return SetPos(WantedTick);
 }
 
+int CDemoPlayer::FindKeyFrame(int WantedTick) const
+{
+	// the last key frame not after the wanted tick
+	int Low = 0;
+	int High = m_Info.m_SeekablePoints - 1;
+	while(Low < High)
+	{
+		int Mid = (Low + High + 1) / 2;
+		if(m_pKeyFrames[Mid].m_Tick > WantedTick)
+			High = Mid - 1;
+		else
+			Low = Mid;
+	}
+	return Low;
+}
+
+int CDemoPlayer::KeyFrameTick(int WantedTick) const
+{
+	if(!m_File || m_Info.m_SeekablePoints <= 0)
+		return -1;
+	WantedTick = clamp(WantedTick, m_Info.m_Info.m_FirstTick, m_Info.m_Info.m_LastTick) - 5;
+	return m_pKeyFrames[FindKeyFrame(WantedTick)].m_Tick;
+}
+
 int CDemoPlayer::SetPos(int WantedTick)
 {
 	if(!m_File)
@@ -931,16 +1172,7 @@ int CDemoPlayer::SetPos(int WantedTick)
 	// -5 because we have to have a current tick and previous tick when we do the playback
 	WantedTick = clamp(WantedTick, m_Info.m_Info.m_FirstTick, m_Info.m_Info.m_LastTick) - 5;
 
-	// get correct key frame
-	int KeyFrame = 0;
-	while(KeyFrame < m_Info.m_SeekablePoints - 1 && m_pKeyFrames[KeyFrame].m_Tick < WantedTick)
-	{
-		KeyFrame++;
-	}
-	while(KeyFrame > 0 && m_pKeyFrames[KeyFrame].m_Tick > WantedTick)
-	{
-		KeyFrame--;
-	}
+	int KeyFrame = FindKeyFrame(WantedTick);
 
 	// seek to the correct key frame
 	io_seek(m_File, m_pKeyFrames[KeyFrame].m_Filepos, IOSEEK_START);
@@ -10,13 +10,34 @@
 
 #include "snapshot.h"
 
+#include <vector>
+
+struct CDemoKeyFrame
+{
+	long m_Filepos;
+	int m_Tick;
+};
+
+// Seek index written next to a recorded demo as `<demo>.idx`. Holds the
+// tick range and all keyframe positions, so the demo player doesn't have to
+// scan the whole file. Only used if the demo's size and checksum match the
+// ones in the index.
+void DemoIndexFilename(const char *pDemoFilename, char *pBuffer, int BufferSize);
+bool DemoIndexSave(class IStorage *pStorage, const char *pDemoFilename, int FirstTick, int LastTick, const CDemoKeyFrame *pKeyFrames, int NumKeyFrames);
+// Remove or rename a demo together with its seek index.
+bool DemoRemove(class IStorage *pStorage, const char *pFilename, int StorageType);
+bool DemoRename(class IStorage *pStorage, const char *pOldFilename, const char *pNewFilename, int StorageType);
+
 class CDemoRecorder : public IDemoRecorder
 {
 	class IConsole *m_pConsole;
+	class IStorage *m_pStorage;
 	IOHANDLE m_File;
 	char m_aCurrentFilename[256];
 	int m_LastTickMarker;
 	int m_LastKeyFrame;
+	int m_KeyFrameInterval;
+	std::vector<CDemoKeyFrame> m_vKeyFrames;
 	int m_FirstTick;
 	unsigned char m_aLastSnapshotData[CSnapshot::MAX_SIZE];
 	class CSnapshotDelta *m_pSnapshotDelta;
@@ -82,11 +103,7 @@ private:
 	IListener *m_pListener;
 
 	// Playback
-	struct CKeyFrame
-	{
-		long m_Filepos;
-		int m_Tick;
-	};
+	typedef CDemoKeyFrame CKeyFrame;
 
 	struct CKeyFrameSearch
 	{
@@ -108,10 +125,17 @@ private:
 	int m_LastSnapshotDataSize;
 	class CSnapshotDelta *m_pSnapshotDelta;
 
+	// decoding buffers, members so that several players can run in parallel
+	char m_aCompressedData[CSnapshot::MAX_SIZE];
+	char m_aDecompressedData[CSnapshot::MAX_SIZE];
+	char m_aChunkData[CSnapshot::MAX_SIZE];
+	char m_aNewSnapshotData[CSnapshot::MAX_SIZE];
+
 	int ReadChunkHeader(int *pType, int *pSize, int *pTick);
 	void DoTick();
 	void ScanFile();
-	int NextFrame();
+	bool LoadIndex(class IStorage *pStorage, const char *pFilename, int StorageType);
+	int FindKeyFrame(int WantedTick) const;
 
 	int64 time();
 
@@ -125,6 +149,8 @@ public:
 
 	int Load(class IStorage *pStorage, class IConsole *pConsole, const char *pFilename, int StorageType);
 	bool ExtractMap(class IStorage *pStorage);
+	// Returns the embedded map, to be freed with `free`, or 0 if there is none.
+	unsigned char *GetMapData();
 	int Play();
 	void Pause();
 	void Unpause();
@@ -134,6 +160,11 @@ public:
 	int SeekPercent(float Percent);
 	int SeekTime(float Seconds);
 	int SetPos(int WantedTick);
+	// Tick of the keyframe `SetPos(WantedTick)` starts decoding from.
+	int KeyFrameTick(int WantedTick) const;
+	// Decodes the next tick right away, independent of the playback time.
+	// Returns false once playback has stopped.
+	int NextFrame();
 	const CInfo *BaseInfo() const { return &m_Info.m_Info; }
 	void GetDemoName(char *pBuffer, int BufferSize) const;
 	bool GetDemoInfo(class IStorage *pStorage, const char *pFilename, int StorageType, CDemoHeader *pDemoHeader, CTimelineMarkers *pTimelineMarkers, CMapInfo *pMapInfo) const;
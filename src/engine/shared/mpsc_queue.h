@@ -0,0 +1,73 @@
+#ifndef ENGINE_SHARED_MPSC_QUEUE_H
+#define ENGINE_SHARED_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+// Lock-free queue with any number of producers and one consumer. Producers
+// push onto a linked stack, the consumer takes the whole stack at once and
+// reverses it, so checking an empty queue is a single atomic load.
+template<typename T>
+class CMpscQueue
+{
+	struct CNode
+	{
+		T m_Value;
+		CNode *m_pNext;
+	};
+
+	std::atomic<CNode *> m_pHead;
+
+	static void Free(CNode *pNode)
+	{
+		while(pNode)
+		{
+			CNode *pNext = pNode->m_pNext;
+			delete pNode;
+			pNode = pNext;
+		}
+	}
+
+public:
+	CMpscQueue() :
+		m_pHead(nullptr)
+	{
+	}
+	~CMpscQueue() { Free(m_pHead.load()); }
+	CMpscQueue(const CMpscQueue &) = delete;
+	CMpscQueue &operator=(const CMpscQueue &) = delete;
+
+	// can be called from any thread
+	void Push(T Value)
+	{
+		CNode *pNode = new CNode{std::move(Value), m_pHead.load(std::memory_order_relaxed)};
+		while(!m_pHead.compare_exchange_weak(pNode->m_pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	bool Empty() const { return m_pHead.load(std::memory_order_relaxed) == nullptr; }
+
+	// appends all queued values in the order they were pushed, only one
+	// thread may pop at a time
+	void PopAll(std::vector<T> *pvValues)
+	{
+		if(Empty())
+			return;
+		CNode *pNode = m_pHead.exchange(nullptr, std::memory_order_acquire);
+		CNode *pFirst = nullptr;
+		while(pNode)
+		{
+			CNode *pNext = pNode->m_pNext;
+			pNode->m_pNext = pFirst;
+			pFirst = pNode;
+			pNode = pNext;
+		}
+		for(CNode *p = pFirst; p; p = p->m_pNext)
+			pvValues->push_back(std::move(p->m_Value));
+		Free(pFirst);
+	}
+};
+
+#endif // ENGINE_SHARED_MPSC_QUEUE_H
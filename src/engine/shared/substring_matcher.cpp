@@ -0,0 +1,110 @@
+#include "substring_matcher.h"
+
+#include <base/math.h>
+#include <base/system.h>
+
+#include <algorithm>
+
+CSubstringMatcher::CSubstringMatcher() :
+	m_NumWords(0)
+{
+	Init({});
+}
+
+int CSubstringMatcher::Child(int Node, int Char) const
+{
+	const CNode &Parent = m_vNodes[Node];
+	auto pBegin = m_vEdges.begin() + Parent.m_FirstEdge;
+	auto pEnd = pBegin + Parent.m_NumEdges;
+	auto pEdge = std::lower_bound(pBegin, pEnd, Char, [](const CEdge &Edge, int Value) { return Edge.m_Char < Value; });
+	if(pEdge == pEnd || pEdge->m_Char != Char)
+		return -1;
+	return pEdge->m_Node;
+}
+
+void CSubstringMatcher::Init(const std::vector<CWord> &vWords)
+{
+	// build the trie with unsorted edges first
+	std::vector<std::vector<CEdge>> vvChildren(1);
+	std::vector<int> vValues(1, 0);
+	m_NumWords = 0;
+	for(const CWord &Word : vWords)
+	{
+		int Node = 0;
+		const char *pStr = Word.m_pWord;
+		int Char;
+		while((Char = str_utf8_decode(&pStr)))
+		{
+			Char = str_utf8_tolower(Char);
+			int Next = -1;
+			for(const CEdge &Edge : vvChildren[Node])
+			{
+				if(Edge.m_Char == Char)
+				{
+					Next = Edge.m_Node;
+					break;
+				}
+			}
+			if(Next < 0)
+			{
+				Next = vvChildren.size();
+				vvChildren[Node].push_back({Char, Next});
+				vvChildren.emplace_back();
+				vValues.push_back(0);
+			}
+			Node = Next;
+		}
+		if(Node == 0)
+			continue;
+		vValues[Node] = maximum(vValues[Node], Word.m_Value);
+		m_NumWords++;
+	}
+
+	m_vNodes.resize(vvChildren.size());
+	m_vEdges.clear();
+	for(unsigned i = 0; i < vvChildren.size(); i++)
+	{
+		std::sort(vvChildren[i].begin(), vvChildren[i].end(), [](const CEdge &a, const CEdge &b) { return a.m_Char < b.m_Char; });
+		m_vNodes[i].m_FirstEdge = m_vEdges.size();
+		m_vNodes[i].m_NumEdges = vvChildren[i].size();
+		m_vNodes[i].m_Fail = 0;
+		m_vNodes[i].m_Value = vValues[i];
+		m_vEdges.insert(m_vEdges.end(), vvChildren[i].begin(), vvChildren[i].end());
+	}
+
+	// fail links in breadth-first order, so the ones of shorter prefixes
+	// are known
+	std::vector<int> vQueue;
+	vQueue.reserve(m_vNodes.size());
+	vQueue.push_back(0);
+	for(unsigned i = 0; i < vQueue.size(); i++)
+	{
+		int Node = vQueue[i];
+		for(int e = 0; e < m_vNodes[Node].m_NumEdges; e++)
+		{
+			const CEdge &Edge = m_vEdges[m_vNodes[Node].m_FirstEdge + e];
+			int Fail = 0;
+			if(Node != 0)
+			{
+				int State = m_vNodes[Node].m_Fail;
+				int Next;
+				while((Next = Child(State, Edge.m_Char)) < 0 && State != 0)
+					State = m_vNodes[State].m_Fail;
+				Fail = maximum(Next, 0);
+			}
+			CNode &Target = m_vNodes[Edge.m_Node];
+			Target.m_Fail = Fail;
+			Target.m_Value = maximum(Target.m_Value, m_vNodes[Fail].m_Value);
+			vQueue.push_back(Edge.m_Node);
+		}
+	}
+}
+
+int CSubstringMatcher::Next(int State, int Char) const
+{
+	Char = str_utf8_tolower(Char);
+	int Next;
+	while((Next = Child(State, Char)) < 0 && State != 0)
+		State = m_vNodes[State].m_Fail;
+	return maximum(Next, 0);
+}
@@ -0,0 +1,57 @@
+#ifndef ENGINE_SHARED_SUBSTRING_MATCHER_H
+#define ENGINE_SHARED_SUBSTRING_MATCHER_H
+
+#include <vector>
+
+// Aho-Corasick automaton over the lowercase codepoints of a set of words,
+// so that a text is checked against all of them in one pass. Feed the
+// codepoints of the text to `Next` starting with state 0, `Value` is then
+// nonzero whenever a word ends at the current codepoint.
+class CSubstringMatcher
+{
+public:
+	struct CWord
+	{
+		const char *m_pWord;
+		// positive, the largest one is reported if several words end at
+		// the same codepoint
+		int m_Value;
+	};
+
+	CSubstringMatcher();
+
+	// replaces the words, empty ones are ignored
+	void Init(const std::vector<CWord> &vWords);
+	int NumWords() const { return m_NumWords; }
+
+	// state after reading the codepoint `Char`, matching is case insensitive
+	int Next(int State, int Char) const;
+	// largest value of the words ending in the state, 0 if there are none
+	int Value(int State) const { return m_vNodes[State].m_Value; }
+
+private:
+	struct CNode
+	{
+		int m_FirstEdge;
+		int m_NumEdges;
+		int m_Fail;
+		// including the words reached through the fail links
+		int m_Value;
+	};
+
+	struct CEdge
+	{
+		int m_Char;
+		int m_Node;
+	};
+
+	// returns -1 if there is no edge
+	int Child(int Node, int Char) const;
+
+	int m_NumWords;
+	std::vector<CNode> m_vNodes;
+	// edges of each node, sorted by character
+	std::vector<CEdge> m_vEdges;
+};
+
+#endif // ENGINE_SHARED_SUBSTRING_MATCHER_H
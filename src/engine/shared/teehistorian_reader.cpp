@@ -0,0 +1,687 @@
+#include "teehistorian_reader.h"
+
+#include <engine/shared/compression.h>
+#include <engine/shared/packer.h>
+
+#include <base/math.h>
+
+#include <algorithm>
+#include <zlib.h>
+
+static const CUuid TEEHISTORIAN_UUID = CalculateUuid("teehistorian@ddnet.tw");
+const CUuid TEEHISTORIAN_INDEX_UUID = CalculateUuid("teehistorian-index@ddnet.tw");
+
+static void WriteInt32(unsigned char *pBuf, int Value)
+{
+	for(int i = 0; i < 4; i++)
+		pBuf[i] = (Value >> (i * 8)) & 0xff;
+}
+
+static void WriteInt64(unsigned char *pBuf, int64 Value)
+{
+	for(int i = 0; i < 8; i++)
+		pBuf[i] = (Value >> (i * 8)) & 0xff;
+}
+
+static int ReadInt32(const unsigned char *pBuf)
+{
+	unsigned Value = 0;
+	for(int i = 0; i < 4; i++)
+		Value |= (unsigned)pBuf[i] << (i * 8);
+	return (int)Value;
+}
+
+static int64 ReadInt64(const unsigned char *pBuf)
+{
+	uint64 Value = 0;
+	for(int i = 0; i < 8; i++)
+		Value |= (uint64)pBuf[i] << (i * 8);
+	return (int64)Value;
+}
+
+// `io_seek` only takes an int offset, large parts need several steps
+static bool SeekLarge(IOHANDLE File, int64 Offset)
+{
+	if(io_seek(File, 0, IOSEEK_START) != 0)
+		return false;
+	while(Offset > 0)
+	{
+		int Step = minimum(Offset, (int64)1 << 30);
+		if(io_seek(File, Step, IOSEEK_CUR) != 0)
+			return false;
+		Offset -= Step;
+	}
+	return true;
+}
+
+void TeeHistorianIndexHeader(unsigned char *pBuf)
+{
+	mem_copy(pBuf, &TEEHISTORIAN_INDEX_UUID, sizeof(TEEHISTORIAN_INDEX_UUID));
+	WriteInt32(pBuf + 16, TEEHISTORIAN_INDEX_VERSION);
+}
+
+void TeeHistorianIndexEntryHeader(unsigned char *pBuf, int EntrySize, int Tick, int Part, int64 FileOffset, int64 StreamOffset)
+{
+	WriteInt32(pBuf, EntrySize);
+	WriteInt32(pBuf + 4, Tick);
+	WriteInt32(pBuf + 8, Part);
+	WriteInt64(pBuf + 12, FileOffset);
+	WriteInt64(pBuf + 20, StreamOffset);
+}
+
+void CTeeHistorianState::Reset()
+{
+	m_Tick = 0;
+	// Tick 0 is implicit at the start, the first player data starts tick 1.
+	m_LastClientID = MAX_CLIENTS;
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		m_aPlayers[i].m_Alive = false;
+		m_aPlayers[i].m_InputExists = false;
+	}
+}
+
+void CTeeHistorianState::Pack(std::vector<unsigned char> *pOut) const
+{
+	unsigned char aBuf[(3 + MAX_CLIENTS * (4 + INPUT_SIZE)) * 5];
+	unsigned char *pCur = aBuf;
+	pCur = CVariableInt::Pack(pCur, m_Tick);
+	pCur = CVariableInt::Pack(pCur, m_LastClientID);
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		const CPlayer *pPlayer = &m_aPlayers[i];
+		if(!pPlayer->m_Alive && !pPlayer->m_InputExists)
+			continue;
+		pCur = CVariableInt::Pack(pCur, i);
+		pCur = CVariableInt::Pack(pCur, (pPlayer->m_Alive ? 1 : 0) | (pPlayer->m_InputExists ? 2 : 0));
+		if(pPlayer->m_Alive)
+		{
+			pCur = CVariableInt::Pack(pCur, pPlayer->m_X);
+			pCur = CVariableInt::Pack(pCur, pPlayer->m_Y);
+		}
+		if(pPlayer->m_InputExists)
+		{
+			for(int j = 0; j < INPUT_SIZE; j++)
+				pCur = CVariableInt::Pack(pCur, pPlayer->m_aInput[j]);
+		}
+	}
+	pCur = CVariableInt::Pack(pCur, -1);
+	pOut->assign(aBuf, pCur);
+}
+
+bool CTeeHistorianState::Unpack(const unsigned char *pData, int Size)
+{
+	Reset();
+	CUnpacker Unpacker;
+	Unpacker.Reset(pData, Size);
+	m_Tick = Unpacker.GetInt();
+	m_LastClientID = Unpacker.GetInt();
+	while(!Unpacker.Error())
+	{
+		int ClientID = Unpacker.GetInt();
+		if(ClientID == -1)
+			break;
+		if(ClientID < 0 || ClientID >= MAX_CLIENTS)
+			return false;
+		CPlayer *pPlayer = &m_aPlayers[ClientID];
+		int Flags = Unpacker.GetInt();
+		pPlayer->m_Alive = Flags & 1;
+		pPlayer->m_InputExists = Flags & 2;
+		if(pPlayer->m_Alive)
+		{
+			pPlayer->m_X = Unpacker.GetInt();
+			pPlayer->m_Y = Unpacker.GetInt();
+		}
+		if(pPlayer->m_InputExists)
+		{
+			for(int j = 0; j < INPUT_SIZE; j++)
+				pPlayer->m_aInput[j] = Unpacker.GetInt();
+		}
+	}
+	return !Unpacker.Error();
+}
+
+CTeeHistorianReader::CTeeHistorianReader() :
+	m_pfnOpenFile(0),
+	m_pUser(0),
+	m_Error(false),
+	m_Finished(false),
+	m_Compressed(false),
+	m_Part(0),
+	m_PartDone(false),
+	m_File(0),
+	m_pStream(0),
+	m_BufferPos(0),
+	m_BufferSize(0),
+	m_IndexFile(0),
+	m_HasPending(false)
+{
+	m_State.Reset();
+}
+
+CTeeHistorianReader::~CTeeHistorianReader()
+{
+	Close();
+}
+
+bool CTeeHistorianReader::Open(FOpenFile pfnOpenFile, void *pUser)
+{
+	Close();
+	m_pfnOpenFile = pfnOpenFile;
+	m_pUser = pUser;
+	m_Error = false;
+
+	IOHANDLE File = m_pfnOpenFile(0, false, m_pUser);
+	if(!File)
+	{
+		return false;
+	}
+	unsigned char aMagic[2];
+	m_Compressed = io_read(File, aMagic, sizeof(aMagic)) == sizeof(aMagic) && aMagic[0] == 0x1f && aMagic[1] == 0x8b;
+	io_close(File);
+
+	if(!Rewind())
+	{
+		Close();
+		return false;
+	}
+	LoadIndex();
+	return true;
+}
+
+void CTeeHistorianReader::Close()
+{
+	ClosePart();
+	if(m_IndexFile)
+	{
+		io_close(m_IndexFile);
+		m_IndexFile = 0;
+	}
+	m_vIndex.clear();
+	m_vHeader.clear();
+	m_HasPending = false;
+	m_Finished = false;
+	m_State.Reset();
+}
+
+bool CTeeHistorianReader::LoadIndex()
+{
+	m_IndexFile = m_pfnOpenFile(0, true, m_pUser);
+	if(!m_IndexFile)
+	{
+		return false;
+	}
+	unsigned char aHeader[TEEHISTORIAN_INDEX_HEADER_SIZE];
+	if(io_read(m_IndexFile, aHeader, sizeof(aHeader)) != sizeof(aHeader) ||
+		mem_comp(aHeader, &TEEHISTORIAN_INDEX_UUID, sizeof(TEEHISTORIAN_INDEX_UUID)) != 0 ||
+		ReadInt32(aHeader + 16) != TEEHISTORIAN_INDEX_VERSION)
+	{
+		io_close(m_IndexFile);
+		m_IndexFile = 0;
+		return false;
+	}
+
+	long Length = io_length(m_IndexFile);
+	long Pos = sizeof(aHeader);
+	io_seek(m_IndexFile, Pos, IOSEEK_START);
+	while(true)
+	{
+		unsigned char aEntry[TEEHISTORIAN_INDEX_ENTRY_HEADER_SIZE];
+		if(io_read(m_IndexFile, aEntry, sizeof(aEntry)) != sizeof(aEntry))
+		{
+			break;
+		}
+		CIndexEntry Entry;
+		int EntrySize = ReadInt32(aEntry);
+		Entry.m_Tick = ReadInt32(aEntry + 4);
+		Entry.m_Part = ReadInt32(aEntry + 8);
+		Entry.m_FileOffset = ReadInt64(aEntry + 12);
+		Entry.m_StreamOffset = ReadInt64(aEntry + 20);
+		Entry.m_StatePos = Pos + sizeof(aEntry);
+		Entry.m_StateSize = EntrySize - (sizeof(aEntry) - 4);
+		// ignore a partially written last entry
+		if(Entry.m_StateSize < 0 || Entry.m_StatePos + Entry.m_StateSize > Length)
+		{
+			break;
+		}
+		if(!m_vIndex.empty() && Entry.m_Tick < m_vIndex.back().m_Tick)
+		{
+			break;
+		}
+		m_vIndex.push_back(Entry);
+		Pos = Entry.m_StatePos + Entry.m_StateSize;
+		io_seek(m_IndexFile, Pos, IOSEEK_START);
+	}
+	return true;
+}
+
+bool CTeeHistorianReader::OpenPart(int Part, int64 FileOffset, bool RawDeflate)
+{
+	ClosePart();
+	m_File = m_pfnOpenFile(Part, false, m_pUser);
+	if(!m_File)
+	{
+		return false;
+	}
+	m_Part = Part;
+	m_PartDone = false;
+	if(FileOffset && !SeekLarge(m_File, FileOffset))
+	{
+		ClosePart();
+		return false;
+	}
+	if(m_Compressed)
+	{
+		z_stream *pStream = new z_stream;
+		mem_zero(pStream, sizeof(*pStream));
+		// raw deflate data when starting at an index entry, gzip otherwise
+		if(inflateInit2(pStream, RawDeflate ? -15 : 15 + 16) != Z_OK)
+		{
+			delete pStream;
+			ClosePart();
+			return false;
+		}
+		m_pStream = pStream;
+	}
+	return true;
+}
+
+void CTeeHistorianReader::ClosePart()
+{
+	if(m_pStream)
+	{
+		z_stream *pStream = (z_stream *)m_pStream;
+		inflateEnd(pStream);
+		delete pStream;
+		m_pStream = 0;
+	}
+	if(m_File)
+	{
+		io_close(m_File);
+		m_File = 0;
+	}
+	m_BufferPos = 0;
+	m_BufferSize = 0;
+}
+
+bool CTeeHistorianReader::Rewind()
+{
+	m_HasPending = false;
+	m_Finished = false;
+	m_State.Reset();
+	if(!OpenPart(0, 0, false))
+	{
+		return false;
+	}
+
+	CUuid Uuid;
+	if(!GetRaw((unsigned char *)&Uuid, sizeof(Uuid)) || Uuid != TEEHISTORIAN_UUID)
+	{
+		return false;
+	}
+	m_vHeader.clear();
+	unsigned char Byte;
+	do
+	{
+		if(!GetByte(&Byte))
+		{
+			return false;
+		}
+		m_vHeader.push_back(Byte);
+	} while(Byte != 0);
+	return true;
+}
+
+bool CTeeHistorianReader::Fill()
+{
+	m_BufferPos = 0;
+	m_BufferSize = 0;
+	while(true)
+	{
+		if(m_PartDone && !OpenPart(m_Part + 1, 0, false))
+		{
+			return false;
+		}
+		if(!m_File)
+		{
+			return false;
+		}
+
+		if(!m_pStream)
+		{
+			m_BufferSize = io_read(m_File, m_aBuffer, sizeof(m_aBuffer));
+			if(m_BufferSize)
+			{
+				return true;
+			}
+			m_PartDone = true;
+			continue;
+		}
+
+		z_stream *pStream = (z_stream *)m_pStream;
+		if(pStream->avail_in == 0)
+		{
+			unsigned Read = io_read(m_File, m_aInput, sizeof(m_aInput));
+			if(Read == 0)
+			{
+				// truncated part, e.g. because the server crashed
+				m_PartDone = true;
+				continue;
+			}
+			pStream->next_in = m_aInput;
+			pStream->avail_in = Read;
+		}
+		pStream->next_out = m_aBuffer;
+		pStream->avail_out = sizeof(m_aBuffer);
+		int Result = inflate(pStream, Z_NO_FLUSH);
+		if(Result != Z_OK && Result != Z_STREAM_END && Result != Z_BUF_ERROR)
+		{
+			m_Error = true;
+			ClosePart();
+			return false;
+		}
+		// each part is a separate gzip member
+		if(Result == Z_STREAM_END)
+		{
+			m_PartDone = true;
+		}
+		m_BufferSize = sizeof(m_aBuffer) - pStream->avail_out;
+		if(m_BufferSize)
+		{
+			return true;
+		}
+	}
+}
+
+bool CTeeHistorianReader::GetByte(unsigned char *pByte)
+{
+	if(m_BufferPos == m_BufferSize && !Fill())
+	{
+		return false;
+	}
+	*pByte = m_aBuffer[m_BufferPos++];
+	return true;
+}
+
+bool CTeeHistorianReader::GetInt(int *pInt)
+{
+	// see `CVariableInt::Unpack`
+	unsigned char Byte;
+	if(!GetByte(&Byte))
+	{
+		return false;
+	}
+	int Sign = (Byte >> 6) & 1;
+	int Value = Byte & 0x3f;
+	for(int Shift = 6; Byte & 0x80 && Shift < 32; Shift += 7)
+	{
+		if(!GetByte(&Byte))
+		{
+			m_Error = true;
+			return false;
+		}
+		Value |= (Byte & 0x7f) << Shift;
+	}
+	*pInt = Value ^ -Sign;
+	return true;
+}
+
+bool CTeeHistorianReader::GetRaw(unsigned char *pData, int Size)
+{
+	while(Size > 0)
+	{
+		if(m_BufferPos == m_BufferSize && !Fill())
+		{
+			m_Error = true;
+			return false;
+		}
+		int Chunk = minimum(Size, m_BufferSize - m_BufferPos);
+		mem_copy(pData, m_aBuffer + m_BufferPos, Chunk);
+		m_BufferPos += Chunk;
+		pData += Chunk;
+		Size -= Chunk;
+	}
+	return true;
+}
+
+bool CTeeHistorianReader::GetString(int *pOffset)
+{
+	*pOffset = m_vData.size();
+	unsigned char Byte;
+	do
+	{
+		if(!GetByte(&Byte))
+		{
+			m_Error = true;
+			return false;
+		}
+		m_vData.push_back(Byte);
+	} while(Byte != 0);
+	return true;
+}
+
+bool CTeeHistorianReader::ReadChunk(CChunk *pChunk)
+{
+	if(m_Finished || m_Error)
+	{
+		return false;
+	}
+
+	int Type;
+	if(!GetInt(&Type))
+	{
+		return false;
+	}
+	m_vData.clear();
+	pChunk->m_ClientID = -1;
+	pChunk->m_X = 0;
+	pChunk->m_Y = 0;
+	pChunk->m_Dt = 0;
+	pChunk->m_pData = 0;
+	pChunk->m_DataSize = 0;
+	pChunk->m_NumArgs = 0;
+	if(Type >= 0)
+	{
+		pChunk->m_ClientID = Type;
+		Type = TEEHISTORIAN_PLAYER_DIFF;
+	}
+	else
+	{
+		Type = -Type;
+		if(Type != TEEHISTORIAN_FINISH && Type != TEEHISTORIAN_TICK_SKIP && Type != TEEHISTORIAN_EX)
+		{
+			if(!GetInt(&pChunk->m_ClientID))
+			{
+				m_Error = true;
+				return false;
+			}
+		}
+	}
+	pChunk->m_Type = Type;
+
+	int ClientID = pChunk->m_ClientID;
+	if(Type != TEEHISTORIAN_CONSOLE_COMMAND && Type != TEEHISTORIAN_FINISH && Type != TEEHISTORIAN_TICK_SKIP && Type != TEEHISTORIAN_EX && (ClientID < 0 || ClientID >= MAX_CLIENTS))
+	{
+		m_Error = true;
+		return false;
+	}
+	CTeeHistorianState::CPlayer *pPlayer = ClientID >= 0 && ClientID < MAX_CLIENTS ? &m_State.m_aPlayers[ClientID] : 0;
+
+	if(Type == TEEHISTORIAN_PLAYER_DIFF || Type == TEEHISTORIAN_PLAYER_NEW || Type == TEEHISTORIAN_PLAYER_OLD)
+	{
+		// player data with a client ID not larger than the previous one
+		// implicitly starts the next tick
+		if(ClientID <= m_State.m_LastClientID)
+		{
+			m_State.m_Tick++;
+		}
+		m_State.m_LastClientID = ClientID;
+	}
+
+	bool Success = true;
+	switch(Type)
+	{
+	case TEEHISTORIAN_FINISH:
+		m_Finished = true;
+		break;
+	case TEEHISTORIAN_TICK_SKIP:
+		Success = GetInt(&pChunk->m_Dt);
+		m_State.m_Tick += pChunk->m_Dt + 1;
+		m_State.m_LastClientID = -1;
+		break;
+	case TEEHISTORIAN_PLAYER_DIFF:
+	{
+		int Dx, Dy;
+		Success = GetInt(&Dx) && GetInt(&Dy);
+		pPlayer->m_X += Dx;
+		pPlayer->m_Y += Dy;
+		pChunk->m_X = pPlayer->m_X;
+		pChunk->m_Y = pPlayer->m_Y;
+		break;
+	}
+	case TEEHISTORIAN_PLAYER_NEW:
+		Success = GetInt(&pPlayer->m_X) && GetInt(&pPlayer->m_Y);
+		pPlayer->m_Alive = true;
+		pChunk->m_X = pPlayer->m_X;
+		pChunk->m_Y = pPlayer->m_Y;
+		break;
+	case TEEHISTORIAN_PLAYER_OLD:
+		pPlayer->m_Alive = false;
+		break;
+	case TEEHISTORIAN_INPUT_DIFF:
+	case TEEHISTORIAN_INPUT_NEW:
+		for(int i = 0; i < CTeeHistorianState::INPUT_SIZE && Success; i++)
+		{
+			int Value;
+			Success = GetInt(&Value);
+			if(Type == TEEHISTORIAN_INPUT_DIFF)
+				pPlayer->m_aInput[i] += Value;
+			else
+				pPlayer->m_aInput[i] = Value;
+		}
+		pPlayer->m_InputExists = true;
+		mem_copy(pChunk->m_aInput, pPlayer->m_aInput, sizeof(pChunk->m_aInput));
+		break;
+	case TEEHISTORIAN_MESSAGE:
+	case TEEHISTORIAN_EX:
+	{
+		if(Type == TEEHISTORIAN_EX)
+		{
+			Success = GetRaw((unsigned char *)&pChunk->m_Uuid, sizeof(pChunk->m_Uuid));
+		}
+		int Size = 0;
+		Success = Success && GetInt(&Size) && Size >= 0;
+		if(Success)
+		{
+			m_vData.resize(Size);
+			Success = GetRaw(m_vData.data(), Size);
+			pChunk->m_pData = m_vData.data();
+			pChunk->m_DataSize = Size;
+		}
+		break;
+	}
+	case TEEHISTORIAN_JOIN:
+		break;
+	case TEEHISTORIAN_DROP:
+	{
+		int Offset;
+		Success = GetString(&Offset);
+		pChunk->m_pData = m_vData.data() + Offset;
+		pChunk->m_DataSize = m_vData.size() - Offset - 1;
+		break;
+	}
+	case TEEHISTORIAN_CONSOLE_COMMAND:
+	{
+		int aOffsets[MAX_ARGS];
+		int Offset = 0;
+		Success = GetInt(&pChunk->m_FlagMask) && GetString(&Offset) && GetInt(&pChunk->m_NumArgs) && pChunk->m_NumArgs >= 0;
+		for(int i = 0; Success && i < pChunk->m_NumArgs; i++)
+		{
+			int ArgOffset;
+			Success = GetString(&ArgOffset);
+			if(i < MAX_ARGS)
+				aOffsets[i] = ArgOffset;
+		}
+		if(Success)
+		{
+			pChunk->m_NumArgs = minimum(pChunk->m_NumArgs, (int)MAX_ARGS);
+			pChunk->m_pData = m_vData.data() + Offset;
+			pChunk->m_DataSize = str_length((const char *)pChunk->m_pData);
+			for(int i = 0; i < pChunk->m_NumArgs; i++)
+				pChunk->m_apArgs[i] = (const char *)m_vData.data() + aOffsets[i];
+		}
+		break;
+	}
+	default:
+		Success = false;
+	}
+
+	if(!Success)
+	{
+		m_Error = true;
+		return false;
+	}
+	pChunk->m_Tick = m_State.m_Tick;
+	return true;
+}
+
+bool CTeeHistorianReader::SeekTick(int Tick)
+{
+	if(!m_pfnOpenFile)
+	{
+		return false;
+	}
+	m_HasPending = false;
+
+	// last index entry at or before `Tick`
+	std::vector<CIndexEntry>::const_iterator It = std::upper_bound(m_vIndex.begin(), m_vIndex.end(), Tick,
+		[](int Tick, const CIndexEntry &Entry) { return Tick < Entry.m_Tick; });
+	const CIndexEntry *pEntry = It == m_vIndex.begin() ? 0 : &*(It - 1);
+
+	// the current position is only usable if we haven't passed `Tick` yet
+	bool Behind = m_Error || m_State.m_Tick >= Tick;
+	if(pEntry && (Behind || pEntry->m_Tick > m_State.m_Tick + 1))
+	{
+		std::vector<unsigned char> vState(pEntry->m_StateSize);
+		if(io_seek(m_IndexFile, pEntry->m_StatePos, IOSEEK_START) != 0 ||
+			io_read(m_IndexFile, vState.data(), vState.size()) != vState.size() ||
+			!m_State.Unpack(vState.data(), vState.size()) ||
+			!OpenPart(pEntry->m_Part, pEntry->m_FileOffset, m_Compressed))
+		{
+			m_Error = true;
+			return false;
+		}
+		m_Error = false;
+		m_Finished = false;
+	}
+	else if(Behind)
+	{
+		m_Error = false;
+		if(!Rewind())
+		{
+			m_Error = true;
+			return false;
+		}
+	}
+
+	while(ReadChunk(&m_Pending))
+	{
+		if(m_Pending.m_Tick >= Tick)
+		{
+			m_HasPending = true;
+			return true;
+		}
+	}
+	return !m_Error;
+}
+
+bool CTeeHistorianReader::NextChunk(CChunk *pChunk)
+{
+	if(m_HasPending)
+	{
+		*pChunk = m_Pending;
+		m_HasPending = false;
+		return true;
+	}
+	return ReadChunk(pChunk);
+}
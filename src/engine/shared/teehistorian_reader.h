@@ -0,0 +1,189 @@
+#ifndef ENGINE_SHARED_TEEHISTORIAN_READER_H
+#define ENGINE_SHARED_TEEHISTORIAN_READER_H
+
+#include <base/system.h>
+#include <engine/shared/protocol.h>
+#include <engine/shared/uuid_manager.h>
+
+#include <vector>
+
+enum
+{
+	TEEHISTORIAN_NONE,
+	TEEHISTORIAN_FINISH,
+	TEEHISTORIAN_TICK_SKIP,
+	TEEHISTORIAN_PLAYER_NEW,
+	TEEHISTORIAN_PLAYER_OLD,
+	TEEHISTORIAN_INPUT_DIFF,
+	TEEHISTORIAN_INPUT_NEW,
+	TEEHISTORIAN_MESSAGE,
+	TEEHISTORIAN_JOIN,
+	TEEHISTORIAN_DROP,
+	TEEHISTORIAN_CONSOLE_COMMAND,
+	TEEHISTORIAN_EX,
+
+	// Not an actual chunk type, player position diffs start with the
+	// (non-negative) client ID instead.
+	TEEHISTORIAN_PLAYER_DIFF,
+};
+
+// Everything a decoder needs to continue reading the stream at a tick
+// boundary. Written to the index every few ticks.
+class CTeeHistorianState
+{
+public:
+	enum
+	{
+		// sizeof(CNetObj_PlayerInput) / sizeof(int)
+		INPUT_SIZE = 10,
+	};
+
+	struct CPlayer
+	{
+		bool m_Alive;
+		int m_X;
+		int m_Y;
+
+		bool m_InputExists;
+		int m_aInput[INPUT_SIZE];
+	};
+
+	int m_Tick;
+	int m_LastClientID;
+	CPlayer m_aPlayers[MAX_CLIENTS];
+
+	void Reset();
+	void Pack(std::vector<unsigned char> *pOut) const;
+	bool Unpack(const unsigned char *pData, int Size);
+};
+
+// The index file consists of the index UUID and a version, followed by
+// entries of the form
+//
+//     int32 entry size (excluding this field)
+//     int32 tick
+//     int32 part
+//     int64 offset in the (possibly compressed) part file
+//     int64 offset in the uncompressed stream
+//     packed CTeeHistorianState
+//
+// All integers are little endian. For compressed parts, the compressor is
+// fully flushed at each entry so that decompression can start there.
+extern const CUuid TEEHISTORIAN_INDEX_UUID;
+enum
+{
+	TEEHISTORIAN_INDEX_VERSION = 1,
+	TEEHISTORIAN_INDEX_HEADER_SIZE = 16 + 4,
+	TEEHISTORIAN_INDEX_ENTRY_HEADER_SIZE = 4 + 4 + 4 + 8 + 8,
+};
+
+void TeeHistorianIndexHeader(unsigned char *pBuf);
+void TeeHistorianIndexEntryHeader(unsigned char *pBuf, int EntrySize, int Tick, int Part, int64 FileOffset, int64 StreamOffset);
+
+class CTeeHistorianReader
+{
+public:
+	// Opens the file for part `Part` or the index file if `Index` is set.
+	// Return 0 if the file doesn't exist.
+	typedef IOHANDLE (*FOpenFile)(int Part, bool Index, void *pUser);
+
+	enum
+	{
+		MAX_ARGS = 16,
+	};
+
+	struct CChunk
+	{
+		int m_Type;
+		int m_Tick;
+		int m_ClientID;
+
+		// PLAYER_NEW, PLAYER_DIFF: position after this chunk
+		int m_X;
+		int m_Y;
+		// INPUT_NEW, INPUT_DIFF: input after this chunk
+		int m_aInput[CTeeHistorianState::INPUT_SIZE];
+		// TICK_SKIP
+		int m_Dt;
+
+		// MESSAGE: message, DROP: reason, CONSOLE_COMMAND: command,
+		// EX: payload. Valid until the next call to `NextChunk`.
+		const unsigned char *m_pData;
+		int m_DataSize;
+
+		// CONSOLE_COMMAND
+		int m_FlagMask;
+		int m_NumArgs;
+		const char *m_apArgs[MAX_ARGS];
+
+		// EX
+		CUuid m_Uuid;
+	};
+
+	CTeeHistorianReader();
+	~CTeeHistorianReader();
+
+	bool Open(FOpenFile pfnOpenFile, void *pUser);
+	void Close();
+
+	const char *HeaderJson() const { return m_vHeader.data(); }
+	bool Compressed() const { return m_Compressed; }
+	bool HasIndex() const { return !m_vIndex.empty(); }
+	int NumIndexEntries() const { return m_vIndex.size(); }
+	bool Error() const { return m_Error; }
+	const CTeeHistorianState *State() const { return &m_State; }
+
+	// Positions the reader so that the next chunk is the first one
+	// belonging to `Tick` or a later tick. Uses the index if available.
+	bool SeekTick(int Tick);
+	// Returns false at the end of the stream or on error.
+	bool NextChunk(CChunk *pChunk);
+
+private:
+	struct CIndexEntry
+	{
+		int m_Tick;
+		int m_Part;
+		int64 m_FileOffset;
+		int64 m_StreamOffset;
+		long m_StatePos;
+		int m_StateSize;
+	};
+
+	bool LoadIndex();
+	bool OpenPart(int Part, int64 FileOffset, bool RawDeflate);
+	void ClosePart();
+	bool Rewind();
+	bool Fill();
+	bool GetByte(unsigned char *pByte);
+	bool GetInt(int *pInt);
+	bool GetRaw(unsigned char *pData, int Size);
+	bool GetString(int *pOffset);
+	bool ReadChunk(CChunk *pChunk);
+
+	FOpenFile m_pfnOpenFile;
+	void *m_pUser;
+	bool m_Error;
+	bool m_Finished;
+
+	bool m_Compressed;
+	int m_Part;
+	bool m_PartDone;
+	IOHANDLE m_File;
+	void *m_pStream;
+	unsigned char m_aInput[16 * 1024];
+	unsigned char m_aBuffer[16 * 1024];
+	int m_BufferPos;
+	int m_BufferSize;
+
+	std::vector<char> m_vHeader;
+	IOHANDLE m_IndexFile;
+	std::vector<CIndexEntry> m_vIndex;
+
+	CTeeHistorianState m_State;
+	std::vector<unsigned char> m_vData;
+	bool m_HasPending;
+	CChunk m_Pending;
+};
+
+#endif // ENGINE_SHARED_TEEHISTORIAN_READER_H
@@ -0,0 +1,368 @@
+#include "teehistorian_writer.h"
+#include "teehistorian_reader.h"
+
+#include <zlib.h>
+
+enum
+{
+	// flush the compressor at least this often so that a crash doesn't
+	// lose more than that
+	FLUSH_INTERVAL_SECONDS = 1,
+};
+
+CTeeHistorianWriter::CTeeHistorianWriter() :
+	m_pfnOpenFile(0),
+	m_pUser(0),
+	m_pThread(0),
+	m_Finish(false),
+	m_FlushWaiting(false),
+	m_Overflowed(false),
+	m_File(0),
+	m_Part(0),
+	m_PartSize(0),
+	m_PartFileSize(0),
+	m_StreamOffset(0),
+	m_IndexFile(0),
+	m_PartStart(0),
+	m_pStream(0),
+	m_Error(0),
+	m_BytesDropped(0),
+	m_BytesIn(0),
+	m_MaxBytesQueued(0),
+	m_BytesWritten(0),
+	m_CompressTime(0),
+	m_NumParts(0)
+{
+	mem_zero(&m_Config, sizeof(m_Config));
+}
+
+CTeeHistorianWriter::~CTeeHistorianWriter()
+{
+	Close();
+}
+
+const char *CTeeHistorianWriter::FileExtension(int Compression)
+{
+	return Compression == COMPRESSION_ZLIB ? ".teehistorian.gz" : ".teehistorian";
+}
+
+bool CTeeHistorianWriter::Open(const CConfig *pConfig, FOpenFile pfnOpenFile, void *pUser)
+{
+	dbg_assert(!m_pThread, "teehistorian writer already open");
+
+	m_Config = *pConfig;
+	m_pfnOpenFile = pfnOpenFile;
+	m_pUser = pUser;
+	m_vPending.clear();
+	m_vPendingIndex.clear();
+	m_Finish = false;
+	m_FlushWaiting = false;
+	m_Overflowed = false;
+	m_Part = 0;
+	m_StreamOffset = 0;
+	m_Error = 0;
+	m_BytesDropped = 0;
+	m_BytesIn = 0;
+	m_MaxBytesQueued = 0;
+	m_BytesWritten = 0;
+	m_CompressTime = 0;
+	m_NumParts = 0;
+
+	if(!OpenPart())
+	{
+		return false;
+	}
+	m_pThread = thread_init(WorkerThread, this, "teehistorian writer");
+	if(!m_pThread)
+	{
+		ClosePart();
+		return false;
+	}
+	return true;
+}
+
+bool CTeeHistorianWriter::Write(const void *pData, int Size)
+{
+	m_Lock.take();
+	if(m_Overflowed || (m_Config.m_MaxQueued && (int64)m_vPending.size() + Size > m_Config.m_MaxQueued))
+	{
+		m_Overflowed = true;
+		m_Lock.release();
+		m_BytesDropped += Size;
+		return false;
+	}
+	const unsigned char *pBytes = (const unsigned char *)pData;
+	m_vPending.insert(m_vPending.end(), pBytes, pBytes + Size);
+	m_BytesIn += Size;
+	if((int64)m_vPending.size() > m_MaxBytesQueued)
+	{
+		m_MaxBytesQueued = m_vPending.size();
+	}
+	m_Lock.release();
+	m_Semaphore.signal();
+	return true;
+}
+
+void CTeeHistorianWriter::WriteIndex(int Tick, const void *pState, int StateSize)
+{
+	m_Lock.take();
+	if(!m_Overflowed)
+	{
+		m_vPendingIndex.emplace_back();
+		CIndexMarker *pMarker = &m_vPendingIndex.back();
+		pMarker->m_Pos = m_vPending.size();
+		pMarker->m_Tick = Tick;
+		pMarker->m_vState.assign((const unsigned char *)pState, (const unsigned char *)pState + StateSize);
+	}
+	m_Lock.release();
+}
+
+void CTeeHistorianWriter::Flush()
+{
+	if(!m_pThread)
+	{
+		return;
+	}
+	m_Lock.take();
+	m_FlushWaiting = true;
+	m_Lock.release();
+	m_Semaphore.signal();
+	m_FlushedSemaphore.wait();
+}
+
+void CTeeHistorianWriter::Close()
+{
+	if(!m_pThread)
+	{
+		return;
+	}
+	m_Lock.take();
+	m_Finish = true;
+	m_Lock.release();
+	m_Semaphore.signal();
+	thread_wait(m_pThread);
+	m_pThread = 0;
+}
+
+void CTeeHistorianWriter::GetStats(CStats *pStats)
+{
+	m_Lock.take();
+	pStats->m_BytesIn = m_BytesIn;
+	pStats->m_BytesQueued = m_vPending.size();
+	pStats->m_MaxBytesQueued = m_MaxBytesQueued;
+	m_Lock.release();
+	pStats->m_BytesDropped = m_BytesDropped.load();
+	pStats->m_BytesWritten = m_BytesWritten.load();
+	pStats->m_CompressTime = m_CompressTime.load() * 1000000 / time_freq();
+	pStats->m_NumParts = m_NumParts.load();
+}
+
+void CTeeHistorianWriter::WorkerThread(void *pUser)
+{
+	((CTeeHistorianWriter *)pUser)->Worker();
+}
+
+void CTeeHistorianWriter::Worker()
+{
+	std::vector<unsigned char> vLocal;
+	std::vector<CIndexMarker> vLocalIndex;
+	int64 LastFlush = time_get();
+	while(true)
+	{
+		m_Lock.take();
+		while(m_vPending.empty() && !m_Finish && !m_FlushWaiting)
+		{
+			m_Lock.release();
+			m_Semaphore.wait();
+			m_Lock.take();
+		}
+		// everything written before `Close` is already in the queue
+		bool Finish = m_Finish;
+		bool FlushWaiting = m_FlushWaiting;
+		m_FlushWaiting = false;
+		std::swap(vLocal, m_vPending);
+		std::swap(vLocalIndex, m_vPendingIndex);
+		m_Lock.release();
+
+		if((!vLocal.empty() || !vLocalIndex.empty() || FlushWaiting) && m_File)
+		{
+			int64 Now = time_get();
+			bool Flush = FlushWaiting || Now - LastFlush > FLUSH_INTERVAL_SECONDS * time_freq();
+			int Pos = 0;
+			for(const CIndexMarker &Marker : vLocalIndex)
+			{
+				// flush fully so that the reader can start decompressing at
+				// the index entry
+				if(!WritePart(vLocal.data() + Pos, Marker.m_Pos - Pos, FLUSH_FULL) || !WriteIndexEntry(&Marker))
+				{
+					m_Error = 1;
+				}
+				Pos = Marker.m_Pos;
+			}
+			if(!WritePart(vLocal.data() + Pos, vLocal.size() - Pos, Flush ? FLUSH_SYNC : FLUSH_NONE))
+			{
+				m_Error = 1;
+			}
+			if(Flush)
+			{
+				io_flush(m_File);
+				if(m_IndexFile)
+				{
+					io_flush(m_IndexFile);
+				}
+				LastFlush = Now;
+			}
+			if(io_error(m_File))
+			{
+				m_Error = 1;
+			}
+
+			bool RotateSize = m_Config.m_RotateSize && m_PartSize >= m_Config.m_RotateSize;
+			bool RotateTime = m_Config.m_RotateTime && Now - m_PartStart >= m_Config.m_RotateTime * time_freq();
+			if(!Finish && (RotateSize || RotateTime))
+			{
+				if(!ClosePart() || !OpenPart())
+				{
+					m_Error = 1;
+				}
+			}
+		}
+		vLocal.clear();
+		vLocalIndex.clear();
+		if(FlushWaiting)
+		{
+			m_FlushedSemaphore.signal();
+		}
+
+		if(Finish)
+		{
+			break;
+		}
+	}
+	if(m_File && !ClosePart())
+	{
+		m_Error = 1;
+	}
+	if(m_IndexFile && io_close(m_IndexFile) != 0)
+	{
+		m_Error = 1;
+	}
+	m_IndexFile = 0;
+}
+
+bool CTeeHistorianWriter::OpenPart()
+{
+	m_File = m_pfnOpenFile(m_Part, false, m_pUser);
+	if(!m_File)
+	{
+		m_Error = 1;
+		return false;
+	}
+	m_Part++;
+	m_NumParts++;
+	m_PartSize = 0;
+	m_PartFileSize = 0;
+	m_PartStart = time_get();
+
+	if(m_Config.m_Compression == COMPRESSION_ZLIB)
+	{
+		z_stream *pStream = new z_stream;
+		mem_zero(pStream, sizeof(*pStream));
+		// 15 + 16: maximum window size with gzip header
+		if(deflateInit2(pStream, m_Config.m_CompressionLevel, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			delete pStream;
+			io_close(m_File);
+			m_File = 0;
+			m_Error = 1;
+			return false;
+		}
+		m_pStream = pStream;
+	}
+	return true;
+}
+
+bool CTeeHistorianWriter::ClosePart()
+{
+	bool Success = true;
+	if(m_pStream)
+	{
+		Success = WritePart(0, 0, FLUSH_FINISH);
+		z_stream *pStream = (z_stream *)m_pStream;
+		deflateEnd(pStream);
+		delete pStream;
+		m_pStream = 0;
+	}
+	if(io_close(m_File) != 0)
+	{
+		Success = false;
+	}
+	m_File = 0;
+	return Success;
+}
+
+bool CTeeHistorianWriter::WritePart(const unsigned char *pData, int Size, int Flush)
+{
+	if(!m_pStream)
+	{
+		if(io_write(m_File, pData, Size) != (unsigned)Size)
+		{
+			return false;
+		}
+		m_PartSize += Size;
+		m_PartFileSize += Size;
+		m_StreamOffset += Size;
+		m_BytesWritten += Size;
+		return true;
+	}
+	m_PartSize += Size;
+	m_StreamOffset += Size;
+
+	z_stream *pStream = (z_stream *)m_pStream;
+	pStream->next_in = (Bytef *)pData;
+	pStream->avail_in = Size;
+
+	static const int s_aFlushModes[] = {Z_NO_FLUSH, Z_SYNC_FLUSH, Z_FULL_FLUSH, Z_FINISH};
+	unsigned char aOut[64 * 1024];
+	do
+	{
+		pStream->next_out = aOut;
+		pStream->avail_out = sizeof(aOut);
+		int64 Start = time_get();
+		int Result = deflate(pStream, s_aFlushModes[Flush]);
+		m_CompressTime += time_get() - Start;
+		if(Result == Z_STREAM_ERROR)
+		{
+			return false;
+		}
+		unsigned Have = sizeof(aOut) - pStream->avail_out;
+		if(Have && io_write(m_File, aOut, Have) != Have)
+		{
+			return false;
+		}
+		m_PartFileSize += Have;
+		m_BytesWritten += Have;
+	} while(pStream->avail_out == 0);
+	return true;
+}
+
+bool CTeeHistorianWriter::WriteIndexEntry(const CIndexMarker *pMarker)
+{
+	if(!m_IndexFile)
+	{
+		m_IndexFile = m_pfnOpenFile(0, true, m_pUser);
+		if(!m_IndexFile)
+		{
+			return false;
+		}
+		unsigned char aHeader[TEEHISTORIAN_INDEX_HEADER_SIZE];
+		TeeHistorianIndexHeader(aHeader);
+		io_write(m_IndexFile, aHeader, sizeof(aHeader));
+	}
+	unsigned char aEntry[TEEHISTORIAN_INDEX_ENTRY_HEADER_SIZE];
+	int Size = sizeof(aEntry) - 4 + pMarker->m_vState.size();
+	TeeHistorianIndexEntryHeader(aEntry, Size, pMarker->m_Tick, m_Part - 1, m_PartFileSize, m_StreamOffset);
+	io_write(m_IndexFile, aEntry, sizeof(aEntry));
+	io_write(m_IndexFile, pMarker->m_vState.data(), pMarker->m_vState.size());
+	return io_error(m_IndexFile) == 0;
+}
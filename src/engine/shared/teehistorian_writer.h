@@ -0,0 +1,135 @@
+#ifndef ENGINE_SHARED_TEEHISTORIAN_WRITER_H
+#define ENGINE_SHARED_TEEHISTORIAN_WRITER_H
+
+#include <base/system.h>
+#include <base/tl/threading.h>
+
+#include <atomic>
+#include <vector>
+
+// Asynchronous sink for the teehistorian stream. Data handed to `Write` is
+// queued and compressed/written by a worker thread, optionally splitting the
+// output into several parts. Concatenating the (decompressed) parts yields
+// the original stream; for gzip output `cat part0 part1 ... | zcat` works.
+class CTeeHistorianWriter
+{
+public:
+	// Opens the file for part `Part` (starting at 0) or the index file if
+	// `Index` is set, called from the worker thread.
+	typedef IOHANDLE (*FOpenFile)(int Part, bool Index, void *pUser);
+
+	enum
+	{
+		COMPRESSION_NONE = 0,
+		COMPRESSION_ZLIB,
+	};
+
+	struct CConfig
+	{
+		int m_Compression;
+		int m_CompressionLevel;
+		// stream bytes (before compression) in a part before a new one is
+		// started, 0 = never
+		int64 m_RotateSize;
+		// seconds before a new part is started, 0 = never
+		int m_RotateTime;
+		// maximum number of bytes waiting for the worker, 0 = unbounded
+		int m_MaxQueued;
+	};
+
+	struct CStats
+	{
+		int64 m_BytesIn;
+		int64 m_BytesQueued;
+		int64 m_MaxBytesQueued;
+		int64 m_BytesDropped;
+		int64 m_BytesWritten;
+		int64 m_CompressTime; // in microseconds
+		int m_NumParts;
+	};
+
+	CTeeHistorianWriter();
+	~CTeeHistorianWriter();
+
+	bool Open(const CConfig *pConfig, FOpenFile pfnOpenFile, void *pUser);
+	// Returns false if the data was dropped because the queue is full. Once
+	// something was dropped, the stream is truncated and all further data
+	// is dropped as well, so the output stays parseable.
+	bool Write(const void *pData, int Size);
+	// Adds an index entry for `Tick` at the current stream position, see
+	// `teehistorian_reader.h` for the format. The index file is created
+	// with the first entry.
+	void WriteIndex(int Tick, const void *pState, int StateSize);
+	// Waits until the worker wrote and flushed everything queued so far.
+	void Flush();
+	// Flushes all queued data, finishes the current part and waits for the
+	// worker thread.
+	void Close();
+
+	bool IsOpen() const { return m_pThread != 0; }
+	int Compression() const { return m_Config.m_Compression; }
+	int Error() const { return m_Error.load(); }
+	int64 BytesDropped() const { return m_BytesDropped.load(); }
+	void GetStats(CStats *pStats);
+
+	static const char *FileExtension(int Compression);
+
+private:
+	enum
+	{
+		FLUSH_NONE,
+		FLUSH_SYNC,
+		FLUSH_FULL,
+		FLUSH_FINISH,
+	};
+
+	struct CIndexMarker
+	{
+		// position in the pending data
+		int m_Pos;
+		int m_Tick;
+		std::vector<unsigned char> m_vState;
+	};
+
+	static void WorkerThread(void *pUser);
+	void Worker();
+
+	bool OpenPart();
+	bool ClosePart();
+	bool WritePart(const unsigned char *pData, int Size, int Flush);
+	bool WriteIndexEntry(const CIndexMarker *pMarker);
+
+	CConfig m_Config;
+	FOpenFile m_pfnOpenFile;
+	void *m_pUser;
+	void *m_pThread;
+
+	lock m_Lock;
+	semaphore m_Semaphore;
+	semaphore m_FlushedSemaphore;
+	std::vector<unsigned char> m_vPending;
+	std::vector<CIndexMarker> m_vPendingIndex;
+	bool m_Finish;
+	bool m_FlushWaiting;
+	bool m_Overflowed;
+
+	// worker state
+	IOHANDLE m_File;
+	int m_Part;
+	int64 m_PartSize;
+	int64 m_PartFileSize;
+	int64 m_StreamOffset;
+	IOHANDLE m_IndexFile;
+	int64 m_PartStart;
+	void *m_pStream;
+
+	std::atomic<int> m_Error;
+	std::atomic<int64> m_BytesDropped;
+	int64 m_BytesIn;
+	int64 m_MaxBytesQueued;
+	std::atomic<int64> m_BytesWritten;
+	std::atomic<int64> m_CompressTime;
+	std::atomic<int> m_NumParts;
+};
+
+#endif // ENGINE_SHARED_TEEHISTORIAN_WRITER_H
@@ -131,6 +131,9 @@ public:
 
 	virtual void OnWindowResize() = 0;
 
+	// text layout cache usage since the start, for debugging
+	virtual void GetLayoutCacheStats(int64 *pHits, int64 *pMisses, int *pNumEntries) = 0;
+
 	virtual float GetGlyphOffsetX(int FontSize, char TextCharacter) = 0;
 };
 
@@ -536,6 +536,8 @@ void CGameClient::OnReset()
 {
 	m_LastNewPredictedTick[0] = -1;
 	m_LastNewPredictedTick[1] = -1;
+	m_NumPredictedTicks = 0;
+	m_PredictionDummy = false;
 
 	InvalidateSnapshot();
 
@@ -1682,6 +1684,24 @@ void CGameClient::OnNewSnapshot()
 		UpdatePrediction();
 }
 
+void CGameClient::GetPredictionInput(int Tick, bool Dummy, CPredictionInput *pInput)
+{
+	// zeroed as a whole, the inputs are compared with mem_comp
+	mem_zero(pInput, sizeof(*pInput));
+	pInput->m_Tick = Tick;
+	if(const int *pData = Client()->GetDirectInput(Tick, m_IsDummySwapping))
+	{
+		pInput->m_HasInput = true;
+		mem_copy(&pInput->m_Input, pData, sizeof(pInput->m_Input));
+	}
+	if(Dummy)
+		if(const int *pData = Client()->GetDirectInput(Tick, m_IsDummySwapping ^ 1))
+		{
+			pInput->m_HasDummyInput = true;
+			mem_copy(&pInput->m_DummyInput, pData, sizeof(pInput->m_DummyInput));
+		}
+}
+
 void CGameClient::OnPredict()
 {
 	// store the previous values so we can detect prediction errors
@@ -1714,13 +1734,37 @@ void CGameClient::OnPredict()
 
 	// init
 	bool Dummy = g_Config.m_ClDummy ^ m_IsDummySwapping;
-	m_PredictedWorld.CopyWorld(&m_GameWorld);
+	int FirstTick = Client()->GameTick(g_Config.m_ClDummy) + 1;
 
-	// don't predict inactive players
-	for(int i = 0; i < MAX_CLIENTS; i++)
-		if(CCharacter *pChar = m_PredictedWorld.GetCharacterByID(i))
-			if(!m_Snap.m_aCharacters[i].m_Active && pChar->m_SnapTicks > 10)
-				pChar->Destroy();
+	// continue the previous prediction if the game world didn't change since
+	// and the ticks it already simulated still have the same inputs
+	bool Continue = m_PredictedWorld.m_IsValidCopy && m_PredictedWorld.m_pParent == &m_GameWorld && m_PredictionDummy == Dummy &&
+			g_Config.m_ClPredictFreeze != 2 && in_range(m_PredictedWorld.GameTick(), FirstTick, Client()->PredGameTick(g_Config.m_ClDummy)) &&
+			m_PredictedWorld.GetCharacterByID(m_Snap.m_LocalClientID);
+	if(Continue)
+	{
+		bool HasDummy = PredictDummy() && m_PredictedWorld.GetCharacterByID(m_PredictedDummyID);
+		for(int Tick = FirstTick; Continue && Tick <= m_PredictedWorld.GameTick(); Tick++)
+		{
+			CPredictionInput Input;
+			GetPredictionInput(Tick, HasDummy, &Input);
+			Continue = mem_comp(&Input, &m_aPredictionInputs[Tick % 200], sizeof(Input)) == 0;
+		}
+	}
+	if(Continue)
+		FirstTick = m_PredictedWorld.GameTick() + 1;
+	else
+	{
+		m_PredictedWorld.CopyWorld(&m_GameWorld);
+		m_PredictionDummy = Dummy;
+
+		// don't predict inactive players
+		for(int i = 0; i < MAX_CLIENTS; i++)
+			if(CCharacter *pChar = m_PredictedWorld.GetCharacterByID(i))
+				if(!m_Snap.m_aCharacters[i].m_Active && pChar->m_SnapTicks > 10)
+					pChar->Destroy();
+	}
+	m_NumPredictedTicks = maximum(Client()->PredGameTick(g_Config.m_ClDummy) - FirstTick + 1, 0);
 
 	CCharacter *pLocalChar = m_PredictedWorld.GetCharacterByID(m_Snap.m_LocalClientID);
 	if(!pLocalChar)
@@ -1730,7 +1774,7 @@ void CGameClient::OnPredict()
 		pDummyChar = m_PredictedWorld.GetCharacterByID(m_PredictedDummyID);
 
 	// predict
-	for(int Tick = Client()->GameTick(g_Config.m_ClDummy) + 1; Tick <= Client()->PredGameTick(g_Config.m_ClDummy); Tick++)
+	for(int Tick = FirstTick; Tick <= Client()->PredGameTick(g_Config.m_ClDummy); Tick++)
 	{
 		// fetch the previous characters
 		if(Tick == Client()->PredGameTick(g_Config.m_ClDummy))
@@ -1747,8 +1791,10 @@ void CGameClient::OnPredict()
 			pLocalChar->m_CanMoveInFreeze = true;
 
 		// apply inputs and tick
-		CNetObj_PlayerInput *pInputData = (CNetObj_PlayerInput *)Client()->GetDirectInput(Tick, m_IsDummySwapping);
-		CNetObj_PlayerInput *pDummyInputData = !pDummyChar ? 0 : (CNetObj_PlayerInput *)Client()->GetDirectInput(Tick, m_IsDummySwapping ^ 1);
+		CPredictionInput *pInput = &m_aPredictionInputs[Tick % 200];
+		GetPredictionInput(Tick, pDummyChar, pInput);
+		CNetObj_PlayerInput *pInputData = pInput->m_HasInput ? &pInput->m_Input : 0;
+		CNetObj_PlayerInput *pDummyInputData = pInput->m_HasDummyInput ? &pInput->m_DummyInput : 0;
 		bool DummyFirst = pInputData && pDummyInputData && pDummyChar->GetCID() < pLocalChar->GetCID();
 
 		if(DummyFirst)
@@ -447,6 +447,7 @@ public:
 	CGameWorld m_GameWorld;
 	CGameWorld m_PredictedWorld;
 	CGameWorld m_PrevPredictedWorld;
+	int m_NumPredictedTicks; // ticks simulated by the last prediction, for the debug hud
 
 	void Echo(const char *pString);
 	bool IsOtherTeam(int ClientID);
@@ -578,6 +579,20 @@ private:
 
 	int m_PredictedDummyID;
 	int m_IsDummySwapping;
+
+	// the inputs the predicted world was simulated with, it is only
+	// continued if the inputs of the ticks it already simulated didn't change
+	struct CPredictionInput
+	{
+		int m_Tick;
+		bool m_HasInput;
+		bool m_HasDummyInput;
+		CNetObj_PlayerInput m_Input;
+		CNetObj_PlayerInput m_DummyInput;
+	};
+	CPredictionInput m_aPredictionInputs[200];
+	bool m_PredictionDummy;
+	void GetPredictionInput(int Tick, bool Dummy, CPredictionInput *pInput);
 	CCharOrder m_CharOrder;
 	class CCharacter m_aLastWorldCharacters[MAX_CLIENTS];
 
@@ -131,6 +131,9 @@ void CGameWorld::RemoveEntity(CEntity *pEnt)
 	if(!pEnt->m_pNextTypeEntity && !pEnt->m_pPrevTypeEntity && m_apFirstEntityTypes[pEnt->m_ObjType] != pEnt)
 		return;
 
+	// copies can't be continued, their entities may point to this one
+	OnModified();
+
 	// remove
 	if(pEnt->m_pPrevTypeEntity)
 		pEnt->m_pPrevTypeEntity->m_pNextTypeEntity = pEnt->m_pNextTypeEntity;
@@ -533,10 +536,14 @@ void CGameWorld::CopyWorld(CGameWorld *pFrom)
 	}
 	m_pTuningList = pFrom->m_pTuningList;
 	m_Teams = pFrom->m_Teams;
-	// delete the previous entities
+	// keep the previous entities around to copy into, so that predicting
+	// every frame doesn't allocate once the world has reached its size
+	CEntity *apOld[NUM_ENTTYPES];
 	for(int i = 0; i < NUM_ENTTYPES; i++)
-		while(m_apFirstEntityTypes[i])
-			delete m_apFirstEntityTypes[i];
+	{
+		apOld[i] = m_apFirstEntityTypes[i];
+		m_apFirstEntityTypes[i] = 0;
+	}
 	for(int i = 0; i < MAX_CLIENTS; i++)
 	{
 		m_apCharacters[i] = 0;
@@ -547,15 +554,17 @@ void CGameWorld::CopyWorld(CGameWorld *pFrom)
 	{
 		for(CEntity *pEnt = pFrom->FindLast(Type); pEnt; pEnt = pEnt->TypePrev())
 		{
-			CEntity *pCopy = 0;
+			CEntity *pCopy = apOld[Type];
+			if(pCopy)
+				apOld[Type] = pCopy->m_pNextTypeEntity;
 			if(Type == ENTTYPE_PROJECTILE)
-				pCopy = new CProjectile(*((CProjectile *)pEnt));
+				pCopy = pCopy ? &(*((CProjectile *)pCopy) = *((CProjectile *)pEnt)) : new CProjectile(*((CProjectile *)pEnt));
 			else if(Type == ENTTYPE_LASER)
-				pCopy = new CLaser(*((CLaser *)pEnt));
+				pCopy = pCopy ? &(*((CLaser *)pCopy) = *((CLaser *)pEnt)) : new CLaser(*((CLaser *)pEnt));
 			else if(Type == ENTTYPE_CHARACTER)
-				pCopy = new CCharacter(*((CCharacter *)pEnt));
+				pCopy = pCopy ? &(*((CCharacter *)pCopy) = *((CCharacter *)pEnt)) : new CCharacter(*((CCharacter *)pEnt));
 			else if(Type == ENTTYPE_PICKUP)
-				pCopy = new CPickup(*((CPickup *)pEnt));
+				pCopy = pCopy ? &(*((CPickup *)pCopy) = *((CPickup *)pEnt)) : new CPickup(*((CPickup *)pEnt));
 			if(pCopy)
 			{
 				pCopy->m_pParent = pEnt;
@@ -563,6 +572,16 @@ void CGameWorld::CopyWorld(CGameWorld *pFrom)
 			}
 		}
 	}
+	// delete the previous entities that weren't needed, they are already
+	// unlinked from the lists
+	for(int i = 0; i < NUM_ENTTYPES; i++)
+		while(CEntity *pEnt = apOld[i])
+		{
+			apOld[i] = pEnt->m_pNextTypeEntity;
+			pEnt->m_pNextTypeEntity = 0;
+			pEnt->m_pPrevTypeEntity = 0;
+			delete pEnt;
+		}
 	m_IsValidCopy = true;
 }
 
@@ -0,0 +1,49 @@
+#include "censor.h"
+
+#include <base/system.h>
+
+#include <cstring>
+
+static int NumCodepoints(const char *pStr)
+{
+	int Num = 0;
+	while(str_utf8_decode(&pStr))
+		Num++;
+	return Num;
+}
+
+void CCensor::Init(const std::vector<std::string> &vWords)
+{
+	std::vector<CSubstringMatcher::CWord> vMatcherWords;
+	vMatcherWords.reserve(vWords.size());
+	for(const std::string &Word : vWords)
+		vMatcherWords.push_back({Word.c_str(), NumCodepoints(Word.c_str())});
+	m_Matcher.Init(vMatcherWords);
+}
+
+void CCensor::Censor(char *pMessage) const
+{
+	if(m_Matcher.NumWords() == 0)
+		return;
+
+	// byte offset of each codepoint, to censor a match of known length
+	std::vector<int> vOffsets;
+	vOffsets.reserve(str_length(pMessage) + 1);
+	int State = 0;
+	const char *pStr = pMessage;
+	while(true)
+	{
+		vOffsets.push_back(pStr - pMessage);
+		int Char = str_utf8_decode(&pStr);
+		if(Char == 0)
+			break;
+		State = m_Matcher.Next(State, Char);
+
+		int Length = m_Matcher.Value(State);
+		if(Length)
+		{
+			int Start = vOffsets[vOffsets.size() - Length];
+			memset(pMessage + Start, '*', (pStr - pMessage) - Start);
+		}
+	}
+}
@@ -0,0 +1,27 @@
+#ifndef GAME_SERVER_CENSOR_H
+#define GAME_SERVER_CENSOR_H
+
+#include <engine/shared/substring_matcher.h>
+
+#include <string>
+#include <vector>
+
+// Checks a message against all censored words in one pass.
+class CCensor
+{
+public:
+	// replaces the censored words, empty ones are ignored
+	void Init(const std::vector<std::string> &vWords);
+	int NumWords() const { return m_Matcher.NumWords(); }
+
+	// replaces every byte of each occurrence of a word with '*', matching
+	// is case insensitive and occurrences may overlap
+	void Censor(char *pMessage) const;
+
+private:
+	// the value of a word is its length in codepoints, so the longest
+	// word ending at a codepoint is reported
+	CSubstringMatcher m_Matcher;
+};
+
+#endif // GAME_SERVER_CENSOR_H
@@ -752,3 +752,19 @@ void CGameContext::ConDumpAntibot(IConsole::IResult *pResult, void *pUserData)
 	CGameContext *pSelf = (CGameContext *)pUserData;
 	pSelf->Antibot()->Dump();
 }
+
+void CGameContext::ConDumpTeeHistorian(IConsole::IResult *pResult, void *pUserData)
+{
+	CGameContext *pSelf = (CGameContext *)pUserData;
+	if(!pSelf->m_TeeHistorianActive)
+	{
+		pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "teehistorian", "not recording");
+		return;
+	}
+	CTeeHistorianWriter::CStats Stats;
+	pSelf->m_TeeHistorianWriter.GetStats(&Stats);
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "in=%lld written=%lld parts=%d queued=%lld max_queued=%lld dropped=%lld compress_time=%lldus",
+		Stats.m_BytesIn, Stats.m_BytesWritten, Stats.m_NumParts, Stats.m_BytesQueued, Stats.m_MaxBytesQueued, Stats.m_BytesDropped, Stats.m_CompressTime);
+	pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "teehistorian", aBuf);
+}
@@ -107,7 +107,37 @@ void CGameContext::Clear()
 void CGameContext::TeeHistorianWrite(const void *pData, int DataSize, void *pUser)
 {
 	CGameContext *pSelf = (CGameContext *)pUser;
-	aio_write(pSelf->m_pTeeHistorianFile, pData, DataSize);
+	pSelf->m_TeeHistorianWriter.Write(pData, DataSize);
+}
+
+void CGameContext::TeeHistorianIndex(int Tick, const void *pState, int StateSize, void *pUser)
+{
+	CGameContext *pSelf = (CGameContext *)pUser;
+	pSelf->m_TeeHistorianWriter.WriteIndex(Tick, pState, StateSize);
+}
+
+IOHANDLE CGameContext::TeeHistorianOpenFile(int Part, bool Index, void *pUser)
+{
+	CGameContext *pSelf = (CGameContext *)pUser;
+
+	char aGameUuid[UUID_MAXSTRSIZE];
+	FormatUuid(pSelf->m_GameUuid, aGameUuid, sizeof(aGameUuid));
+
+	char aFilename[64];
+	const char *pExtension = CTeeHistorianWriter::FileExtension(pSelf->m_TeeHistorianWriter.Compression());
+	if(Index)
+		str_format(aFilename, sizeof(aFilename), "teehistorian/%s.teehistorian.index", aGameUuid);
+	else if(Part == 0)
+		str_format(aFilename, sizeof(aFilename), "teehistorian/%s%s", aGameUuid, pExtension);
+	else
+		str_format(aFilename, sizeof(aFilename), "teehistorian/%s_%d%s", aGameUuid, Part, pExtension);
+
+	IOHANDLE File = pSelf->Storage()->OpenFile(aFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
+	if(!File)
+		dbg_msg("teehistorian", "failed to open '%s'", aFilename);
+	else
+		dbg_msg("teehistorian", "recording to '%s'", aFilename);
+	return File;
 }
 
 void CGameContext::CommandCallback(int ClientID, int FlagMask, const char *pCmd, IConsole::IResult *pResult, void *pUser)
@@ -730,12 +760,19 @@ void CGameContext::OnTick()
 
 	if(m_TeeHistorianActive)
 	{
-		int Error = aio_error(m_pTeeHistorianFile);
+		int Error = m_TeeHistorianWriter.Error();
 		if(Error)
 		{
 			dbg_msg("teehistorian", "error writing to file, err=%d", Error);
 			Server()->SetErrorShutdown("teehistorian io error");
 		}
+		int64 Dropped = m_TeeHistorianWriter.BytesDropped();
+		if(Dropped != m_TeeHistorianDropped)
+		{
+			if(m_TeeHistorianDropped == 0)
+				dbg_msg("teehistorian", "write queue over sv_tee_historian_buffer_size=%d KiB, truncating recording", g_Config.m_SvTeeHistorianBufferSize);
+			m_TeeHistorianDropped = Dropped;
+		}
 
 		if(!m_TeeHistorian.Starting())
 		{
@@ -752,6 +789,7 @@ void CGameContext::OnTick()
 
 	//if(world.paused) // make sure that the game object always updates
 	m_pController->Tick();
+	m_pScore->OnTick();
 
 	if(m_TeeHistorianActive)
 	{
@@ -1616,20 +1654,7 @@ void *CGameContext::PreProcessMsg(int *MsgID, CUnpacker *pUnpacker, int ClientID
 void CGameContext::CensorMessage(char *pCensoredMessage, const char *pMessage, int Size)
 {
 	str_copy(pCensoredMessage, pMessage, Size);
-
-	for(int i = 0; i < m_aCensorlist.size(); i++)
-	{
-		char *pCurLoc = pCensoredMessage;
-		do
-		{
-			pCurLoc = (char *)str_find_nocase(pCurLoc, m_aCensorlist[i].cstr());
-			if(pCurLoc)
-			{
-				memset(pCurLoc, '*', str_length(m_aCensorlist[i].cstr()));
-				pCurLoc++;
-			}
-		} while(pCurLoc);
-	}
+	m_Censor.Censor(pCensoredMessage);
 }
 
 void CGameContext::OnMessage(int MsgID, CUnpacker *pUnpacker, int ClientID)
@@ -3030,6 +3055,7 @@ void CGameContext::OnConsoleInit()
 	Console()->Register("add_map_votes", "", CFGFLAG_SERVER, ConAddMapVotes, this, "Automatically adds voting options for all maps");
 	Console()->Register("vote", "r['yes'|'no']", CFGFLAG_SERVER, ConVote, this, "Force a vote to yes/no");
 	Console()->Register("dump_antibot", "", CFGFLAG_SERVER, ConDumpAntibot, this, "Dumps the antibot status");
+	Console()->Register("dump_teehistorian", "", CFGFLAG_SERVER, ConDumpTeeHistorian, this, "Dumps the tee historian writer statistics");
 
 	Console()->Chain("sv_motd", ConchainSpecialMotdupdate, this);
 
@@ -3162,35 +3188,31 @@ void CGameContext::OnInit(/*class IKernel *pKernel*/)
 	{
 		CLineReader LineReader;
 		LineReader.Init(File);
+		std::vector<std::string> vWords;
 		char *pLine;
 		while((pLine = LineReader.Get()))
 		{
-			m_aCensorlist.add(pLine);
+			vWords.push_back(pLine);
 		}
 		io_close(File);
+		m_Censor.Init(vWords);
 	}
 
 	m_TeeHistorianActive = g_Config.m_SvTeeHistorian;
 	if(m_TeeHistorianActive)
 	{
-		char aGameUuid[UUID_MAXSTRSIZE];
-		FormatUuid(m_GameUuid, aGameUuid, sizeof(aGameUuid));
-
-		char aFilename[64];
-		str_format(aFilename, sizeof(aFilename), "teehistorian/%s.teehistorian", aGameUuid);
-
-		IOHANDLE File = Storage()->OpenFile(aFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
-		if(!File)
+		CTeeHistorianWriter::CConfig WriterConfig;
+		WriterConfig.m_Compression = g_Config.m_SvTeeHistorianCompression;
+		WriterConfig.m_CompressionLevel = g_Config.m_SvTeeHistorianCompressionLevel;
+		WriterConfig.m_RotateSize = (int64)g_Config.m_SvTeeHistorianRotateSize * 1024 * 1024;
+		WriterConfig.m_RotateTime = g_Config.m_SvTeeHistorianRotateTime * 60;
+		WriterConfig.m_MaxQueued = g_Config.m_SvTeeHistorianBufferSize * 1024;
+		m_TeeHistorianDropped = 0;
+		if(!m_TeeHistorianWriter.Open(&WriterConfig, TeeHistorianOpenFile, this))
 		{
-			dbg_msg("teehistorian", "failed to open '%s'", aFilename);
 			Server()->SetErrorShutdown("teehistorian open error");
 			return;
 		}
-		else
-		{
-			dbg_msg("teehistorian", "recording to '%s'", aFilename);
-		}
-		m_pTeeHistorianFile = aio_new(File);
 
 		char aVersion[128];
 		if(GIT_SHORTREV_HASH)
@@ -3221,6 +3243,8 @@ void CGameContext::OnInit(/*class IKernel *pKernel*/)
 		GameInfo.m_MapCrc = MapCrc;
 
 		m_TeeHistorian.Reset(&GameInfo, TeeHistorianWrite, this);
+		if(g_Config.m_SvTeeHistorianIndexInterval)
+			m_TeeHistorian.EnableIndex(g_Config.m_SvTeeHistorianIndexInterval, TeeHistorianIndex, this);
 
 		for(int i = 0; i < MAX_CLIENTS; i++)
 		{
@@ -3495,15 +3519,17 @@ void CGameContext::OnShutdown()
 	if(m_TeeHistorianActive)
 	{
 		m_TeeHistorian.Finish();
-		aio_close(m_pTeeHistorianFile);
-		aio_wait(m_pTeeHistorianFile);
-		int Error = aio_error(m_pTeeHistorianFile);
+		m_TeeHistorianWriter.Close();
+		int Error = m_TeeHistorianWriter.Error();
 		if(Error)
 		{
 			dbg_msg("teehistorian", "error closing file, err=%d", Error);
 			Server()->SetErrorShutdown("teehistorian close error");
 		}
-		aio_free(m_pTeeHistorianFile);
+		if(m_TeeHistorianDropped)
+		{
+			dbg_msg("teehistorian", "recording was truncated, dropped %lld bytes", m_TeeHistorianWriter.BytesDropped());
+		}
 	}
 
 	DeleteTempfile();
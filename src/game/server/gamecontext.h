@@ -7,6 +7,7 @@
 #include <engine/console.h>
 #include <engine/server.h>
 #include <engine/shared/memheap.h>
+#include <engine/shared/teehistorian_writer.h>
 
 #include <game/layers.h>
 #include <game/mapbugs.h>
@@ -15,6 +16,7 @@
 #include <base/tl/array.h>
 #include <base/tl/string.h>
 
+#include "censor.h"
 #include "eventhandler.h"
 #include "gamecontroller.h"
 #include "gameworld.h"
@@ -78,17 +80,20 @@ class CGameContext : public IGameServer
 	CNetObjHandler m_NetObjHandler;
 	CTuningParams m_Tuning;
 	CTuningParams m_aTuningList[NUM_TUNEZONES];
-	array<string> m_aCensorlist;
+	CCensor m_Censor;
 
 	bool m_TeeHistorianActive;
 	CTeeHistorian m_TeeHistorian;
-	ASYNCIO *m_pTeeHistorianFile;
+	CTeeHistorianWriter m_TeeHistorianWriter;
+	int64 m_TeeHistorianDropped;
 	CUuid m_GameUuid;
 	CMapBugs m_MapBugs;
 	CPrng m_Prng;
 
 	static void CommandCallback(int ClientID, int FlagMask, const char *pCmd, IConsole::IResult *pResult, void *pUser);
 	static void TeeHistorianWrite(const void *pData, int DataSize, void *pUser);
+	static void TeeHistorianIndex(int Tick, const void *pState, int StateSize, void *pUser);
+	static IOHANDLE TeeHistorianOpenFile(int Part, bool Index, void *pUser);
 
 	static void ConTuneParam(IConsole::IResult *pResult, void *pUserData);
 	static void ConToggleTuneParam(IConsole::IResult *pResult, void *pUserData);
@@ -119,6 +124,7 @@ class CGameContext : public IGameServer
 	static void ConVoteNo(IConsole::IResult *pResult, void *pUserData);
 	static void ConDrySave(IConsole::IResult *pResult, void *pUserData);
 	static void ConDumpAntibot(IConsole::IResult *pResult, void *pUserData);
+	static void ConDumpTeeHistorian(IConsole::IResult *pResult, void *pUserData);
 	static void ConchainSpecialMotdupdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 
 	CGameContext(int Resetting);
@@ -0,0 +1,116 @@
+#include "leaderboard.h"
+
+#include <base/math.h>
+#include <base/system.h>
+
+#include <algorithm>
+
+CLeaderboard::CLeaderboard(bool Descending) :
+	m_Descending(Descending),
+	m_Loaded(false)
+{
+}
+
+bool CLeaderboard::Better(float Score1, float Score2) const
+{
+	return m_Descending ? Score1 > Score2 : Score1 < Score2;
+}
+
+int CLeaderboard::FirstIndex(float Score) const
+{
+	auto It = std::lower_bound(m_vEntries.begin(), m_vEntries.end(), Score,
+		[this](const CEntry &Entry, float Value) { return Better(Entry.m_Score, Value); });
+	return It - m_vEntries.begin();
+}
+
+void CLeaderboard::Set(const std::vector<CEntry> &vEntries)
+{
+	m_vEntries = vEntries;
+	std::stable_sort(m_vEntries.begin(), m_vEntries.end(),
+		[this](const CEntry &Entry1, const CEntry &Entry2) { return Better(Entry1.m_Score, Entry2.m_Score); });
+	m_Scores.clear();
+	m_Scores.reserve(m_vEntries.size());
+	for(const CEntry &Entry : m_vEntries)
+		m_Scores[Entry.m_aName] = Entry.m_Score;
+	m_Loaded = true;
+}
+
+void CLeaderboard::Insert(const char *pName, float Score)
+{
+	// behind all entries with the same score
+	auto It = std::upper_bound(m_vEntries.begin(), m_vEntries.end(), Score,
+		[this](float Value, const CEntry &Entry) { return Better(Value, Entry.m_Score); });
+	CEntry Entry;
+	str_copy(Entry.m_aName, pName, sizeof(Entry.m_aName));
+	Entry.m_Score = Score;
+	m_vEntries.insert(It, Entry);
+	m_Scores[pName] = Score;
+}
+
+void CLeaderboard::Remove(const char *pName, float Score)
+{
+	for(int i = FirstIndex(Score); i < (int)m_vEntries.size() && m_vEntries[i].m_Score == Score; i++)
+	{
+		if(str_comp(m_vEntries[i].m_aName, pName) == 0)
+		{
+			m_vEntries.erase(m_vEntries.begin() + i);
+			break;
+		}
+	}
+	m_Scores.erase(pName);
+}
+
+void CLeaderboard::Update(const char *pName, float Score)
+{
+	auto It = m_Scores.find(pName);
+	if(It != m_Scores.end())
+	{
+		if(!Better(Score, It->second))
+			return;
+		Remove(pName, It->second);
+	}
+	Insert(pName, Score);
+}
+
+void CLeaderboard::Add(const char *pName, float Score)
+{
+	auto It = m_Scores.find(pName);
+	if(It != m_Scores.end())
+	{
+		float Old = It->second;
+		Remove(pName, Old);
+		Score += Old;
+	}
+	Insert(pName, Score);
+}
+
+void CLeaderboard::Clear()
+{
+	m_vEntries.clear();
+	m_Scores.clear();
+	m_Loaded = false;
+}
+
+bool CLeaderboard::Rank(const char *pName, int *pRank, float *pScore) const
+{
+	auto It = m_Scores.find(pName);
+	if(It == m_Scores.end())
+		return false;
+	*pRank = FirstIndex(It->second) + 1;
+	*pScore = It->second;
+	return true;
+}
+
+int CLeaderboard::Top(int Offset, int Num, int *pRanks, CEntry *pEntries) const
+{
+	int Start = maximum(absolute(Offset) - 1, 0);
+	int Size = m_vEntries.size();
+	int Count = 0;
+	for(int i = Start; i < Size && Count < Num; i++, Count++)
+	{
+		const CEntry &Entry = m_vEntries[Offset >= 0 ? i : Size - 1 - i];
+		pRanks[Count] = FirstIndex(Entry.m_Score) + 1;
+		pEntries[Count] = Entry;
+	}
+	return Count;
+}
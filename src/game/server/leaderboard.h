@@ -0,0 +1,55 @@
+#ifndef GAME_SERVER_LEADERBOARD_H
+#define GAME_SERVER_LEADERBOARD_H
+
+#include <engine/shared/protocol.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// In-memory copy of a ranking, e.g. the best times on the current map or
+// the points of all players, so that rank and top lists can be answered
+// without a database query. Equal scores share a rank like `RANK()`.
+class CLeaderboard
+{
+public:
+	struct CEntry
+	{
+		char m_aName[MAX_NAME_LENGTH];
+		float m_Score;
+	};
+
+	// higher scores rank first if `Descending` is set
+	CLeaderboard(bool Descending);
+
+	// replaces all entries, names are expected to be unique
+	void Set(const std::vector<CEntry> &vEntries);
+	// adds the name or keeps the better of its old and new score
+	void Update(const char *pName, float Score);
+	// adds `Score` to the current score of the name
+	void Add(const char *pName, float Score);
+	void Clear();
+
+	bool Loaded() const { return m_Loaded; }
+	int Size() const { return m_vEntries.size(); }
+
+	// returns false if the name isn't ranked
+	bool Rank(const char *pName, int *pRank, float *pScore) const;
+	// fills at most `Num` entries starting at rank `Offset` like `/top5`,
+	// a negative offset counts from the last rank backwards
+	int Top(int Offset, int Num, int *pRanks, CEntry *pEntries) const;
+
+private:
+	bool Better(float Score1, float Score2) const;
+	int FirstIndex(float Score) const;
+	void Insert(const char *pName, float Score);
+	void Remove(const char *pName, float Score);
+
+	bool m_Descending;
+	bool m_Loaded;
+	// sorted from best to worst
+	std::vector<CEntry> m_vEntries;
+	std::unordered_map<std::string, float> m_Scores;
+};
+
+#endif // GAME_SERVER_LEADERBOARD_H
@@ -166,20 +166,6 @@ static int PlayerFlags_SixToSeven(int Flags)
 
 void CPlayer::Tick()
 {
-#ifdef CONF_DEBUG
-	if(!g_Config.m_DbgDummies || m_ClientID < MAX_CLIENTS - g_Config.m_DbgDummies)
-#endif
-		if(m_ScoreQueryResult != nullptr && m_ScoreQueryResult.use_count() == 1)
-		{
-			ProcessScoreResult(*m_ScoreQueryResult);
-			m_ScoreQueryResult = nullptr;
-		}
-	if(m_ScoreFinishResult != nullptr && m_ScoreFinishResult.use_count() == 1)
-	{
-		ProcessScoreResult(*m_ScoreFinishResult);
-		m_ScoreFinishResult = nullptr;
-	}
-
 	if(!Server()->ClientIngame(m_ClientID))
 		return;
 
@@ -924,6 +910,26 @@ void CPlayer::SpectatePlayerName(const char *pName)
 	}
 }
 
+void CPlayer::OnScoreResult(CScorePlayerResult *pResult)
+{
+	// results of a player who left before they arrived don't match
+	if(m_ScoreQueryResult.get() == pResult)
+	{
+#ifdef CONF_DEBUG
+		if(!g_Config.m_DbgDummies || m_ClientID < MAX_CLIENTS - g_Config.m_DbgDummies)
+#endif
+		{
+			ProcessScoreResult(*m_ScoreQueryResult);
+			m_ScoreQueryResult = nullptr;
+		}
+	}
+	else if(m_ScoreFinishResult.get() == pResult)
+	{
+		ProcessScoreResult(*m_ScoreFinishResult);
+		m_ScoreFinishResult = nullptr;
+	}
+}
+
 void CPlayer::ProcessScoreResult(CScorePlayerResult &Result)
 {
 	if(Result.m_Done) // SQL request was successful
@@ -195,6 +195,8 @@ public:
 	bool m_Halloween;
 	bool m_FirstPacket;
 	int64 m_LastSQLQuery;
+	// takes the result if it belongs to a request of this player
+	void OnScoreResult(CScorePlayerResult *pResult);
 	void ProcessScoreResult(CScorePlayerResult &Result);
 	std::shared_ptr<CScorePlayerResult> m_ScoreQueryResult;
 	std::shared_ptr<CScorePlayerResult> m_ScoreFinishResult;
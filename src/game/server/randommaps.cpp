@@ -0,0 +1,60 @@
+#include "randommaps.h"
+
+#include <base/system.h>
+#include <game/prng.h>
+
+CRandomMaps::CRandomMaps() :
+	m_Loaded(false)
+{
+}
+
+void CRandomMaps::Set(const std::vector<CMap> &vMaps)
+{
+	m_vMaps = vMaps;
+	m_vAll.clear();
+	m_ByStars.clear();
+	for(int i = 0; i < (int)m_vMaps.size(); i++)
+	{
+		m_vAll.push_back(i);
+		m_ByStars[m_vMaps[i].m_Stars].push_back(i);
+	}
+	m_Loaded = true;
+}
+
+bool CRandomMaps::Excluded(int Map, const char *pExclude, const std::unordered_set<std::string> *pFinished) const
+{
+	const char *pName = m_vMaps[Map].m_aName;
+	return str_comp(pName, pExclude) == 0 || (pFinished && pFinished->count(pName));
+}
+
+const char *CRandomMaps::Pick(int Stars, const char *pExclude, const std::unordered_set<std::string> *pFinished, CPrng *pPrng) const
+{
+	const std::vector<int> *pCandidates = &m_vAll;
+	if(Stars >= 0)
+	{
+		auto It = m_ByStars.find(Stars);
+		if(It == m_ByStars.end())
+			return nullptr;
+		pCandidates = &It->second;
+	}
+	if(pCandidates->empty())
+		return nullptr;
+
+	// usually only few maps are excluded, so random tries hit quickly
+	for(int i = 0; i < 8; i++)
+	{
+		int Map = (*pCandidates)[pPrng->RandomBits() % pCandidates->size()];
+		if(!Excluded(Map, pExclude, pFinished))
+			return m_vMaps[Map].m_aName;
+	}
+
+	std::vector<int> vLeft;
+	for(int Map : *pCandidates)
+	{
+		if(!Excluded(Map, pExclude, pFinished))
+			vLeft.push_back(Map);
+	}
+	if(vLeft.empty())
+		return nullptr;
+	return m_vMaps[vLeft[pPrng->RandomBits() % vLeft.size()]].m_aName;
+}
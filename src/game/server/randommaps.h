@@ -0,0 +1,42 @@
+#ifndef GAME_SERVER_RANDOMMAPS_H
+#define GAME_SERVER_RANDOMMAPS_H
+
+#include <engine/map.h>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class CPrng;
+
+// Maps of this server grouped by star rating, so that random map votes
+// don't have to sort the maps table.
+class CRandomMaps
+{
+public:
+	struct CMap
+	{
+		char m_aName[MAX_MAP_LENGTH];
+		int m_Stars;
+	};
+
+	CRandomMaps();
+
+	void Set(const std::vector<CMap> &vMaps);
+	bool Loaded() const { return m_Loaded; }
+
+	// picks a map other than `pExclude` that isn't in `pFinished`, from
+	// all maps if `Stars` is negative. Returns nullptr if none is left
+	const char *Pick(int Stars, const char *pExclude, const std::unordered_set<std::string> *pFinished, CPrng *pPrng) const;
+
+private:
+	bool Excluded(int Map, const char *pExclude, const std::unordered_set<std::string> *pFinished) const;
+
+	bool m_Loaded;
+	std::vector<CMap> m_vMaps;
+	std::vector<int> m_vAll;
+	std::unordered_map<int, std::vector<int>> m_ByStars;
+};
+
+#endif // GAME_SERVER_RANDOMMAPS_H
@@ -1,20 +1,11 @@
 #include "save.h"
 
-#include <cstdio>
 #include <new>
 
 #include "gamemodes/DDRace.h"
 #include "teams.h"
 #include <engine/shared/config.h>
 
-CSaveTee::CSaveTee()
-{
-}
-
-CSaveTee::~CSaveTee()
-{
-}
-
 void CSaveTee::save(CCharacter *pChr)
 {
 	m_ClientID = pChr->m_pPlayer->GetCID();
@@ -203,187 +194,6 @@ void CSaveTee::load(CCharacter *pChr, int Team)
 	pChr->SetRescue();
 }
 
-char *CSaveTee::GetString(const CSaveTeam *pTeam)
-{
-	// Add time penalty of 60 seconds (only to the database)
-	int Time = m_Time + 60 * SERVER_TICK_SPEED;
-
-	int HookedPlayer = -1;
-	if(m_HookedPlayer != -1)
-	{
-		for(int n = 0; n < pTeam->GetMembersCount(); n++)
-		{
-			if(m_HookedPlayer == pTeam->m_pSavedTees[n].GetClientID())
-			{
-				HookedPlayer = n;
-				break;
-			}
-		}
-	}
-
-	str_format(m_aString, sizeof(m_aString),
-		"%s\t%d\t%d\t%d\t%d\t%d\t"
-		// weapons
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t"
-		// tee stats
-		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_SuperJump
-		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_DDRaceState
-		"%d\t%d\t%d\t%d\t" // m_Pos.x
-		"%d\t%d\t" // m_TeleCheckpoint
-		"%d\t%d\t%f\t%f\t" // m_CorePos.x
-		"%d\t%d\t%d\t%d\t" // m_ActiveWeapon
-		"%d\t%d\t%f\t%f\t" // m_HookPos.x
-		"%d\t%d\t%d\t%d\t" // m_HookTeleBase.x
-		// time checkpoints
-		"%d\t%d\t%d\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%d\t"
-		"%d\t%d\t%d\t"
-		"%s\t"
-		"%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t%d\t%d",
-		m_aName, m_Alive, m_Paused, m_NeededFaketuning, m_TeeFinished, m_IsSolo,
-		// weapons
-		m_aWeapons[0].m_AmmoRegenStart, m_aWeapons[0].m_Ammo, m_aWeapons[0].m_Ammocost, m_aWeapons[0].m_Got,
-		m_aWeapons[1].m_AmmoRegenStart, m_aWeapons[1].m_Ammo, m_aWeapons[1].m_Ammocost, m_aWeapons[1].m_Got,
-		m_aWeapons[2].m_AmmoRegenStart, m_aWeapons[2].m_Ammo, m_aWeapons[2].m_Ammocost, m_aWeapons[2].m_Got,
-		m_aWeapons[3].m_AmmoRegenStart, m_aWeapons[3].m_Ammo, m_aWeapons[3].m_Ammocost, m_aWeapons[3].m_Got,
-		m_aWeapons[4].m_AmmoRegenStart, m_aWeapons[4].m_Ammo, m_aWeapons[4].m_Ammocost, m_aWeapons[4].m_Got,
-		m_aWeapons[5].m_AmmoRegenStart, m_aWeapons[5].m_Ammo, m_aWeapons[5].m_Ammocost, m_aWeapons[5].m_Got,
-		m_LastWeapon, m_QueuedWeapon,
-		// tee states
-		m_SuperJump, m_Jetpack, m_NinjaJetpack, m_FreezeTime, m_FreezeTick, m_DeepFreeze, m_EndlessHook,
-		m_DDRaceState, m_Hit, m_Collision, m_TuneZone, m_TuneZoneOld, m_Hook, Time,
-		(int)m_Pos.x, (int)m_Pos.y, (int)m_PrevPos.x, (int)m_PrevPos.y,
-		m_TeleCheckpoint, m_LastPenalty,
-		(int)m_CorePos.x, (int)m_CorePos.y, m_Vel.x, m_Vel.y,
-		m_ActiveWeapon, m_Jumped, m_JumpedTotal, m_Jumps,
-		(int)m_HookPos.x, (int)m_HookPos.y, m_HookDir.x, m_HookDir.y,
-		(int)m_HookTeleBase.x, (int)m_HookTeleBase.y, m_HookTick, m_HookState,
-		// time checkpoints
-		m_CpTime, m_CpActive, m_CpLastBroadcast,
-		m_aCpCurrent[0], m_aCpCurrent[1], m_aCpCurrent[2], m_aCpCurrent[3], m_aCpCurrent[4],
-		m_aCpCurrent[5], m_aCpCurrent[6], m_aCpCurrent[7], m_aCpCurrent[8], m_aCpCurrent[9],
-		m_aCpCurrent[10], m_aCpCurrent[11], m_aCpCurrent[12], m_aCpCurrent[13], m_aCpCurrent[14],
-		m_aCpCurrent[15], m_aCpCurrent[16], m_aCpCurrent[17], m_aCpCurrent[18], m_aCpCurrent[19],
-		m_aCpCurrent[20], m_aCpCurrent[21], m_aCpCurrent[22], m_aCpCurrent[23], m_aCpCurrent[24],
-		m_NotEligibleForFinish,
-		m_HasTelegunGun, m_HasTelegunLaser, m_HasTelegunGrenade,
-		m_aGameUuid,
-		HookedPlayer, m_NewHook,
-		m_InputDirection, m_InputJump, m_InputFire, m_InputHook,
-		m_ReloadTimer[0], m_ReloadTimer[1], m_ReloadTimer[2], m_ReloadTimer[3], m_ReloadTimer[4], m_ReloadTimer[5]);
-	return m_aString;
-}
-
-int CSaveTee::FromString(const char *String)
-{
-	int Num;
-	Num = sscanf(String,
-		"%[^\t]\t%d\t%d\t%d\t%d\t%d\t"
-		// weapons
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t"
-		// tee states
-		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_SuperJump
-		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_DDRaceState
-		"%f\t%f\t%f\t%f\t" // m_Pos.x
-		"%d\t%d\t" // m_TeleCheckpoint
-		"%f\t%f\t%f\t%f\t" // m_CorePos.x
-		"%d\t%d\t%d\t%d\t" // m_ActiveWeapon
-		"%f\t%f\t%f\t%f\t" // m_HookPos.x
-		"%f\t%f\t%d\t%d\t" // m_HookTeleBase.x
-		// time checkpoints
-		"%d\t%d\t%d\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%f\t%f\t%f\t%f\t%f\t"
-		"%d\t"
-		"%d\t%d\t%d\t"
-		"%36s\t"
-		"%d\t%d"
-		"%d\t%d\t%d\t%d\t"
-		"%d\t%d\t%d\t%d\t%d\t%d",
-		m_aName, &m_Alive, &m_Paused, &m_NeededFaketuning, &m_TeeFinished, &m_IsSolo,
-		// weapons
-		&m_aWeapons[0].m_AmmoRegenStart, &m_aWeapons[0].m_Ammo, &m_aWeapons[0].m_Ammocost, &m_aWeapons[0].m_Got,
-		&m_aWeapons[1].m_AmmoRegenStart, &m_aWeapons[1].m_Ammo, &m_aWeapons[1].m_Ammocost, &m_aWeapons[1].m_Got,
-		&m_aWeapons[2].m_AmmoRegenStart, &m_aWeapons[2].m_Ammo, &m_aWeapons[2].m_Ammocost, &m_aWeapons[2].m_Got,
-		&m_aWeapons[3].m_AmmoRegenStart, &m_aWeapons[3].m_Ammo, &m_aWeapons[3].m_Ammocost, &m_aWeapons[3].m_Got,
-		&m_aWeapons[4].m_AmmoRegenStart, &m_aWeapons[4].m_Ammo, &m_aWeapons[4].m_Ammocost, &m_aWeapons[4].m_Got,
-		&m_aWeapons[5].m_AmmoRegenStart, &m_aWeapons[5].m_Ammo, &m_aWeapons[5].m_Ammocost, &m_aWeapons[5].m_Got,
-		&m_LastWeapon, &m_QueuedWeapon,
-		// tee states
-		&m_SuperJump, &m_Jetpack, &m_NinjaJetpack, &m_FreezeTime, &m_FreezeTick, &m_DeepFreeze, &m_EndlessHook,
-		&m_DDRaceState, &m_Hit, &m_Collision, &m_TuneZone, &m_TuneZoneOld, &m_Hook, &m_Time,
-		&m_Pos.x, &m_Pos.y, &m_PrevPos.x, &m_PrevPos.y,
-		&m_TeleCheckpoint, &m_LastPenalty,
-		&m_CorePos.x, &m_CorePos.y, &m_Vel.x, &m_Vel.y,
-		&m_ActiveWeapon, &m_Jumped, &m_JumpedTotal, &m_Jumps,
-		&m_HookPos.x, &m_HookPos.y, &m_HookDir.x, &m_HookDir.y,
-		&m_HookTeleBase.x, &m_HookTeleBase.y, &m_HookTick, &m_HookState,
-		// time checkpoints
-		&m_CpTime, &m_CpActive, &m_CpLastBroadcast,
-		&m_aCpCurrent[0], &m_aCpCurrent[1], &m_aCpCurrent[2], &m_aCpCurrent[3], &m_aCpCurrent[4],
-		&m_aCpCurrent[5], &m_aCpCurrent[6], &m_aCpCurrent[7], &m_aCpCurrent[8], &m_aCpCurrent[9],
-		&m_aCpCurrent[10], &m_aCpCurrent[11], &m_aCpCurrent[12], &m_aCpCurrent[13], &m_aCpCurrent[14],
-		&m_aCpCurrent[15], &m_aCpCurrent[16], &m_aCpCurrent[17], &m_aCpCurrent[18], &m_aCpCurrent[19],
-		&m_aCpCurrent[20], &m_aCpCurrent[21], &m_aCpCurrent[22], &m_aCpCurrent[23], &m_aCpCurrent[24],
-		&m_NotEligibleForFinish,
-		&m_HasTelegunGun, &m_HasTelegunLaser, &m_HasTelegunGrenade,
-		m_aGameUuid,
-		&m_HookedPlayer, &m_NewHook,
-		&m_InputDirection, &m_InputJump, &m_InputFire, &m_InputHook,
-		&m_ReloadTimer[0], &m_ReloadTimer[1], &m_ReloadTimer[2], &m_ReloadTimer[3], &m_ReloadTimer[4], &m_ReloadTimer[5]);
-	switch(Num) // Don't forget to update this when you save / load more / less.
-	{
-	case 96:
-		m_NotEligibleForFinish = false;
-		// fall through
-	case 97:
-		m_HasTelegunGrenade = 0;
-		m_HasTelegunLaser = 0;
-		m_HasTelegunGun = 0;
-		// fall through
-	case 101:
-		m_HookedPlayer = -1;
-		m_NewHook = false;
-		if(m_HookState == HOOK_GRABBED)
-			m_HookState = HOOK_FLYING;
-		m_InputDirection = 0;
-		m_InputJump = 0;
-		m_InputFire = 0;
-		m_InputHook = 0;
-		for(int i = 0; i < NUM_WEAPONS; i++)
-			m_ReloadTimer[i] = 0;
-		// fall through
-	case 108:
-		return 0;
-	default:
-		dbg_msg("load", "failed to load tee-string");
-		dbg_msg("load", "loaded %d vars", Num);
-		return Num + 1; // never 0 here
-	}
-}
-
 void CSaveTee::LoadHookedPlayer(const CSaveTeam *pTeam)
 {
 	if(m_HookedPlayer == -1)
@@ -391,21 +201,6 @@ void CSaveTee::LoadHookedPlayer(const CSaveTeam *pTeam)
 	m_HookedPlayer = pTeam->m_pSavedTees[m_HookedPlayer].GetClientID();
 }
 
-CSaveTeam::CSaveTeam(IGameController *Controller)
-{
-	m_pController = Controller;
-	m_pSwitchers = 0;
-	m_pSavedTees = 0;
-}
-
-CSaveTeam::~CSaveTeam()
-{
-	if(m_pSwitchers)
-		delete[] m_pSwitchers;
-	if(m_pSavedTees)
-		delete[] m_pSavedTees;
-}
-
 int CSaveTeam::save(int Team)
 {
 	if(g_Config.m_SvTeam == 3 || (Team > 0 && Team < MAX_CLIENTS))
@@ -531,177 +326,6 @@ CCharacter *CSaveTeam::MatchCharacter(int ClientID, int SaveID, bool KeepCurrent
 	return m_pController->GameServer()->m_apPlayers[ClientID]->ForceSpawn(m_pSavedTees[SaveID].GetPos());
 }
 
-char *CSaveTeam::GetString()
-{
-	str_format(m_aString, sizeof(m_aString), "%d\t%d\t%d\t%d\t%d", m_TeamState, m_MembersCount, m_NumSwitchers, m_TeamLocked, m_Practice);
-
-	for(int i = 0; i < m_MembersCount; i++)
-	{
-		char aBuf[1024];
-		str_format(aBuf, sizeof(aBuf), "\n%s", m_pSavedTees[i].GetString(this));
-		str_append(m_aString, aBuf, sizeof(m_aString));
-	}
-
-	if(m_pSwitchers && m_NumSwitchers)
-	{
-		for(int i = 1; i < m_NumSwitchers + 1; i++)
-		{
-			char aBuf[64];
-			str_format(aBuf, sizeof(aBuf), "\n%d\t%d\t%d", m_pSwitchers[i].m_Status, m_pSwitchers[i].m_EndTime, m_pSwitchers[i].m_Type);
-			str_append(m_aString, aBuf, sizeof(m_aString));
-		}
-	}
-
-	return m_aString;
-}
-
-int CSaveTeam::FromString(const char *String)
-{
-	char TeamStats[MAX_CLIENTS];
-	char Switcher[64];
-	char SaveTee[1024];
-
-	char *CopyPos;
-	unsigned int Pos = 0;
-	unsigned int LastPos = 0;
-	unsigned int StrSize;
-
-	str_copy(m_aString, String, sizeof(m_aString));
-
-	while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
-		Pos++;
-
-	CopyPos = m_aString + LastPos;
-	StrSize = Pos - LastPos + 1;
-	if(m_aString[Pos] == '\n')
-	{
-		Pos++; // skip \n
-		LastPos = Pos;
-	}
-
-	if(StrSize <= 0)
-	{
-		dbg_msg("load", "savegame: wrong format (couldn't load teamstats)");
-		return 1;
-	}
-
-	if(StrSize < sizeof(TeamStats))
-	{
-		str_copy(TeamStats, CopyPos, StrSize);
-		int Num = sscanf(TeamStats, "%d\t%d\t%d\t%d\t%d", &m_TeamState, &m_MembersCount, &m_NumSwitchers, &m_TeamLocked, &m_Practice);
-		switch(Num) // Don't forget to update this when you save / load more / less.
-		{
-		case 4:
-			m_Practice = false;
-			// fallthrough
-		case 5:
-			break;
-		default:
-			dbg_msg("load", "failed to load teamstats");
-			dbg_msg("load", "loaded %d vars", Num);
-			return Num + 1; // never 0 here
-		}
-	}
-	else
-	{
-		dbg_msg("load", "savegame: wrong format (couldn't load teamstats, too big)");
-		return 1;
-	}
-
-	if(m_pSavedTees)
-	{
-		delete[] m_pSavedTees;
-		m_pSavedTees = 0;
-	}
-
-	if(m_MembersCount)
-		m_pSavedTees = new CSaveTee[m_MembersCount];
-
-	for(int n = 0; n < m_MembersCount; n++)
-	{
-		while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
-			Pos++;
-
-		CopyPos = m_aString + LastPos;
-		StrSize = Pos - LastPos + 1;
-		if(m_aString[Pos] == '\n')
-		{
-			Pos++; // skip \n
-			LastPos = Pos;
-		}
-
-		if(StrSize <= 0)
-		{
-			dbg_msg("load", "savegame: wrong format (couldn't load tee)");
-			return 1;
-		}
-
-		if(StrSize < sizeof(SaveTee))
-		{
-			str_copy(SaveTee, CopyPos, StrSize);
-			int Num = m_pSavedTees[n].FromString(SaveTee);
-			if(Num)
-			{
-				dbg_msg("load", "failed to load tee");
-				dbg_msg("load", "loaded %d vars", Num - 1);
-				return 1;
-			}
-		}
-		else
-		{
-			dbg_msg("load", "savegame: wrong format (couldn't load tee, too big)");
-			return 1;
-		}
-	}
-
-	if(m_pSwitchers)
-	{
-		delete[] m_pSwitchers;
-		m_pSwitchers = 0;
-	}
-
-	if(m_NumSwitchers)
-		m_pSwitchers = new SSimpleSwitchers[m_NumSwitchers + 1];
-
-	for(int n = 1; n < m_NumSwitchers + 1; n++)
-	{
-		while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
-			Pos++;
-
-		CopyPos = m_aString + LastPos;
-		StrSize = Pos - LastPos + 1;
-		if(m_aString[Pos] == '\n')
-		{
-			Pos++; // skip \n
-			LastPos = Pos;
-		}
-
-		if(StrSize <= 0)
-		{
-			dbg_msg("load", "savegame: wrong format (couldn't load switcher)");
-			return 1;
-		}
-
-		if(StrSize < sizeof(Switcher))
-		{
-			str_copy(Switcher, CopyPos, StrSize);
-			int Num = sscanf(Switcher, "%d\t%d\t%d", &(m_pSwitchers[n].m_Status), &(m_pSwitchers[n].m_EndTime), &(m_pSwitchers[n].m_Type));
-			if(Num != 3)
-			{
-				dbg_msg("load", "failed to load switcher");
-				dbg_msg("load", "loaded %d vars", Num - 1);
-			}
-		}
-		else
-		{
-			dbg_msg("load", "savegame: wrong format (couldn't load switcher, too big)");
-			return 1;
-		}
-	}
-
-	return 0;
-}
-
 bool CSaveTeam::MatchPlayers(const char (*paNames)[MAX_NAME_LENGTH], const int *pClientID, int NumPlayer, char *pMessage, int MessageLen)
 {
 	if(NumPlayer > m_MembersCount)
@@ -8,7 +8,9 @@
 class IGameController;
 class CGameContext;
 class CCharacter;
+class CPacker;
 class CSaveTeam;
+class CUnpacker;
 
 class CSaveTee
 {
@@ -19,13 +21,21 @@ public:
 	void load(CCharacter *pchr, int Team);
 	char *GetString(const CSaveTeam *pTeam);
 	int FromString(const char *String);
+	// compact encoding of everything but the name, see CSaveTeam::GetString
+	bool Pack(CPacker *pPacker, const CSaveTeam *pTeam);
+	bool Unpack(CUnpacker *pUnpacker);
 	void LoadHookedPlayer(const CSaveTeam *pTeam);
 	vec2 GetPos() const { return m_Pos; }
 	const char *GetName() const { return m_aName; }
+	void SetName(const char *pName);
 	int GetClientID() const { return m_ClientID; }
 	void SetClientID(int ClientID) { m_ClientID = ClientID; };
 
 private:
+	// time and hooked player as they are stored in the database
+	int SavedTime() const;
+	int SavedHookedPlayer(const CSaveTeam *pTeam) const;
+
 	int m_ClientID;
 
 	char m_aString[2048];
@@ -110,11 +120,20 @@ private:
 class CSaveTeam
 {
 public:
+	enum
+	{
+		// version of the compact format, increase it when adding fields
+		COMPACT_VERSION = 1,
+	};
+
 	CSaveTeam(IGameController *Controller);
 	~CSaveTeam();
-	char *GetString();
+	// the compact format stores the state of each tee in base64 after its
+	// name and is protected by a checksum, the text format is kept for
+	// logs and older servers
+	char *GetString(bool Compact = false);
 	int GetMembersCount() const { return m_MembersCount; }
-	// MatchPlayers has to be called afterwards
+	// reads both formats, MatchPlayers has to be called afterwards
 	int FromString(const char *String);
 	// returns true if a team can load, otherwise writes a nice error Message in pMessage
 	bool MatchPlayers(const char (*paNames)[MAX_NAME_LENGTH], const int *pClientID, int NumPlayer, char *pMessage, int MessageLen);
@@ -127,6 +146,8 @@ public:
 
 private:
 	CCharacter *MatchCharacter(int ClientID, int SaveID, bool KeepCurrentWeakStrong);
+	bool GetCompactString();
+	int FromCompactString(const char *String);
 
 	IGameController *m_pController;
 
@@ -0,0 +1,763 @@
+#include "save.h"
+
+#include <cstdio>
+
+#include <engine/shared/packer.h>
+#include <engine/shared/uuid_manager.h>
+#include <game/gamecore.h>
+
+#include <zlib.h>
+
+CSaveTee::CSaveTee()
+{
+}
+
+CSaveTee::~CSaveTee()
+{
+}
+
+void CSaveTee::SetName(const char *pName)
+{
+	str_copy(m_aName, pName, sizeof(m_aName));
+}
+
+int CSaveTee::SavedTime() const
+{
+	// Add time penalty of 60 seconds (only to the database)
+	return m_Time + 60 * SERVER_TICK_SPEED;
+}
+
+int CSaveTee::SavedHookedPlayer(const CSaveTeam *pTeam) const
+{
+	if(m_HookedPlayer != -1)
+	{
+		for(int n = 0; n < pTeam->GetMembersCount(); n++)
+		{
+			if(m_HookedPlayer == pTeam->m_pSavedTees[n].GetClientID())
+				return n;
+		}
+	}
+	return -1;
+}
+
+char *CSaveTee::GetString(const CSaveTeam *pTeam)
+{
+	int Time = SavedTime();
+	int HookedPlayer = SavedHookedPlayer(pTeam);
+
+	str_format(m_aString, sizeof(m_aString),
+		"%s\t%d\t%d\t%d\t%d\t%d\t"
+		// weapons
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t"
+		// tee stats
+		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_SuperJump
+		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_DDRaceState
+		"%d\t%d\t%d\t%d\t" // m_Pos.x
+		"%d\t%d\t" // m_TeleCheckpoint
+		"%d\t%d\t%f\t%f\t" // m_CorePos.x
+		"%d\t%d\t%d\t%d\t" // m_ActiveWeapon
+		"%d\t%d\t%f\t%f\t" // m_HookPos.x
+		"%d\t%d\t%d\t%d\t" // m_HookTeleBase.x
+		// time checkpoints
+		"%d\t%d\t%d\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%d\t"
+		"%d\t%d\t%d\t"
+		"%s\t"
+		"%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t%d\t%d",
+		m_aName, m_Alive, m_Paused, m_NeededFaketuning, m_TeeFinished, m_IsSolo,
+		// weapons
+		m_aWeapons[0].m_AmmoRegenStart, m_aWeapons[0].m_Ammo, m_aWeapons[0].m_Ammocost, m_aWeapons[0].m_Got,
+		m_aWeapons[1].m_AmmoRegenStart, m_aWeapons[1].m_Ammo, m_aWeapons[1].m_Ammocost, m_aWeapons[1].m_Got,
+		m_aWeapons[2].m_AmmoRegenStart, m_aWeapons[2].m_Ammo, m_aWeapons[2].m_Ammocost, m_aWeapons[2].m_Got,
+		m_aWeapons[3].m_AmmoRegenStart, m_aWeapons[3].m_Ammo, m_aWeapons[3].m_Ammocost, m_aWeapons[3].m_Got,
+		m_aWeapons[4].m_AmmoRegenStart, m_aWeapons[4].m_Ammo, m_aWeapons[4].m_Ammocost, m_aWeapons[4].m_Got,
+		m_aWeapons[5].m_AmmoRegenStart, m_aWeapons[5].m_Ammo, m_aWeapons[5].m_Ammocost, m_aWeapons[5].m_Got,
+		m_LastWeapon, m_QueuedWeapon,
+		// tee states
+		m_SuperJump, m_Jetpack, m_NinjaJetpack, m_FreezeTime, m_FreezeTick, m_DeepFreeze, m_EndlessHook,
+		m_DDRaceState, m_Hit, m_Collision, m_TuneZone, m_TuneZoneOld, m_Hook, Time,
+		(int)m_Pos.x, (int)m_Pos.y, (int)m_PrevPos.x, (int)m_PrevPos.y,
+		m_TeleCheckpoint, m_LastPenalty,
+		(int)m_CorePos.x, (int)m_CorePos.y, m_Vel.x, m_Vel.y,
+		m_ActiveWeapon, m_Jumped, m_JumpedTotal, m_Jumps,
+		(int)m_HookPos.x, (int)m_HookPos.y, m_HookDir.x, m_HookDir.y,
+		(int)m_HookTeleBase.x, (int)m_HookTeleBase.y, m_HookTick, m_HookState,
+		// time checkpoints
+		m_CpTime, m_CpActive, m_CpLastBroadcast,
+		m_aCpCurrent[0], m_aCpCurrent[1], m_aCpCurrent[2], m_aCpCurrent[3], m_aCpCurrent[4],
+		m_aCpCurrent[5], m_aCpCurrent[6], m_aCpCurrent[7], m_aCpCurrent[8], m_aCpCurrent[9],
+		m_aCpCurrent[10], m_aCpCurrent[11], m_aCpCurrent[12], m_aCpCurrent[13], m_aCpCurrent[14],
+		m_aCpCurrent[15], m_aCpCurrent[16], m_aCpCurrent[17], m_aCpCurrent[18], m_aCpCurrent[19],
+		m_aCpCurrent[20], m_aCpCurrent[21], m_aCpCurrent[22], m_aCpCurrent[23], m_aCpCurrent[24],
+		m_NotEligibleForFinish,
+		m_HasTelegunGun, m_HasTelegunLaser, m_HasTelegunGrenade,
+		m_aGameUuid,
+		HookedPlayer, m_NewHook,
+		m_InputDirection, m_InputJump, m_InputFire, m_InputHook,
+		m_ReloadTimer[0], m_ReloadTimer[1], m_ReloadTimer[2], m_ReloadTimer[3], m_ReloadTimer[4], m_ReloadTimer[5]);
+	return m_aString;
+}
+
+int CSaveTee::FromString(const char *String)
+{
+	int Num;
+	Num = sscanf(String,
+		"%[^\t]\t%d\t%d\t%d\t%d\t%d\t"
+		// weapons
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t"
+		// tee states
+		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_SuperJump
+		"%d\t%d\t%d\t%d\t%d\t%d\t%d\t" // m_DDRaceState
+		"%f\t%f\t%f\t%f\t" // m_Pos.x
+		"%d\t%d\t" // m_TeleCheckpoint
+		"%f\t%f\t%f\t%f\t" // m_CorePos.x
+		"%d\t%d\t%d\t%d\t" // m_ActiveWeapon
+		"%f\t%f\t%f\t%f\t" // m_HookPos.x
+		"%f\t%f\t%d\t%d\t" // m_HookTeleBase.x
+		// time checkpoints
+		"%d\t%d\t%d\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%f\t%f\t%f\t%f\t%f\t"
+		"%d\t"
+		"%d\t%d\t%d\t"
+		"%36s\t"
+		"%d\t%d"
+		"%d\t%d\t%d\t%d\t"
+		"%d\t%d\t%d\t%d\t%d\t%d",
+		m_aName, &m_Alive, &m_Paused, &m_NeededFaketuning, &m_TeeFinished, &m_IsSolo,
+		// weapons
+		&m_aWeapons[0].m_AmmoRegenStart, &m_aWeapons[0].m_Ammo, &m_aWeapons[0].m_Ammocost, &m_aWeapons[0].m_Got,
+		&m_aWeapons[1].m_AmmoRegenStart, &m_aWeapons[1].m_Ammo, &m_aWeapons[1].m_Ammocost, &m_aWeapons[1].m_Got,
+		&m_aWeapons[2].m_AmmoRegenStart, &m_aWeapons[2].m_Ammo, &m_aWeapons[2].m_Ammocost, &m_aWeapons[2].m_Got,
+		&m_aWeapons[3].m_AmmoRegenStart, &m_aWeapons[3].m_Ammo, &m_aWeapons[3].m_Ammocost, &m_aWeapons[3].m_Got,
+		&m_aWeapons[4].m_AmmoRegenStart, &m_aWeapons[4].m_Ammo, &m_aWeapons[4].m_Ammocost, &m_aWeapons[4].m_Got,
+		&m_aWeapons[5].m_AmmoRegenStart, &m_aWeapons[5].m_Ammo, &m_aWeapons[5].m_Ammocost, &m_aWeapons[5].m_Got,
+		&m_LastWeapon, &m_QueuedWeapon,
+		// tee states
+		&m_SuperJump, &m_Jetpack, &m_NinjaJetpack, &m_FreezeTime, &m_FreezeTick, &m_DeepFreeze, &m_EndlessHook,
+		&m_DDRaceState, &m_Hit, &m_Collision, &m_TuneZone, &m_TuneZoneOld, &m_Hook, &m_Time,
+		&m_Pos.x, &m_Pos.y, &m_PrevPos.x, &m_PrevPos.y,
+		&m_TeleCheckpoint, &m_LastPenalty,
+		&m_CorePos.x, &m_CorePos.y, &m_Vel.x, &m_Vel.y,
+		&m_ActiveWeapon, &m_Jumped, &m_JumpedTotal, &m_Jumps,
+		&m_HookPos.x, &m_HookPos.y, &m_HookDir.x, &m_HookDir.y,
+		&m_HookTeleBase.x, &m_HookTeleBase.y, &m_HookTick, &m_HookState,
+		// time checkpoints
+		&m_CpTime, &m_CpActive, &m_CpLastBroadcast,
+		&m_aCpCurrent[0], &m_aCpCurrent[1], &m_aCpCurrent[2], &m_aCpCurrent[3], &m_aCpCurrent[4],
+		&m_aCpCurrent[5], &m_aCpCurrent[6], &m_aCpCurrent[7], &m_aCpCurrent[8], &m_aCpCurrent[9],
+		&m_aCpCurrent[10], &m_aCpCurrent[11], &m_aCpCurrent[12], &m_aCpCurrent[13], &m_aCpCurrent[14],
+		&m_aCpCurrent[15], &m_aCpCurrent[16], &m_aCpCurrent[17], &m_aCpCurrent[18], &m_aCpCurrent[19],
+		&m_aCpCurrent[20], &m_aCpCurrent[21], &m_aCpCurrent[22], &m_aCpCurrent[23], &m_aCpCurrent[24],
+		&m_NotEligibleForFinish,
+		&m_HasTelegunGun, &m_HasTelegunLaser, &m_HasTelegunGrenade,
+		m_aGameUuid,
+		&m_HookedPlayer, &m_NewHook,
+		&m_InputDirection, &m_InputJump, &m_InputFire, &m_InputHook,
+		&m_ReloadTimer[0], &m_ReloadTimer[1], &m_ReloadTimer[2], &m_ReloadTimer[3], &m_ReloadTimer[4], &m_ReloadTimer[5]);
+	switch(Num) // Don't forget to update this when you save / load more / less.
+	{
+	case 96:
+		m_NotEligibleForFinish = false;
+		// fall through
+	case 97:
+		m_HasTelegunGrenade = 0;
+		m_HasTelegunLaser = 0;
+		m_HasTelegunGun = 0;
+		// fall through
+	case 101:
+		m_HookedPlayer = -1;
+		m_NewHook = false;
+		if(m_HookState == HOOK_GRABBED)
+			m_HookState = HOOK_FLYING;
+		m_InputDirection = 0;
+		m_InputJump = 0;
+		m_InputFire = 0;
+		m_InputHook = 0;
+		// fall through
+	case 107:
+		for(int i = 0; i < NUM_WEAPONS; i++)
+			m_ReloadTimer[i] = 0;
+		// fall through
+	case 113:
+		return 0;
+	default:
+		dbg_msg("load", "failed to load tee-string");
+		dbg_msg("load", "loaded %d vars", Num);
+		return Num + 1; // never 0 here
+	}
+}
+
+static void PackFloat(CPacker *pPacker, float Value)
+{
+	int Bits;
+	mem_copy(&Bits, &Value, sizeof(Bits));
+	pPacker->AddInt(Bits);
+}
+
+static float UnpackFloat(CUnpacker *pUnpacker)
+{
+	int Bits = pUnpacker->GetInt();
+	float Value;
+	mem_copy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+static void PackVec(CPacker *pPacker, vec2 Value)
+{
+	PackFloat(pPacker, Value.x);
+	PackFloat(pPacker, Value.y);
+}
+
+static vec2 UnpackVec(CUnpacker *pUnpacker)
+{
+	float x = UnpackFloat(pUnpacker);
+	return vec2(x, UnpackFloat(pUnpacker));
+}
+
+// same fields and order as the text format, but floats keep all their bits
+bool CSaveTee::Pack(CPacker *pPacker, const CSaveTeam *pTeam)
+{
+	pPacker->AddInt(m_Alive);
+	pPacker->AddInt(m_Paused);
+	pPacker->AddInt(m_NeededFaketuning);
+	pPacker->AddInt(m_TeeFinished);
+	pPacker->AddInt(m_IsSolo);
+	for(int i = 0; i < NUM_WEAPONS; i++)
+	{
+		pPacker->AddInt(m_aWeapons[i].m_AmmoRegenStart);
+		pPacker->AddInt(m_aWeapons[i].m_Ammo);
+		pPacker->AddInt(m_aWeapons[i].m_Ammocost);
+		pPacker->AddInt(m_aWeapons[i].m_Got);
+	}
+	pPacker->AddInt(m_LastWeapon);
+	pPacker->AddInt(m_QueuedWeapon);
+
+	// tee states
+	pPacker->AddInt(m_SuperJump);
+	pPacker->AddInt(m_Jetpack);
+	pPacker->AddInt(m_NinjaJetpack);
+	pPacker->AddInt(m_FreezeTime);
+	pPacker->AddInt(m_FreezeTick);
+	pPacker->AddInt(m_DeepFreeze);
+	pPacker->AddInt(m_EndlessHook);
+	pPacker->AddInt(m_DDRaceState);
+	pPacker->AddInt(m_Hit);
+	pPacker->AddInt(m_Collision);
+	pPacker->AddInt(m_TuneZone);
+	pPacker->AddInt(m_TuneZoneOld);
+	pPacker->AddInt(m_Hook);
+	pPacker->AddInt(SavedTime());
+	PackVec(pPacker, m_Pos);
+	PackVec(pPacker, m_PrevPos);
+	pPacker->AddInt(m_TeleCheckpoint);
+	pPacker->AddInt(m_LastPenalty);
+	PackVec(pPacker, m_CorePos);
+	PackVec(pPacker, m_Vel);
+	pPacker->AddInt(m_ActiveWeapon);
+	pPacker->AddInt(m_Jumped);
+	pPacker->AddInt(m_JumpedTotal);
+	pPacker->AddInt(m_Jumps);
+	PackVec(pPacker, m_HookPos);
+	PackVec(pPacker, m_HookDir);
+	PackVec(pPacker, m_HookTeleBase);
+	pPacker->AddInt(m_HookTick);
+	pPacker->AddInt(m_HookState);
+
+	// time checkpoints
+	pPacker->AddInt(m_CpTime);
+	pPacker->AddInt(m_CpActive);
+	pPacker->AddInt(m_CpLastBroadcast);
+	for(float CpCurrent : m_aCpCurrent)
+		PackFloat(pPacker, CpCurrent);
+
+	pPacker->AddInt(m_NotEligibleForFinish);
+	pPacker->AddInt(m_HasTelegunGun);
+	pPacker->AddInt(m_HasTelegunLaser);
+	pPacker->AddInt(m_HasTelegunGrenade);
+
+	CUuid GameUuid;
+	mem_zero(&GameUuid, sizeof(GameUuid));
+	if(str_length(m_aGameUuid) == UUID_MAXSTRSIZE - 1)
+		ParseUuid(&GameUuid, m_aGameUuid);
+	pPacker->AddRaw(&GameUuid, sizeof(GameUuid));
+
+	pPacker->AddInt(SavedHookedPlayer(pTeam));
+	pPacker->AddInt(m_NewHook);
+	pPacker->AddInt(m_InputDirection);
+	pPacker->AddInt(m_InputJump);
+	pPacker->AddInt(m_InputFire);
+	pPacker->AddInt(m_InputHook);
+	for(int ReloadTimer : m_ReloadTimer)
+		pPacker->AddInt(ReloadTimer);
+	return !pPacker->Error();
+}
+
+bool CSaveTee::Unpack(CUnpacker *pUnpacker)
+{
+	m_Alive = pUnpacker->GetInt();
+	m_Paused = pUnpacker->GetInt();
+	m_NeededFaketuning = pUnpacker->GetInt();
+	m_TeeFinished = pUnpacker->GetInt();
+	m_IsSolo = pUnpacker->GetInt();
+	for(int i = 0; i < NUM_WEAPONS; i++)
+	{
+		m_aWeapons[i].m_AmmoRegenStart = pUnpacker->GetInt();
+		m_aWeapons[i].m_Ammo = pUnpacker->GetInt();
+		m_aWeapons[i].m_Ammocost = pUnpacker->GetInt();
+		m_aWeapons[i].m_Got = pUnpacker->GetInt();
+	}
+	m_LastWeapon = pUnpacker->GetInt();
+	m_QueuedWeapon = pUnpacker->GetInt();
+
+	// tee states
+	m_SuperJump = pUnpacker->GetInt();
+	m_Jetpack = pUnpacker->GetInt();
+	m_NinjaJetpack = pUnpacker->GetInt();
+	m_FreezeTime = pUnpacker->GetInt();
+	m_FreezeTick = pUnpacker->GetInt();
+	m_DeepFreeze = pUnpacker->GetInt();
+	m_EndlessHook = pUnpacker->GetInt();
+	m_DDRaceState = pUnpacker->GetInt();
+	m_Hit = pUnpacker->GetInt();
+	m_Collision = pUnpacker->GetInt();
+	m_TuneZone = pUnpacker->GetInt();
+	m_TuneZoneOld = pUnpacker->GetInt();
+	m_Hook = pUnpacker->GetInt();
+	m_Time = pUnpacker->GetInt();
+	m_Pos = UnpackVec(pUnpacker);
+	m_PrevPos = UnpackVec(pUnpacker);
+	m_TeleCheckpoint = pUnpacker->GetInt();
+	m_LastPenalty = pUnpacker->GetInt();
+	m_CorePos = UnpackVec(pUnpacker);
+	m_Vel = UnpackVec(pUnpacker);
+	m_ActiveWeapon = pUnpacker->GetInt();
+	m_Jumped = pUnpacker->GetInt();
+	m_JumpedTotal = pUnpacker->GetInt();
+	m_Jumps = pUnpacker->GetInt();
+	m_HookPos = UnpackVec(pUnpacker);
+	m_HookDir = UnpackVec(pUnpacker);
+	m_HookTeleBase = UnpackVec(pUnpacker);
+	m_HookTick = pUnpacker->GetInt();
+	m_HookState = pUnpacker->GetInt();
+
+	// time checkpoints
+	m_CpTime = pUnpacker->GetInt();
+	m_CpActive = pUnpacker->GetInt();
+	m_CpLastBroadcast = pUnpacker->GetInt();
+	for(float &CpCurrent : m_aCpCurrent)
+		CpCurrent = UnpackFloat(pUnpacker);
+
+	m_NotEligibleForFinish = pUnpacker->GetInt();
+	m_HasTelegunGun = pUnpacker->GetInt();
+	m_HasTelegunLaser = pUnpacker->GetInt();
+	m_HasTelegunGrenade = pUnpacker->GetInt();
+
+	const unsigned char *pGameUuid = pUnpacker->GetRaw(sizeof(CUuid));
+	if(pGameUuid)
+	{
+		CUuid GameUuid;
+		mem_copy(&GameUuid, pGameUuid, sizeof(GameUuid));
+		FormatUuid(GameUuid, m_aGameUuid, sizeof(m_aGameUuid));
+	}
+
+	m_HookedPlayer = pUnpacker->GetInt();
+	m_NewHook = pUnpacker->GetInt();
+	m_InputDirection = pUnpacker->GetInt();
+	m_InputJump = pUnpacker->GetInt();
+	m_InputFire = pUnpacker->GetInt();
+	m_InputHook = pUnpacker->GetInt();
+	for(int &ReloadTimer : m_ReloadTimer)
+		ReloadTimer = pUnpacker->GetInt();
+	return !pUnpacker->Error();
+}
+
+CSaveTeam::CSaveTeam(IGameController *Controller)
+{
+	m_pController = Controller;
+	m_aString[0] = '\0';
+	m_pSwitchers = 0;
+	m_pSavedTees = 0;
+	m_TeamState = 0;
+	m_MembersCount = 0;
+	m_NumSwitchers = 0;
+	m_TeamLocked = 0;
+	m_Practice = 0;
+}
+
+CSaveTeam::~CSaveTeam()
+{
+	if(m_pSwitchers)
+		delete[] m_pSwitchers;
+	if(m_pSavedTees)
+		delete[] m_pSavedTees;
+}
+
+char *CSaveTeam::GetString(bool Compact)
+{
+	if(Compact && GetCompactString())
+		return m_aString;
+
+	str_format(m_aString, sizeof(m_aString), "%d\t%d\t%d\t%d\t%d", m_TeamState, m_MembersCount, m_NumSwitchers, m_TeamLocked, m_Practice);
+
+	for(int i = 0; i < m_MembersCount; i++)
+	{
+		char aBuf[1024];
+		str_format(aBuf, sizeof(aBuf), "\n%s", m_pSavedTees[i].GetString(this));
+		str_append(m_aString, aBuf, sizeof(m_aString));
+	}
+
+	if(m_pSwitchers && m_NumSwitchers)
+	{
+		for(int i = 1; i < m_NumSwitchers + 1; i++)
+		{
+			char aBuf[64];
+			str_format(aBuf, sizeof(aBuf), "\n%d\t%d\t%d", m_pSwitchers[i].m_Status, m_pSwitchers[i].m_EndTime, m_pSwitchers[i].m_Type);
+			str_append(m_aString, aBuf, sizeof(m_aString));
+		}
+	}
+
+	return m_aString;
+}
+
+// "#<version>\t<checksum>\t<team>" followed by a "\n<name>\t<tee>" line per
+// tee, so that saves can still be searched by player name. The team and
+// tees are packed and base64 encoded, the checksum is the crc32 of all
+// characters after it.
+bool CSaveTeam::GetCompactString()
+{
+	CPacker Packer;
+	Packer.Reset();
+	Packer.AddInt(m_TeamState);
+	Packer.AddInt(m_MembersCount);
+	Packer.AddInt(m_pSwitchers ? m_NumSwitchers : 0);
+	Packer.AddInt(m_TeamLocked);
+	Packer.AddInt(m_Practice);
+	for(int i = 1; m_pSwitchers && i < m_NumSwitchers + 1; i++)
+	{
+		Packer.AddInt(m_pSwitchers[i].m_Status);
+		Packer.AddInt(m_pSwitchers[i].m_EndTime);
+		Packer.AddInt(m_pSwitchers[i].m_Type);
+	}
+	if(Packer.Error())
+		return false;
+
+	char aBuf[CPacker::PACKER_BUFFER_SIZE * 4 / 3 + 4];
+	str_base64(aBuf, sizeof(aBuf), Packer.Data(), Packer.Size());
+	str_format(m_aString, sizeof(m_aString), "#%d\t%08x\t%s", (int)COMPACT_VERSION, 0, aBuf);
+
+	for(int i = 0; i < m_MembersCount; i++)
+	{
+		Packer.Reset();
+		if(!m_pSavedTees[i].Pack(&Packer, this))
+			return false;
+		str_base64(aBuf, sizeof(aBuf), Packer.Data(), Packer.Size());
+		str_append(m_aString, "\n", sizeof(m_aString));
+		str_append(m_aString, m_pSavedTees[i].GetName(), sizeof(m_aString));
+		str_append(m_aString, "\t", sizeof(m_aString));
+		str_append(m_aString, aBuf, sizeof(m_aString));
+	}
+	if(str_length(m_aString) + 1 >= (int)sizeof(m_aString))
+		return false;
+
+	// fill in the checksum of everything behind it
+	char *pChecksum = (char *)str_find(m_aString, "\t") + 1;
+	char aChecksum[16];
+	str_format(aChecksum, sizeof(aChecksum), "%08x", (unsigned)crc32(0, (const Bytef *)pChecksum + 8, str_length(pChecksum + 8)));
+	mem_copy(pChecksum, aChecksum, 8);
+	return true;
+}
+
+// copies the line at *ppLine into pBuf and moves *ppLine to the next one
+static bool ReadCompactLine(const char **ppLine, char *pBuf, int BufSize)
+{
+	const char *pEnd = *ppLine;
+	while(*pEnd && *pEnd != '\n')
+		pEnd++;
+	if(pEnd - *ppLine >= BufSize)
+	{
+		dbg_msg("load", "savegame: wrong format (line too long)");
+		return false;
+	}
+	str_copy(pBuf, *ppLine, pEnd - *ppLine + 1);
+	*ppLine = *pEnd ? pEnd + 1 : pEnd;
+	return true;
+}
+
+int CSaveTeam::FromCompactString(const char *String)
+{
+	int Version;
+	unsigned Checksum;
+	if(sscanf(String, "#%d\t%8x\t", &Version, &Checksum) != 2)
+	{
+		dbg_msg("load", "savegame: wrong format (couldn't read header)");
+		return 1;
+	}
+	if(Version < 1 || Version > COMPACT_VERSION)
+	{
+		dbg_msg("load", "savegame: unsupported version %d", Version);
+		return 1;
+	}
+	const char *pData = str_find(String, "\t") + 1;
+	if(str_length(pData) < 9 || pData[8] != '\t')
+	{
+		dbg_msg("load", "savegame: wrong format (couldn't read checksum)");
+		return 1;
+	}
+	pData += 8;
+	if((unsigned)crc32(0, (const Bytef *)pData, str_length(pData)) != Checksum)
+	{
+		dbg_msg("load", "savegame: checksum mismatch");
+		return 1;
+	}
+
+	unsigned char aData[CPacker::PACKER_BUFFER_SIZE];
+	char aLine[CPacker::PACKER_BUFFER_SIZE * 4 / 3 + MAX_NAME_LENGTH + 4];
+	CUnpacker Unpacker;
+	const char *pLine = pData + 1;
+
+	// the team comes first, it tells how many tees follow
+	if(!ReadCompactLine(&pLine, aLine, sizeof(aLine)))
+		return 1;
+	int Size = str_base64_decode(aData, sizeof(aData), aLine);
+	if(Size < 0)
+	{
+		dbg_msg("load", "savegame: wrong format (invalid base64)");
+		return 1;
+	}
+	Unpacker.Reset(aData, Size);
+	m_TeamState = Unpacker.GetInt();
+	m_MembersCount = Unpacker.GetInt();
+	m_NumSwitchers = Unpacker.GetInt();
+	m_TeamLocked = Unpacker.GetInt();
+	m_Practice = Unpacker.GetInt();
+	if(Unpacker.Error() || m_MembersCount < 0 || m_MembersCount > MAX_CLIENTS || m_NumSwitchers < 0)
+	{
+		dbg_msg("load", "failed to load teamstats");
+		m_MembersCount = 0;
+		m_NumSwitchers = 0;
+		return 1;
+	}
+
+	delete[] m_pSavedTees;
+	m_pSavedTees = 0;
+	if(m_MembersCount)
+		m_pSavedTees = new CSaveTee[m_MembersCount];
+
+	delete[] m_pSwitchers;
+	m_pSwitchers = 0;
+	if(m_NumSwitchers)
+		m_pSwitchers = new SSimpleSwitchers[m_NumSwitchers + 1];
+	for(int i = 1; i < m_NumSwitchers + 1; i++)
+	{
+		m_pSwitchers[i].m_Status = Unpacker.GetInt();
+		m_pSwitchers[i].m_EndTime = Unpacker.GetInt();
+		m_pSwitchers[i].m_Type = Unpacker.GetInt();
+	}
+	if(Unpacker.Error())
+	{
+		dbg_msg("load", "failed to load switchers");
+		return 1;
+	}
+
+	// then one line per tee, its name and its state
+	for(int n = 0; n < m_MembersCount; n++)
+	{
+		if(!ReadCompactLine(&pLine, aLine, sizeof(aLine)))
+			return 1;
+		char *pBase64 = (char *)str_find(aLine, "\t");
+		if(!pBase64)
+		{
+			dbg_msg("load", "savegame: wrong format (couldn't load tee)");
+			return 1;
+		}
+		*pBase64++ = '\0';
+		m_pSavedTees[n].SetName(aLine);
+		Size = str_base64_decode(aData, sizeof(aData), pBase64);
+		if(Size < 0)
+		{
+			dbg_msg("load", "savegame: wrong format (invalid base64)");
+			return 1;
+		}
+		Unpacker.Reset(aData, Size);
+		if(!m_pSavedTees[n].Unpack(&Unpacker))
+		{
+			dbg_msg("load", "failed to load tee");
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int CSaveTeam::FromString(const char *String)
+{
+	if(String[0] == '#')
+		return FromCompactString(String);
+
+	char TeamStats[MAX_CLIENTS];
+	char Switcher[64];
+	char SaveTee[1024];
+
+	char *CopyPos;
+	unsigned int Pos = 0;
+	unsigned int LastPos = 0;
+	unsigned int StrSize;
+
+	str_copy(m_aString, String, sizeof(m_aString));
+
+	while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
+		Pos++;
+
+	CopyPos = m_aString + LastPos;
+	StrSize = Pos - LastPos + 1;
+	if(m_aString[Pos] == '\n')
+	{
+		Pos++; // skip \n
+		LastPos = Pos;
+	}
+
+	if(StrSize <= 0)
+	{
+		dbg_msg("load", "savegame: wrong format (couldn't load teamstats)");
+		return 1;
+	}
+
+	if(StrSize < sizeof(TeamStats))
+	{
+		str_copy(TeamStats, CopyPos, StrSize);
+		int Num = sscanf(TeamStats, "%d\t%d\t%d\t%d\t%d", &m_TeamState, &m_MembersCount, &m_NumSwitchers, &m_TeamLocked, &m_Practice);
+		switch(Num) // Don't forget to update this when you save / load more / less.
+		{
+		case 4:
+			m_Practice = false;
+			// fallthrough
+		case 5:
+			break;
+		default:
+			dbg_msg("load", "failed to load teamstats");
+			dbg_msg("load", "loaded %d vars", Num);
+			return Num + 1; // never 0 here
+		}
+	}
+	else
+	{
+		dbg_msg("load", "savegame: wrong format (couldn't load teamstats, too big)");
+		return 1;
+	}
+
+	if(m_pSavedTees)
+	{
+		delete[] m_pSavedTees;
+		m_pSavedTees = 0;
+	}
+
+	if(m_MembersCount)
+		m_pSavedTees = new CSaveTee[m_MembersCount];
+
+	for(int n = 0; n < m_MembersCount; n++)
+	{
+		while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
+			Pos++;
+
+		CopyPos = m_aString + LastPos;
+		StrSize = Pos - LastPos + 1;
+		if(m_aString[Pos] == '\n')
+		{
+			Pos++; // skip \n
+			LastPos = Pos;
+		}
+
+		if(StrSize <= 0)
+		{
+			dbg_msg("load", "savegame: wrong format (couldn't load tee)");
+			return 1;
+		}
+
+		if(StrSize < sizeof(SaveTee))
+		{
+			str_copy(SaveTee, CopyPos, StrSize);
+			int Num = m_pSavedTees[n].FromString(SaveTee);
+			if(Num)
+			{
+				dbg_msg("load", "failed to load tee");
+				dbg_msg("load", "loaded %d vars", Num - 1);
+				return 1;
+			}
+		}
+		else
+		{
+			dbg_msg("load", "savegame: wrong format (couldn't load tee, too big)");
+			return 1;
+		}
+	}
+
+	if(m_pSwitchers)
+	{
+		delete[] m_pSwitchers;
+		m_pSwitchers = 0;
+	}
+
+	if(m_NumSwitchers)
+		m_pSwitchers = new SSimpleSwitchers[m_NumSwitchers + 1];
+
+	for(int n = 1; n < m_NumSwitchers + 1; n++)
+	{
+		while(m_aString[Pos] != '\n' && Pos < sizeof(m_aString) && m_aString[Pos]) // find next \n or \0
+			Pos++;
+
+		CopyPos = m_aString + LastPos;
+		StrSize = Pos - LastPos + 1;
+		if(m_aString[Pos] == '\n')
+		{
+			Pos++; // skip \n
+			LastPos = Pos;
+		}
+
+		if(StrSize <= 0)
+		{
+			dbg_msg("load", "savegame: wrong format (couldn't load switcher)");
+			return 1;
+		}
+
+		if(StrSize < sizeof(Switcher))
+		{
+			str_copy(Switcher, CopyPos, StrSize);
+			int Num = sscanf(Switcher, "%d\t%d\t%d", &(m_pSwitchers[n].m_Status), &(m_pSwitchers[n].m_EndTime), &(m_pSwitchers[n].m_Type));
+			if(Num != 3)
+			{
+				dbg_msg("load", "failed to load switcher");
+				dbg_msg("load", "loaded %d vars", Num - 1);
+			}
+		}
+		else
+		{
+			dbg_msg("load", "savegame: wrong format (couldn't load switcher, too big)");
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
@@ -17,40 +17,6 @@
 #include <fstream>
 #include <random>
 
-CScorePlayerResult::CScorePlayerResult() :
-	m_Done(false)
-{
-	SetVariant(Variant::DIRECT);
-}
-
-void CScorePlayerResult::SetVariant(Variant v)
-{
-	m_MessageKind = v;
-	switch(v)
-	{
-	case DIRECT:
-	case ALL:
-		for(int i = 0; i < MAX_MESSAGES; i++)
-			m_Data.m_aaMessages[i][0] = 0;
-		break;
-	case BROADCAST:
-		m_Data.m_Broadcast[0] = 0;
-		break;
-	case MAP_VOTE:
-		m_Data.m_MapVote.m_Map[0] = '\0';
-		m_Data.m_MapVote.m_Reason[0] = '\0';
-		m_Data.m_MapVote.m_Server[0] = '\0';
-		break;
-	case PLAYER_INFO:
-		m_Data.m_Info.m_Score = -9999;
-		m_Data.m_Info.m_Birthday = 0;
-		m_Data.m_Info.m_HasFinishScore = false;
-		m_Data.m_Info.m_Time = 0;
-		for(int i = 0; i < NUM_CHECKPOINTS; i++)
-			m_Data.m_Info.m_CpTime[i] = 0;
-	}
-}
-
 CTeamrank::CTeamrank() :
 	m_NumNames(0)
 {
@@ -93,7 +59,7 @@ std::shared_ptr<CScorePlayerResult> CScore::NewSqlPlayerResult(int ClientID)
 	CPlayer *pCurPlayer = GameServer()->m_apPlayers[ClientID];
 	if(pCurPlayer->m_ScoreQueryResult != nullptr) // TODO: send player a message: "too many requests"
 		return nullptr;
-	pCurPlayer->m_ScoreQueryResult = std::make_shared<CScorePlayerResult>();
+	pCurPlayer->m_ScoreQueryResult = std::make_shared<CScorePlayerResult>(ClientID, m_pPlayerResults);
 	return pCurPlayer->m_ScoreQueryResult;
 }
 
@@ -113,7 +79,12 @@ void CScore::ExecPlayerThread(
 	str_copy(Tmp->m_RequestingPlayer, Server()->ClientName(ClientID), sizeof(Tmp->m_RequestingPlayer));
 	Tmp->m_Offset = Offset;
 
-	m_pPool->Execute(pFuncPtr, std::move(Tmp), pThreadName);
+	if(!m_pPool->Execute(pFuncPtr, std::move(Tmp), pThreadName))
+	{
+		pResult->SetVariant(CScorePlayerResult::DIRECT);
+		str_copy(pResult->m_Data.m_aaMessages[0], "The database is busy, please try again later", sizeof(pResult->m_Data.m_aaMessages[0]));
+		pResult->m_Done = true;
+	}
 }
 
 bool CScore::RateLimitPlayer(int ClientID)
@@ -141,8 +112,14 @@ void CScore::GeneratePassphrase(char *pBuf, int BufSize)
 
 CScore::CScore(CGameContext *pGameServer, CDbConnectionPool *pPool) :
 	m_pPool(pPool),
+	m_Times(false),
+	m_Points(true),
+	m_MapPoints(-1),
+	m_LastLeaderboardLoad(0),
+	m_PlayerDataBatchStart(0),
 	m_pGameServer(pGameServer),
-	m_pServer(pGameServer->Server())
+	m_pServer(pGameServer->Server()),
+	m_pPlayerResults(std::make_shared<CScorePlayerResultQueue>())
 {
 	auto InitResult = std::make_shared<CScoreInitResult>();
 	auto Tmp = std::unique_ptr<CSqlInitData>(new CSqlInitData(InitResult));
@@ -177,6 +154,16 @@ CScore::CScore(CGameContext *pGameServer, CDbConnectionPool *pPool) :
 		return;
 	}
 	m_pPool->Execute(Init, std::move(Tmp), "load best time");
+
+	if(g_Config.m_SvRankCache)
+		LoadLeaderboards();
+
+	// the maps table rarely changes, loading it once per map is enough
+	m_pRandomMapsResult = std::make_shared<CScoreRandomMapsResult>();
+	auto RandomMaps = std::unique_ptr<CSqlRandomMapsRequest>(new CSqlRandomMapsRequest(m_pRandomMapsResult));
+	str_copy(RandomMaps->m_ServerType, g_Config.m_SvServerType, sizeof(RandomMaps->m_ServerType));
+	if(!m_pPool->Execute(LoadRandomMapsThread, std::move(RandomMaps), "load random maps"))
+		m_pRandomMapsResult = nullptr;
 }
 
 bool CScore::Init(IDbConnection *pSqlServer, const ISqlData *pGameData)
@@ -198,70 +185,276 @@ bool CScore::Init(IDbConnection *pSqlServer, const ISqlData *pGameData)
 	return true;
 }
 
-void CScore::LoadPlayerData(int ClientID)
+void CScore::OnTick()
 {
-	ExecPlayerThread(LoadPlayerDataThread, "load player data", ClientID, "", 0);
+	m_pPlayerResults->PopAll(&m_vpCompletedResults);
+	for(const auto &pResult : m_vpCompletedResults)
+	{
+		CPlayer *pPlayer = GameServer()->m_apPlayers[pResult->m_ClientID];
+		if(pPlayer)
+			pPlayer->OnScoreResult(pResult.get());
+	}
+	m_vpCompletedResults.clear();
+
+	if(m_pPlayerDataBatch != nullptr && Server()->Tick() >= m_PlayerDataBatchStart + (int64)g_Config.m_SvSqlPlayerDataBatch * Server()->TickSpeed() / 1000)
+		FlushPlayerData();
+
+	if(m_pLeaderboardResult != nullptr && m_pLeaderboardResult.use_count() == 1)
+	{
+		if(m_pLeaderboardResult->m_Done)
+		{
+			m_Times.Set(m_pLeaderboardResult->m_vTimes);
+			m_Points.Set(m_pLeaderboardResult->m_vPoints);
+			m_MapPoints = m_pLeaderboardResult->m_MapPoints;
+			// the reload might have run before these were written
+			for(const CLeaderboard::CEntry &Finish : m_vPendingFinishes)
+				ApplyFinish(Finish.m_aName, Finish.m_Score);
+		}
+		m_vPendingFinishes.clear();
+		m_pLeaderboardResult = nullptr;
+	}
+
+	if(m_pRandomMapsResult != nullptr && m_pRandomMapsResult.use_count() == 1)
+	{
+		if(m_pRandomMapsResult->m_Done)
+			m_RandomMaps.Set(m_pRandomMapsResult->m_vMaps);
+		m_pRandomMapsResult = nullptr;
+	}
+
+	for(unsigned i = 0; i < m_vpFinishedMapsResults.size();)
+	{
+		auto &pFinished = m_vpFinishedMapsResults[i];
+		if(pFinished.use_count() != 1)
+		{
+			i++;
+			continue;
+		}
+		// a failed load leaves the vote unfinished like a failed query
+		if(pFinished->m_Done)
+		{
+			auto &Finished = m_FinishedMaps[pFinished->m_aName];
+			Finished.insert(pFinished->m_vMaps.begin(), pFinished->m_vMaps.end());
+			PickRandomMap(pFinished->m_pVote.get(), pFinished->m_Stars, &Finished, "You have no more unfinished maps on this server!");
+		}
+		m_vpFinishedMapsResults.erase(m_vpFinishedMapsResults.begin() + i);
+	}
+
+	if(!g_Config.m_SvRankCache)
+	{
+		m_Times.Clear();
+		m_Points.Clear();
+	}
+	else if(m_pLeaderboardResult == nullptr)
+	{
+		// retry failed loads sooner than the regular refresh
+		int Interval = m_Times.Loaded() ? g_Config.m_SvRankCacheRefresh : 10;
+		if(Interval && Server()->Tick() >= m_LastLeaderboardLoad + (int64)Interval * Server()->TickSpeed())
+			LoadLeaderboards();
+	}
 }
 
-// update stuff
-bool CScore::LoadPlayerDataThread(IDbConnection *pSqlServer, const ISqlData *pGameData)
+void CScore::LoadLeaderboards()
 {
-	const CSqlPlayerRequest *pData = dynamic_cast<const CSqlPlayerRequest *>(pGameData);
-	pData->m_pResult->SetVariant(CScorePlayerResult::PLAYER_INFO);
+	m_LastLeaderboardLoad = Server()->Tick();
+	auto pResult = std::make_shared<CScoreLeaderboardResult>();
+	auto Tmp = std::unique_ptr<CSqlLeaderboardRequest>(new CSqlLeaderboardRequest(pResult));
+	str_copy(Tmp->m_Map, g_Config.m_SvMap, sizeof(Tmp->m_Map));
+	if(m_pPool->Execute(LoadLeaderboardsThread, std::move(Tmp), "load leaderboards"))
+		m_pLeaderboardResult = pResult;
+}
+
+bool CScore::LoadLeaderboardsThread(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CSqlLeaderboardRequest *pData = dynamic_cast<const CSqlLeaderboardRequest *>(pGameData);
+	CLeaderboard::CEntry Entry;
 
 	char aBuf[512];
-	// get best race time
 	str_format(aBuf, sizeof(aBuf),
-		"SELECT Time, cp1, cp2, cp3, cp4, cp5, cp6, cp7, cp8, cp9, cp10, "
-		"  cp11, cp12, cp13, cp14, cp15, cp16, cp17, cp18, cp19, cp20, "
-		"  cp21, cp22, cp23, cp24, cp25 "
-		"FROM %s_race "
-		"WHERE Map = ? AND Name = ? "
-		"ORDER BY Time ASC "
-		"LIMIT 1;",
+		"SELECT Name, MIN(Time) FROM %s_race WHERE Map = ? GROUP BY Name;",
 		pSqlServer->GetPrefix());
 	pSqlServer->PrepareStatement(aBuf);
 	pSqlServer->BindString(1, pData->m_Map);
-	pSqlServer->BindString(2, pData->m_RequestingPlayer);
+	while(pSqlServer->Step())
+	{
+		pSqlServer->GetString(1, Entry.m_aName, sizeof(Entry.m_aName));
+		Entry.m_Score = pSqlServer->GetFloat(2);
+		pData->m_pResult->m_vTimes.push_back(Entry);
+	}
 
+	str_format(aBuf, sizeof(aBuf), "SELECT Name, Points FROM %s_points;", pSqlServer->GetPrefix());
+	pSqlServer->PrepareStatement(aBuf);
+	while(pSqlServer->Step())
+	{
+		pSqlServer->GetString(1, Entry.m_aName, sizeof(Entry.m_aName));
+		Entry.m_Score = pSqlServer->GetInt(2);
+		pData->m_pResult->m_vPoints.push_back(Entry);
+	}
+
+	str_format(aBuf, sizeof(aBuf), "SELECT Points FROM %s_maps WHERE Map = ?;", pSqlServer->GetPrefix());
+	pSqlServer->PrepareStatement(aBuf);
+	pSqlServer->BindString(1, pData->m_Map);
 	if(pSqlServer->Step())
+		pData->m_pResult->m_MapPoints = pSqlServer->GetInt(1);
+
+	pData->m_pResult->m_Done = true;
+	return true;
+}
+
+void CScore::ApplyFinish(const char *pName, float Time)
+{
+	if(!m_Times.Loaded())
+		return;
+	// mirrors SaveScoreThread, the first finish on a map gives its points
+	int Rank;
+	float BestTime;
+	if(m_MapPoints >= 0 && m_Points.Loaded() && !m_Times.Rank(pName, &Rank, &BestTime))
+		m_Points.Add(pName, m_MapPoints);
+	m_Times.Update(pName, Time);
+}
+
+void CScore::LoadPlayerData(int ClientID)
+{
+	auto pResult = NewSqlPlayerResult(ClientID);
+	if(pResult == nullptr)
+		return;
+	if(m_pPlayerDataBatch == nullptr)
 	{
-		// get the best time
-		float Time = pSqlServer->GetFloat(1);
-		pData->m_pResult->m_Data.m_Info.m_Time = Time;
-		pData->m_pResult->m_Data.m_Info.m_Score = -Time;
-		pData->m_pResult->m_Data.m_Info.m_HasFinishScore = true;
+		m_pPlayerDataBatch = std::unique_ptr<CSqlPlayerDataRequest>(new CSqlPlayerDataRequest());
+		str_copy(m_pPlayerDataBatch->m_Map, g_Config.m_SvMap, sizeof(m_pPlayerDataBatch->m_Map));
+		m_PlayerDataBatchStart = Server()->Tick();
+	}
+	CSqlPlayerDataRequest::CEntry Entry;
+	Entry.m_pResult = pResult;
+	str_copy(Entry.m_aName, Server()->ClientName(ClientID), sizeof(Entry.m_aName));
+	// a client that reconnected into the same slot replaces its old entry,
+	// so there is at most one entry per client
+	std::vector<CSqlPlayerDataRequest::CEntry> &vPlayers = m_pPlayerDataBatch->m_vPlayers;
+	auto It = std::find_if(vPlayers.begin(), vPlayers.end(), [ClientID](const CSqlPlayerDataRequest::CEntry &Player) {
+		return Player.m_pResult->m_ClientID == ClientID;
+	});
+	if(It != vPlayers.end())
+		*It = Entry;
+	else
+		vPlayers.push_back(Entry);
+
+	if(g_Config.m_SvSqlPlayerDataBatch == 0)
+		FlushPlayerData();
+}
+
+void CScore::FlushPlayerData()
+{
+	if(m_pPlayerDataBatch == nullptr)
+		return;
+	// keep the results to report a rejected request, the request is moved
+	std::vector<std::shared_ptr<CScorePlayerResult>> vpResults;
+	for(const auto &Player : m_pPlayerDataBatch->m_vPlayers)
+		vpResults.push_back(Player.m_pResult);
+
+	if(!m_pPool->Execute(LoadPlayerDataThread, std::move(m_pPlayerDataBatch), "load player data"))
+	{
+		for(auto &pResult : vpResults)
+		{
+			pResult->SetVariant(CScorePlayerResult::DIRECT);
+			str_copy(pResult->m_Data.m_aaMessages[0], "The database is busy, please try again later", sizeof(pResult->m_Data.m_aaMessages[0]));
+			pResult->m_Done = true;
+		}
+	}
+	m_pPlayerDataBatch = nullptr;
+}
+
+// update stuff
+bool CScore::LoadPlayerDataThread(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CSqlPlayerDataRequest *pData = dynamic_cast<const CSqlPlayerDataRequest *>(pGameData);
+	const std::vector<CSqlPlayerDataRequest::CEntry> &vPlayers = pData->m_vPlayers;
+	for(const auto &Player : vPlayers)
+		Player.m_pResult->SetVariant(CScorePlayerResult::PLAYER_INFO);
+
+	std::string Names;
+	for(unsigned i = 0; i < vPlayers.size(); i++)
+		Names += i == 0 ? "?" : ", ?";
+
+	std::vector<char> vBuf(1024 + Names.size());
+	// get best race times, equal times can return more than one row per name
+	str_format(vBuf.data(), vBuf.size(),
+		"SELECT r.Name, r.Time, cp1, cp2, cp3, cp4, cp5, cp6, cp7, cp8, cp9, cp10, "
+		"  cp11, cp12, cp13, cp14, cp15, cp16, cp17, cp18, cp19, cp20, "
+		"  cp21, cp22, cp23, cp24, cp25 "
+		"FROM %s_race AS r INNER JOIN ("
+		"  SELECT Name, MIN(Time) AS Time "
+		"  FROM %s_race "
+		"  WHERE Map = ? AND Name IN (%s) "
+		"  GROUP BY Name"
+		") AS b ON r.Name = b.Name AND r.Time = b.Time "
+		"WHERE r.Map = ?;",
+		pSqlServer->GetPrefix(), pSqlServer->GetPrefix(), Names.c_str());
+	pSqlServer->PrepareStatement(vBuf.data());
+	pSqlServer->BindString(1, pData->m_Map);
+	for(unsigned i = 0; i < vPlayers.size(); i++)
+		pSqlServer->BindString(i + 2, vPlayers[i].m_aName);
+	pSqlServer->BindString(vPlayers.size() + 2, pData->m_Map);
 
-		if(g_Config.m_SvCheckpointSave)
+	while(pSqlServer->Step())
+	{
+		char aName[MAX_NAME_LENGTH];
+		pSqlServer->GetString(1, aName, sizeof(aName));
+		for(const auto &Player : vPlayers)
 		{
-			for(int i = 0; i < NUM_CHECKPOINTS; i++)
+			auto *pInfo = &Player.m_pResult->m_Data.m_Info;
+			if(str_comp(Player.m_aName, aName) != 0 || pInfo->m_HasFinishScore)
+				continue;
+
+			// get the best time
+			float Time = pSqlServer->GetFloat(2);
+			pInfo->m_Time = Time;
+			pInfo->m_Score = -Time;
+			pInfo->m_HasFinishScore = true;
+
+			if(g_Config.m_SvCheckpointSave)
 			{
-				pData->m_pResult->m_Data.m_Info.m_CpTime[i] = pSqlServer->GetFloat(i + 2);
+				for(int i = 0; i < NUM_CHECKPOINTS; i++)
+				{
+					pInfo->m_CpTime[i] = pSqlServer->GetFloat(i + 3);
+				}
 			}
 		}
 	}
 
 	// birthday check
-	str_format(aBuf, sizeof(aBuf),
-		"SELECT CURRENT_TIMESTAMP AS Current, MIN(Timestamp) AS Stamp "
+	str_format(vBuf.data(), vBuf.size(),
+		"SELECT CURRENT_TIMESTAMP AS Current, Name, MIN(Timestamp) AS Stamp "
 		"FROM %s_race "
-		"WHERE Name = ?",
-		pSqlServer->GetPrefix());
-	pSqlServer->PrepareStatement(aBuf);
-	pSqlServer->BindString(1, pData->m_RequestingPlayer);
+		"WHERE Name IN (%s) "
+		"GROUP BY Name;",
+		pSqlServer->GetPrefix(), Names.c_str());
+	pSqlServer->PrepareStatement(vBuf.data());
+	for(unsigned i = 0; i < vPlayers.size(); i++)
+		pSqlServer->BindString(i + 1, vPlayers[i].m_aName);
 
-	if(pSqlServer->Step() && !pSqlServer->IsNull(2))
+	while(pSqlServer->Step())
 	{
+		if(pSqlServer->IsNull(3))
+			continue;
+		char aName[MAX_NAME_LENGTH];
+		pSqlServer->GetString(2, aName, sizeof(aName));
 		char aCurrent[TIMESTAMP_STR_LENGTH];
 		pSqlServer->GetString(1, aCurrent, sizeof(aCurrent));
 		char aStamp[TIMESTAMP_STR_LENGTH];
-		pSqlServer->GetString(2, aStamp, sizeof(aStamp));
+		pSqlServer->GetString(3, aStamp, sizeof(aStamp));
 		int CurrentYear, CurrentMonth, CurrentDay;
 		int StampYear, StampMonth, StampDay;
 		if(sscanf(aCurrent, "%d-%d-%d", &CurrentYear, &CurrentMonth, &CurrentDay) == 3 && sscanf(aStamp, "%d-%d-%d", &StampYear, &StampMonth, &StampDay) == 3 && CurrentMonth == StampMonth && CurrentDay == StampDay)
-			pData->m_pResult->m_Data.m_Info.m_Birthday = CurrentYear - StampYear;
+		{
+			for(const auto &Player : vPlayers)
+			{
+				if(str_comp(Player.m_aName, aName) == 0)
+					Player.m_pResult->m_Data.m_Info.m_Birthday = CurrentYear - StampYear;
+			}
+		}
 	}
-	pData->m_pResult->m_Done = true;
+
+	for(const auto &Player : vPlayers)
+		Player.m_pResult->m_Done = true;
 	return true;
 }
 
@@ -457,7 +650,7 @@ void CScore::SaveScore(int ClientID, float Time, const char *pTimestamp, float C
 	CPlayer *pCurPlayer = GameServer()->m_apPlayers[ClientID];
 	if(pCurPlayer->m_ScoreFinishResult != nullptr)
 		dbg_msg("sql", "WARNING: previous save score result didn't complete, overwriting it now");
-	pCurPlayer->m_ScoreFinishResult = std::make_shared<CScorePlayerResult>();
+	pCurPlayer->m_ScoreFinishResult = std::make_shared<CScorePlayerResult>(ClientID, m_pPlayerResults);
 	auto Tmp = std::unique_ptr<CSqlScoreData>(new CSqlScoreData(pCurPlayer->m_ScoreFinishResult));
 	str_copy(Tmp->m_Map, g_Config.m_SvMap, sizeof(Tmp->m_Map));
 	FormatUuid(GameServer()->GameUuid(), Tmp->m_GameUuid, sizeof(Tmp->m_GameUuid));
@@ -468,13 +661,24 @@ void CScore::SaveScore(int ClientID, float Time, const char *pTimestamp, float C
 	for(int i = 0; i < NUM_CHECKPOINTS; i++)
 		Tmp->m_aCpCurrent[i] = CpTime[i];
 
-	m_pPool->ExecuteWrite(SaveScoreThread, std::move(Tmp), "save score");
+	// the database keeps two decimals
+	CLeaderboard::CEntry Finish;
+	str_copy(Finish.m_aName, Tmp->m_Name, sizeof(Finish.m_aName));
+	Finish.m_Score = round_to_int(Time * 100.0f) / 100.0f;
+	ApplyFinish(Finish.m_aName, Finish.m_Score);
+	if(m_pLeaderboardResult != nullptr)
+		m_vPendingFinishes.push_back(Finish);
+	auto FinishedMaps = m_FinishedMaps.find(Finish.m_aName);
+	if(FinishedMaps != m_FinishedMaps.end())
+		FinishedMaps->second.insert(g_Config.m_SvMap);
+
+	m_pPool->ExecuteWrite(SaveScoreThread, std::move(Tmp), "save score", true);
 }
 
 bool CScore::SaveScoreThread(IDbConnection *pSqlServer, const ISqlData *pGameData, bool Failure)
 {
 	const CSqlScoreData *pData = dynamic_cast<const CSqlScoreData *>(pGameData);
-	auto paMessages = pData->m_pResult->m_Data.m_aaMessages;
+	pData->m_aPointsMessage[0] = 0;
 
 	char aBuf[1024];
 
@@ -497,48 +701,50 @@ bool CScore::SaveScoreThread(IDbConnection *pSqlServer, const ISqlData *pGameDat
 		{
 			int Points = pSqlServer->GetInt(1);
 			pSqlServer->AddPoints(pData->m_Name, Points);
-			str_format(paMessages[0], sizeof(paMessages[0]),
+			str_format(pData->m_aPointsMessage, sizeof(pData->m_aPointsMessage),
 				"You earned %d point%s for finishing this map!",
 				Points, Points == 1 ? "" : "s");
 		}
 	}
 
 	// save score. Can't fail, because no UNIQUE/PRIMARY KEY constrain is defined.
+	// times are bound rather than formatted into the query so that the
+	// statement is the same for every finish and can be reused
 	str_format(aBuf, sizeof(aBuf),
 		"%s INTO %s_race("
 		"	Map, Name, Timestamp, Time, Server, "
 		"	cp1, cp2, cp3, cp4, cp5, cp6, cp7, cp8, cp9, cp10, cp11, cp12, cp13, "
 		"	cp14, cp15, cp16, cp17, cp18, cp19, cp20, cp21, cp22, cp23, cp24, cp25, "
 		"	GameID, DDNet7) "
-		"VALUES (?, ?, %s, %.2f, ?, "
-		"	%.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, "
-		"	%.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, "
-		"	%.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, "
+		"VALUES (?, ?, %s, ROUND(?, 2), ?, "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
 		"	?, false);",
 		pSqlServer->InsertIgnore(), pSqlServer->GetPrefix(),
-		pSqlServer->InsertTimestampAsUtc(), pData->m_Time,
-		pData->m_aCpCurrent[0], pData->m_aCpCurrent[1], pData->m_aCpCurrent[2],
-		pData->m_aCpCurrent[3], pData->m_aCpCurrent[4], pData->m_aCpCurrent[5],
-		pData->m_aCpCurrent[6], pData->m_aCpCurrent[7], pData->m_aCpCurrent[8],
-		pData->m_aCpCurrent[9], pData->m_aCpCurrent[10], pData->m_aCpCurrent[11],
-		pData->m_aCpCurrent[12], pData->m_aCpCurrent[13], pData->m_aCpCurrent[14],
-		pData->m_aCpCurrent[15], pData->m_aCpCurrent[16], pData->m_aCpCurrent[17],
-		pData->m_aCpCurrent[18], pData->m_aCpCurrent[19], pData->m_aCpCurrent[20],
-		pData->m_aCpCurrent[21], pData->m_aCpCurrent[22], pData->m_aCpCurrent[23],
-		pData->m_aCpCurrent[24]);
+		pSqlServer->InsertTimestampAsUtc());
 	pSqlServer->PrepareStatement(aBuf);
 	pSqlServer->BindString(1, pData->m_Map);
 	pSqlServer->BindString(2, pData->m_Name);
 	pSqlServer->BindString(3, pData->m_aTimestamp);
-	pSqlServer->BindString(4, g_Config.m_SvSqlServerName);
-	pSqlServer->BindString(5, pData->m_GameUuid);
+	pSqlServer->BindFloat(4, pData->m_Time);
+	pSqlServer->BindString(5, g_Config.m_SvSqlServerName);
+	for(int i = 0; i < NUM_CHECKPOINTS; i++)
+		pSqlServer->BindFloat(6 + i, pData->m_aCpCurrent[i]);
+	pSqlServer->BindString(6 + NUM_CHECKPOINTS, pData->m_GameUuid);
 	pSqlServer->Print();
 	pSqlServer->Step();
-
-	pData->m_pResult->m_Done = true;
 	return true;
 }
 
+void CSqlScoreData::OnCommit() const
+{
+	str_copy(m_pResult->m_Data.m_aaMessages[0], m_aPointsMessage, sizeof(m_pResult->m_Data.m_aaMessages[0]));
+	m_pResult->m_Done = true;
+}
+
 void CScore::SaveTeamScore(int *aClientIDs, unsigned int Size, float Time, const char *pTimestamp)
 {
 	CConsole *pCon = (CConsole *)GameServer()->Console();
@@ -558,7 +764,7 @@ void CScore::SaveTeamScore(int *aClientIDs, unsigned int Size, float Time, const
 	FormatUuid(GameServer()->GameUuid(), Tmp->m_GameUuid, sizeof(Tmp->m_GameUuid));
 	str_copy(Tmp->m_Map, g_Config.m_SvMap, sizeof(Tmp->m_Map));
 
-	m_pPool->ExecuteWrite(SaveTeamScoreThread, std::move(Tmp), "save team score");
+	m_pPool->ExecuteWrite(SaveTeamScoreThread, std::move(Tmp), "save team score", true);
 }
 
 bool CScore::SaveTeamScoreThread(IDbConnection *pSqlServer, const ISqlData *pGameData, bool Failure)
@@ -609,12 +815,13 @@ bool CScore::SaveTeamScoreThread(IDbConnection *pSqlServer, const ISqlData *pGam
 		if(pData->m_Time < Time)
 		{
 			str_format(aBuf, sizeof(aBuf),
-				"UPDATE %s_teamrace SET Time=%.2f, Timestamp=?, DDNet7=false, GameID=? WHERE ID = ?;",
-				pSqlServer->GetPrefix(), pData->m_Time);
+				"UPDATE %s_teamrace SET Time=ROUND(?, 2), Timestamp=?, DDNet7=false, GameID=? WHERE ID = ?;",
+				pSqlServer->GetPrefix());
 			pSqlServer->PrepareStatement(aBuf);
-			pSqlServer->BindString(1, pData->m_aTimestamp);
-			pSqlServer->BindString(2, pData->m_GameUuid);
-			pSqlServer->BindBlob(3, Teamrank.m_TeamID.m_aData, sizeof(Teamrank.m_TeamID.m_aData));
+			pSqlServer->BindFloat(1, pData->m_Time);
+			pSqlServer->BindString(2, pData->m_aTimestamp);
+			pSqlServer->BindString(3, pData->m_GameUuid);
+			pSqlServer->BindBlob(4, Teamrank.m_TeamID.m_aData, sizeof(Teamrank.m_TeamID.m_aData));
 			pSqlServer->Print();
 			pSqlServer->Step();
 		}
@@ -627,15 +834,16 @@ bool CScore::SaveTeamScoreThread(IDbConnection *pSqlServer, const ISqlData *pGam
 			// if no entry found... create a new one
 			str_format(aBuf, sizeof(aBuf),
 				"%s INTO %s_teamrace(Map, Name, Timestamp, Time, ID, GameID, DDNet7) "
-				"VALUES (?, ?, %s, %.2f, ?, ?, false);",
+				"VALUES (?, ?, %s, ROUND(?, 2), ?, ?, false);",
 				pSqlServer->InsertIgnore(), pSqlServer->GetPrefix(),
-				pSqlServer->InsertTimestampAsUtc(), pData->m_Time);
+				pSqlServer->InsertTimestampAsUtc());
 			pSqlServer->PrepareStatement(aBuf);
 			pSqlServer->BindString(1, pData->m_Map);
 			pSqlServer->BindString(2, pData->m_aNames[i]);
 			pSqlServer->BindString(3, pData->m_aTimestamp);
-			pSqlServer->BindBlob(4, GameID.m_aData, sizeof(GameID.m_aData));
-			pSqlServer->BindString(5, pData->m_GameUuid);
+			pSqlServer->BindFloat(4, pData->m_Time);
+			pSqlServer->BindBlob(5, GameID.m_aData, sizeof(GameID.m_aData));
+			pSqlServer->BindString(6, pData->m_GameUuid);
 			pSqlServer->Print();
 			pSqlServer->Step();
 		}
@@ -643,10 +851,43 @@ bool CScore::SaveTeamScoreThread(IDbConnection *pSqlServer, const ISqlData *pGam
 	return true;
 }
 
+static void RankMessage(CScorePlayerResult *pResult, int Rank, const char *pName, float Time, const char *pRequestingPlayer)
+{
+	char aTime[64];
+	str_time_float(Time, TIME_HOURS_CENTISECS, aTime, sizeof(aTime));
+	if(g_Config.m_SvHideScore)
+	{
+		str_format(pResult->m_Data.m_aaMessages[0], sizeof(pResult->m_Data.m_aaMessages[0]),
+			"Your time: %s", aTime);
+	}
+	else
+	{
+		pResult->m_MessageKind = CScorePlayerResult::ALL;
+		str_format(pResult->m_Data.m_aaMessages[0], sizeof(pResult->m_Data.m_aaMessages[0]),
+			"%d. %s Time: %s, requested by %s",
+			Rank, pName, aTime, pRequestingPlayer);
+	}
+}
+
 void CScore::ShowRank(int ClientID, const char *pName)
 {
 	if(RateLimitPlayer(ClientID))
 		return;
+	if(m_Times.Loaded())
+	{
+		auto pResult = NewSqlPlayerResult(ClientID);
+		if(pResult == nullptr)
+			return;
+		int Rank;
+		float Time;
+		if(m_Times.Rank(pName, &Rank, &Time))
+			RankMessage(pResult.get(), Rank, pName, Time, Server()->ClientName(ClientID));
+		else
+			str_format(pResult->m_Data.m_aaMessages[0], sizeof(pResult->m_Data.m_aaMessages[0]),
+				"%s is not ranked", pName);
+		pResult->FinishLocally();
+		return;
+	}
 	ExecPlayerThread(ShowRankThread, "show rank", ClientID, pName, 0);
 }
 
@@ -674,23 +915,9 @@ bool CScore::ShowRankThread(IDbConnection *pSqlServer, const ISqlData *pGameData
 
 	if(pSqlServer->Step())
 	{
-		int Rank = pSqlServer->GetInt(1);
-		float Time = pSqlServer->GetFloat(3);
-		str_time_float(Time, TIME_HOURS_CENTISECS, aBuf, sizeof(aBuf));
-		if(g_Config.m_SvHideScore)
-		{
-			str_format(pData->m_pResult->m_Data.m_aaMessages[0], sizeof(pData->m_pResult->m_Data.m_aaMessages[0]),
-				"Your time: %s", aBuf);
-		}
-		else
-		{
-			char aName[MAX_NAME_LENGTH];
-			pSqlServer->GetString(2, aName, sizeof(aName));
-			pData->m_pResult->m_MessageKind = CScorePlayerResult::ALL;
-			str_format(pData->m_pResult->m_Data.m_aaMessages[0], sizeof(pData->m_pResult->m_Data.m_aaMessages[0]),
-				"%d. %s Time: %s, requested by %s",
-				Rank, aName, aBuf, pData->m_RequestingPlayer);
-		}
+		char aName[MAX_NAME_LENGTH];
+		pSqlServer->GetString(2, aName, sizeof(aName));
+		RankMessage(pData->m_pResult.get(), pSqlServer->GetInt(1), aName, pSqlServer->GetFloat(3), pData->m_RequestingPlayer);
 	}
 	else
 	{
@@ -783,6 +1010,27 @@ void CScore::ShowTop5(int ClientID, int Offset)
 {
 	if(RateLimitPlayer(ClientID))
 		return;
+	if(m_Times.Loaded())
+	{
+		auto pResult = NewSqlPlayerResult(ClientID);
+		if(pResult == nullptr)
+			return;
+		auto paMessages = pResult->m_Data.m_aaMessages;
+		int aRanks[5];
+		CLeaderboard::CEntry aEntries[5];
+		int Num = m_Times.Top(Offset, 5, aRanks, aEntries);
+		str_copy(paMessages[0], "----------- Top 5 -----------", sizeof(paMessages[0]));
+		for(int i = 0; i < Num; i++)
+		{
+			char aTime[64];
+			str_time_float(aEntries[i].m_Score, TIME_HOURS_CENTISECS, aTime, sizeof(aTime));
+			str_format(paMessages[i + 1], sizeof(paMessages[i + 1]),
+				"%d. %s Time: %s", aRanks[i], aEntries[i].m_aName, aTime);
+		}
+		str_copy(paMessages[Num + 1], "-------------------------------", sizeof(paMessages[Num + 1]));
+		pResult->FinishLocally();
+		return;
+	}
 	ExecPlayerThread(ShowTop5Thread, "show top5", ClientID, "", Offset);
 }
 
@@ -916,6 +1164,8 @@ bool CScore::ShowTeamTop5Thread(IDbConnection *pSqlServer, const ISqlData *pGame
 	return true;
 }
 
+// not answered from m_Times, it only keeps the best time of each player
+// while /times lists every finish with its date
 void CScore::ShowTimes(int ClientID, int Offset)
 {
 	if(RateLimitPlayer(ClientID))
@@ -1030,6 +1280,28 @@ void CScore::ShowPoints(int ClientID, const char *pName)
 {
 	if(RateLimitPlayer(ClientID))
 		return;
+	if(m_Points.Loaded())
+	{
+		auto pResult = NewSqlPlayerResult(ClientID);
+		if(pResult == nullptr)
+			return;
+		int Rank;
+		float Points;
+		if(m_Points.Rank(pName, &Rank, &Points))
+		{
+			pResult->m_MessageKind = CScorePlayerResult::ALL;
+			str_format(pResult->m_Data.m_aaMessages[0], sizeof(pResult->m_Data.m_aaMessages[0]),
+				"%d. %s Points: %d, requested by %s",
+				Rank, pName, (int)Points, Server()->ClientName(ClientID));
+		}
+		else
+		{
+			str_format(pResult->m_Data.m_aaMessages[0], sizeof(pResult->m_Data.m_aaMessages[0]),
+				"%s has not collected any points so far", pName);
+		}
+		pResult->FinishLocally();
+		return;
+	}
 	ExecPlayerThread(ShowPointsThread, "show points", ClientID, pName, 0);
 }
 
@@ -1075,6 +1347,25 @@ void CScore::ShowTopPoints(int ClientID, int Offset)
 {
 	if(RateLimitPlayer(ClientID))
 		return;
+	if(m_Points.Loaded())
+	{
+		auto pResult = NewSqlPlayerResult(ClientID);
+		if(pResult == nullptr)
+			return;
+		auto paMessages = pResult->m_Data.m_aaMessages;
+		int aRanks[5];
+		CLeaderboard::CEntry aEntries[5];
+		int Num = m_Points.Top(Offset, 5, aRanks, aEntries);
+		str_copy(paMessages[0], "-------- Top Points --------", sizeof(paMessages[0]));
+		for(int i = 0; i < Num; i++)
+		{
+			str_format(paMessages[i + 1], sizeof(paMessages[i + 1]),
+				"%d. %s Points: %d", aRanks[i], aEntries[i].m_aName, (int)aEntries[i].m_Score);
+		}
+		str_copy(paMessages[Num + 1], "-------------------------------", sizeof(paMessages[Num + 1]));
+		pResult->FinishLocally();
+		return;
+	}
 	ExecPlayerThread(ShowTopPointsThread, "show top points", ClientID, "", Offset);
 }
 
@@ -1120,11 +1411,68 @@ bool CScore::ShowTopPointsThread(IDbConnection *pSqlServer, const ISqlData *pGam
 	return true;
 }
 
+void CScore::PickRandomMap(CScoreRandomMapResult *pResult, int Stars, const std::unordered_set<std::string> *pFinished, const char *pNoMapMessage)
+{
+	const char *pMap = m_RandomMaps.Pick(Stars, g_Config.m_SvMap, pFinished, &m_Prng);
+	if(pMap)
+		str_copy(pResult->m_Map, pMap, sizeof(pResult->m_Map));
+	else
+		str_copy(pResult->m_aMessage, pNoMapMessage, sizeof(pResult->m_aMessage));
+	pResult->m_Done = true;
+}
+
+bool CScore::LoadRandomMapsThread(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CSqlRandomMapsRequest *pData = dynamic_cast<const CSqlRandomMapsRequest *>(pGameData);
+
+	char aBuf[512];
+	str_format(aBuf, sizeof(aBuf), "SELECT Map, Stars FROM %s_maps WHERE Server = ?;", pSqlServer->GetPrefix());
+	pSqlServer->PrepareStatement(aBuf);
+	pSqlServer->BindString(1, pData->m_ServerType);
+
+	CRandomMaps::CMap Map;
+	while(pSqlServer->Step())
+	{
+		pSqlServer->GetString(1, Map.m_aName, sizeof(Map.m_aName));
+		Map.m_Stars = pSqlServer->GetInt(2);
+		pData->m_pResult->m_vMaps.push_back(Map);
+	}
+
+	pData->m_pResult->m_Done = true;
+	return true;
+}
+
+bool CScore::LoadFinishedMapsThread(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CSqlFinishedMapsRequest *pData = dynamic_cast<const CSqlFinishedMapsRequest *>(pGameData);
+
+	char aBuf[512];
+	str_format(aBuf, sizeof(aBuf), "SELECT DISTINCT Map FROM %s_race WHERE Name = ?;", pSqlServer->GetPrefix());
+	pSqlServer->PrepareStatement(aBuf);
+	pSqlServer->BindString(1, pData->m_pResult->m_aName);
+
+	while(pSqlServer->Step())
+	{
+		char aMap[MAX_MAP_LENGTH];
+		pSqlServer->GetString(1, aMap, sizeof(aMap));
+		pData->m_pResult->m_vMaps.push_back(aMap);
+	}
+
+	pData->m_pResult->m_Done = true;
+	return true;
+}
+
 void CScore::RandomMap(int ClientID, int Stars)
 {
 	auto pResult = std::make_shared<CScoreRandomMapResult>(ClientID);
 	GameServer()->m_SqlRandomMapResult = pResult;
 
+	if(m_RandomMaps.Loaded())
+	{
+		PickRandomMap(pResult.get(), 0 <= Stars && Stars <= 5 ? Stars : -1, nullptr, "No maps found on this server!");
+		return;
+	}
+
 	auto Tmp = std::unique_ptr<CSqlRandomMapRequest>(new CSqlRandomMapRequest(pResult));
 	Tmp->m_Stars = Stars;
 	str_copy(Tmp->m_CurrentMap, g_Config.m_SvMap, sizeof(Tmp->m_CurrentMap));
@@ -1179,6 +1527,31 @@ void CScore::RandomUnfinishedMap(int ClientID, int Stars)
 	auto pResult = std::make_shared<CScoreRandomMapResult>(ClientID);
 	GameServer()->m_SqlRandomMapResult = pResult;
 
+	if(m_RandomMaps.Loaded())
+	{
+		const char *pName = GameServer()->Server()->ClientName(ClientID);
+		auto Finished = m_FinishedMaps.find(pName);
+		if(Finished != m_FinishedMaps.end())
+		{
+			PickRandomMap(pResult.get(), Stars, &Finished->second, "You have no more unfinished maps on this server!");
+			return;
+		}
+
+		// the vote is picked once the finished maps are loaded
+		auto pFinished = std::make_shared<CScoreFinishedMapsResult>(pResult, Stars);
+		str_copy(pFinished->m_aName, pName, sizeof(pFinished->m_aName));
+		if(m_pPool->Execute(LoadFinishedMapsThread, std::unique_ptr<CSqlFinishedMapsRequest>(new CSqlFinishedMapsRequest(pFinished)), "load finished maps"))
+		{
+			m_vpFinishedMapsResults.push_back(pFinished);
+		}
+		else
+		{
+			str_copy(pResult->m_aMessage, "The database is busy, please try again later", sizeof(pResult->m_aMessage));
+			pResult->m_Done = true;
+		}
+		return;
+	}
+
 	auto Tmp = std::unique_ptr<CSqlRandomMapRequest>(new CSqlRandomMapRequest(pResult));
 	Tmp->m_Stars = Stars;
 	str_copy(Tmp->m_CurrentMap, g_Config.m_SvMap, sizeof(Tmp->m_CurrentMap));
@@ -1277,7 +1650,7 @@ bool CScore::SaveTeamThread(IDbConnection *pSqlServer, const ISqlData *pGameData
 	char aSaveID[UUID_MAXSTRSIZE];
 	FormatUuid(pData->m_pResult->m_SaveID, aSaveID, UUID_MAXSTRSIZE);
 
-	char *pSaveState = pData->m_pResult->m_SavedTeam.GetString();
+	char *pSaveState = pData->m_pResult->m_SavedTeam.GetString(g_Config.m_SvSaveGamesCompact);
 	char aBuf[65536];
 
 	char aTable[512];
@@ -4,13 +4,18 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <engine/map.h>
 #include <engine/server/databases/connection_pool.h>
+#include <engine/shared/mpsc_queue.h>
 #include <game/prng.h>
 #include <game/voting.h>
 
+#include "leaderboard.h"
+#include "randommaps.h"
 #include "save.h"
 
 struct ISqlData;
@@ -24,10 +29,23 @@ enum
 	TIMESTAMP_STR_LENGTH = 20, // 2019-04-02 19:38:36
 };
 
-struct CScorePlayerResult
+struct CScorePlayerResult;
+// finished player results, drained by the game thread every tick
+typedef CMpscQueue<std::shared_ptr<CScorePlayerResult>> CScorePlayerResultQueue;
+
+struct CScorePlayerResult : std::enable_shared_from_this<CScorePlayerResult>
 {
 	std::atomic_bool m_Done;
-	CScorePlayerResult();
+	CScorePlayerResult(int ClientID, std::weak_ptr<CScorePlayerResultQueue> pCompletions);
+
+	int m_ClientID;
+	std::weak_ptr<CScorePlayerResultQueue> m_pCompletions;
+	// called by the request holding the result once it is done with it,
+	// i.e. after the last retry of a write
+	void Complete();
+	// for results answered without a database request, e.g. from the
+	// cached leaderboards
+	void FinishLocally();
 
 	enum
 	{
@@ -80,6 +98,33 @@ struct CScoreRandomMapResult
 	char m_aMessage[512];
 };
 
+struct CScoreRandomMapsResult
+{
+	CScoreRandomMapsResult() :
+		m_Done(false)
+	{
+	}
+	std::atomic_bool m_Done;
+	std::vector<CRandomMaps::CMap> m_vMaps;
+};
+
+// maps finished by a player voting for a random unfinished map
+struct CScoreFinishedMapsResult
+{
+	CScoreFinishedMapsResult(std::shared_ptr<CScoreRandomMapResult> pVote, int Stars) :
+		m_Done(false),
+		m_pVote(pVote),
+		m_Stars(Stars)
+	{
+		m_aName[0] = '\0';
+	}
+	std::atomic_bool m_Done;
+	std::shared_ptr<CScoreRandomMapResult> m_pVote;
+	int m_Stars;
+	char m_aName[MAX_NAME_LENGTH];
+	std::vector<std::string> m_vMaps;
+};
+
 struct CScoreSaveResult
 {
 	CScoreSaveResult(int PlayerID, IGameController *Controller) :
@@ -116,6 +161,20 @@ struct CScoreInitResult
 	float m_CurrentRecord;
 };
 
+struct CScoreLeaderboardResult
+{
+	CScoreLeaderboardResult() :
+		m_Done(false),
+		m_MapPoints(-1)
+	{
+	}
+	std::atomic_bool m_Done;
+	std::vector<CLeaderboard::CEntry> m_vTimes;
+	std::vector<CLeaderboard::CEntry> m_vPoints;
+	// -1 if the map isn't in the maps table
+	int m_MapPoints;
+};
+
 class CPlayerData
 {
 public:
@@ -158,12 +217,25 @@ struct CSqlInitData : ISqlData
 	char m_Map[MAX_MAP_LENGTH];
 };
 
+struct CSqlLeaderboardRequest : ISqlData
+{
+	CSqlLeaderboardRequest(std::shared_ptr<CScoreLeaderboardResult> pResult) :
+		m_pResult(pResult)
+	{
+	}
+	std::shared_ptr<CScoreLeaderboardResult> m_pResult;
+
+	// current map
+	char m_Map[MAX_MAP_LENGTH];
+};
+
 struct CSqlPlayerRequest : ISqlData
 {
 	CSqlPlayerRequest(std::shared_ptr<CScorePlayerResult> pResult) :
 		m_pResult(pResult)
 	{
 	}
+	~CSqlPlayerRequest() { m_pResult->Complete(); }
 	std::shared_ptr<CScorePlayerResult> m_pResult;
 	// object being requested, either map (128 bytes) or player (16 bytes)
 	char m_Name[MAX_MAP_LENGTH];
@@ -174,6 +246,27 @@ struct CSqlPlayerRequest : ISqlData
 	int m_Offset;
 };
 
+// player data of everyone who joined within sv_sql_player_data_batch
+// milliseconds, loaded with one query
+struct CSqlPlayerDataRequest : ISqlData
+{
+	struct CEntry
+	{
+		std::shared_ptr<CScorePlayerResult> m_pResult;
+		char m_aName[MAX_NAME_LENGTH];
+	};
+	std::vector<CEntry> m_vPlayers;
+
+	~CSqlPlayerDataRequest()
+	{
+		for(const CEntry &Player : m_vPlayers)
+			Player.m_pResult->Complete();
+	}
+
+	// current map
+	char m_Map[MAX_MAP_LENGTH];
+};
+
 struct CSqlRandomMapRequest : ISqlData
 {
 	CSqlRandomMapRequest(std::shared_ptr<CScoreRandomMapResult> pResult) :
@@ -188,13 +281,35 @@ struct CSqlRandomMapRequest : ISqlData
 	int m_Stars;
 };
 
+struct CSqlRandomMapsRequest : ISqlData
+{
+	CSqlRandomMapsRequest(std::shared_ptr<CScoreRandomMapsResult> pResult) :
+		m_pResult(pResult)
+	{
+	}
+	std::shared_ptr<CScoreRandomMapsResult> m_pResult;
+
+	char m_ServerType[32];
+};
+
+struct CSqlFinishedMapsRequest : ISqlData
+{
+	CSqlFinishedMapsRequest(std::shared_ptr<CScoreFinishedMapsResult> pResult) :
+		m_pResult(pResult)
+	{
+	}
+	std::shared_ptr<CScoreFinishedMapsResult> m_pResult;
+};
+
 struct CSqlScoreData : ISqlData
 {
 	CSqlScoreData(std::shared_ptr<CScorePlayerResult> pResult) :
 		m_pResult(pResult)
 	{
+		m_aPointsMessage[0] = 0;
 	}
-	virtual ~CSqlScoreData(){};
+	virtual ~CSqlScoreData() { m_pResult->Complete(); }
+	virtual void OnCommit() const;
 
 	std::shared_ptr<CScorePlayerResult> m_pResult;
 
@@ -209,6 +324,10 @@ struct CSqlScoreData : ISqlData
 	int m_Num;
 	bool m_Search;
 	char m_aRequestingPlayer[MAX_NAME_LENGTH];
+
+	// written by SaveScoreThread on every attempt, copied into m_pResult
+	// by OnCommit
+	mutable char m_aPointsMessage[512];
 };
 
 struct CSqlTeamScoreData : ISqlData
@@ -284,8 +403,41 @@ class CScore
 	CPlayerData m_aPlayerData[MAX_CLIENTS];
 	CDbConnectionPool *m_pPool;
 
+	// best times on the current map and points of all players, answer
+	// /rank, /top5, /points and /toppoints without a query once loaded
+	CLeaderboard m_Times;
+	CLeaderboard m_Points;
+	int m_MapPoints;
+	std::shared_ptr<CScoreLeaderboardResult> m_pLeaderboardResult;
+	// finishes since the running reload was started, applied again on
+	// top of its result
+	std::vector<CLeaderboard::CEntry> m_vPendingFinishes;
+	int64 m_LastLeaderboardLoad;
+
+	void LoadLeaderboards();
+	void ApplyFinish(const char *pName, float Time);
+
+	// player data loads waiting to be sent as one batch
+	std::unique_ptr<CSqlPlayerDataRequest> m_pPlayerDataBatch;
+	int64 m_PlayerDataBatchStart;
+
+	void FlushPlayerData();
+
+	// maps of this server, answer random map votes once loaded
+	CRandomMaps m_RandomMaps;
+	std::shared_ptr<CScoreRandomMapsResult> m_pRandomMapsResult;
+	// finished maps of players who voted for an unfinished map
+	std::unordered_map<std::string, std::unordered_set<std::string>> m_FinishedMaps;
+	// votes waiting for the finished maps of the voter
+	std::vector<std::shared_ptr<CScoreFinishedMapsResult>> m_vpFinishedMapsResults;
+
+	void PickRandomMap(CScoreRandomMapResult *pResult, int Stars, const std::unordered_set<std::string> *pFinished, const char *pNoMapMessage);
+
 	static bool Init(IDbConnection *pSqlServer, const ISqlData *pGameData);
+	static bool LoadLeaderboardsThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
 
+	static bool LoadRandomMapsThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
+	static bool LoadFinishedMapsThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
 	static bool RandomMapThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
 	static bool RandomUnfinishedMapThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
 	static bool MapVoteThread(IDbConnection *pSqlServer, const ISqlData *pGameData);
@@ -316,6 +468,10 @@ class CScore
 	CPrng m_Prng;
 	void GeneratePassphrase(char *pBuf, int BufSize);
 
+	// results are handed to the players by OnTick once their request is done
+	std::shared_ptr<CScorePlayerResultQueue> m_pPlayerResults;
+	std::vector<std::shared_ptr<CScorePlayerResult>> m_vpCompletedResults;
+
 	// returns new SqlResult bound to the player, if no current Thread is active for this player
 	std::shared_ptr<CScorePlayerResult> NewSqlPlayerResult(int ClientID);
 	// Creates for player database requests
@@ -335,6 +491,8 @@ public:
 
 	CPlayerData *PlayerData(int ID) { return &m_aPlayerData[ID]; }
 
+	void OnTick();
+
 	void MapInfo(int ClientID, const char *pMapName);
 	void MapVote(int ClientID, const char *pMapName);
 	void LoadPlayerData(int ClientID);
@@ -3,37 +3,27 @@
 #include <engine/shared/config.h>
 #include <engine/shared/json.h>
 #include <engine/shared/snapshot.h>
+#include <engine/shared/teehistorian_reader.h>
 #include <game/gamecore.h>
 
 static const char TEEHISTORIAN_NAME[] = "teehistorian@ddnet.tw";
 static const CUuid TEEHISTORIAN_UUID = CalculateUuid(TEEHISTORIAN_NAME);
 static const char TEEHISTORIAN_VERSION[] = "2";
 
+static_assert(sizeof(CNetObj_PlayerInput) == CTeeHistorianState::INPUT_SIZE * sizeof(int), "Index state must hold a complete player input.");
+
 #define UUID(id, name) static const CUuid UUID_##id = CalculateUuid(name);
 #include <engine/shared/teehistorian_ex_chunks.h>
 #undef UUID
 
-enum
-{
-	TEEHISTORIAN_NONE,
-	TEEHISTORIAN_FINISH,
-	TEEHISTORIAN_TICK_SKIP,
-	TEEHISTORIAN_PLAYER_NEW,
-	TEEHISTORIAN_PLAYER_OLD,
-	TEEHISTORIAN_INPUT_DIFF,
-	TEEHISTORIAN_INPUT_NEW,
-	TEEHISTORIAN_MESSAGE,
-	TEEHISTORIAN_JOIN,
-	TEEHISTORIAN_DROP,
-	TEEHISTORIAN_CONSOLE_COMMAND,
-	TEEHISTORIAN_EX,
-};
-
 CTeeHistorian::CTeeHistorian()
 {
 	m_State = STATE_START;
 	m_pfnWriteCallback = 0;
 	m_pWriteCallbackUserdata = 0;
+	m_IndexInterval = 0;
+	m_pfnIndexCallback = 0;
+	m_pIndexCallbackUserdata = 0;
 }
 
 void CTeeHistorian::Reset(const CGameInfo *pGameInfo, WRITE_CALLBACK pfnWriteCallback, void *pUser)
@@ -55,6 +45,9 @@ void CTeeHistorian::Reset(const CGameInfo *pGameInfo, WRITE_CALLBACK pfnWriteCal
 	}
 	m_pfnWriteCallback = pfnWriteCallback;
 	m_pWriteCallbackUserdata = pUser;
+	m_IndexInterval = 0;
+	m_pfnIndexCallback = 0;
+	m_pIndexCallbackUserdata = 0;
 
 	WriteHeader(pGameInfo);
 
@@ -184,6 +177,39 @@ void CTeeHistorian::WriteExtra(CUuid Uuid, const void *pData, int DataSize)
 	Write(pData, DataSize);
 }
 
+void CTeeHistorian::EnableIndex(int Interval, INDEX_CALLBACK pfnIndexCallback, void *pUser)
+{
+	dbg_assert(Interval > 0, "invalid teehistorian index interval");
+	m_IndexInterval = Interval;
+	m_NextIndexTick = 0;
+	m_pfnIndexCallback = pfnIndexCallback;
+	m_pIndexCallbackUserdata = pUser;
+}
+
+void CTeeHistorian::WriteIndex()
+{
+	// the state a reader has after reading everything written so far
+	CTeeHistorianState State;
+	State.m_Tick = m_LastWrittenTick;
+	State.m_LastClientID = m_MaxClientID;
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		const CPlayer *pPrev = &m_aPrevPlayers[i];
+		CTeeHistorianState::CPlayer *pPlayer = &State.m_aPlayers[i];
+		pPlayer->m_Alive = pPrev->m_Alive;
+		pPlayer->m_X = pPrev->m_X;
+		pPlayer->m_Y = pPrev->m_Y;
+		pPlayer->m_InputExists = pPrev->m_InputExists;
+		if(pPrev->m_InputExists)
+		{
+			mem_copy(pPlayer->m_aInput, &pPrev->m_Input, sizeof(pPlayer->m_aInput));
+		}
+	}
+	std::vector<unsigned char> vState;
+	State.Pack(&vState);
+	m_pfnIndexCallback(m_Tick, vState.data(), vState.size(), m_pIndexCallbackUserdata);
+}
+
 void CTeeHistorian::BeginTick(int Tick)
 {
 	dbg_assert(m_State == STATE_START || m_State == STATE_BEFORE_TICK, "invalid teehistorian state");
@@ -196,6 +222,12 @@ void CTeeHistorian::BeginTick(int Tick)
 		dbg_msg("teehistorian", "tick %d", Tick);
 	}
 
+	if(m_pfnIndexCallback && Tick >= m_NextIndexTick)
+	{
+		WriteIndex();
+		m_NextIndexTick = Tick - Tick % m_IndexInterval + m_IndexInterval;
+	}
+
 	m_State = STATE_BEFORE_PLAYERS;
 }
 
@@ -17,6 +17,7 @@ class CTeeHistorian
 {
 public:
 	typedef void (*WRITE_CALLBACK)(const void *pData, int DataSize, void *pUser);
+	typedef void (*INDEX_CALLBACK)(int Tick, const void *pState, int StateSize, void *pUser);
 
 	struct CGameInfo
 	{
@@ -48,6 +49,9 @@ public:
 	CTeeHistorian();
 
 	void Reset(const CGameInfo *pGameInfo, WRITE_CALLBACK pfnWriteCallback, void *pUser);
+	// Reports the decoder state every `Interval` ticks so that readers can
+	// start in the middle of the stream. Disabled by `Reset`.
+	void EnableIndex(int Interval, INDEX_CALLBACK pfnIndexCallback, void *pUser);
 	void Finish();
 
 	bool Starting() const { return m_State == STATE_START; }
@@ -89,6 +93,7 @@ private:
 	void EnsureTickWrittenPlayerData(int ClientID);
 	void EnsureTickWritten();
 	void WriteTick();
+	void WriteIndex();
 	void Write(const void *pData, int DataSize);
 
 	enum
@@ -116,6 +121,11 @@ private:
 	WRITE_CALLBACK m_pfnWriteCallback;
 	void *m_pWriteCallbackUserdata;
 
+	int m_IndexInterval;
+	int m_NextIndexTick;
+	INDEX_CALLBACK m_pfnIndexCallback;
+	void *m_pIndexCallbackUserdata;
+
 	int m_State;
 
 	int m_LastWrittenTick;
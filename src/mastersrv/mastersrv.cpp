@@ -1,5 +1,6 @@
 /* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
 /* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#include <base/math.h>
 #include <base/system.h>
 
 #include <engine/config.h>
@@ -13,15 +14,40 @@
 
 #include "mastersrv.h"
 
+#include <unordered_map>
+
 enum
 {
 	MTU = 1400,
 	MAX_SERVERS_PER_PACKET = 75,
-	MAX_PACKETS = 16,
+	MAX_PACKETS = 64,
 	MAX_SERVERS = MAX_SERVERS_PER_PACKET * MAX_PACKETS,
 	EXPIRE_TIME = 90
 };
 
+struct CAddrHash
+{
+	size_t operator()(const NETADDR &Addr) const
+	{
+		// FNV-1a over the same bytes `net_addr_comp` compares
+		const unsigned char *pData = (const unsigned char *)&Addr;
+		size_t Hash = 2166136261u;
+		for(unsigned i = 0; i < sizeof(Addr); i++)
+			Hash = (Hash ^ pData[i]) * 16777619u;
+		return Hash;
+	}
+};
+
+struct CAddrEqual
+{
+	bool operator()(const NETADDR &Addr1, const NETADDR &Addr2) const
+	{
+		return net_addr_comp(&Addr1, &Addr2) == 0;
+	}
+};
+
+typedef std::unordered_map<NETADDR, int, CAddrHash, CAddrEqual> CAddrIndex;
+
 struct CCheckServer
 {
 	enum ServerType m_Type;
@@ -33,16 +59,26 @@ struct CCheckServer
 
 static CCheckServer m_aCheckServers[MAX_SERVERS];
 static int m_NumCheckServers = 0;
+// both addresses of the check servers
+static CAddrIndex m_CheckServerIndex;
 
 struct CServerEntry
 {
 	enum ServerType m_Type;
 	NETADDR m_Address;
 	int64 m_Expire;
+	// position in the list packets of its type
+	int m_Slot;
 };
 
 static CServerEntry m_aServers[MAX_SERVERS];
 static int m_NumServers = 0;
+static CAddrIndex m_ServerIndex;
+
+// the servers in the list packets of each type, the packets are updated
+// when a server is added or removed so requests are answered from them
+static int m_aaSlotServers[2][MAX_SERVERS];
+static int m_aNumSlots[2] = {0, 0};
 
 struct CPacketData
 {
@@ -88,84 +124,63 @@ static CNetClient m_NetOp; // main
 
 IConsole *m_pConsole;
 
-void BuildPackets()
+void InitPackets()
 {
-	CServerEntry *pCurrent = &m_aServers[0];
-	int ServersLeft = m_NumServers;
-	m_NumPackets = 0;
-	m_NumPacketsLegacy = 0;
-	int PacketIndex = 0;
-	int PacketIndexLegacy = 0;
-	while(ServersLeft-- && (m_NumPackets + m_NumPacketsLegacy) < MAX_PACKETS)
+	for(int i = 0; i < MAX_PACKETS; i++)
 	{
-		if(pCurrent->m_Type == SERVERTYPE_NORMAL)
-		{
-			if(PacketIndex % MAX_SERVERS_PER_PACKET == 0)
-			{
-				PacketIndex = 0;
-				m_NumPackets++;
-			}
-
-			// copy header
-			mem_copy(m_aPackets[m_NumPackets - 1].m_Data.m_aHeader, SERVERBROWSE_LIST, sizeof(SERVERBROWSE_LIST));
-
-			// copy server addresses
-			if(pCurrent->m_Address.type == NETTYPE_IPV6)
-			{
-				mem_copy(m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp, pCurrent->m_Address.ip,
-					sizeof(m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp));
-			}
-			else
-			{
-				static char IPV4Mapping[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, (char)0xFF, (char)0xFF};
-
-				mem_copy(m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp, IPV4Mapping, sizeof(IPV4Mapping));
-				m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp[12] = pCurrent->m_Address.ip[0];
-				m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp[13] = pCurrent->m_Address.ip[1];
-				m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp[14] = pCurrent->m_Address.ip[2];
-				m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aIp[15] = pCurrent->m_Address.ip[3];
-			}
-
-			m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aPort[0] = (pCurrent->m_Address.port >> 8) & 0xff;
-			m_aPackets[m_NumPackets - 1].m_Data.m_aServers[PacketIndex].m_aPort[1] = pCurrent->m_Address.port & 0xff;
-
-			PacketIndex++;
-
-			m_aPackets[m_NumPackets - 1].m_Size = sizeof(SERVERBROWSE_LIST) + sizeof(CMastersrvAddr) * PacketIndex;
+		mem_copy(m_aPackets[i].m_Data.m_aHeader, SERVERBROWSE_LIST, sizeof(SERVERBROWSE_LIST));
+		mem_copy(m_aPacketsLegacy[i].m_Data.m_aHeader, SERVERBROWSE_LIST_LEGACY, sizeof(SERVERBROWSE_LIST_LEGACY));
+	}
+}
 
-			pCurrent++;
+void WriteSlot(ServerType Type, int Slot, const NETADDR *pAddr)
+{
+	int Packet = Slot / MAX_SERVERS_PER_PACKET;
+	int Index = Slot % MAX_SERVERS_PER_PACKET;
+	if(Type == SERVERTYPE_NORMAL)
+	{
+		CMastersrvAddr *pEntry = &m_aPackets[Packet].m_Data.m_aServers[Index];
+		if(pAddr->type == NETTYPE_IPV6)
+		{
+			mem_copy(pEntry->m_aIp, pAddr->ip, sizeof(pEntry->m_aIp));
 		}
-		else if(pCurrent->m_Type == SERVERTYPE_LEGACY)
+		else
 		{
-			if(PacketIndexLegacy % MAX_SERVERS_PER_PACKET == 0)
-			{
-				PacketIndexLegacy = 0;
-				m_NumPacketsLegacy++;
-			}
-
-			// copy header
-			mem_copy(m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Data.m_aHeader, SERVERBROWSE_LIST_LEGACY, sizeof(SERVERBROWSE_LIST_LEGACY));
+			static char IPV4Mapping[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, (char)0xFF, (char)0xFF};
 
-			// copy server addresses
-			mem_copy(m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Data.m_aServers[PacketIndexLegacy].m_aIp, pCurrent->m_Address.ip,
-				sizeof(m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Data.m_aServers[PacketIndexLegacy].m_aIp));
-			// 0.5 has the port in little endian on the network
-			m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Data.m_aServers[PacketIndexLegacy].m_aPort[0] = pCurrent->m_Address.port & 0xff;
-			m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Data.m_aServers[PacketIndexLegacy].m_aPort[1] = (pCurrent->m_Address.port >> 8) & 0xff;
-
-			PacketIndexLegacy++;
+			mem_copy(pEntry->m_aIp, IPV4Mapping, sizeof(IPV4Mapping));
+			mem_copy(&pEntry->m_aIp[12], pAddr->ip, 4);
+		}
 
-			m_aPacketsLegacy[m_NumPacketsLegacy - 1].m_Size = sizeof(SERVERBROWSE_LIST_LEGACY) + sizeof(CMastersrvAddrLegacy) * PacketIndexLegacy;
+		pEntry->m_aPort[0] = (pAddr->port >> 8) & 0xff;
+		pEntry->m_aPort[1] = pAddr->port & 0xff;
+	}
+	else
+	{
+		CMastersrvAddrLegacy *pEntry = &m_aPacketsLegacy[Packet].m_Data.m_aServers[Index];
+		mem_copy(pEntry->m_aIp, pAddr->ip, sizeof(pEntry->m_aIp));
+		// 0.5 has the port in little endian on the network
+		pEntry->m_aPort[0] = pAddr->port & 0xff;
+		pEntry->m_aPort[1] = (pAddr->port >> 8) & 0xff;
+	}
+}
 
-			pCurrent++;
-		}
+void UpdatePacketSizes(ServerType Type)
+{
+	int NumSlots = m_aNumSlots[Type];
+	int NumPackets = (NumSlots + MAX_SERVERS_PER_PACKET - 1) / MAX_SERVERS_PER_PACKET;
+	for(int i = 0; i < NumPackets; i++)
+	{
+		int NumEntries = minimum(NumSlots - i * MAX_SERVERS_PER_PACKET, (int)MAX_SERVERS_PER_PACKET);
+		if(Type == SERVERTYPE_NORMAL)
+			m_aPackets[i].m_Size = sizeof(SERVERBROWSE_LIST) + sizeof(CMastersrvAddr) * NumEntries;
 		else
-		{
-			*pCurrent = m_aServers[m_NumServers - 1];
-			m_NumServers--;
-			dbg_msg("mastersrv", "ERROR: server of invalid type, dropping it");
-		}
+			m_aPacketsLegacy[i].m_Size = sizeof(SERVERBROWSE_LIST_LEGACY) + sizeof(CMastersrvAddrLegacy) * NumEntries;
 	}
+	if(Type == SERVERTYPE_NORMAL)
+		m_NumPackets = NumPackets;
+	else
+		m_NumPacketsLegacy = NumPackets;
 }
 
 void SendOk(NETADDR *pAddr)
@@ -204,8 +219,54 @@ void SendCheck(NETADDR *pAddr)
 	m_NetChecker.Send(&p);
 }
 
+void IndexAddress(CAddrIndex *pIndex, const NETADDR *pAddr, int Index)
+{
+	// keeps the entry of another server using the address
+	pIndex->emplace(*pAddr, Index);
+}
+
+void UnindexAddress(CAddrIndex *pIndex, const NETADDR *pAddr, int Index)
+{
+	auto It = pIndex->find(*pAddr);
+	if(It != pIndex->end() && It->second == Index)
+		pIndex->erase(It);
+}
+
+void MoveAddress(CAddrIndex *pIndex, const NETADDR *pAddr, int From, int To)
+{
+	auto It = pIndex->find(*pAddr);
+	if(It != pIndex->end() && It->second == From)
+		It->second = To;
+}
+
+int FindCheckServer(const NETADDR *pAddr)
+{
+	auto It = m_CheckServerIndex.find(*pAddr);
+	return It == m_CheckServerIndex.end() ? -1 : It->second;
+}
+
+void RemoveCheckServer(int Index)
+{
+	CCheckServer *pCheck = &m_aCheckServers[Index];
+	UnindexAddress(&m_CheckServerIndex, &pCheck->m_Address, Index);
+	UnindexAddress(&m_CheckServerIndex, &pCheck->m_AltAddress, Index);
+
+	int Last = --m_NumCheckServers;
+	if(Index != Last)
+	{
+		*pCheck = m_aCheckServers[Last];
+		MoveAddress(&m_CheckServerIndex, &pCheck->m_Address, Last, Index);
+		MoveAddress(&m_CheckServerIndex, &pCheck->m_AltAddress, Last, Index);
+	}
+}
+
 void AddCheckserver(NETADDR *pInfo, NETADDR *pAlt, ServerType Type)
 {
+	// a repeated heartbeat restarts the check
+	int Existing = FindCheckServer(pInfo);
+	if(Existing >= 0 && net_addr_comp(&m_aCheckServers[Existing].m_Address, pInfo) == 0)
+		RemoveCheckServer(Existing);
+
 	// add server
 	if(m_NumCheckServers == MAX_SERVERS)
 	{
@@ -223,22 +284,22 @@ void AddCheckserver(NETADDR *pInfo, NETADDR *pAlt, ServerType Type)
 	m_aCheckServers[m_NumCheckServers].m_TryCount = 0;
 	m_aCheckServers[m_NumCheckServers].m_TryTime = 0;
 	m_aCheckServers[m_NumCheckServers].m_Type = Type;
+	IndexAddress(&m_CheckServerIndex, pInfo, m_NumCheckServers);
+	IndexAddress(&m_CheckServerIndex, pAlt, m_NumCheckServers);
 	m_NumCheckServers++;
 }
 
 void AddServer(NETADDR *pInfo, ServerType Type)
 {
 	// see if server already exists in list
-	for(int i = 0; i < m_NumServers; i++)
+	auto It = m_ServerIndex.find(*pInfo);
+	if(It != m_ServerIndex.end())
 	{
-		if(net_addr_comp(&m_aServers[i].m_Address, pInfo) == 0)
-		{
-			char aAddrStr[NETADDR_MAXSTRSIZE];
-			net_addr_str(pInfo, aAddrStr, sizeof(aAddrStr), true);
-			dbg_msg("mastersrv", "updated: %s", aAddrStr);
-			m_aServers[i].m_Expire = time_get() + time_freq() * EXPIRE_TIME;
-			return;
-		}
+		char aAddrStr[NETADDR_MAXSTRSIZE];
+		net_addr_str(pInfo, aAddrStr, sizeof(aAddrStr), true);
+		dbg_msg("mastersrv", "updated: %s", aAddrStr);
+		m_aServers[It->second].m_Expire = time_get() + time_freq() * EXPIRE_TIME;
+		return;
 	}
 
 	// add server
@@ -251,12 +312,44 @@ void AddServer(NETADDR *pInfo, ServerType Type)
 	char aAddrStr[NETADDR_MAXSTRSIZE];
 	net_addr_str(pInfo, aAddrStr, sizeof(aAddrStr), true);
 	dbg_msg("mastersrv", "added: %s", aAddrStr);
-	m_aServers[m_NumServers].m_Address = *pInfo;
-	m_aServers[m_NumServers].m_Expire = time_get() + time_freq() * EXPIRE_TIME;
-	m_aServers[m_NumServers].m_Type = Type;
+	CServerEntry *pEntry = &m_aServers[m_NumServers];
+	pEntry->m_Address = *pInfo;
+	pEntry->m_Expire = time_get() + time_freq() * EXPIRE_TIME;
+	pEntry->m_Type = Type;
+	pEntry->m_Slot = m_aNumSlots[Type]++;
+	m_aaSlotServers[Type][pEntry->m_Slot] = m_NumServers;
+	WriteSlot(Type, pEntry->m_Slot, pInfo);
+	UpdatePacketSizes(Type);
+	m_ServerIndex[*pInfo] = m_NumServers;
 	m_NumServers++;
 }
 
+void RemoveServer(int Index)
+{
+	CServerEntry *pEntry = &m_aServers[Index];
+	ServerType Type = pEntry->m_Type;
+
+	// fill the slot with the last one of the packets
+	int LastSlot = --m_aNumSlots[Type];
+	if(pEntry->m_Slot != LastSlot)
+	{
+		int Moved = m_aaSlotServers[Type][LastSlot];
+		m_aaSlotServers[Type][pEntry->m_Slot] = Moved;
+		m_aServers[Moved].m_Slot = pEntry->m_Slot;
+		WriteSlot(Type, pEntry->m_Slot, &m_aServers[Moved].m_Address);
+	}
+	UpdatePacketSizes(Type);
+
+	m_ServerIndex.erase(pEntry->m_Address);
+	int Last = --m_NumServers;
+	if(Index != Last)
+	{
+		*pEntry = m_aServers[Last];
+		m_ServerIndex[pEntry->m_Address] = Index;
+		m_aaSlotServers[pEntry->m_Type][pEntry->m_Slot] = Index;
+	}
+}
+
 void UpdateServers()
 {
 	int64 Now = time_get();
@@ -275,8 +368,7 @@ void UpdateServers()
 
 				// FAIL!!
 				SendError(&m_aCheckServers[i].m_Address);
-				m_aCheckServers[i] = m_aCheckServers[m_NumCheckServers - 1];
-				m_NumCheckServers--;
+				RemoveCheckServer(i);
 				i--;
 			}
 			else
@@ -304,8 +396,7 @@ void PurgeServers()
 			char aAddrStr[NETADDR_MAXSTRSIZE];
 			net_addr_str(&m_aServers[i].m_Address, aAddrStr, sizeof(aAddrStr), true);
 			dbg_msg("mastersrv", "expired: %s", aAddrStr);
-			m_aServers[i] = m_aServers[m_NumServers - 1];
-			m_NumServers--;
+			RemoveServer(i);
 		}
 		else
 			i++;
@@ -320,7 +411,7 @@ void ReloadBans()
 
 int main(int argc, const char **argv) // ignore_convention
 {
-	int64 LastBuild = 0, LastBanReload = 0;
+	int64 LastPurge = 0, LastBanReload = 0;
 	ServerType Type = SERVERTYPE_INVALID;
 	NETADDR BindAddr;
 
@@ -329,6 +420,7 @@ int main(int argc, const char **argv) // ignore_convention
 
 	mem_copy(m_CountData.m_Header, SERVERBROWSE_COUNT, sizeof(SERVERBROWSE_COUNT));
 	mem_copy(m_CountDataLegacy.m_Header, SERVERBROWSE_COUNT_LEGACY, sizeof(SERVERBROWSE_COUNT_LEGACY));
+	InitPackets();
 
 	IKernel *pKernel = IKernel::Create();
 	IStorage *pStorage = CreateStorage("Teeworlds", IStorage::STORAGETYPE_BASIC, argc, argv);
@@ -495,24 +587,15 @@ int main(int argc, const char **argv) // ignore_convention
 			if(Packet.m_DataSize == sizeof(SERVERBROWSE_FWRESPONSE) &&
 				mem_comp(Packet.m_pData, SERVERBROWSE_FWRESPONSE, sizeof(SERVERBROWSE_FWRESPONSE)) == 0)
 			{
-				Type = SERVERTYPE_INVALID;
-				// remove it from checking
-				for(int i = 0; i < m_NumCheckServers; i++)
-				{
-					if(net_addr_comp(&m_aCheckServers[i].m_Address, &Packet.m_Address) == 0 ||
-						net_addr_comp(&m_aCheckServers[i].m_AltAddress, &Packet.m_Address) == 0)
-					{
-						Type = m_aCheckServers[i].m_Type;
-						m_NumCheckServers--;
-						m_aCheckServers[i] = m_aCheckServers[m_NumCheckServers];
-						break;
-					}
-				}
-
 				// drops servers that were not in the CheckServers list
-				if(Type == SERVERTYPE_INVALID)
+				int Check = FindCheckServer(&Packet.m_Address);
+				if(Check < 0)
 					continue;
 
+				// remove it from checking
+				Type = m_aCheckServers[Check].m_Type;
+				RemoveCheckServer(Check);
+
 				AddServer(&Packet.m_Address, Type);
 				SendOk(&Packet.m_Address);
 			}
@@ -525,13 +608,14 @@ int main(int argc, const char **argv) // ignore_convention
 			ReloadBans();
 		}
 
-		if(time_get() - LastBuild > time_freq() * 5)
+		// new servers are checked right away, retries wait a second
+		UpdateServers();
+
+		if(time_get() - LastPurge > time_freq() * 5)
 		{
-			LastBuild = time_get();
+			LastPurge = time_get();
 
 			PurgeServers();
-			UpdateServers();
-			BuildPackets();
 		}
 
 		// be nice to the CPU
@@ -0,0 +1,136 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/censor.h>
+
+#include <cstring>
+
+static std::string Censor(const CCensor &Censor, const char *pMessage)
+{
+	char aBuf[256];
+	str_copy(aBuf, pMessage, sizeof(aBuf));
+	Censor.Censor(aBuf);
+	return aBuf;
+}
+
+TEST(Censor, Empty)
+{
+	CCensor Empty;
+	EXPECT_EQ(Censor(Empty, "abc"), "abc");
+	Empty.Init({"", ""});
+	EXPECT_EQ(Empty.NumWords(), 0);
+	EXPECT_EQ(Censor(Empty, "abc"), "abc");
+}
+
+TEST(Censor, Words)
+{
+	CCensor Words;
+	Words.Init({"bad", "worse", "he"});
+	EXPECT_EQ(Words.NumWords(), 3);
+	EXPECT_EQ(Censor(Words, ""), "");
+	EXPECT_EQ(Censor(Words, "good"), "good");
+	EXPECT_EQ(Censor(Words, "bad"), "***");
+	EXPECT_EQ(Censor(Words, "not bad, worse"), "not ***, *****");
+	EXPECT_EQ(Censor(Words, "BaD badbad"), "*** ******");
+	EXPECT_EQ(Censor(Words, "the shell"), "t** s**ll");
+	EXPECT_EQ(Censor(Words, "ba d"), "ba d");
+}
+
+TEST(Censor, Overlapping)
+{
+	CCensor Words;
+	Words.Init({"abc", "bcd", "c", "xyzw", "yz"});
+	EXPECT_EQ(Censor(Words, "abcd"), "****");
+	EXPECT_EQ(Censor(Words, "_bc_"), "_b*_");
+	EXPECT_EQ(Censor(Words, "xyzv"), "x**v");
+	EXPECT_EQ(Censor(Words, "xyzwxyz"), "****x**");
+}
+
+TEST(Censor, Unicode)
+{
+	CCensor Words;
+	Words.Init({"äöü", "ÆØ"});
+	EXPECT_EQ(Censor(Words, "ÄÖÜ!"), "******!");
+	EXPECT_EQ(Censor(Words, "xæøx"), "x****x");
+	EXPECT_EQ(Censor(Words, "äöx"), "äöx");
+	// invalid utf-8 doesn't match anything
+	EXPECT_EQ(Censor(Words, "\xff\xc3\xa4\xc3\xb6\xc3\xbc"), "\xff******");
+}
+
+// word by word like before, but searching the original message so that
+// censoring one word can't hide another
+static void CensorNaive(const std::vector<std::string> &vWords, const char *pMessage, char *pCensored)
+{
+	for(const std::string &Word : vWords)
+	{
+		const char *pCurLoc = pMessage;
+		while((pCurLoc = str_find_nocase(pCurLoc, Word.c_str())))
+		{
+			memset(pCensored + (pCurLoc - pMessage), '*', Word.size());
+			pCurLoc++;
+		}
+	}
+}
+
+TEST(Censor, DISABLED_Benchmark)
+{
+	static const int NUM_WORDS = 10000;
+	static const int NUM_MESSAGES = 1000;
+	unsigned Seed = 1;
+	auto Random = [&Seed](int Max) {
+		Seed = Seed * 1103515245 + 12345;
+		return (int)((Seed >> 16) % Max);
+	};
+	std::vector<std::string> vWords;
+	for(int i = 0; i < NUM_WORDS; i++)
+	{
+		std::string Word;
+		int Length = 4 + Random(7);
+		for(int j = 0; j < Length; j++)
+			Word += 'a' + Random(26);
+		vWords.push_back(Word);
+	}
+	std::vector<std::string> vMessages;
+	for(int i = 0; i < NUM_MESSAGES; i++)
+	{
+		std::string Message;
+		while(Message.size() < 100)
+		{
+			if(Random(10) == 0)
+				Message += vWords[Random(NUM_WORDS)];
+			else
+				Message += 'a' + Random(26);
+			Message += ' ';
+		}
+		vMessages.push_back(Message);
+	}
+
+	int64 Start = time_get();
+	CCensor Words;
+	Words.Init(vWords);
+	int64 Built = time_get();
+	for(const std::string &Message : vMessages)
+	{
+		char aBuf[256];
+		str_copy(aBuf, Message.c_str(), sizeof(aBuf));
+		Words.Censor(aBuf);
+	}
+	int64 Done = time_get();
+	int64 NaiveTime = time_get();
+	for(const std::string &Message : vMessages)
+	{
+		char aBuf[256];
+		char aExpected[256];
+		str_copy(aBuf, Message.c_str(), sizeof(aBuf));
+		str_copy(aExpected, Message.c_str(), sizeof(aExpected));
+		Words.Censor(aBuf);
+		CensorNaive(vWords, Message.c_str(), aExpected);
+		EXPECT_STREQ(aBuf, aExpected);
+	}
+	NaiveTime = time_get() - NaiveTime - (Done - Built);
+
+	RecordBenchmark("%d words built in %.2fms, %d messages in %.2fms, word by word %.2fms",
+		NUM_WORDS, (Built - Start) * 1000.0 / time_freq(), NUM_MESSAGES, (Done - Built) * 1000.0 / time_freq(),
+		NaiveTime * 1000.0 / time_freq());
+}
@@ -0,0 +1,302 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <base/tl/threading.h>
+#include <engine/server/databases/connection_pool.h>
+#include <engine/server/databases/sqlite.h>
+
+#include <atomic>
+
+struct CTestSqlData : ISqlData
+{
+	CTestSqlData(std::atomic<int> *pDone, std::atomic<int> *pBackupWrites, std::atomic<int> *pCommits, int Value, semaphore *pBlock) :
+		m_pDone(pDone), m_pBackupWrites(pBackupWrites), m_pCommits(pCommits), m_Value(Value), m_pBlock(pBlock) {}
+
+	virtual void OnCommit() const { (*m_pCommits)++; }
+
+	std::atomic<int> *m_pDone;
+	std::atomic<int> *m_pBackupWrites;
+	std::atomic<int> *m_pCommits;
+	int m_Value;
+	semaphore *m_pBlock;
+};
+
+static bool InsertValue(IDbConnection *pSqlServer, const ISqlData *pGameData, bool Failure)
+{
+	const CTestSqlData *pData = dynamic_cast<const CTestSqlData *>(pGameData);
+	// negative values fail unless written to the backup
+	if(pData->m_Value < 0 && !Failure)
+		return false;
+	pSqlServer->PrepareStatement("INSERT INTO test(value) VALUES (?);");
+	pSqlServer->BindInt(1, pData->m_Value);
+	pSqlServer->Step();
+	if(Failure)
+		(*pData->m_pBackupWrites)++;
+	(*pData->m_pDone)++;
+	return true;
+}
+
+static bool CountValues(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CTestSqlData *pData = dynamic_cast<const CTestSqlData *>(pGameData);
+	if(pData->m_pBlock)
+		pData->m_pBlock->wait();
+	pSqlServer->PrepareStatement("SELECT COUNT(*) FROM test;");
+	pSqlServer->Step();
+	(*pData->m_pDone)++;
+	return true;
+}
+
+static bool CountCacheHits(IDbConnection *pSqlServer, const ISqlData *pGameData)
+{
+	const CTestSqlData *pData = dynamic_cast<const CTestSqlData *>(pGameData);
+	for(int i = 0; i < 2; i++)
+	{
+		pSqlServer->PrepareStatement("SELECT COUNT(*) FROM test;");
+		pSqlServer->Step();
+	}
+	CStatementCacheStats Stats;
+	pSqlServer->GetStatementCacheStats(&Stats);
+	*pData->m_pDone += Stats.m_Hits;
+	return true;
+}
+
+class ConnectionPool : public ::testing::Test
+{
+protected:
+	CTestInfo m_Info;
+	CDbConnectionPool m_Pool;
+	std::atomic<int> m_Done;
+	std::atomic<int> m_BackupWrites;
+	std::atomic<int> m_Commits;
+
+	ConnectionPool() :
+		m_Done(0),
+		m_BackupWrites(0),
+		m_Commits(0)
+	{
+		CSqliteConnection Connection(m_Info.m_aFilename, false);
+		EXPECT_EQ(Connection.Connect(), IDbConnection::SUCCESS);
+		Connection.PrepareStatement("CREATE TABLE IF NOT EXISTS test(value INTEGER);");
+		Connection.Step();
+		Connection.Disconnect();
+	}
+
+	~ConnectionPool()
+	{
+		m_Pool.OnShutdown();
+		fs_remove(m_Info.m_aFilename);
+	}
+
+	void Register(CDbConnectionPool::Mode Mode)
+	{
+		m_Pool.RegisterDatabase(std::unique_ptr<IDbConnection>(new CSqliteConnection(m_Info.m_aFilename, false)), Mode);
+	}
+
+	bool Write(int Value, bool Batch = false)
+	{
+		return m_Pool.ExecuteWrite(InsertValue, std::unique_ptr<const ISqlData>(new CTestSqlData(&m_Done, &m_BackupWrites, &m_Commits, Value, 0)), "test write", Batch);
+	}
+
+	int NumRows()
+	{
+		CSqliteConnection Connection(m_Info.m_aFilename, false);
+		EXPECT_EQ(Connection.Connect(), IDbConnection::SUCCESS);
+		Connection.PrepareStatement("SELECT COUNT(*) FROM test;");
+		Connection.Step();
+		int Num = Connection.GetInt(1);
+		Connection.Disconnect();
+		return Num;
+	}
+
+	// waits until `Num` tasks of the mode are finished
+	bool WaitForFinished(CDbConnectionPool::Mode Mode, int Num, CDbConnectionPool::CStats *pStats)
+	{
+		for(int i = 0; i < 10000; i++)
+		{
+			m_Pool.GetStats(Mode, pStats);
+			if(pStats->m_Done + pStats->m_Failed >= Num)
+				return true;
+			thread_sleep(1000);
+		}
+		return false;
+	}
+
+	bool Read(semaphore *pBlock = 0)
+	{
+		return m_Pool.Execute(CountValues, std::unique_ptr<const ISqlData>(new CTestSqlData(&m_Done, &m_BackupWrites, &m_Commits, 0, pBlock)), "test read");
+	}
+
+	bool WaitForDone(int Num)
+	{
+		for(int i = 0; i < 10000 && m_Done.load() < Num; i++)
+			thread_sleep(1000);
+		return m_Done.load() >= Num;
+	}
+};
+
+TEST_F(ConnectionPool, ReadsAndWrites)
+{
+	Register(CDbConnectionPool::READ);
+	Register(CDbConnectionPool::WRITE);
+	m_Pool.Start(2, 1, 64);
+
+	for(int i = 0; i < 20; i++)
+		EXPECT_TRUE(Write(i));
+	ASSERT_TRUE(WaitForDone(20));
+	for(int i = 0; i < 10; i++)
+		EXPECT_TRUE(Read());
+	ASSERT_TRUE(WaitForDone(30));
+
+	CDbConnectionPool::CStats Stats;
+	m_Pool.GetStats(CDbConnectionPool::WRITE, &Stats);
+	EXPECT_EQ(Stats.m_NumWorkers, 1);
+	EXPECT_EQ(Stats.m_Done, 20);
+	EXPECT_EQ(Stats.m_Failed, 0);
+	EXPECT_EQ(Stats.m_Overflows, 0);
+	int64 Latencies = 0;
+	for(int i = 0; i < CDbConnectionPool::NUM_LATENCY_BUCKETS; i++)
+		Latencies += Stats.m_aLatency[i];
+	EXPECT_EQ(Latencies, 20);
+
+	m_Pool.GetStats(CDbConnectionPool::READ, &Stats);
+	EXPECT_EQ(Stats.m_NumWorkers, 2);
+	EXPECT_EQ(Stats.m_Done, 10);
+}
+
+TEST_F(ConnectionPool, QueuedBeforeStart)
+{
+	Register(CDbConnectionPool::WRITE);
+	EXPECT_TRUE(Write(1));
+	EXPECT_TRUE(Write(2));
+	m_Pool.Start(1, 1, 64);
+	EXPECT_TRUE(WaitForDone(2));
+}
+
+TEST_F(ConnectionPool, SlowReadDoesNotBlockWrites)
+{
+	Register(CDbConnectionPool::READ);
+	Register(CDbConnectionPool::WRITE);
+	m_Pool.Start(1, 1, 64);
+
+	semaphore Block;
+	EXPECT_TRUE(Read(&Block));
+	EXPECT_TRUE(Write(1));
+	EXPECT_TRUE(WaitForDone(1));
+	Block.signal();
+	EXPECT_TRUE(WaitForDone(2));
+}
+
+TEST_F(ConnectionPool, ReadOverflow)
+{
+	Register(CDbConnectionPool::READ);
+	m_Pool.Start(1, 1, 2);
+
+	semaphore Block;
+	EXPECT_TRUE(Read(&Block));
+	// wait for the worker to pick up the blocking read
+	CDbConnectionPool::CStats Stats;
+	for(int i = 0; i < 10000; i++)
+	{
+		m_Pool.GetStats(CDbConnectionPool::READ, &Stats);
+		if(Stats.m_Queued == 0)
+			break;
+		thread_sleep(1000);
+	}
+	EXPECT_TRUE(Read());
+	EXPECT_TRUE(Read());
+	EXPECT_FALSE(Read());
+
+	m_Pool.GetStats(CDbConnectionPool::READ, &Stats);
+	EXPECT_EQ(Stats.m_Queued, 2);
+	EXPECT_EQ(Stats.m_MaxQueued, 2);
+	EXPECT_EQ(Stats.m_Overflows, 1);
+
+	Block.signal();
+	EXPECT_TRUE(WaitForDone(3));
+}
+
+TEST_F(ConnectionPool, WriteBackup)
+{
+	// can't be opened, the directory doesn't exist
+	char aBroken[128];
+	str_format(aBroken, sizeof(aBroken), "%s.missing/test.sqlite", m_Info.m_aFilename);
+	m_Pool.RegisterDatabase(std::unique_ptr<IDbConnection>(new CSqliteConnection(aBroken, false)), CDbConnectionPool::WRITE);
+	Register(CDbConnectionPool::WRITE_BACKUP);
+	m_Pool.Start(1, 1, 64);
+
+	EXPECT_TRUE(Write(1));
+	EXPECT_TRUE(WaitForDone(1));
+	EXPECT_EQ(m_BackupWrites.load(), 1);
+
+	CDbConnectionPool::CStats Stats;
+	for(int i = 0; i < 10000; i++)
+	{
+		m_Pool.GetStats(CDbConnectionPool::WRITE_BACKUP, &Stats);
+		if(Stats.m_Done == 1)
+			break;
+		thread_sleep(1000);
+	}
+	EXPECT_EQ(Stats.m_Done, 1);
+	m_Pool.GetStats(CDbConnectionPool::WRITE, &Stats);
+	EXPECT_EQ(Stats.m_Failed, 1);
+}
+
+TEST_F(ConnectionPool, WriteBatch)
+{
+	Register(CDbConnectionPool::WRITE);
+	m_Pool.Start(1, 1, 64, 100);
+
+	for(int i = 0; i < 20; i++)
+		EXPECT_TRUE(Write(i, true));
+	CDbConnectionPool::CStats Stats;
+	ASSERT_TRUE(WaitForFinished(CDbConnectionPool::WRITE, 20, &Stats));
+	EXPECT_EQ(Stats.m_Done, 20);
+	EXPECT_EQ(Stats.m_BatchedWrites, 20);
+	EXPECT_GE(Stats.m_Batches, 1);
+	EXPECT_LT(Stats.m_Batches, 20);
+	int64 Commits = 0;
+	for(int i = 0; i < CDbConnectionPool::NUM_LATENCY_BUCKETS; i++)
+		Commits += Stats.m_aCommitLatency[i];
+	EXPECT_EQ(Commits, Stats.m_Batches);
+	EXPECT_EQ(NumRows(), 20);
+	EXPECT_EQ(m_Commits.load(), 20);
+}
+
+TEST_F(ConnectionPool, WriteBatchFailure)
+{
+	Register(CDbConnectionPool::WRITE);
+	Register(CDbConnectionPool::WRITE_BACKUP);
+	m_Pool.Start(1, 1, 64, 100);
+
+	EXPECT_TRUE(Write(1, true));
+	EXPECT_TRUE(Write(-1, true));
+	EXPECT_TRUE(Write(2, true));
+	CDbConnectionPool::CStats Stats;
+	ASSERT_TRUE(WaitForFinished(CDbConnectionPool::WRITE_BACKUP, 1, &Stats));
+	EXPECT_EQ(Stats.m_Done, 1);
+	EXPECT_EQ(m_BackupWrites.load(), 1);
+
+	// the batch was rolled back and retried one by one
+	ASSERT_TRUE(WaitForFinished(CDbConnectionPool::WRITE, 3, &Stats));
+	EXPECT_EQ(Stats.m_Done, 2);
+	EXPECT_EQ(Stats.m_Failed, 1);
+	EXPECT_EQ(Stats.m_Batches, 0);
+	EXPECT_EQ(NumRows(), 3);
+	// the first write ran twice but is only committed once
+	EXPECT_EQ(m_Done.load(), 4);
+	EXPECT_EQ(m_Commits.load(), 3);
+}
+
+TEST_F(ConnectionPool, StatementCacheSize)
+{
+	Register(CDbConnectionPool::READ);
+	Register(CDbConnectionPool::WRITE);
+	m_Pool.Start(1, 1, 64, 0, 0);
+
+	EXPECT_TRUE(m_Pool.Execute(CountCacheHits, std::unique_ptr<const ISqlData>(new CTestSqlData(&m_Done, &m_BackupWrites, &m_Commits, 0, 0)), "test read"));
+	CDbConnectionPool::CStats Stats;
+	ASSERT_TRUE(WaitForFinished(CDbConnectionPool::READ, 1, &Stats));
+	EXPECT_EQ(m_Done.load(), 0);
+}
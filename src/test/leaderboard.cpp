@@ -0,0 +1,136 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/leaderboard.h>
+
+static CLeaderboard::CEntry Entry(const char *pName, float Score)
+{
+	CLeaderboard::CEntry Result;
+	str_copy(Result.m_aName, pName, sizeof(Result.m_aName));
+	Result.m_Score = Score;
+	return Result;
+}
+
+TEST(Leaderboard, Rank)
+{
+	CLeaderboard Times(false);
+	EXPECT_FALSE(Times.Loaded());
+	Times.Set({Entry("c", 30.0f), Entry("a", 10.0f), Entry("b", 20.0f), Entry("d", 20.0f)});
+	EXPECT_TRUE(Times.Loaded());
+
+	int Rank;
+	float Score;
+	ASSERT_TRUE(Times.Rank("a", &Rank, &Score));
+	EXPECT_EQ(Rank, 1);
+	EXPECT_EQ(Score, 10.0f);
+	// equal times share a rank
+	ASSERT_TRUE(Times.Rank("b", &Rank, &Score));
+	EXPECT_EQ(Rank, 2);
+	ASSERT_TRUE(Times.Rank("d", &Rank, &Score));
+	EXPECT_EQ(Rank, 2);
+	ASSERT_TRUE(Times.Rank("c", &Rank, &Score));
+	EXPECT_EQ(Rank, 4);
+	EXPECT_FALSE(Times.Rank("e", &Rank, &Score));
+}
+
+TEST(Leaderboard, Update)
+{
+	CLeaderboard Times(false);
+	Times.Set({Entry("a", 10.0f), Entry("b", 20.0f)});
+
+	int Rank;
+	float Score;
+	// worse times are ignored
+	Times.Update("a", 15.0f);
+	ASSERT_TRUE(Times.Rank("a", &Rank, &Score));
+	EXPECT_EQ(Score, 10.0f);
+
+	Times.Update("b", 5.0f);
+	ASSERT_TRUE(Times.Rank("b", &Rank, &Score));
+	EXPECT_EQ(Rank, 1);
+	ASSERT_TRUE(Times.Rank("a", &Rank, &Score));
+	EXPECT_EQ(Rank, 2);
+
+	Times.Update("c", 7.0f);
+	EXPECT_EQ(Times.Size(), 3);
+	ASSERT_TRUE(Times.Rank("a", &Rank, &Score));
+	EXPECT_EQ(Rank, 3);
+}
+
+TEST(Leaderboard, Points)
+{
+	CLeaderboard Points(true);
+	Points.Set({Entry("a", 10), Entry("b", 20)});
+	Points.Add("a", 15);
+	Points.Add("c", 1);
+
+	int aRanks[5];
+	CLeaderboard::CEntry aEntries[5];
+	ASSERT_EQ(Points.Top(1, 5, aRanks, aEntries), 3);
+	EXPECT_STREQ(aEntries[0].m_aName, "a");
+	EXPECT_EQ(aEntries[0].m_Score, 25);
+	EXPECT_STREQ(aEntries[1].m_aName, "b");
+	EXPECT_STREQ(aEntries[2].m_aName, "c");
+	EXPECT_EQ(aRanks[2], 3);
+}
+
+TEST(Leaderboard, Top)
+{
+	CLeaderboard Times(false);
+	std::vector<CLeaderboard::CEntry> vEntries;
+	for(int i = 0; i < 12; i++)
+	{
+		char aName[16];
+		str_format(aName, sizeof(aName), "p%d", i);
+		vEntries.push_back(Entry(aName, 100.0f - i));
+	}
+	Times.Set(vEntries);
+
+	int aRanks[5];
+	CLeaderboard::CEntry aEntries[5];
+	ASSERT_EQ(Times.Top(1, 5, aRanks, aEntries), 5);
+	EXPECT_STREQ(aEntries[0].m_aName, "p11");
+	EXPECT_EQ(aRanks[4], 5);
+
+	ASSERT_EQ(Times.Top(10, 5, aRanks, aEntries), 3);
+	EXPECT_EQ(aRanks[0], 10);
+	EXPECT_EQ(aRanks[2], 12);
+
+	// negative offsets start at the last rank
+	ASSERT_EQ(Times.Top(-1, 5, aRanks, aEntries), 5);
+	EXPECT_STREQ(aEntries[0].m_aName, "p0");
+	EXPECT_EQ(aRanks[0], 12);
+	EXPECT_EQ(aRanks[4], 8);
+
+	EXPECT_EQ(Times.Top(13, 5, aRanks, aEntries), 0);
+}
+
+TEST(Leaderboard, DISABLED_Benchmark)
+{
+	static const int NUM_PLAYERS = 100000;
+	static const int NUM_QUERIES = 100000;
+	std::vector<CLeaderboard::CEntry> vEntries;
+	for(int i = 0; i < NUM_PLAYERS; i++)
+	{
+		char aName[16];
+		str_format(aName, sizeof(aName), "player%d", i);
+		vEntries.push_back(Entry(aName, 1000.0f + (i * 7919) % NUM_PLAYERS / 100.0f));
+	}
+	CLeaderboard Times(false);
+	int64 Start = time_get();
+	Times.Set(vEntries);
+	int64 Loaded = time_get();
+	int Found = 0;
+	for(int i = 0; i < NUM_QUERIES; i++)
+	{
+		int Rank;
+		float Score;
+		Found += Times.Rank(vEntries[(i * 31) % NUM_PLAYERS].m_aName, &Rank, &Score);
+	}
+	int64 Done = time_get();
+	EXPECT_EQ(Found, NUM_QUERIES);
+
+	RecordBenchmark("%d players loaded in %.2fms, %d rank lookups in %.2fms",
+		NUM_PLAYERS, (Loaded - Start) * 1000.0 / time_freq(), NUM_QUERIES, (Done - Loaded) * 1000.0 / time_freq());
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/mpsc_queue.h>
+
+#include <memory>
+
+TEST(MpscQueue, Order)
+{
+	CMpscQueue<int> Queue;
+	std::vector<int> vValues;
+	EXPECT_TRUE(Queue.Empty());
+	Queue.PopAll(&vValues);
+	EXPECT_TRUE(vValues.empty());
+
+	Queue.Push(1);
+	Queue.Push(2);
+	Queue.Push(3);
+	EXPECT_FALSE(Queue.Empty());
+	Queue.PopAll(&vValues);
+	EXPECT_EQ(vValues, std::vector<int>({1, 2, 3}));
+	EXPECT_TRUE(Queue.Empty());
+
+	Queue.Push(4);
+	Queue.PopAll(&vValues);
+	EXPECT_EQ(vValues, std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(MpscQueue, Destroy)
+{
+	auto pValue = std::make_shared<int>(1);
+	{
+		CMpscQueue<std::shared_ptr<int>> Queue;
+		Queue.Push(pValue);
+		Queue.Push(pValue);
+		EXPECT_EQ(pValue.use_count(), 3);
+	}
+	EXPECT_EQ(pValue.use_count(), 1);
+}
+
+struct CProducer
+{
+	CMpscQueue<int> *m_pQueue;
+	int m_ID;
+};
+
+static const int NUM_PRODUCERS = 4;
+static const int NUM_PUSHES = 10000;
+
+static void ProducerThread(void *pUser)
+{
+	CProducer *pProducer = (CProducer *)pUser;
+	for(int i = 0; i < NUM_PUSHES; i++)
+		pProducer->m_pQueue->Push(pProducer->m_ID * NUM_PUSHES + i);
+}
+
+TEST(MpscQueue, Concurrent)
+{
+	CMpscQueue<int> Queue;
+	CProducer aProducers[NUM_PRODUCERS];
+	void *apThreads[NUM_PRODUCERS];
+	for(int i = 0; i < NUM_PRODUCERS; i++)
+	{
+		aProducers[i].m_pQueue = &Queue;
+		aProducers[i].m_ID = i;
+		apThreads[i] = thread_init(ProducerThread, &aProducers[i], "mpsc producer");
+	}
+
+	// pop while pushing, every producer's values have to stay in order
+	std::vector<int> vValues;
+	int aNext[NUM_PRODUCERS] = {0};
+	int Popped = 0;
+	while(Popped < NUM_PRODUCERS * NUM_PUSHES)
+	{
+		vValues.clear();
+		Queue.PopAll(&vValues);
+		for(int Value : vValues)
+		{
+			int ID = Value / NUM_PUSHES;
+			ASSERT_EQ(Value % NUM_PUSHES, aNext[ID]);
+			aNext[ID]++;
+		}
+		Popped += vValues.size();
+	}
+	for(int i = 0; i < NUM_PRODUCERS; i++)
+	{
+		thread_wait(apThreads[i]);
+		EXPECT_EQ(aNext[i], NUM_PUSHES);
+	}
+	EXPECT_TRUE(Queue.Empty());
+}
@@ -1,7 +1,11 @@
+#include "test.h"
 #include <gtest/gtest.h>
 
 #include <engine/server/name_ban.h>
 
+#include <algorithm>
+#include <vector>
+
 TEST(NameBan, Empty)
 {
 	EXPECT_FALSE(IsNameBanned("", 0, 0));
@@ -27,3 +31,148 @@ TEST(NameBan, Substring)
 	EXPECT_TRUE(IsNameBanned("abcxyzdef", &Xyz, 1));
 	EXPECT_FALSE(IsNameBanned("abcdef", &Xyz, 1));
 }
+
+TEST(NameBan, Index)
+{
+	CNameBans Bans;
+	EXPECT_FALSE(Bans.IsBanned("abc"));
+	Bans.Ban("abc", 0, 0, "");
+	Bans.Ban("xyz", 0, 1, "substring");
+	EXPECT_TRUE(Bans.IsBanned("   äbc"));
+	EXPECT_FALSE(Bans.IsBanned("abcdef"));
+	ASSERT_TRUE(Bans.IsBanned("abcXYZ"));
+	EXPECT_STREQ(Bans.IsBanned("abcXYZ")->m_aReason, "substring");
+	// substrings fold non-ASCII letters like str_utf8_find_nocase
+	Bans.Ban("grün", 0, 1, "");
+	CNameBan Gruen("grün", 0, 1);
+	EXPECT_TRUE(Bans.IsBanned("GRÜNER"));
+	EXPECT_TRUE(IsNameBanned("GRÜNER", &Gruen, 1));
+	EXPECT_TRUE(Bans.Unban("grün"));
+
+	// changing a ban takes effect immediately
+	Bans.Ban("abc", 3, 0, "changed");
+	ASSERT_TRUE(Bans.IsBanned("abcdef"));
+	EXPECT_STREQ(Bans.IsBanned("abcdef")->m_aReason, "changed");
+	Bans.Ban("xyz", 0, 0, "");
+	EXPECT_FALSE(Bans.IsBanned("0123xyz"));
+
+	EXPECT_TRUE(Bans.Unban("abc"));
+	EXPECT_FALSE(Bans.Unban("abc"));
+	EXPECT_FALSE(Bans.IsBanned("abcdef"));
+	EXPECT_EQ(Bans.NumBans(), 1);
+	EXPECT_FALSE(Bans.Find("abc"));
+	EXPECT_TRUE(Bans.Find("xyz"));
+}
+
+static void RandomName(char *pName, int Size, unsigned *pSeed)
+{
+	// few distinct characters, so that names are close to each other
+	static const char *s_apChars[] = {"a", "b", "c", "l", "I", "rn", "m", "ä", " "};
+	int Length = 1 + (*pSeed = *pSeed * 1103515245 + 12345) / 65536 % 8;
+	pName[0] = 0;
+	for(int i = 0; i < Length; i++)
+	{
+		*pSeed = *pSeed * 1103515245 + 12345;
+		str_append(pName, s_apChars[*pSeed / 65536 % (sizeof(s_apChars) / sizeof(s_apChars[0]))], Size);
+	}
+}
+
+// same results as the linear scan while bans are added, changed and
+// removed in random order
+TEST(NameBan, IndexRandom)
+{
+	unsigned Seed = 1;
+	CNameBans Bans;
+	std::vector<CNameBan> vBans;
+	for(int i = 0; i < 2000; i++)
+	{
+		char aName[MAX_NAME_LENGTH];
+		RandomName(aName, sizeof(aName), &Seed);
+		Seed = Seed * 1103515245 + 12345;
+		int Op = Seed / 65536 % 4;
+		int Distance = (int)(Seed / 65536 / 4 % 4) - 1;
+		int IsSubstring = Seed / 65536 / 16 % 16 == 0;
+		auto It = std::find_if(vBans.begin(), vBans.end(), [&](const CNameBan &Ban) { return str_comp(Ban.m_aName, aName) == 0; });
+		if(Op == 0)
+		{
+			EXPECT_EQ(Bans.Unban(aName), It != vBans.end());
+			if(It != vBans.end())
+				vBans.erase(It);
+		}
+		else if(Op == 1)
+		{
+			Bans.Ban(aName, Distance, IsSubstring, "");
+			if(It != vBans.end())
+			{
+				It->m_Distance = Distance;
+				It->m_IsSubstring = IsSubstring;
+			}
+			else
+				vBans.emplace_back(aName, Distance, IsSubstring);
+		}
+		else
+		{
+			const CNameBan *pExpected = vBans.empty() ? 0 : IsNameBanned(aName, vBans.data(), vBans.size());
+			const CNameBan *pResult = Bans.IsBanned(aName);
+			ASSERT_EQ(pResult == 0, pExpected == 0) << aName;
+			if(pResult)
+			{
+				EXPECT_STREQ(pResult->m_aName, pExpected->m_aName) << aName;
+			}
+		}
+	}
+	EXPECT_EQ(Bans.NumBans(), (int)vBans.size());
+}
+
+// every other name is a ban with a changed character
+static void CheckedName(char *pName, int Size, const std::vector<CNameBan> &vBans, int i)
+{
+	if(i % 2)
+	{
+		str_format(pName, Size, "player%d", i);
+		return;
+	}
+	str_copy(pName, vBans[i * 7 % vBans.size()].m_aName, Size);
+	pName[i % 3] = 'x';
+}
+
+TEST(NameBan, DISABLED_Benchmark)
+{
+	static const int NUM_BANS = 5000;
+	static const int NUM_CHECKS = 2000;
+	unsigned Seed = 1;
+	CNameBans Bans;
+	std::vector<CNameBan> vBans;
+	for(int i = 0; i < NUM_BANS; i++)
+	{
+		char aName[MAX_NAME_LENGTH];
+		int Length = 5 + (Seed = Seed * 1103515245 + 12345) / 65536 % 11;
+		for(int c = 0; c < Length; c++)
+			aName[c] = 'a' + (Seed = Seed * 1103515245 + 12345) / 65536 % 26;
+		aName[Length] = 0;
+		Bans.Ban(aName, str_length(aName) / 3, i % 10 == 0, "");
+		vBans.emplace_back(aName, str_length(aName) / 3, i % 10 == 0);
+	}
+
+	int aFound[2] = {0, 0};
+	int64 Start = time_get();
+	for(int i = 0; i < NUM_CHECKS; i++)
+	{
+		char aName[MAX_NAME_LENGTH];
+		CheckedName(aName, sizeof(aName), vBans, i);
+		aFound[0] += IsNameBanned(aName, vBans.data(), vBans.size()) != 0;
+	}
+	int64 Linear = time_get();
+	for(int i = 0; i < NUM_CHECKS; i++)
+	{
+		char aName[MAX_NAME_LENGTH];
+		CheckedName(aName, sizeof(aName), vBans, i);
+		aFound[1] += Bans.IsBanned(aName) != 0;
+	}
+	int64 Done = time_get();
+	EXPECT_EQ(aFound[0], aFound[1]);
+	EXPECT_GT(aFound[0], 0);
+
+	RecordBenchmark("%d bans, %d checks: %.2fms linear, %.2fms indexed",
+		NUM_BANS, NUM_CHECKS, (Linear - Start) * 1000.0 / time_freq(), (Done - Linear) * 1000.0 / time_freq());
+}
@@ -0,0 +1,151 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/client/prediction/entities/character.h>
+#include <game/client/prediction/entities/laser.h>
+#include <game/client/prediction/entities/pickup.h>
+#include <game/client/prediction/entities/projectile.h>
+#include <game/client/prediction/gameworld.h>
+#include <game/collision.h>
+
+static void FillWorld(CGameWorld *pWorld, CCollision *pCollision, int NumChars, int NumProjectiles)
+{
+	pWorld->m_pCollision = pCollision;
+	pWorld->m_GameTickSpeed = SERVER_TICK_SPEED;
+	mem_zero(&pWorld->m_WorldConfig, sizeof(pWorld->m_WorldConfig));
+	pWorld->m_WorldConfig.m_PredictWeapons = true;
+	pWorld->m_pTuningList = pWorld->m_Tuning;
+
+	pWorld->NetObjBegin();
+	for(int i = 0; i < NumChars; i++)
+	{
+		CNetObj_Character Char;
+		mem_zero(&Char, sizeof(Char));
+		Char.m_X = i * 64;
+		Char.m_Y = 100;
+		pWorld->NetCharAdd(i, &Char, 0, 0, i == 0);
+	}
+	for(int i = 0; i < NumProjectiles; i++)
+	{
+		CNetObj_Projectile Proj;
+		mem_zero(&Proj, sizeof(Proj));
+		Proj.m_X = i * 16;
+		Proj.m_Y = 200;
+		Proj.m_VelX = 100;
+		Proj.m_Type = WEAPON_GRENADE;
+		pWorld->NetObjAdd(i, NETOBJTYPE_PROJECTILE, &Proj);
+
+		CNetObj_Pickup Pickup;
+		mem_zero(&Pickup, sizeof(Pickup));
+		Pickup.m_X = i * 32;
+		Pickup.m_Y = 300;
+		pWorld->NetObjAdd(i, NETOBJTYPE_PICKUP, &Pickup);
+
+		CNetObj_Laser Laser;
+		mem_zero(&Laser, sizeof(Laser));
+		Laser.m_X = i * 16 + 100;
+		Laser.m_Y = 400;
+		Laser.m_FromX = i * 16;
+		Laser.m_FromY = 400;
+		pWorld->InsertEntity(new CLaser(pWorld, i, &Laser));
+	}
+	pWorld->NetObjEnd(0);
+}
+
+static int Count(CGameWorld *pWorld, int Type)
+{
+	int Num = 0;
+	for(CEntity *pEnt = pWorld->FindFirst(Type); pEnt; pEnt = pEnt->TypeNext())
+		Num++;
+	return Num;
+}
+
+static void ExpectCopy(CGameWorld *pCopy, CGameWorld *pFrom)
+{
+	EXPECT_TRUE(pCopy->m_IsValidCopy);
+	for(int Type = 0; Type < CGameWorld::NUM_ENTTYPES; Type++)
+	{
+		EXPECT_EQ(Count(pCopy, Type), Count(pFrom, Type));
+		CEntity *pEnt = pCopy->FindFirst(Type);
+		for(CEntity *pOrig = pFrom->FindFirst(Type); pOrig && pEnt; pOrig = pOrig->TypeNext(), pEnt = pEnt->TypeNext())
+		{
+			EXPECT_NE(pEnt, pOrig);
+			EXPECT_EQ(pEnt->m_pParent, pOrig);
+			EXPECT_EQ(pEnt->GameWorld(), pCopy);
+			EXPECT_EQ(pEnt->ID(), pOrig->ID());
+			EXPECT_EQ(pEnt->m_Pos, pOrig->m_Pos);
+		}
+	}
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		CCharacter *pChar = pCopy->GetCharacterByID(i);
+		EXPECT_EQ(pChar != 0, pFrom->GetCharacterByID(i) != 0);
+		if(pChar)
+		{
+			EXPECT_EQ(pChar->GameWorld(), pCopy);
+			EXPECT_EQ(pCopy->m_Core.m_apCharacters[i], pChar->Core());
+		}
+	}
+}
+
+TEST(Prediction, CopyWorld)
+{
+	CCollision Collision;
+	CGameWorld Small, Large, Copy;
+	FillWorld(&Small, &Collision, 4, 3);
+	FillWorld(&Large, &Collision, 16, 20);
+
+	// the copy grows, shrinks and grows again
+	Copy.CopyWorld(&Small);
+	ExpectCopy(&Copy, &Small);
+	Copy.CopyWorld(&Large);
+	ExpectCopy(&Copy, &Large);
+	Copy.CopyWorld(&Small);
+	ExpectCopy(&Copy, &Small);
+	Copy.CopyWorld(&Large);
+	ExpectCopy(&Copy, &Large);
+
+	// removing a copied entity marks its parent as destroyed
+	Copy.m_GameTick = 123;
+	CEntity *pProj = Copy.FindFirst(CGameWorld::ENTTYPE_PROJECTILE);
+	CEntity *pParent = pProj->m_pParent;
+	Copy.RemoveEntity(pProj);
+	pProj->Destroy();
+	EXPECT_EQ(pParent->m_DestroyTick, 123);
+
+	// a copy of a copy points to the entities of the first copy
+	CGameWorld Copy2;
+	Copy.CopyWorld(&Large);
+	Copy2.CopyWorld(&Copy);
+	ExpectCopy(&Copy2, &Copy);
+
+	// a copy can't be continued once an entity of the original is gone
+	CEntity *pPickup = Large.FindFirst(CGameWorld::ENTTYPE_PICKUP);
+	Large.RemoveEntity(pPickup);
+	pPickup->Destroy();
+	EXPECT_FALSE(Copy.m_IsValidCopy);
+	EXPECT_TRUE(Copy2.m_IsValidCopy);
+	Copy.CopyWorld(&Large);
+	ExpectCopy(&Copy, &Large);
+}
+
+TEST(Prediction, DISABLED_Benchmark)
+{
+	static const int NUM_COPIES = 20000;
+	CCollision Collision;
+	CGameWorld World, Predicted, PrevPredicted;
+	FillWorld(&World, &Collision, MAX_CLIENTS, 50);
+
+	int64 Start = time_get();
+	for(int i = 0; i < NUM_COPIES; i++)
+	{
+		Predicted.CopyWorld(&World);
+		PrevPredicted.CopyWorld(&Predicted);
+	}
+	int64 Time = time_get() - Start;
+	ExpectCopy(&PrevPredicted, &Predicted);
+
+	RecordBenchmark("%d world copies with %d characters and 150 other entities in %.2fms, %.2fus per copy",
+		2 * NUM_COPIES, MAX_CLIENTS, Time * 1000.0 / time_freq(), Time * 1000000.0 / time_freq() / (2 * NUM_COPIES));
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/prng.h>
+#include <game/server/randommaps.h>
+
+class RandomMaps : public ::testing::Test
+{
+protected:
+	CRandomMaps m_Maps;
+	CPrng m_Prng;
+
+	RandomMaps()
+	{
+		uint64 aSeed[2] = {1, 2};
+		m_Prng.Seed(aSeed);
+
+		std::vector<CRandomMaps::CMap> vMaps;
+		for(int i = 0; i < 20; i++)
+		{
+			CRandomMaps::CMap Map;
+			str_format(Map.m_aName, sizeof(Map.m_aName), "map%d", i);
+			Map.m_Stars = i % 4;
+			vMaps.push_back(Map);
+		}
+		m_Maps.Set(vMaps);
+	}
+};
+
+TEST_F(RandomMaps, Stars)
+{
+	EXPECT_TRUE(m_Maps.Loaded());
+	for(int i = 0; i < 100; i++)
+	{
+		const char *pMap = m_Maps.Pick(2, "", nullptr, &m_Prng);
+		ASSERT_TRUE(pMap);
+		EXPECT_EQ(str_toint(pMap + 3) % 4, 2);
+	}
+	EXPECT_FALSE(m_Maps.Pick(5, "", nullptr, &m_Prng));
+	EXPECT_TRUE(m_Maps.Pick(-1, "", nullptr, &m_Prng));
+}
+
+TEST_F(RandomMaps, Exclude)
+{
+	// one star maps are map1, map5, map9, map13 and map17
+	std::unordered_set<std::string> Finished = {"map1", "map9", "map13"};
+	for(int i = 0; i < 100; i++)
+	{
+		const char *pMap = m_Maps.Pick(1, "map5", &Finished, &m_Prng);
+		ASSERT_TRUE(pMap);
+		EXPECT_STREQ(pMap, "map17");
+	}
+	Finished.insert("map17");
+	EXPECT_FALSE(m_Maps.Pick(1, "map5", &Finished, &m_Prng));
+
+	for(int i = 0; i < 100; i++)
+		EXPECT_STRNE(m_Maps.Pick(-1, "map0", &Finished, &m_Prng), "map0");
+}
+
+TEST_F(RandomMaps, Empty)
+{
+	CRandomMaps Maps;
+	EXPECT_FALSE(Maps.Loaded());
+	EXPECT_FALSE(Maps.Pick(-1, "", nullptr, &m_Prng));
+	Maps.Set({});
+	EXPECT_FALSE(Maps.Pick(-1, "", nullptr, &m_Prng));
+}
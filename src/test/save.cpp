@@ -0,0 +1,127 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/save.h>
+
+#include <string>
+
+static std::string LegacyTee(const char *pName, int HookedPlayer)
+{
+	char aBuf[1024];
+	str_format(aBuf, sizeof(aBuf),
+		"%s\t1\t0\t0\t0\t0\t"
+		"0\t-1\t0\t1\t0\t-1\t0\t1\t0\t-1\t0\t0\t0\t-1\t0\t1\t0\t-1\t0\t0\t0\t-1\t0\t0\t"
+		"1\t-1\t"
+		"0\t0\t0\t0\t1234\t0\t0\t"
+		"1\t0\t1\t0\t0\t1\t6000\t"
+		"1040\t2064\t1041\t2060\t"
+		"0\t0\t"
+		"1040\t2064\t0.500000\t-3.250000\t"
+		"1\t0\t0\t2\t"
+		"1100\t2000\t0.600000\t-0.800000\t"
+		"0\t0\t12\t3\t"
+		"0\t1\t0\t"
+		"12.340000\t25.500000\t0.000000\t0.000000\t0.000000\t"
+		"0.000000\t0.000000\t0.000000\t0.000000\t0.000000\t"
+		"0.000000\t0.000000\t0.000000\t0.000000\t0.000000\t"
+		"0.000000\t0.000000\t0.000000\t0.000000\t0.000000\t"
+		"0.000000\t0.000000\t0.000000\t0.000000\t0.000000\t"
+		"0\t"
+		"0\t1\t0\t"
+		"b1c04d5e-7a8f-4e62-9c3a-0123456789ab\t"
+		"%d\t0\t"
+		"1\t0\t0\t1\t"
+		"0\t0\t0\t0\t0\t0",
+		pName, HookedPlayer);
+	return aBuf;
+}
+
+static std::string LegacyTeam()
+{
+	std::string Result = "2\t3\t2\t1\t0";
+	Result += "\n" + LegacyTee("player1", 1);
+	Result += "\n" + LegacyTee("player2", -1);
+	Result += "\n" + LegacyTee("player 3", 0);
+	Result += "\n1\t0\t0\n0\t150\t2";
+	return Result;
+}
+
+static int Load(CSaveTeam *pTeam, const std::string &Save)
+{
+	int Result = pTeam->FromString(Save.c_str());
+	// client ids are assigned by MatchPlayers when loading for real
+	for(int i = 0; Result == 0 && i < pTeam->GetMembersCount(); i++)
+		pTeam->m_pSavedTees[i].SetClientID(i);
+	return Result;
+}
+
+TEST(Save, RoundTrip)
+{
+	CSaveTeam Legacy(nullptr);
+	ASSERT_EQ(Load(&Legacy, LegacyTeam()), 0);
+	ASSERT_EQ(Legacy.GetMembersCount(), 3);
+	std::string Text = Legacy.GetString(false);
+	std::string Compact = Legacy.GetString(true);
+	EXPECT_EQ(Compact[0], '#');
+	EXPECT_LT(Compact.size(), Text.size());
+	// saves are searched by player name in the database
+	EXPECT_NE(Compact.find("\nplayer 3\t"), std::string::npos);
+
+	CSaveTeam FromText(nullptr);
+	CSaveTeam FromCompact(nullptr);
+	ASSERT_EQ(Load(&FromText, Text), 0);
+	ASSERT_EQ(Load(&FromCompact, Compact), 0);
+	EXPECT_STREQ(FromText.m_pSavedTees[2].GetName(), "player 3");
+	EXPECT_STREQ(FromCompact.m_pSavedTees[2].GetName(), "player 3");
+	EXPECT_EQ(std::string(FromCompact.GetString(false)), std::string(FromText.GetString(false)));
+	EXPECT_EQ(std::string(FromCompact.GetString(true)), std::string(FromText.GetString(true)));
+}
+
+TEST(Save, Corrupted)
+{
+	CSaveTeam Team(nullptr);
+	ASSERT_EQ(Load(&Team, LegacyTeam()), 0);
+	std::string Compact = Team.GetString(true);
+
+	std::string Modified = Compact;
+	Modified[Modified.size() - 5] ^= 1;
+	EXPECT_NE(Load(&Team, Modified), 0);
+	EXPECT_NE(Load(&Team, Compact.substr(0, Compact.size() - 4)), 0);
+	EXPECT_NE(Load(&Team, Compact.substr(0, 8)), 0);
+	Modified = Compact;
+	Modified[1] = '9';
+	EXPECT_NE(Load(&Team, Modified), 0);
+	Modified[1] = '0';
+	EXPECT_NE(Load(&Team, Modified), 0);
+	EXPECT_EQ(Load(&Team, Compact), 0);
+
+	CSaveTeam Fresh(nullptr);
+	EXPECT_NE(Load(&Fresh, Compact.substr(0, 8)), 0);
+	EXPECT_EQ(Fresh.GetMembersCount(), 0);
+}
+
+TEST(Save, DISABLED_Benchmark)
+{
+	static const int NUM_ROUNDS = 2000;
+	CSaveTeam Team(nullptr);
+	ASSERT_EQ(Load(&Team, LegacyTeam()), 0);
+
+	int aSize[2];
+	int64 aTime[2];
+	for(int Compact = 0; Compact < 2; Compact++)
+	{
+		std::string Save = Team.GetString(Compact);
+		aSize[Compact] = Save.size();
+		CSaveTeam Loaded(nullptr);
+		int64 Start = time_get();
+		for(int i = 0; i < NUM_ROUNDS; i++)
+		{
+			ASSERT_EQ(Loaded.FromString(Save.c_str()), 0);
+			Loaded.GetString(Compact);
+		}
+		aTime[Compact] = time_get() - Start;
+	}
+	RecordBenchmark("%d saves and loads of 3 tees: text %d bytes in %.2fms, compact %d bytes in %.2fms",
+		NUM_ROUNDS, aSize[0], aTime[0] * 1000.0 / time_freq(), aSize[1], aTime[1] * 1000.0 / time_freq());
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <game/server/score.h>
+
+#include <memory>
+#include <vector>
+
+// the player's result slot as CScore::NewSqlPlayerResult and
+// CPlayer::OnScoreResult use it
+struct CResultSlot
+{
+	std::shared_ptr<CScorePlayerResultQueue> m_pQueue = std::make_shared<CScorePlayerResultQueue>();
+	std::shared_ptr<CScorePlayerResult> m_pResult;
+
+	CScorePlayerResult *New()
+	{
+		if(m_pResult != nullptr)
+			return nullptr;
+		m_pResult = std::make_shared<CScorePlayerResult>(0, m_pQueue);
+		return m_pResult.get();
+	}
+
+	void Tick()
+	{
+		std::vector<std::shared_ptr<CScorePlayerResult>> vpResults;
+		m_pQueue->PopAll(&vpResults);
+		for(const auto &pResult : vpResults)
+		{
+			EXPECT_TRUE(pResult->m_Done);
+			if(pResult == m_pResult)
+				m_pResult = nullptr;
+		}
+	}
+};
+
+TEST(Score, CachedCommandFreesSlot)
+{
+	CResultSlot Slot;
+	// /rank answered from the cached leaderboard
+	CScorePlayerResult *pRank = Slot.New();
+	ASSERT_NE(pRank, nullptr);
+	pRank->FinishLocally();
+	EXPECT_EQ(Slot.New(), nullptr);
+	Slot.Tick();
+
+	// the next command gets a result again
+	CScorePlayerResult *pTop5 = Slot.New();
+	ASSERT_NE(pTop5, nullptr);
+	pTop5->FinishLocally();
+	Slot.Tick();
+	EXPECT_NE(Slot.New(), nullptr);
+}
+
+TEST(Score, FinishAfterMapChange)
+{
+	CResultSlot Slot;
+	CScorePlayerResult *pResult = Slot.New();
+	ASSERT_NE(pResult, nullptr);
+	// the queue goes away with the old CScore
+	Slot.m_pQueue = nullptr;
+	pResult->FinishLocally();
+	EXPECT_TRUE(pResult->m_Done);
+}
@@ -0,0 +1,157 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/databases/sqlite.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+static const char *CREATE_TABLE = "CREATE TABLE IF NOT EXISTS test(Name VARCHAR(16), Time FLOAT);";
+static const char *INSERT = "INSERT INTO test(Name, Time) VALUES (?, ?);";
+static const char *SELECT_RANK =
+	"SELECT Rank, Time FROM ("
+	"  SELECT RANK() OVER w AS Rank, MIN(Time) AS Time, Name "
+	"  FROM test GROUP BY Name WINDOW w AS (ORDER BY MIN(Time))"
+	") AS a WHERE Name = ?;";
+
+static void Insert(CSqliteConnection *pConnection, int Player, float Time)
+{
+	char aName[16];
+	str_format(aName, sizeof(aName), "player%d", Player);
+	pConnection->PrepareStatement(INSERT);
+	pConnection->BindString(1, aName);
+	pConnection->BindFloat(2, Time);
+	pConnection->Step();
+}
+
+class Sqlite : public ::testing::Test
+{
+protected:
+	CTestInfo m_Info;
+
+	~Sqlite()
+	{
+		char aBuf[128];
+		fs_remove(m_Info.m_aFilename);
+		str_format(aBuf, sizeof(aBuf), "%s-wal", m_Info.m_aFilename);
+		fs_remove(aBuf);
+		str_format(aBuf, sizeof(aBuf), "%s-shm", m_Info.m_aFilename);
+		fs_remove(aBuf);
+	}
+
+	std::unique_ptr<CSqliteConnection> Writer(bool Wal)
+	{
+		auto pConnection = std::unique_ptr<CSqliteConnection>(new CSqliteConnection(m_Info.m_aFilename, false));
+		pConnection->SetJournal(Wal, -1, -1);
+		EXPECT_EQ(pConnection->Connect(), IDbConnection::SUCCESS);
+		pConnection->PrepareStatement(CREATE_TABLE);
+		pConnection->Step();
+		return pConnection;
+	}
+};
+
+TEST_F(Sqlite, WalReadOnly)
+{
+	auto pWriter = Writer(true);
+	Insert(pWriter.get(), 1, 10.0f);
+
+	std::unique_ptr<CSqliteConnection> pReader(pWriter->Copy());
+	pReader->SetReadOnly(true);
+	ASSERT_EQ(pReader->Connect(), IDbConnection::SUCCESS);
+
+	pReader->PrepareStatement("PRAGMA journal_mode;");
+	ASSERT_TRUE(pReader->Step());
+	char aMode[16];
+	pReader->GetString(1, aMode, sizeof(aMode));
+	EXPECT_STREQ(aMode, "wal");
+
+	// an open read doesn't block the writer
+	pReader->PrepareStatement("SELECT COUNT(*) FROM test;");
+	ASSERT_TRUE(pReader->Step());
+	EXPECT_EQ(pReader->GetInt(1), 1);
+	Insert(pWriter.get(), 2, 20.0f);
+	pReader->PrepareStatement("SELECT COUNT(*) FROM test;");
+	ASSERT_TRUE(pReader->Step());
+	EXPECT_EQ(pReader->GetInt(1), 2);
+
+	EXPECT_THROW(Insert(pReader.get(), 3, 30.0f), std::runtime_error);
+	pReader->Disconnect();
+	pWriter->Disconnect();
+}
+
+struct CStressReader
+{
+	std::unique_ptr<CSqliteConnection> m_pConnection;
+	std::atomic_bool *m_pStop;
+	std::vector<int64> m_vLatencies; // in microseconds
+};
+
+static void StressReaderThread(void *pUser)
+{
+	CStressReader *pReader = (CStressReader *)pUser;
+	for(int i = 0; !pReader->m_pStop->load(); i++)
+	{
+		char aName[16];
+		str_format(aName, sizeof(aName), "player%d", i % 500);
+		int64 Start = time_get();
+		pReader->m_pConnection->PrepareStatement(SELECT_RANK);
+		pReader->m_pConnection->BindString(1, aName);
+		pReader->m_pConnection->Step();
+		pReader->m_vLatencies.push_back((time_get() - Start) * 1000000 / time_freq());
+	}
+}
+
+// concurrent rank queries while finishes are inserted one by one
+TEST_F(Sqlite, DISABLED_Benchmark)
+{
+	static const int NUM_READERS = 4;
+	static const int NUM_INSERTS = 1000;
+	char aaResults[2][256];
+	for(int Wal = 0; Wal < 2; Wal++)
+	{
+		auto pWriter = Writer(Wal);
+		pWriter->BeginTransaction();
+		pWriter->PrepareStatement("DELETE FROM test;");
+		pWriter->Step();
+		for(int i = 0; i < 2000; i++)
+			Insert(pWriter.get(), i % 500, 100.0f + i);
+		pWriter->CommitTransaction();
+
+		std::atomic_bool Stop(false);
+		CStressReader aReaders[NUM_READERS];
+		void *apThreads[NUM_READERS];
+		for(int i = 0; i < NUM_READERS; i++)
+		{
+			aReaders[i].m_pConnection = std::unique_ptr<CSqliteConnection>(pWriter->Copy());
+			aReaders[i].m_pConnection->SetReadOnly(Wal);
+			ASSERT_EQ(aReaders[i].m_pConnection->Connect(), IDbConnection::SUCCESS);
+			aReaders[i].m_pStop = &Stop;
+			apThreads[i] = thread_init(StressReaderThread, &aReaders[i], "sqlite stress reader");
+		}
+
+		int64 Start = time_get();
+		for(int i = 0; i < NUM_INSERTS; i++)
+			Insert(pWriter.get(), i % 500, 50.0f + i);
+		int64 WriteTime = time_get() - Start;
+
+		Stop.store(true);
+		std::vector<int64> vLatencies;
+		for(int i = 0; i < NUM_READERS; i++)
+		{
+			thread_wait(apThreads[i]);
+			aReaders[i].m_pConnection->Disconnect();
+			vLatencies.insert(vLatencies.end(), aReaders[i].m_vLatencies.begin(), aReaders[i].m_vLatencies.end());
+		}
+		pWriter->Disconnect();
+		ASSERT_FALSE(vLatencies.empty());
+		std::sort(vLatencies.begin(), vLatencies.end());
+
+		str_format(aaResults[Wal], sizeof(aaResults[Wal]), "%s: %d inserts in %.2fms, %d rank queries p50=%.2fms p99=%.2fms max=%.2fms",
+			Wal ? "wal" : "rollback journal", NUM_INSERTS, WriteTime * 1000.0 / time_freq(), (int)vLatencies.size(),
+			vLatencies[vLatencies.size() / 2] / 1000.0, vLatencies[vLatencies.size() * 99 / 100] / 1000.0,
+			vLatencies.back() / 1000.0);
+	}
+	RecordBenchmark("%s; %s", aaResults[0], aaResults[1]);
+}
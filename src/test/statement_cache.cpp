@@ -0,0 +1,166 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/databases/sqlite.h>
+
+static const char *CREATE_TABLE = "CREATE TABLE IF NOT EXISTS test(Name VARCHAR(16), Time FLOAT);";
+static const char *INSERT = "INSERT INTO test(Name, Time) VALUES (?, ?);";
+static const char *SELECT_RANK =
+	"SELECT Rank, Time FROM ("
+	"  SELECT RANK() OVER w AS Rank, MIN(Time) AS Time, Name "
+	"  FROM test GROUP BY Name WINDOW w AS (ORDER BY MIN(Time))"
+	") AS a WHERE Name = ?;";
+
+class StatementCache : public ::testing::Test
+{
+protected:
+	CSqliteConnection m_Connection;
+
+	StatementCache() :
+		m_Connection(":memory:", false)
+	{
+		EXPECT_EQ(m_Connection.Connect(), IDbConnection::SUCCESS);
+		m_Connection.PrepareStatement(CREATE_TABLE);
+		m_Connection.Step();
+		for(int i = 0; i < 100; i++)
+		{
+			char aName[16];
+			str_format(aName, sizeof(aName), "player%d", i);
+			m_Connection.PrepareStatement(INSERT);
+			m_Connection.BindString(1, aName);
+			m_Connection.BindFloat(2, 1000.0f - i);
+			m_Connection.Step();
+		}
+	}
+
+	~StatementCache()
+	{
+		m_Connection.Disconnect();
+	}
+
+	int Rank(const char *pName)
+	{
+		m_Connection.PrepareStatement(SELECT_RANK);
+		m_Connection.BindString(1, pName);
+		if(!m_Connection.Step())
+			return -1;
+		return m_Connection.GetInt(1);
+	}
+
+	CStatementCacheStats Stats()
+	{
+		CStatementCacheStats Stats;
+		m_Connection.GetStatementCacheStats(&Stats);
+		return Stats;
+	}
+};
+
+TEST_F(StatementCache, Reuse)
+{
+	CStatementCacheStats Before = Stats();
+	EXPECT_EQ(Before.m_Hits, 99);
+	EXPECT_EQ(Before.m_Misses, 2);
+
+	EXPECT_EQ(Rank("player99"), 1);
+	EXPECT_EQ(Rank("player0"), 100);
+	// the previous result is discarded without stepping through it
+	EXPECT_EQ(Rank("player50"), 50);
+	EXPECT_EQ(Rank("nobody"), -1);
+
+	CStatementCacheStats After = Stats();
+	EXPECT_EQ(After.m_Hits - Before.m_Hits, 3);
+	EXPECT_EQ(After.m_Misses - Before.m_Misses, 1);
+	EXPECT_EQ(After.m_Size, 3);
+	EXPECT_EQ(After.m_Evictions, 0);
+}
+
+TEST_F(StatementCache, Eviction)
+{
+	m_Connection.SetStatementCacheSize(2);
+	EXPECT_EQ(Rank("player1"), 99);
+	CStatementCacheStats Stats1 = Stats();
+	EXPECT_EQ(Stats1.m_Size, 2);
+	EXPECT_EQ(Stats1.m_Evictions, 1);
+
+	// the create statement was evicted
+	m_Connection.PrepareStatement(CREATE_TABLE);
+	EXPECT_EQ(Stats().m_Misses, Stats1.m_Misses + 1);
+	EXPECT_EQ(Rank("player1"), 99);
+	EXPECT_EQ(Stats().m_Hits, Stats1.m_Hits + 1);
+}
+
+TEST_F(StatementCache, Disabled)
+{
+	m_Connection.SetStatementCacheSize(0);
+	CStatementCacheStats Before = Stats();
+	EXPECT_EQ(Rank("player99"), 1);
+	EXPECT_EQ(Rank("player98"), 2);
+	CStatementCacheStats After = Stats();
+	EXPECT_EQ(After.m_Hits, Before.m_Hits);
+	EXPECT_EQ(After.m_Size, 1);
+}
+
+TEST_F(StatementCache, DISABLED_Benchmark)
+{
+	static const int NUM_QUERIES = 2000;
+	int64 aRankTime[2];
+	for(int Cached = 0; Cached < 2; Cached++)
+	{
+		m_Connection.SetStatementCacheSize(Cached ? CStatementCache<int>::DEFAULT_CAPACITY : 0);
+		int64 Start = time_get();
+		for(int i = 0; i < NUM_QUERIES; i++)
+		{
+			char aName[16];
+			str_format(aName, sizeof(aName), "player%d", i % 100);
+			EXPECT_EQ(Rank(aName), 100 - i % 100);
+		}
+		aRankTime[Cached] = time_get() - Start;
+	}
+
+	// same statement as CScore::SaveScoreThread, parsing it dominates
+	CSqliteConnection Race(":memory:", true);
+	ASSERT_EQ(Race.Connect(), IDbConnection::SUCCESS);
+	char aFinish[1024];
+	str_format(aFinish, sizeof(aFinish),
+		"%s INTO %s_race("
+		"	Map, Name, Timestamp, Time, Server, "
+		"	cp1, cp2, cp3, cp4, cp5, cp6, cp7, cp8, cp9, cp10, cp11, cp12, cp13, "
+		"	cp14, cp15, cp16, cp17, cp18, cp19, cp20, cp21, cp22, cp23, cp24, cp25, "
+		"	GameID, DDNet7) "
+		"VALUES (?, ?, %s, ROUND(?, 2), ?, "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), ROUND(?, 2), "
+		"	?, false);",
+		Race.InsertIgnore(), Race.GetPrefix(), Race.InsertTimestampAsUtc());
+	int64 aFinishTime[2];
+	for(int Cached = 0; Cached < 2; Cached++)
+	{
+		Race.SetStatementCacheSize(Cached ? CStatementCache<int>::DEFAULT_CAPACITY : 0);
+		int64 Start = time_get();
+		for(int i = 0; i < NUM_QUERIES; i++)
+		{
+			char aName[16];
+			str_format(aName, sizeof(aName), "player%d", Cached * NUM_QUERIES + i);
+			Race.PrepareStatement(aFinish);
+			Race.BindString(1, "map");
+			Race.BindString(2, aName);
+			Race.BindString(3, "2021-01-01 00:00:00");
+			Race.BindFloat(4, 100.0f + i / 100.0f);
+			Race.BindString(5, "TEST");
+			for(int Cp = 0; Cp < 25; Cp++)
+				Race.BindFloat(6 + Cp, Cp + i / 100.0f);
+			Race.BindString(31, "uuid");
+			Race.Step();
+		}
+		aFinishTime[Cached] = time_get() - Start;
+	}
+	Race.Disconnect();
+
+	RecordBenchmark("%d rank queries: %.2fms without cache, %.2fms with cache; %d finishes: %.2fms without cache, %.2fms with cache",
+		NUM_QUERIES, aRankTime[0] * 1000.0 / time_freq(), aRankTime[1] * 1000.0 / time_freq(),
+		NUM_QUERIES, aFinishTime[0] * 1000.0 / time_freq(), aFinishTime[1] * 1000.0 / time_freq());
+}
@@ -61,6 +61,8 @@ TEST(Str, Utf8CompConfusables)
 	EXPECT_TRUE(str_utf8_comp_confusable("l", "ӏ") == 0); // CYRILLIC SMALL LETTER PALOCHKA
 	EXPECT_FALSE(str_utf8_comp_confusable("o", "x") == 0);
 	EXPECT_TRUE(str_utf8_comp_confusable("aceiou", "ąçęįǫų") == 0);
+	EXPECT_TRUE(str_utf8_comp_confusable("a\xf4\x8f\xbf\xbd", "a") == 0); // private use U+10FFFD is ignored
+	EXPECT_FALSE(str_utf8_comp_confusable("a\xf4\x8f\xbf\xbf", "a") == 0); // U+10FFFF
 }
 
 TEST(Str, Utf8ToLower)
@@ -69,6 +71,10 @@ TEST(Str, Utf8ToLower)
 	EXPECT_TRUE(str_utf8_tolower('z') == 'z');
 	EXPECT_TRUE(str_utf8_tolower(192) == 224); // À -> à
 	EXPECT_TRUE(str_utf8_tolower(7882) == 7883); // Ị -> ị
+	EXPECT_TRUE(str_utf8_tolower(0x1E921) == 0x1E943); // last mapped codepoint
+	EXPECT_TRUE(str_utf8_tolower(0x1E922) == 0x1E922);
+	EXPECT_TRUE(str_utf8_tolower(0x10FFFF) == 0x10FFFF);
+	EXPECT_TRUE(str_utf8_tolower(-1) == -1);
 
 	EXPECT_TRUE(str_utf8_comp_nocase("ÖlÜ", "ölü") == 0);
 	EXPECT_TRUE(str_utf8_comp_nocase("ÜlÖ", "ölü") > 0); // ü > ö
@@ -154,6 +160,38 @@ TEST(Str, HexDecode)
 	EXPECT_STREQ(aOut, "ABCD");
 }
 
+TEST(Str, Base64)
+{
+	char aBuf[16];
+	str_base64(aBuf, sizeof(aBuf), "", 0);
+	EXPECT_STREQ(aBuf, "");
+	str_base64(aBuf, sizeof(aBuf), "f", 1);
+	EXPECT_STREQ(aBuf, "Zg==");
+	str_base64(aBuf, sizeof(aBuf), "fo", 2);
+	EXPECT_STREQ(aBuf, "Zm8=");
+	str_base64(aBuf, sizeof(aBuf), "foobar", 6);
+	EXPECT_STREQ(aBuf, "Zm9vYmFy");
+	str_base64(aBuf, 8, "foobar", 6);
+	EXPECT_STREQ(aBuf, "Zm9v");
+}
+
+TEST(Str, Base64Decode)
+{
+	char aOut[8];
+	EXPECT_EQ(str_base64_decode(aOut, sizeof(aOut), ""), 0);
+	ASSERT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zg=="), 1);
+	EXPECT_EQ(aOut[0], 'f');
+	ASSERT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zm8="), 2);
+	EXPECT_EQ(mem_comp(aOut, "fo", 2), 0);
+	ASSERT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zm9vYmFy"), 6);
+	EXPECT_EQ(mem_comp(aOut, "foobar", 6), 0);
+	EXPECT_EQ(str_base64_decode(aOut, 5, "Zm9vYmFy"), -1);
+	EXPECT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zm9"), -1);
+	EXPECT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zm9v\n"), -1);
+	EXPECT_EQ(str_base64_decode(aOut, sizeof(aOut), "Zg==Zg=="), -1);
+	EXPECT_EQ(str_base64_decode(aOut, sizeof(aOut), "Z==="), -1);
+}
+
 TEST(Str, Tokenize)
 {
 	char aTest[] = "GER,RUS,ZAF,BRA,CAN";
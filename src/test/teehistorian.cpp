@@ -1,11 +1,17 @@
+#include "test.h"
 #include <gtest/gtest.h>
 
 #include <base/detect.h>
 #include <engine/server.h>
 #include <engine/shared/config.h>
+#include <engine/shared/teehistorian_reader.h>
+#include <engine/shared/teehistorian_writer.h>
 #include <game/gamecore.h>
 #include <game/server/teehistorian.h>
 
+#include <vector>
+#include <zlib.h>
+
 void RegisterGameUuids(CUuidManager *pManager);
 
 class TeeHistorian : public ::testing::Test
@@ -19,6 +25,11 @@ protected:
 
 	CPacker m_Buffer;
 
+	CTestInfo m_Info;
+	CTeeHistorianWriter *m_pWriter;
+	std::vector<unsigned char> m_vWritten;
+	int m_NumParts;
+
 	enum
 	{
 		STATE_NONE,
@@ -70,13 +81,265 @@ protected:
 		m_GameInfo.m_pTuning = &m_Tuning;
 		m_GameInfo.m_pUuids = &m_UuidManager;
 
+		m_pWriter = 0;
+		m_NumParts = 0;
 		Reset(&m_GameInfo);
 	}
 
+	~TeeHistorian()
+	{
+		// also clean up after failed tests
+		char aFilename[128];
+		for(int i = 0; i < m_NumParts; i++)
+		{
+			PartFilename(i, aFilename, sizeof(aFilename));
+			fs_remove(aFilename);
+		}
+		IndexFilename(aFilename, sizeof(aFilename));
+		fs_remove(aFilename);
+	}
+
 	static void Write(const void *pData, int DataSize, void *pUser)
 	{
 		TeeHistorian *pThis = (TeeHistorian *)pUser;
 		pThis->m_Buffer.AddRaw(pData, DataSize);
+		if(pThis->m_pWriter)
+		{
+			pThis->m_pWriter->Write(pData, DataSize);
+			const unsigned char *pBytes = (const unsigned char *)pData;
+			pThis->m_vWritten.insert(pThis->m_vWritten.end(), pBytes, pBytes + DataSize);
+		}
+	}
+
+	void PartFilename(int Part, char *pBuf, int BufSize)
+	{
+		str_format(pBuf, BufSize, "%s.%d", m_Info.m_aFilename, Part);
+	}
+
+	void IndexFilename(char *pBuf, int BufSize)
+	{
+		str_format(pBuf, BufSize, "%s.index", m_Info.m_aFilename);
+	}
+
+	static IOHANDLE OpenFile(int Part, bool Index, void *pUser, int Flags)
+	{
+		TeeHistorian *pThis = (TeeHistorian *)pUser;
+		char aFilename[128];
+		if(Index)
+			pThis->IndexFilename(aFilename, sizeof(aFilename));
+		else
+		{
+			pThis->PartFilename(Part, aFilename, sizeof(aFilename));
+			pThis->m_NumParts = maximum(pThis->m_NumParts, Part + 1);
+		}
+		return io_open(aFilename, Flags);
+	}
+
+	static IOHANDLE OpenPart(int Part, bool Index, void *pUser)
+	{
+		return OpenFile(Part, Index, pUser, IOFLAG_WRITE);
+	}
+
+	static IOHANDLE OpenPartRead(int Part, bool Index, void *pUser)
+	{
+		return OpenFile(Part, Index, pUser, IOFLAG_READ);
+	}
+
+	static void WriteIndex(int Tick, const void *pState, int StateSize, void *pUser)
+	{
+		TeeHistorian *pThis = (TeeHistorian *)pUser;
+		pThis->m_pWriter->WriteIndex(Tick, pState, StateSize);
+	}
+
+	void ReadPart(int Part, int Compression, std::vector<unsigned char> *pOut)
+	{
+		char aFilename[128];
+		PartFilename(Part, aFilename, sizeof(aFilename));
+		IOHANDLE File = io_open(aFilename, IOFLAG_READ);
+		ASSERT_TRUE(File);
+		std::vector<unsigned char> vData(io_length(File));
+		ASSERT_EQ(io_read(File, vData.data(), vData.size()), vData.size());
+		io_close(File);
+		fs_remove(aFilename);
+
+		if(Compression == CTeeHistorianWriter::COMPRESSION_NONE)
+		{
+			pOut->insert(pOut->end(), vData.begin(), vData.end());
+			return;
+		}
+
+		z_stream Stream;
+		mem_zero(&Stream, sizeof(Stream));
+		ASSERT_EQ(inflateInit2(&Stream, 15 + 16), Z_OK);
+		Stream.next_in = vData.data();
+		Stream.avail_in = vData.size();
+		int Result;
+		do
+		{
+			unsigned char aOut[1024];
+			Stream.next_out = aOut;
+			Stream.avail_out = sizeof(aOut);
+			Result = inflate(&Stream, Z_NO_FLUSH);
+			ASSERT_TRUE(Result == Z_OK || Result == Z_STREAM_END);
+			pOut->insert(pOut->end(), aOut, aOut + sizeof(aOut) - Stream.avail_out);
+		} while(Result != Z_STREAM_END);
+		EXPECT_EQ(Stream.avail_in, 0u);
+		inflateEnd(&Stream);
+	}
+
+	void ExpectWriterRoundTrip(int Compression, int RotateSize)
+	{
+		CTeeHistorianWriter::CConfig Config;
+		Config.m_Compression = Compression;
+		Config.m_CompressionLevel = 6;
+		Config.m_RotateSize = RotateSize;
+		Config.m_RotateTime = 0;
+		Config.m_MaxQueued = 0;
+
+		CTeeHistorianWriter Writer;
+		ASSERT_TRUE(Writer.Open(&Config, OpenPart, this));
+		m_pWriter = &Writer;
+		Reset(&m_GameInfo);
+		for(int i = 1; i < 2000; i++)
+		{
+			Tick(i);
+			for(int c = 0; c < 16; c++)
+			{
+				Player(c, i * (c + 1), i % 50 + c);
+			}
+			if(i % 100 == 0)
+			{
+				Inputs();
+				m_TH.RecordPlayerMessage(i % 64, "chat", 5);
+				// the worker writes the stream in several batches
+				Writer.Flush();
+			}
+		}
+		Finish();
+		m_pWriter = 0;
+		Writer.Close();
+		ASSERT_EQ(Writer.Error(), 0);
+
+		CTeeHistorianWriter::CStats Stats;
+		Writer.GetStats(&Stats);
+		EXPECT_EQ(Stats.m_BytesIn, (int64)m_vWritten.size());
+		EXPECT_EQ(Stats.m_BytesQueued, 0);
+		EXPECT_EQ(Stats.m_BytesDropped, 0);
+		if(RotateSize)
+		{
+			EXPECT_GT(Stats.m_NumParts, 1);
+		}
+		else
+		{
+			EXPECT_EQ(Stats.m_NumParts, 1);
+		}
+
+		std::vector<unsigned char> vRead;
+		for(int i = 0; i < Stats.m_NumParts; i++)
+		{
+			ReadPart(i, Compression, &vRead);
+		}
+		ASSERT_EQ(vRead.size(), m_vWritten.size());
+		EXPECT_TRUE(vRead == m_vWritten);
+	}
+
+	struct CSeenChunk
+	{
+		int m_Type;
+		int m_Tick;
+		int m_ClientID;
+		int m_X;
+		int m_Y;
+	};
+
+	void ReadChunks(CTeeHistorianReader *pReader, std::vector<CSeenChunk> *pOut)
+	{
+		CTeeHistorianReader::CChunk Chunk;
+		while(pReader->NextChunk(&Chunk))
+		{
+			CSeenChunk Seen = {Chunk.m_Type, Chunk.m_Tick, Chunk.m_ClientID, Chunk.m_X, Chunk.m_Y};
+			pOut->push_back(Seen);
+		}
+		EXPECT_FALSE(pReader->Error());
+	}
+
+	void ExpectSeek(int Compression, int RotateSize)
+	{
+		CTeeHistorianWriter::CConfig Config;
+		Config.m_Compression = Compression;
+		Config.m_CompressionLevel = 6;
+		Config.m_RotateSize = RotateSize;
+		Config.m_RotateTime = 0;
+		Config.m_MaxQueued = 0;
+
+		CTeeHistorianWriter Writer;
+		ASSERT_TRUE(Writer.Open(&Config, OpenPart, this));
+		m_pWriter = &Writer;
+		Reset(&m_GameInfo);
+		m_TH.EnableIndex(50, WriteIndex, this);
+		for(int i = 1; i < 1000; i++)
+		{
+			// leave gaps so that some index entries follow tick skips
+			if(i % 170 < 20)
+			{
+				continue;
+			}
+			Tick(i);
+			for(int c = 0; c < 8; c++)
+			{
+				// players join and leave over time
+				if((i / 100 + c) % 4 != 0)
+				{
+					Player(c, i * (c + 1), i % 50 + c);
+				}
+			}
+			if(i % 30 == 0)
+			{
+				Inputs();
+				m_TH.RecordPlayerMessage(i % 8, "chat", 5);
+			}
+		}
+		Finish();
+		m_pWriter = 0;
+		Writer.Close();
+		ASSERT_EQ(Writer.Error(), 0);
+
+		std::vector<CSeenChunk> vAll;
+		{
+			CTeeHistorianReader Reader;
+			ASSERT_TRUE(Reader.Open(OpenPartRead, this));
+			EXPECT_EQ(Reader.Compressed(), Compression == CTeeHistorianWriter::COMPRESSION_ZLIB);
+			EXPECT_GT(Reader.NumIndexEntries(), 10);
+			ReadChunks(&Reader, &vAll);
+		}
+		ASSERT_FALSE(vAll.empty());
+		EXPECT_EQ(vAll.back().m_Type, TEEHISTORIAN_FINISH);
+
+		static const int s_aSeekTicks[] = {0, 1, 49, 50, 51, 175, 333, 520, 999, 990, 5};
+		CTeeHistorianReader Reader;
+		ASSERT_TRUE(Reader.Open(OpenPartRead, this));
+		for(int SeekTick : s_aSeekTicks)
+		{
+			unsigned First = 0;
+			while(First < vAll.size() && vAll[First].m_Tick < SeekTick)
+			{
+				First++;
+			}
+			ASSERT_TRUE(Reader.SeekTick(SeekTick));
+			std::vector<CSeenChunk> vSeeked;
+			ReadChunks(&Reader, &vSeeked);
+			ASSERT_EQ(vSeeked.size(), vAll.size() - First) << "tick " << SeekTick;
+			for(unsigned i = 0; i < vSeeked.size(); i++)
+			{
+				const CSeenChunk &Expected = vAll[First + i];
+				ASSERT_EQ(vSeeked[i].m_Type, Expected.m_Type) << "tick " << SeekTick << " chunk " << i;
+				ASSERT_EQ(vSeeked[i].m_Tick, Expected.m_Tick) << "tick " << SeekTick << " chunk " << i;
+				ASSERT_EQ(vSeeked[i].m_ClientID, Expected.m_ClientID) << "tick " << SeekTick << " chunk " << i;
+				ASSERT_EQ(vSeeked[i].m_X, Expected.m_X) << "tick " << SeekTick << " chunk " << i;
+				ASSERT_EQ(vSeeked[i].m_Y, Expected.m_Y) << "tick " << SeekTick << " chunk " << i;
+			}
+		}
+		Reader.Close();
 	}
 
 	void Reset(const CTeeHistorian::CGameInfo *pGameInfo)
@@ -532,3 +795,61 @@ TEST_F(TeeHistorian, LoadFailed)
 	Finish();
 	Expect(EXPECTED, sizeof(EXPECTED));
 }
+
+TEST_F(TeeHistorian, WriterUncompressed)
+{
+	ExpectWriterRoundTrip(CTeeHistorianWriter::COMPRESSION_NONE, 0);
+}
+
+TEST_F(TeeHistorian, WriterCompressed)
+{
+	ExpectWriterRoundTrip(CTeeHistorianWriter::COMPRESSION_ZLIB, 0);
+}
+
+TEST_F(TeeHistorian, WriterCompressedRotation)
+{
+	ExpectWriterRoundTrip(CTeeHistorianWriter::COMPRESSION_ZLIB, 4 * 1024);
+}
+
+TEST_F(TeeHistorian, WriterOverflow)
+{
+	CTeeHistorianWriter::CConfig Config;
+	Config.m_Compression = CTeeHistorianWriter::COMPRESSION_NONE;
+	Config.m_CompressionLevel = 0;
+	Config.m_RotateSize = 0;
+	Config.m_RotateTime = 0;
+	Config.m_MaxQueued = 16;
+
+	static const char DATA[] = "0123456789abcdef0123456789abcdef";
+	CTeeHistorianWriter Writer;
+	ASSERT_TRUE(Writer.Open(&Config, OpenPart, this));
+	EXPECT_FALSE(Writer.Write(DATA, 17));
+	// the stream is truncated at the first overflow
+	EXPECT_FALSE(Writer.Write(DATA, 1));
+	Writer.Close();
+	EXPECT_EQ(Writer.Error(), 0);
+
+	CTeeHistorianWriter::CStats Stats;
+	Writer.GetStats(&Stats);
+	EXPECT_EQ(Stats.m_BytesIn, 0);
+	EXPECT_EQ(Stats.m_BytesDropped, 18);
+
+	std::vector<unsigned char> vRead;
+	ReadPart(0, CTeeHistorianWriter::COMPRESSION_NONE, &vRead);
+	EXPECT_TRUE(vRead.empty());
+}
+
+TEST_F(TeeHistorian, SeekUncompressed)
+{
+	ExpectSeek(CTeeHistorianWriter::COMPRESSION_NONE, 0);
+}
+
+TEST_F(TeeHistorian, SeekCompressed)
+{
+	ExpectSeek(CTeeHistorianWriter::COMPRESSION_ZLIB, 0);
+}
+
+TEST_F(TeeHistorian, SeekCompressedRotation)
+{
+	ExpectSeek(CTeeHistorianWriter::COMPRESSION_ZLIB, 4 * 1024);
+}
@@ -3,6 +3,9 @@
 
 #include <base/system.h>
 
+#include <stdarg.h>
+#include <stdio.h>
+
 CTestInfo::CTestInfo()
 {
 	const ::testing::TestInfo *pTestInfo =
@@ -11,6 +14,16 @@ CTestInfo::CTestInfo()
 		pTestInfo->test_case_name(), pTestInfo->name(), pid());
 }
 
+void RecordBenchmark(const char *pFormat, ...)
+{
+	char aBuf[512];
+	va_list Args;
+	va_start(Args, pFormat);
+	vsnprintf(aBuf, sizeof(aBuf), pFormat, Args);
+	va_end(Args);
+	::testing::Test::RecordProperty("benchmark", aBuf);
+}
+
 int main(int argc, char **argv)
 {
 	::testing::InitGoogleTest(&argc, argv);
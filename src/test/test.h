@@ -1,9 +1,17 @@
 #ifndef TEST_TEST_H
 #define TEST_TEST_H
+#include <base/system.h>
+
 class CTestInfo
 {
 public:
 	CTestInfo();
 	char m_aFilename[64];
 };
+
+// benchmarks are named DISABLED_Benchmark so that they only run with
+// --gtest_also_run_disabled_tests, the result is kept as the
+// "benchmark" property of the test
+void RecordBenchmark(const char *pFormat, ...)
+	GNUC_ATTRIBUTE((format(printf, 1, 2)));
 #endif // TEST_TEST_H
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/network.h>
+#include <engine/shared/packer.h>
+#include <mastersrv/mastersrv.h>
+#include <twping/probe.h>
+
+#include <atomic>
+#include <vector>
+
+enum
+{
+	NUM_SERVERS = 8,
+	NUM_SILENT = 2,
+	NUM_TARGETS = 1000,
+};
+
+struct CFakeServer
+{
+	NETSOCKET m_Socket;
+	MMSGS m_Mmsgs;
+	std::atomic<bool> *m_pStop;
+};
+
+// answers info requests with the token like a real server
+static void FakeServerThread(void *pUser)
+{
+	CFakeServer *pServer = (CFakeServer *)pUser;
+	net_init_mmsgs(&pServer->m_Mmsgs);
+	while(!pServer->m_pStop->load())
+	{
+		net_socket_read_wait(pServer->m_Socket, 100000);
+		NETADDR Addr;
+		unsigned char aBuffer[NET_MAX_PACKETSIZE];
+		unsigned char *pData;
+		int Bytes;
+		while((Bytes = net_udp_recv(pServer->m_Socket, &Addr, aBuffer, sizeof(aBuffer), &pServer->m_Mmsgs, &pData)) > 0)
+		{
+			CNetPacketConstruct Request;
+			bool Sixup = false;
+			if(CNetBase::UnpackPacket(pData, Bytes, &Request, Sixup) != 0 || !(Request.m_Flags & NET_PACKETFLAG_EXTENDED) ||
+				Request.m_DataSize < (int)sizeof(SERVERBROWSE_GETINFO) + 1 || mem_comp(Request.m_aChunkData, SERVERBROWSE_GETINFO, sizeof(SERVERBROWSE_GETINFO)) != 0)
+				continue;
+			int Token = Request.m_aChunkData[sizeof(SERVERBROWSE_GETINFO)] | (Request.m_aExtraData[0] << 16) | (Request.m_aExtraData[1] << 8);
+
+			CPacker Packer;
+			char aToken[16];
+			str_format(aToken, sizeof(aToken), "%d", Token);
+			Packer.Reset();
+			Packer.AddRaw(SERVERBROWSE_INFO_EXTENDED, sizeof(SERVERBROWSE_INFO_EXTENDED));
+			Packer.AddString(aToken, 0);
+			Packer.AddString("test", 0);
+			CNetBase::SendPacketConnless(pServer->m_Socket, &Addr, Packer.Data(), Packer.Size(), false, 0);
+		}
+	}
+}
+
+TEST(Twping, Probe)
+{
+	ASSERT_EQ(secure_random_init(), 0);
+
+	std::atomic<bool> Stop(false);
+	std::vector<CFakeServer> vServers(NUM_SERVERS + NUM_SILENT);
+	std::vector<NETADDR> vAddrs;
+	// the silent ones are bound so that nothing answers, not even the os
+	for(auto &Server : vServers)
+	{
+		NETADDR Addr;
+		net_addr_from_str(&Addr, "127.0.0.1");
+		Server.m_Socket = net_udp_create(Addr);
+		ASSERT_NE(Server.m_Socket.type, NETTYPE_INVALID);
+		ASSERT_EQ(net_udp_local_addr(Server.m_Socket, &Addr), 0);
+		Server.m_pStop = &Stop;
+		vAddrs.push_back(Addr);
+	}
+	std::vector<void *> vpThreads;
+	for(int i = 0; i < NUM_SERVERS; i++)
+		vpThreads.push_back(thread_init(FakeServerThread, &vServers[i], "twping fake server"));
+
+	NETADDR BindAddr;
+	mem_zero(&BindAddr, sizeof(BindAddr));
+	BindAddr.type = NETTYPE_ALL;
+	CNetClient Net;
+	Net.Open(BindAddr, 0);
+
+	// many requests per server, only the tokens tell them apart
+	std::vector<CTarget> vTargets;
+	for(int i = 0; i < NUM_TARGETS; i++)
+	{
+		CTarget Target;
+		Target.m_Addr = vAddrs[i % vAddrs.size()];
+		net_addr_str(&Target.m_Addr, Target.m_aAddr, sizeof(Target.m_aAddr), true);
+		vTargets.push_back(Target);
+	}
+	Probe(&Net, &vTargets, 128, 1000);
+
+	Stop = true;
+	for(void *pThread : vpThreads)
+		thread_wait(pThread);
+	Net.Close();
+	for(auto &Server : vServers)
+		net_udp_close(Server.m_Socket);
+
+	for(int i = 0; i < NUM_TARGETS; i++)
+	{
+		bool Silent = i % vAddrs.size() >= NUM_SERVERS;
+		EXPECT_EQ(vTargets[i].m_Rtt >= 0, !Silent) << vTargets[i].m_aAddr;
+	}
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+
+// names as seen on public servers
+static const char *s_apNames[] = {
+	"nameless tee",
+	"brainless tee",
+	"(1)nameless tee",
+	"Cireme",
+	"deen",
+	"heinrich5991",
+	"Ryozuki",
+	"[FNG]Slayer",
+	"|TB| Zwelf",
+	"xXx_sniper_xXx",
+	"ChillerDragon",
+	"Ǥöṭ ℌⅰᵍℎ",
+	"ᴋᴀɪ",
+	"ⓝⓔⓞⓝ",
+	"Ꭿ丂卄",
+	"Тимофей",
+	"Владимир",
+	"Ὀδυσσεύς",
+	"ΣΊΣΥΦΟΣ",
+	"محمد",
+	"ชัยชนะ",
+	"大魔王",
+	"ｆｕｌｌｗｉｄｔｈ",
+	"𝕯𝖆𝖗𝖐",
+	"ÆØÅ æøå",
+	"Łukasz",
+	"İstanbul",
+	"Straße",
+	"ÑOÑO",
+	"♥ love ♥",
+	"ʕ•ᴥ•ʔ",
+	"¯\\_(ツ)_/¯",
+	"rn m",
+	"l1I|",
+	"0O○◯",
+	"ＡＢＣ",
+	"Ⱥⱥ Ɐ",
+	"𞤀𞤢",
+	"ⅯⅭⅯⅬⅩⅩⅩⅤ",
+	"t\xe2\x80\x8b" "ee",
+};
+
+TEST(Unicode, DISABLED_Benchmark)
+{
+	static const int NUM_ROUNDS = 5000;
+	const int NumNames = sizeof(s_apNames) / sizeof(s_apNames[0]);
+	int aSkeleton[64];
+	int64 Sum = 0;
+
+	int64 Start = time_get();
+	for(int r = 0; r < NUM_ROUNDS; r++)
+		for(int i = 0; i < NumNames; i++)
+			Sum += str_utf8_to_skeleton(s_apNames[i], aSkeleton, sizeof(aSkeleton) / sizeof(aSkeleton[0]));
+	int64 Skeleton = time_get();
+	for(int r = 0; r < NUM_ROUNDS; r++)
+		for(int i = 0; i < NumNames; i++)
+			Sum += str_utf8_comp_nocase(s_apNames[i], s_apNames[(i + 1) % NumNames]);
+	int64 Done = time_get();
+	EXPECT_NE(Sum, 0);
+
+	RecordBenchmark("%d names: skeletons in %.2fms, case insensitive compares in %.2fms",
+		NUM_ROUNDS * NumNames, (Skeleton - Start) * 1000.0 / time_freq(), (Done - Skeleton) * 1000.0 / time_freq());
+}
@@ -0,0 +1,455 @@
+#include <base/math.h>
+#include <base/system.h>
+#include <base/tl/threading.h>
+
+#include <engine/config.h>
+#include <engine/shared/demo.h>
+#include <engine/shared/jobs.h>
+#include <engine/shared/linereader.h>
+#include <engine/shared/network.h>
+#include <engine/shared/snapshot.h>
+#include <engine/storage.h>
+
+#include <game/generated/protocol.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Cuts many slices out of many demos. Overlapping slices of the same source
+// demo are written in a single playback pass, so they share the decoding
+// work. Between slices the player jumps to the nearest keyframe if that's
+// ahead of the current position. The slices of a demo are split into tick
+// ranges that are played back in parallel, each starting at the keyframe
+// before its first slice, and different source demos are processed in
+// parallel as well.
+
+struct CSlice
+{
+	char m_aDemo[MAX_PATH_LENGTH];
+	char m_aOutput[MAX_PATH_LENGTH];
+	int m_StartTick;
+	int m_EndTick;
+	int m_Line;
+};
+
+static bool CompareSliceStart(const CSlice *pA, const CSlice *pB)
+{
+	return pA->m_StartTick < pB->m_StartTick;
+}
+
+class CSliceJob : public IJob, public CDemoPlayer::IListener
+{
+	enum
+	{
+		STATE_WAITING,
+		STATE_RECORDING,
+		STATE_DONE,
+	};
+
+	struct COutput
+	{
+		const CSlice *m_pSlice;
+		std::unique_ptr<CDemoRecorder> m_pRecorder;
+		int m_State;
+	};
+
+	IStorage *m_pStorage;
+	semaphore *m_pDone;
+	std::vector<COutput> m_vOutputs;
+
+	std::unique_ptr<CSnapshotDelta> m_pSnapshotDelta;
+	std::unique_ptr<CDemoPlayer> m_pPlayer;
+	unsigned char *m_pMapData;
+	int m_NumDone;
+
+	void Run();
+	void Update(int Tick);
+	bool StartOutput(COutput *pOutput);
+	void StopOutput(COutput *pOutput);
+
+public:
+	CSliceJob(IStorage *pStorage, semaphore *pDone, const std::vector<const CSlice *> &vpSlices);
+
+	virtual void OnDemoPlayerSnapshot(void *pData, int Size);
+	virtual void OnDemoPlayerMessage(void *pData, int Size);
+
+	// results, valid after the job is done
+	int m_NumSlices;
+	int m_NumFailed;
+	int64 m_BytesWritten;
+	int m_TicksDecoded;
+};
+
+CSliceJob::CSliceJob(IStorage *pStorage, semaphore *pDone, const std::vector<const CSlice *> &vpSlices) :
+	m_pStorage(pStorage),
+	m_pDone(pDone),
+	m_pMapData(0),
+	m_NumDone(0),
+	m_NumSlices(vpSlices.size()),
+	m_NumFailed(0),
+	m_BytesWritten(0),
+	m_TicksDecoded(0)
+{
+	for(const CSlice *pSlice : vpSlices)
+	{
+		COutput Output;
+		Output.m_pSlice = pSlice;
+		Output.m_State = STATE_WAITING;
+		m_vOutputs.push_back(std::move(Output));
+	}
+}
+
+bool CSliceJob::StartOutput(COutput *pOutput)
+{
+	const CDemoPlayer::CPlaybackInfo *pInfo = m_pPlayer->Info();
+	const CMapInfo *pMapInfo = m_pPlayer->GetMapInfo();
+	SHA256_DIGEST Sha256 = pMapInfo->m_Sha256;
+
+	pOutput->m_pRecorder.reset(new CDemoRecorder(m_pSnapshotDelta.get()));
+	if(pOutput->m_pRecorder->Start(m_pStorage, 0, pOutput->m_pSlice->m_aOutput, pInfo->m_Header.m_aNetversion, pMapInfo->m_aName, &Sha256, pMapInfo->m_Crc, pInfo->m_Header.m_aType, pMapInfo->m_Size, m_pMapData) == -1)
+	{
+		dbg_msg("demo_slice", "line %d: failed to open '%s' for writing", pOutput->m_pSlice->m_Line, pOutput->m_pSlice->m_aOutput);
+		pOutput->m_pRecorder.reset();
+		return false;
+	}
+	return true;
+}
+
+void CSliceJob::StopOutput(COutput *pOutput)
+{
+	if(pOutput->m_State == STATE_RECORDING)
+	{
+		pOutput->m_pRecorder->Stop();
+		pOutput->m_pRecorder.reset();
+
+		IOHANDLE File = m_pStorage->OpenFile(pOutput->m_pSlice->m_aOutput, IOFLAG_READ, IStorage::TYPE_SAVE);
+		if(File)
+		{
+			m_BytesWritten += io_length(File);
+			io_close(File);
+		}
+	}
+	pOutput->m_State = STATE_DONE;
+	m_NumDone++;
+}
+
+void CSliceJob::Update(int Tick)
+{
+	for(COutput &Output : m_vOutputs)
+	{
+		if(Output.m_State == STATE_DONE)
+			continue;
+
+		const CSlice *pSlice = Output.m_pSlice;
+		if(pSlice->m_EndTick != -1 && Tick > pSlice->m_EndTick)
+		{
+			StopOutput(&Output);
+		}
+		else if(Output.m_State == STATE_WAITING && (pSlice->m_StartTick == -1 || Tick >= pSlice->m_StartTick))
+		{
+			if(StartOutput(&Output))
+			{
+				Output.m_State = STATE_RECORDING;
+			}
+			else
+			{
+				m_NumFailed++;
+				StopOutput(&Output);
+			}
+		}
+	}
+}
+
+void CSliceJob::OnDemoPlayerSnapshot(void *pData, int Size)
+{
+	int Tick = m_pPlayer->Info()->m_Info.m_CurrentTick;
+	m_TicksDecoded++;
+	Update(Tick);
+	for(COutput &Output : m_vOutputs)
+	{
+		if(Output.m_State == STATE_RECORDING)
+			Output.m_pRecorder->RecordSnapshot(Tick, pData, Size);
+	}
+}
+
+void CSliceJob::OnDemoPlayerMessage(void *pData, int Size)
+{
+	Update(m_pPlayer->Info()->m_Info.m_CurrentTick);
+	for(COutput &Output : m_vOutputs)
+	{
+		if(Output.m_State == STATE_RECORDING)
+			Output.m_pRecorder->RecordMessage(pData, Size);
+	}
+}
+
+void CSliceJob::Run()
+{
+	const char *pDemo = m_vOutputs[0].m_pSlice->m_aDemo;
+
+	CNetObjHandler NetObjHandler;
+	m_pSnapshotDelta.reset(new CSnapshotDelta());
+	for(int i = 0; i < NUM_NETOBJTYPES; i++)
+		m_pSnapshotDelta->SetStaticsize(i, NetObjHandler.GetObjSize(i));
+
+	m_pPlayer.reset(new CDemoPlayer(m_pSnapshotDelta.get()));
+	m_pPlayer->SetListener(this);
+	if(m_pPlayer->Load(m_pStorage, 0, pDemo, IStorage::TYPE_ABSOLUTE) == -1)
+	{
+		dbg_msg("demo_slice", "failed to load demo '%s'", pDemo);
+		m_NumFailed = m_NumSlices;
+		m_pPlayer.reset();
+		m_pDone->signal();
+		return;
+	}
+	m_pMapData = m_pPlayer->GetMapData();
+
+	m_pPlayer->Play();
+	const IDemoPlayer::CInfo *pInfo = m_pPlayer->BaseInfo();
+	while(m_pPlayer->IsPlaying() && !pInfo->m_Paused && m_NumDone < m_NumSlices)
+	{
+		// skip ahead if nothing is being recorded and the next slice starts
+		// after a keyframe we haven't reached yet
+		bool Recording = false;
+		int NextStart = -1;
+		for(const COutput &Output : m_vOutputs)
+		{
+			if(Output.m_State == STATE_RECORDING)
+				Recording = true;
+			else if(Output.m_State == STATE_WAITING && (NextStart == -1 || Output.m_pSlice->m_StartTick < NextStart))
+				NextStart = Output.m_pSlice->m_StartTick;
+		}
+		if(!Recording && NextStart != -1 && m_pPlayer->KeyFrameTick(NextStart) > pInfo->m_CurrentTick)
+		{
+			m_pPlayer->SetPos(NextStart);
+			continue;
+		}
+
+		m_pPlayer->NextFrame();
+	}
+
+	// finish open-ended slices, slices starting after the end of the demo
+	// are left empty
+	for(COutput &Output : m_vOutputs)
+	{
+		if(Output.m_State == STATE_WAITING)
+			m_NumFailed++;
+		if(Output.m_State != STATE_DONE)
+			StopOutput(&Output);
+	}
+
+	m_pPlayer->Stop();
+	m_pPlayer.reset();
+	m_pSnapshotDelta.reset();
+	free(m_pMapData);
+	m_pMapData = 0;
+
+	m_pDone->signal();
+}
+
+static bool IsTick(const char *pStr)
+{
+	if(str_comp(pStr, "-1") == 0)
+		return true;
+	if(!*pStr)
+		return false;
+	for(; *pStr; pStr++)
+	{
+		if(*pStr < '0' || *pStr > '9')
+			return false;
+	}
+	return true;
+}
+
+static bool ParseManifest(const char *pFilename, std::vector<CSlice> &vSlices)
+{
+	IOHANDLE File = io_open(pFilename, IOFLAG_READ);
+	if(!File)
+	{
+		dbg_msg("demo_slice", "failed to open manifest '%s'", pFilename);
+		return false;
+	}
+
+	CLineReader LineReader;
+	LineReader.Init(File);
+	char *pLine;
+	int LineNumber = 0;
+	bool Success = true;
+	while((pLine = LineReader.Get()))
+	{
+		LineNumber++;
+		const char *pRest = str_skip_whitespaces_const(pLine);
+		if(!*pRest || *pRest == '#')
+			continue;
+
+		CSlice Slice;
+		char aStart[16], aEnd[16];
+		pRest = str_next_token(pRest, " \t", Slice.m_aDemo, sizeof(Slice.m_aDemo));
+		pRest = str_next_token(pRest, " \t", aStart, sizeof(aStart));
+		pRest = str_next_token(pRest, " \t", aEnd, sizeof(aEnd));
+		pRest = str_next_token(pRest, " \t", Slice.m_aOutput, sizeof(Slice.m_aOutput));
+		if(!Slice.m_aOutput[0] || !IsTick(aStart) || !IsTick(aEnd))
+		{
+			dbg_msg("demo_slice", "line %d: expected '<demo> <start tick> <end tick> <output>'", LineNumber);
+			Success = false;
+			continue;
+		}
+		Slice.m_StartTick = str_toint(aStart);
+		Slice.m_EndTick = str_toint(aEnd);
+		Slice.m_Line = LineNumber;
+		if(Slice.m_StartTick != -1 && Slice.m_EndTick != -1 && Slice.m_StartTick >= Slice.m_EndTick)
+		{
+			dbg_msg("demo_slice", "line %d: start tick %d is not before end tick %d", LineNumber, Slice.m_StartTick, Slice.m_EndTick);
+			Success = false;
+			continue;
+		}
+		vSlices.push_back(Slice);
+	}
+	io_close(File);
+	return Success;
+}
+
+static void Usage()
+{
+	dbg_msg("usage", "demo_slice [-j <threads>] <manifest>");
+	dbg_msg("usage", "each manifest line: <demo> <start tick> <end tick> <output>");
+	dbg_msg("usage", "ticks can be -1 for the start/end of the demo, outputs are relative to the current directory");
+}
+
+int main(int argc, char *argv[])
+{
+	dbg_logger_stdout();
+
+	int NumThreads = 0;
+	const char *pManifest = 0;
+	if(argc == 2)
+	{
+		pManifest = argv[1];
+	}
+	else if(argc == 4 && str_comp(argv[1], "-j") == 0)
+	{
+		NumThreads = str_toint(argv[2]);
+		pManifest = argv[3];
+	}
+	else
+	{
+		Usage();
+		return -1;
+	}
+	if(NumThreads <= 0)
+		NumThreads = std::thread::hardware_concurrency();
+	NumThreads = clamp(NumThreads, 1, 32);
+
+	std::vector<CSlice> vSlices;
+	if(!ParseManifest(pManifest, vSlices))
+		return -1;
+
+	IStorage *pStorage = CreateLocalStorage();
+	if(!pStorage)
+	{
+		dbg_msg("demo_slice", "failed to create storage");
+		return -1;
+	}
+	CNetBase::Init();
+
+	// the recorders read the keyframe interval and index settings
+	IConfig *pConfig = CreateConfig();
+	pConfig->Reset();
+
+	// slices grouped by source demo
+	std::vector<std::vector<const CSlice *>> vvpGroups;
+	for(const CSlice &Slice : vSlices)
+	{
+		auto It = std::find_if(vvpGroups.begin(), vvpGroups.end(), [&](const std::vector<const CSlice *> &vpGroup) {
+			return str_comp(vpGroup[0]->m_aDemo, Slice.m_aDemo) == 0;
+		});
+		if(It == vvpGroups.end())
+			vvpGroups.emplace_back(1, &Slice);
+		else
+			It->push_back(&Slice);
+	}
+
+	int64 StartTime = time_get();
+
+	// split the slices of each demo into runs of overlapping slices, these
+	// have to be recorded in the same pass. The runs are then distributed
+	// over up to `NumThreads` jobs covering consecutive tick ranges.
+	std::vector<std::vector<const CSlice *>> vvpJobSlices;
+	int64 BytesRead = 0;
+	for(std::vector<const CSlice *> &vpGroup : vvpGroups)
+	{
+		std::stable_sort(vpGroup.begin(), vpGroup.end(), CompareSliceStart);
+
+		IOHANDLE File = io_open(vpGroup[0]->m_aDemo, IOFLAG_READ);
+		if(File)
+		{
+			BytesRead += io_length(File);
+			io_close(File);
+		}
+
+		std::vector<unsigned> vRunStarts;
+		int RunEnd = 0;
+		for(unsigned i = 0; i < vpGroup.size(); i++)
+		{
+			const CSlice *pSlice = vpGroup[i];
+			if(i == 0 || (RunEnd != -1 && pSlice->m_StartTick > RunEnd))
+			{
+				vRunStarts.push_back(i);
+				RunEnd = pSlice->m_EndTick;
+			}
+			else if(RunEnd != -1)
+			{
+				RunEnd = pSlice->m_EndTick == -1 ? -1 : maximum(RunEnd, pSlice->m_EndTick);
+			}
+		}
+
+		int NumRuns = vRunStarts.size();
+		int NumJobs = minimum(NumThreads, NumRuns);
+		for(int Job = 0; Job < NumJobs; Job++)
+		{
+			unsigned First = vRunStarts[Job * NumRuns / NumJobs];
+			int LastRun = (Job + 1) * NumRuns / NumJobs;
+			unsigned End = LastRun < NumRuns ? vRunStarts[LastRun] : vpGroup.size();
+			vvpJobSlices.emplace_back(vpGroup.begin() + First, vpGroup.begin() + End);
+		}
+	}
+
+	semaphore Done;
+	std::vector<std::shared_ptr<CSliceJob>> vpJobs;
+	{
+		CJobPool JobPool;
+		NumThreads = minimum(NumThreads, maximum((int)vvpJobSlices.size(), 1));
+		JobPool.Init(NumThreads);
+		for(const std::vector<const CSlice *> &vpSlices : vvpJobSlices)
+		{
+			vpJobs.push_back(std::make_shared<CSliceJob>(pStorage, &Done, vpSlices));
+			JobPool.Add(vpJobs.back());
+		}
+		for(unsigned i = 0; i < vpJobs.size(); i++)
+			Done.wait();
+	}
+
+	double Seconds = (time_get() - StartTime) / (double)time_freq();
+
+	int NumFailed = 0;
+	int64 BytesWritten = 0, TicksDecoded = 0;
+	for(const std::shared_ptr<CSliceJob> &pJob : vpJobs)
+	{
+		NumFailed += pJob->m_NumFailed;
+		BytesWritten += pJob->m_BytesWritten;
+		TicksDecoded += pJob->m_TicksDecoded;
+	}
+
+	double Divisor = maximum(Seconds, 0.000001);
+	dbg_msg("demo_slice", "%d slices from %d demos in %d jobs in %.2fs using %d threads, %d failed",
+		(int)vSlices.size(), (int)vvpGroups.size(), (int)vpJobs.size(), Seconds, NumThreads, NumFailed);
+	dbg_msg("demo_slice", "decoded %lld ticks (%.0f ticks/s), read %.2f MiB (%.2f MiB/s), wrote %.2f MiB (%.2f MiB/s)",
+		TicksDecoded, TicksDecoded / Divisor,
+		BytesRead / 1048576.0, BytesRead / 1048576.0 / Divisor,
+		BytesWritten / 1048576.0, BytesWritten / 1048576.0 / Divisor);
+
+	delete pConfig;
+	delete pStorage;
+	return NumFailed ? 1 : 0;
+}
@@ -0,0 +1,210 @@
+#include <base/system.h>
+#include <engine/shared/network.h>
+#include <mastersrv/mastersrv.h>
+
+#include <algorithm>
+#include <vector>
+
+// Registers many fake servers at a master server, each from its own
+// socket, and measures how fast they get through the firewall check.
+
+enum
+{
+	MAX_OPEN = 256,
+	TIMEOUT = 15,
+	// fixed ports, so that a closed socket's port isn't given to the
+	// next one and registered as the same server
+	FIRST_PORT = 30000,
+	LAST_PORT = 65535,
+};
+
+struct CFakeServer
+{
+	NETSOCKET m_Socket;
+	int64 m_HeartbeatTime;
+	int64 m_LastSend;
+};
+
+static MMSGS s_MMSGS;
+
+// returns the size of the connless payload, 0 if there is no packet
+static int Recv(NETSOCKET Socket, NETADDR *pAddr, CNetPacketConstruct *pPacket)
+{
+	unsigned char aBuffer[NET_MAX_PACKETSIZE];
+	unsigned char *pData;
+	while(true)
+	{
+		int Bytes = net_udp_recv(Socket, pAddr, aBuffer, sizeof(aBuffer), &s_MMSGS, &pData);
+		if(Bytes <= 0)
+			return 0;
+		bool Sixup = false;
+		if(CNetBase::UnpackPacket(pData, Bytes, pPacket, Sixup) == 0 && pPacket->m_Flags & NET_PACKETFLAG_CONNLESS)
+			return pPacket->m_DataSize;
+	}
+}
+
+static bool IsMsg(const CNetPacketConstruct *pPacket, const unsigned char *pMsg, int MsgSize)
+{
+	return pPacket->m_DataSize >= MsgSize && mem_comp(pPacket->m_aChunkData, pMsg, MsgSize) == 0;
+}
+
+static void Register(NETADDR *pMaster, int NumServers)
+{
+	NETADDR BindAddr = {NETTYPE_IPV4, {0}, 0};
+	unsigned char aHeartbeat[sizeof(SERVERBROWSE_HEARTBEAT) + 2];
+	mem_copy(aHeartbeat, SERVERBROWSE_HEARTBEAT, sizeof(SERVERBROWSE_HEARTBEAT));
+	// no alternative port like the fake server tool
+	aHeartbeat[sizeof(SERVERBROWSE_HEARTBEAT)] = 0;
+	aHeartbeat[sizeof(SERVERBROWSE_HEARTBEAT) + 1] = 0;
+
+	std::vector<CFakeServer> vOpen;
+	std::vector<int64> vLatencies;
+	int Port = FIRST_PORT;
+	int Started = 0;
+	int Failed = 0;
+	int64 Start = time_get();
+	while(Started < NumServers || !vOpen.empty())
+	{
+		while(Started < NumServers && (int)vOpen.size() < MAX_OPEN)
+		{
+			CFakeServer Server;
+			do
+			{
+				if(Port > LAST_PORT)
+				{
+					dbg_msg("loadgen", "no free ports left");
+					return;
+				}
+				BindAddr.port = Port++;
+				Server.m_Socket = net_udp_create(BindAddr);
+			} while(Server.m_Socket.type == NETTYPE_INVALID);
+			Server.m_HeartbeatTime = time_get();
+			Server.m_LastSend = Server.m_HeartbeatTime;
+			CNetBase::SendPacketConnless(Server.m_Socket, pMaster, aHeartbeat, sizeof(aHeartbeat), false, 0);
+			vOpen.push_back(Server);
+			Started++;
+		}
+
+		bool Received = false;
+		for(unsigned i = 0; i < vOpen.size(); i++)
+		{
+			CFakeServer *pServer = &vOpen[i];
+			bool Done = false;
+			NETADDR Addr;
+			CNetPacketConstruct Packet;
+			while(!Done && Recv(pServer->m_Socket, &Addr, &Packet))
+			{
+				Received = true;
+				if(IsMsg(&Packet, SERVERBROWSE_FWCHECK, sizeof(SERVERBROWSE_FWCHECK)))
+				{
+					pServer->m_LastSend = time_get();
+					CNetBase::SendPacketConnless(pServer->m_Socket, &Addr, SERVERBROWSE_FWRESPONSE, sizeof(SERVERBROWSE_FWRESPONSE), false, 0);
+				}
+				else if(IsMsg(&Packet, SERVERBROWSE_FWOK, sizeof(SERVERBROWSE_FWOK)))
+				{
+					vLatencies.push_back(time_get() - pServer->m_HeartbeatTime);
+					Done = true;
+				}
+				else if(IsMsg(&Packet, SERVERBROWSE_FWERROR, sizeof(SERVERBROWSE_FWERROR)))
+				{
+					Failed++;
+					Done = true;
+				}
+			}
+			// drop what's left, the next socket must not read it
+			while(Recv(pServer->m_Socket, &Addr, &Packet))
+				;
+			// udp packets get lost under load, repeat like a real server
+			// would, only faster
+			if(!Done && time_get() > pServer->m_LastSend + time_freq())
+			{
+				pServer->m_LastSend = time_get();
+				CNetBase::SendPacketConnless(pServer->m_Socket, pMaster, aHeartbeat, sizeof(aHeartbeat), false, 0);
+			}
+			if(!Done && time_get() > pServer->m_HeartbeatTime + time_freq() * TIMEOUT)
+			{
+				Failed++;
+				Done = true;
+			}
+			if(Done)
+			{
+				net_udp_close(pServer->m_Socket);
+				vOpen[i] = vOpen.back();
+				vOpen.pop_back();
+				i--;
+			}
+		}
+		if(!Received)
+			thread_sleep(1000);
+	}
+	int64 Duration = time_get() - Start;
+
+	int Registered = vLatencies.size();
+	std::sort(vLatencies.begin(), vLatencies.end());
+	dbg_msg("loadgen", "%d servers registered in %.2fs, %.0f registrations/s, %d failed",
+		Registered, (double)Duration / time_freq(), Registered / ((double)Duration / time_freq()), Failed);
+	if(Registered)
+	{
+		dbg_msg("loadgen", "registration latency p50=%.2fms p99=%.2fms max=%.2fms",
+			vLatencies[Registered / 2] * 1000.0 / time_freq(), vLatencies[Registered * 99 / 100] * 1000.0 / time_freq(),
+			vLatencies.back() * 1000.0 / time_freq());
+	}
+}
+
+static void RequestList(NETADDR *pMaster)
+{
+	NETADDR BindAddr = {NETTYPE_IPV4, {0}, 0};
+	NETSOCKET Socket = net_udp_create(BindAddr);
+	int64 Start = time_get();
+	CNetBase::SendPacketConnless(Socket, pMaster, SERVERBROWSE_GETLIST, sizeof(SERVERBROWSE_GETLIST), false, 0);
+
+	int NumPackets = 0;
+	int NumServers = 0;
+	int64 Last = Start;
+	// the list is complete once no packet arrived for a while
+	while(time_get() < Last + time_freq() / 2)
+	{
+		NETADDR Addr;
+		CNetPacketConstruct Packet;
+		if(!Recv(Socket, &Addr, &Packet))
+		{
+			thread_sleep(1000);
+			continue;
+		}
+		if(IsMsg(&Packet, SERVERBROWSE_LIST, sizeof(SERVERBROWSE_LIST)))
+		{
+			NumPackets++;
+			NumServers += (Packet.m_DataSize - sizeof(SERVERBROWSE_LIST)) / sizeof(CMastersrvAddr);
+			Last = time_get();
+		}
+	}
+	net_udp_close(Socket);
+	dbg_msg("loadgen", "list: %d servers in %d packets after %.2fms", NumServers, NumPackets, (Last - Start) * 1000.0 / time_freq());
+}
+
+int main(int argc, const char **argv) // ignore_convention
+{
+	dbg_logger_stdout();
+	if(argc > 3)
+	{
+		dbg_msg("usage", "%s [master[:port]] [num_servers]", argv[0]);
+		return -1;
+	}
+	net_init();
+	net_init_mmsgs(&s_MMSGS);
+	CNetBase::Init();
+
+	NETADDR Master;
+	if(net_host_lookup(argc > 1 ? argv[1] : "localhost", &Master, NETTYPE_IPV4))
+	{
+		dbg_msg("loadgen", "host lookup failed");
+		return -1;
+	}
+	if(Master.port == 0)
+		Master.port = MASTERSERVER_PORT;
+	int NumServers = argc > 2 ? str_toint(argv[2]) : 1000;
+
+	Register(&Master, NumServers);
+	RequestList(&Master);
+	return 0;
+}
@@ -0,0 +1,90 @@
+#include "probe.h"
+
+#include <engine/shared/network.h>
+#include <engine/shared/packer.h>
+#include <mastersrv/mastersrv.h>
+
+#include <deque>
+#include <unordered_map>
+
+static void SendRequest(CNetClient *pNet, const NETADDR *pAddr, int Token)
+{
+	// extended request, the 24 bit token tells the replies apart
+	unsigned char Buffer[sizeof(SERVERBROWSE_GETINFO) + 1];
+	mem_copy(Buffer, SERVERBROWSE_GETINFO, sizeof(SERVERBROWSE_GETINFO));
+	Buffer[sizeof(SERVERBROWSE_GETINFO)] = Token & 0xff;
+
+	CNetChunk Packet;
+	Packet.m_ClientID = -1;
+	Packet.m_Address = *pAddr;
+	Packet.m_Flags = NETSENDFLAG_CONNLESS | NETSENDFLAG_EXTENDED;
+	Packet.m_DataSize = sizeof(Buffer);
+	Packet.m_pData = Buffer;
+	mem_zero(&Packet.m_aExtraData, sizeof(Packet.m_aExtraData));
+	Packet.m_aExtraData[0] = (Token >> 16) & 0xff;
+	Packet.m_aExtraData[1] = (Token >> 8) & 0xff;
+	pNet->Send(&Packet);
+}
+
+void Probe(CNetClient *pNet, std::vector<CTarget> *pvTargets, int Concurrency, int TimeoutMs)
+{
+	std::unordered_map<int, int> InFlight; // token to target
+	std::deque<int> vSendOrder; // in flight targets, oldest first
+	int NextTarget = 0;
+	// unpredictable, so that spoofed replies can't guess the tokens
+	int NextToken = secure_rand() & 0xffffff;
+	int64 Timeout = time_freq() * TimeoutMs / 1000;
+
+	for(CTarget &Target : *pvTargets)
+		Target.m_Rtt = -1;
+
+	while(NextTarget < (int)pvTargets->size() || !InFlight.empty())
+	{
+		while(NextTarget < (int)pvTargets->size() && (int)InFlight.size() < Concurrency)
+		{
+			while(InFlight.count(NextToken))
+				NextToken = (NextToken + 1) & 0xffffff;
+			CTarget *pTarget = &(*pvTargets)[NextTarget];
+			SendRequest(pNet, &pTarget->m_Addr, NextToken);
+			pTarget->m_SendTime = time_get();
+			InFlight[NextToken] = NextTarget;
+			vSendOrder.push_back(NextToken);
+			NextToken = (NextToken + 1) & 0xffffff;
+			NextTarget++;
+		}
+
+		net_socket_read_wait(pNet->m_Socket, 1000);
+		pNet->Update();
+		CNetChunk Packet;
+		while(pNet->Recv(&Packet))
+		{
+			if(Packet.m_DataSize < (int)sizeof(SERVERBROWSE_INFO_EXTENDED) || mem_comp(Packet.m_pData, SERVERBROWSE_INFO_EXTENDED, sizeof(SERVERBROWSE_INFO_EXTENDED)) != 0)
+				continue;
+			int64 Now = time_get();
+			CUnpacker Up;
+			Up.Reset((unsigned char *)Packet.m_pData + sizeof(SERVERBROWSE_INFO_EXTENDED), Packet.m_DataSize - sizeof(SERVERBROWSE_INFO_EXTENDED));
+			auto It = InFlight.find(str_toint(Up.GetString()));
+			if(It == InFlight.end())
+				continue;
+			CTarget *pTarget = &(*pvTargets)[It->second];
+			if(net_addr_comp(&pTarget->m_Addr, &Packet.m_Address) != 0)
+				continue;
+			pTarget->m_Rtt = Now - pTarget->m_SendTime;
+			InFlight.erase(It);
+		}
+
+		// all requests have the same timeout, so the oldest expire first
+		int64 Now = time_get();
+		while(!vSendOrder.empty())
+		{
+			auto It = InFlight.find(vSendOrder.front());
+			if(It != InFlight.end())
+			{
+				if(Now - (*pvTargets)[It->second].m_SendTime < Timeout)
+					break;
+				InFlight.erase(It);
+			}
+			vSendOrder.pop_front();
+		}
+	}
+}
@@ -0,0 +1,24 @@
+#ifndef TWPING_PROBE_H
+#define TWPING_PROBE_H
+
+#include <base/system.h>
+
+#include <vector>
+
+class CNetClient;
+
+struct CTarget
+{
+	NETADDR m_Addr;
+	char m_aAddr[NETADDR_MAXSTRSIZE];
+	int64 m_SendTime;
+	// -1 until answered
+	int64 m_Rtt;
+};
+
+// sends info requests to all targets over one socket, keeping up to
+// `Concurrency` of them in flight, and sets the round trip times of the
+// ones that answer within `TimeoutMs`. Needs secure_random_init().
+void Probe(CNetClient *pNet, std::vector<CTarget> *pvTargets, int Concurrency, int TimeoutMs);
+
+#endif
@@ -1,27 +1,30 @@
+#include "probe.h"
+
 #include <base/math.h>
 #include <base/system.h>
+#include <engine/shared/linereader.h>
 #include <engine/shared/network.h>
 #include <engine/shared/packer.h>
 #include <mastersrv/mastersrv.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <vector>
+
 static CNetClient g_NetOp; // main
 
-int main(int argc, char **argv) // ignore_convention
+static void Usage(const char *pProgram)
 {
-	NETADDR BindAddr;
-	mem_zero(&BindAddr, sizeof(BindAddr));
-	BindAddr.type = NETTYPE_ALL;
-	g_NetOp.Open(BindAddr, 0);
-
-	if(argc != 2)
-	{
-		fprintf(stderr, "usage: %s server[:port] (default port: 8303)\n", argv[0]);
-		return 1;
-	}
+	fprintf(stderr, "usage: %s server[:port] (default port: 8303)\n", pProgram);
+	fprintf(stderr, "       %s [-c concurrency] [-t timeout_ms] [-s summary.csv] -l serverlist.txt\n", pProgram);
+	fprintf(stderr, "the round trip time of each server is written to stdout, the\n");
+	fprintf(stderr, "p50/p99 summary to summary.csv or stderr, both as csv\n");
+}
 
+static int PingOne(const char *pAddr)
+{
 	NETADDR Addr;
-	if(net_host_lookup(argv[1], &Addr, NETTYPE_ALL))
+	if(net_host_lookup(pAddr, &Addr, NETTYPE_ALL))
 	{
 		fprintf(stderr, "host lookup failed\n");
 		return 1;
@@ -35,7 +38,7 @@ int main(int argc, char **argv) // ignore_convention
 
 	mem_copy(Buffer, SERVERBROWSE_GETINFO, sizeof(SERVERBROWSE_GETINFO));
 
-	int CurToken = rand() % 256;
+	int CurToken = secure_rand() % 256;
 	Buffer[sizeof(SERVERBROWSE_GETINFO)] = CurToken;
 
 	Packet.m_ClientID = -1;
@@ -68,4 +71,136 @@ int main(int argc, char **argv) // ignore_convention
 			printf("%g ms\n", (double)(endTime - startTime) / time_freq() * 1000);
 		}
 	}
+	return 0;
+}
+
+static bool ReadTargets(const char *pFilename, std::vector<CTarget> *pvTargets)
+{
+	IOHANDLE File = io_open(pFilename, IOFLAG_READ);
+	if(!File)
+	{
+		fprintf(stderr, "couldn't open %s\n", pFilename);
+		return false;
+	}
+	CLineReader LineReader;
+	LineReader.Init(File);
+	char *pLine;
+	while((pLine = LineReader.Get()))
+	{
+		const char *pAddr = str_utf8_skip_whitespaces(pLine);
+		if(!pAddr[0] || pAddr[0] == '#')
+			continue;
+		CTarget Target;
+		// lookups are slow, only do them for names
+		if(net_addr_from_str(&Target.m_Addr, pAddr) && net_host_lookup(pAddr, &Target.m_Addr, NETTYPE_ALL))
+		{
+			fprintf(stderr, "host lookup failed: %s\n", pAddr);
+			continue;
+		}
+		if(Target.m_Addr.port == 0)
+			Target.m_Addr.port = 8303;
+		net_addr_str(&Target.m_Addr, Target.m_aAddr, sizeof(Target.m_aAddr), true);
+		pvTargets->push_back(Target);
+	}
+	io_close(File);
+	return true;
+}
+
+static double Ms(int64 Time)
+{
+	return Time * 1000.0 / time_freq();
+}
+
+static void PrintResults(const std::vector<CTarget> &vTargets, int64 Duration, IOHANDLE SummaryFile)
+{
+	printf("address,status,rtt_ms\n");
+	std::vector<int64> vRtts;
+	for(const CTarget &Target : vTargets)
+	{
+		if(Target.m_Rtt >= 0)
+		{
+			printf("%s,ok,%.3f\n", Target.m_aAddr, Ms(Target.m_Rtt));
+			vRtts.push_back(Target.m_Rtt);
+		}
+		else
+			printf("%s,timeout,\n", Target.m_aAddr);
+	}
+
+	std::sort(vRtts.begin(), vRtts.end());
+	int NumAnswered = vRtts.size();
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "servers,answered,timeouts,duration_s,p50_ms,p99_ms,max_ms\n%d,%d,%d,%.3f,%.3f,%.3f,%.3f\n",
+		(int)vTargets.size(), NumAnswered, (int)vTargets.size() - NumAnswered,
+		Duration / (double)time_freq(),
+		NumAnswered ? Ms(vRtts[NumAnswered / 2]) : 0.0,
+		NumAnswered ? Ms(vRtts[NumAnswered * 99 / 100]) : 0.0,
+		NumAnswered ? Ms(vRtts.back()) : 0.0);
+	fflush(stdout);
+	io_write(SummaryFile, aBuf, str_length(aBuf));
+}
+
+int main(int argc, char **argv) // ignore_convention
+{
+	if(secure_random_init() != 0)
+	{
+		fprintf(stderr, "could not initialize secure RNG\n");
+		return 1;
+	}
+
+	NETADDR BindAddr;
+	mem_zero(&BindAddr, sizeof(BindAddr));
+	BindAddr.type = NETTYPE_ALL;
+	g_NetOp.Open(BindAddr, 0);
+
+	int Concurrency = 256;
+	int TimeoutMs = 1000;
+	const char *pList = 0;
+	const char *pSummary = 0;
+	const char *pServer = 0;
+	for(int i = 1; i < argc; i++) // ignore_convention
+	{
+		if(str_comp(argv[i], "-c") == 0 && i + 1 < argc) // ignore_convention
+			Concurrency = maximum(str_toint(argv[++i]), 1); // ignore_convention
+		else if(str_comp(argv[i], "-t") == 0 && i + 1 < argc) // ignore_convention
+			TimeoutMs = maximum(str_toint(argv[++i]), 1); // ignore_convention
+		else if(str_comp(argv[i], "-l") == 0 && i + 1 < argc) // ignore_convention
+			pList = argv[++i]; // ignore_convention
+		else if(str_comp(argv[i], "-s") == 0 && i + 1 < argc) // ignore_convention
+			pSummary = argv[++i]; // ignore_convention
+		else if(!pServer && argv[i][0] != '-') // ignore_convention
+			pServer = argv[i]; // ignore_convention
+		else
+		{
+			Usage(argv[0]); // ignore_convention
+			return 1;
+		}
+	}
+
+	if(pServer && !pList)
+		return PingOne(pServer);
+	if(!pList || pServer)
+	{
+		Usage(argv[0]); // ignore_convention
+		return 1;
+	}
+
+	std::vector<CTarget> vTargets;
+	if(!ReadTargets(pList, &vTargets))
+		return 1;
+	IOHANDLE SummaryFile = io_stderr();
+	if(pSummary)
+	{
+		SummaryFile = io_open(pSummary, IOFLAG_WRITE);
+		if(!SummaryFile)
+		{
+			fprintf(stderr, "couldn't open %s\n", pSummary);
+			return 1;
+		}
+	}
+	int64 Start = time_get();
+	Probe(&g_NetOp, &vTargets, Concurrency, TimeoutMs);
+	PrintResults(vTargets, time_get() - Start, SummaryFile);
+	if(pSummary)
+		io_close(SummaryFile);
+	return 0;
 }